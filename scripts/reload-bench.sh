@@ -0,0 +1,120 @@
+#!/bin/sh
+#
+# Copyright (C) 2024 CZ.NIC, z.s.p.o. <knot-dns@labs.nic.cz>
+#
+# Knot DNS utility script
+#
+# This script measures the duration of a configuration reload which adds
+# one zone to a server with many zones, with and without the incremental
+# reload. All the zones share one zone file with relative owner names.
+# Then it measures a configuration transaction including a file with a batch
+# of new zones.
+#
+# Usage:  ./reload-bench.sh <knotd> [<zones>]
+#
+# Environment:
+#   KNOTC    knotc binary (default: from PATH)
+#   SETTLE   seconds to wait for the zones to load (default: 30)
+#   REPEAT   number of measured reloads for each mode (default: 3)
+#   BATCH    number of zones in the included file (default: 1000)
+#
+
+set -e
+
+PATH=/bin:/usr/bin:/sbin:/usr/sbin:/usr/local/bin:/usr/local/sbin
+
+KNOTC=${KNOTC:-$(command -v knotc)}
+SETTLE=${SETTLE:-30}
+REPEAT=${REPEAT:-3}
+BATCH=${BATCH:-1000}
+
+if [ $# -lt 1 ]; then
+	echo "Usage: $0 <knotd> [<zones>]" >&2
+	exit 1
+fi
+
+KNOTD=$1
+ZONES=${2:-100000}
+
+WORKDIR=$(mktemp -d)
+
+cleanup() {
+	[ -n "$KNOTD_PID" ] && kill "$KNOTD_PID" 2>/dev/null && wait "$KNOTD_PID" || true
+	rm -rf "$WORKDIR"
+}
+trap cleanup EXIT INT TERM
+
+cat > "$WORKDIR/zone" <<EOF
+@	3600	SOA	ns hostmaster 1 3600 900 604800 60
+@	3600	NS	ns
+ns	3600	A	192.0.2.1
+EOF
+
+# Writes the configuration with the given incremental reload and extra zone.
+write_conf() {
+	cat > "$WORKDIR/knot.conf" <<EOF
+server:
+    rundir: "$WORKDIR"
+    listen: 127.0.0.1@0
+    incremental-reload: $1
+
+database:
+    storage: "$WORKDIR"
+
+log:
+  - target: stderr
+    any: warning
+
+template:
+  - id: default
+    file: "$WORKDIR/zone"
+    zonefile-sync: -1
+    journal-content: none
+
+zone:
+EOF
+	seq 1 "$ZONES" | awk '{ print "  - domain: z" $1 ".example" }' >> "$WORKDIR/knot.conf"
+	[ -n "$2" ] && echo "  - domain: $2" >> "$WORKDIR/knot.conf"
+	return 0
+}
+
+now() {
+	date +%s.%N
+}
+
+for INCR in off on; do
+	write_conf "$INCR"
+	"$KNOTD" -c "$WORKDIR/knot.conf" &
+	KNOTD_PID=$!
+
+	for i in $(seq 1 600); do
+		"$KNOTC" -s "$WORKDIR/knot.sock" status >/dev/null 2>&1 && break
+		sleep 0.1
+	done
+	sleep "$SETTLE"
+
+	for i in $(seq 1 "$REPEAT"); do
+		write_conf "$INCR" "added$i.example"
+		BEGIN=$(now)
+		"$KNOTC" -s "$WORKDIR/knot.sock" -t 3600 reload >/dev/null
+		END=$(now)
+		echo "incremental-reload $INCR, $ZONES zones: reload took" \
+		     "$(echo "$END - $BEGIN" | bc) s"
+	done
+
+	echo "zone:" > "$WORKDIR/batch.conf"
+	seq 1 "$BATCH" | awk '{ print "  - domain: b" $1 ".example" }' \
+		>> "$WORKDIR/batch.conf"
+	BEGIN=$(now)
+	"$KNOTC" -s "$WORKDIR/knot.sock" -t 3600 conf-begin >/dev/null
+	"$KNOTC" -s "$WORKDIR/knot.sock" -t 3600 conf-set include "$WORKDIR/batch.conf" >/dev/null
+	"$KNOTC" -s "$WORKDIR/knot.sock" -t 3600 conf-commit >/dev/null
+	END=$(now)
+	echo "incremental-reload $INCR, $ZONES zones: including $BATCH zones took" \
+	     "$(echo "$END - $BEGIN" | bc) s," \
+	     "$(echo "$BATCH / ($END - $BEGIN)" | bc) zones/s"
+
+	kill "$KNOTD_PID"
+	wait "$KNOTD_PID" || true
+	KNOTD_PID=
+done
@@ -0,0 +1,119 @@
+#!/bin/sh
+#
+# Copyright (C) 2024 CZ.NIC, z.s.p.o. <knot-dns@labs.nic.cz>
+#
+# Knot DNS utility script
+#
+# This script measures the XDP query throughput of a single knotd UDP worker.
+# It creates a veth pair with one end in a network namespace, runs knotd with
+# XDP on the other end, and floods it with kxdpgun at a fixed rate from the
+# namespace. The number of answered queries per second is printed for each
+# given knotd binary, so that two builds can be compared on the same machine.
+#
+# Usage:  ./xdp-bench.sh <knotd> [<knotd> ...]
+#
+# Environment:
+#   KXDPGUN   kxdpgun binary (default: from PATH)
+#   KNOTC     knotc binary (default: from PATH)
+#   QPS       offered load in queries per second (default: 2000000)
+#   DURATION  duration of each run in seconds (default: 10)
+#   CPU       CPU the knotd worker is pinned to (default: 1)
+#   GUN_CPU   CPU kxdpgun is pinned to (default: 2)
+#
+# Note: the script must run as root on GNU/Linux with veth XDP support.
+#
+
+set -e
+
+PATH=/bin:/usr/bin:/sbin:/usr/sbin:/usr/local/bin:/usr/local/sbin
+
+KXDPGUN=${KXDPGUN:-$(command -v kxdpgun)}
+KNOTC=${KNOTC:-$(command -v knotc)}
+QPS=${QPS:-2000000}
+DURATION=${DURATION:-10}
+CPU=${CPU:-1}
+GUN_CPU=${GUN_CPU:-2}
+
+NS=kxdpbench
+IF_SRV=kxdpb0
+IF_GUN=kxdpb1
+IP_SRV=192.0.2.1
+IP_GUN=192.0.2.2
+
+if [ $# -eq 0 ]; then
+	echo "Usage: $0 <knotd> [<knotd> ...]" >&2
+	exit 1
+fi
+
+WORKDIR=$(mktemp -d)
+
+cleanup() {
+	[ -n "$KNOTD_PID" ] && kill "$KNOTD_PID" 2>/dev/null && wait "$KNOTD_PID" || true
+	ip link del "$IF_SRV" 2>/dev/null || true
+	ip netns del "$NS" 2>/dev/null || true
+	rm -rf "$WORKDIR"
+}
+trap cleanup EXIT INT TERM
+
+ip netns add "$NS"
+ip link add "$IF_SRV" type veth peer name "$IF_GUN"
+ip link set "$IF_GUN" netns "$NS"
+ip addr add "$IP_SRV/24" dev "$IF_SRV"
+ip link set "$IF_SRV" up
+ip -n "$NS" addr add "$IP_GUN/24" dev "$IF_GUN"
+ip -n "$NS" link set "$IF_GUN" up
+ip -n "$NS" link set lo up
+
+MAC_SRV=$(cat "/sys/class/net/$IF_SRV/address")
+
+cat > "$WORKDIR/example.com.zone" <<EOF
+@	3600	SOA	ns.example.com. hostmaster.example.com. 1 3600 900 604800 60
+@	3600	NS	ns
+ns	3600	A	$IP_SRV
+www	3600	A	192.0.2.80
+EOF
+
+cat > "$WORKDIR/knot.conf" <<EOF
+server:
+    rundir: "$WORKDIR"
+    listen: $IP_SRV@53
+    udp-workers: 1
+    tcp-workers: 1
+    background-workers: 1
+
+xdp:
+    listen: $IF_SRV@53
+
+log:
+  - target: stderr
+    any: warning
+
+zone:
+  - domain: example.com
+    storage: "$WORKDIR"
+EOF
+
+printf 'www.example.com. A\n' > "$WORKDIR/queries"
+
+for KNOTD in "$@"; do
+	taskset -c "$CPU" "$KNOTD" -c "$WORKDIR/knot.conf" &
+	KNOTD_PID=$!
+
+	# Wait for the XDP socket.
+	for i in $(seq 1 50); do
+		"$KNOTC" -s "$WORKDIR/knot.sock" status >/dev/null 2>&1 && break
+		sleep 0.1
+	done
+	sleep 1
+
+	REPLIES=$(ip netns exec "$NS" taskset -c "$GUN_CPU" "$KXDPGUN" \
+	          -t "$DURATION" -Q "$QPS" -F "$GUN_CPU" -i "$WORKDIR/queries" \
+	          -I "$IF_GUN" -R "$MAC_SRV" "$IP_SRV" |
+	          awk '/^total replies:/ { gsub(/[()]/, "", $4); print $4 }')
+
+	echo "$KNOTD: $REPLIES answered queries per second on one core (offered $QPS)"
+
+	kill "$KNOTD_PID"
+	wait "$KNOTD_PID" || true
+	KNOTD_PID=
+done
@@ -83,10 +83,19 @@ static int evsched_run(dthread_t *thread)
 		event_t *ev = *((event_t**)HHEAD(&sched->heap));
 		assert(ev != NULL);
 
-		if (timercmp_ge(&dt, &ev->tv)) {
+		/* Dispatch all events due at the current time at once. */
+		while (timercmp_ge(&dt, &ev->tv)) {
 			heap_delmin(&sched->heap);
 			ev->cb(ev);
-		} else {
+
+			if (EMPTY_HEAP(&sched->heap)) {
+				ev = NULL;
+				break;
+			}
+			ev = *((event_t**)HHEAD(&sched->heap));
+		}
+
+		if (ev != NULL) {
 			/* Wait for next event or interrupt. Unlock calendar. */
 			struct timespec ts;
 			ts.tv_sec = ev->tv.tv_sec;
@@ -201,8 +210,13 @@ int evsched_schedule(event_t *ev, uint32_t dt)
 		heap_insert(&sched->heap, (heap_val_t *)ev);
 	}
 
+	/* Wake up the scheduler only if the next wake-up time got earlier.
+	 * Otherwise it wakes up at the former time and reschedules itself. */
+	if (heap_find(&sched->heap, (heap_val_t *)ev) == 1) {
+		pthread_cond_signal(&sched->notify);
+	}
+
 	/* Unlock calendar. */
-	pthread_cond_signal(&sched->notify);
 	pthread_mutex_unlock(&sched->heap_lock);
 
 	return KNOT_EOK;
@@ -219,10 +233,11 @@ int evsched_cancel(event_t *ev)
 	/* Lock calendar. */
 	pthread_mutex_lock(&sched->heap_lock);
 
+	/* No wake-up needed, the scheduler just reschedules itself if it
+	 * was waiting for this event. */
 	int found = heap_find(&sched->heap, (heap_val_t *)ev);
 	if (found > 0) {
 		heap_delete(&sched->heap, found);
-		pthread_cond_signal(&sched->notify);
 	}
 
 	/* Unlock calendar. */
@@ -24,6 +24,7 @@
 #include "knot/common/stats.h"
 #include "knot/common/log.h"
 #include "knot/nameserver/query_module.h"
+#include "libknot/quic/tls_common.h"
 #include "libknot/xdp.h"
 
 static uint64_t stats_get_counter(knot_atomic_uint64_t **stats_vals, uint32_t offset,
@@ -82,6 +83,13 @@ int stats_xdp(stats_dump_ctr_f fcn, stats_dump_ctx_t *ctx)
 		DUMP(rings,  rx_fill,    true);
 		DUMP(rings,  tx_fill,    true);
 		DUMP(rings,  cq_fill,    true);
+		DUMP(kernel, answered,   false);
+		DUMP(kernel, missed,     false);
+		DUMP(kernel, dropped,    false);
+		DUMP(kernel, slipped,    false);
+		DUMP(busy_poll, polling, false);
+		DUMP(busy_poll, budget,  true);
+		DUMP(busy_poll, timeout, true);
 	}
 #undef DUMP
 #endif
@@ -110,6 +118,63 @@ int stats_server(stats_dump_ctr_f fcn, stats_dump_ctx_t *ctx)
 	return KNOT_EOK;
 }
 
+int stats_tls(stats_dump_ctr_f fcn, stats_dump_ctx_t *ctx)
+{
+	stats_dump_params_t params = { .section = "tls" };
+
+	if (ctx->server->quic_creds == NULL ||
+	    (ctx->section != NULL && strcasecmp(ctx->section, params.section) != 0)) {
+		return KNOT_EOK;
+	}
+
+	knot_creds_stats_t stats;
+	knot_creds_stats(ctx->server->quic_creds, &stats);
+
+	DUMP_VAL(params, "handshakes", stats.handshakes);
+	DUMP_VAL(params, "resumed", stats.resumed);
+	DUMP_VAL(params, "early-data", stats.early_data);
+
+	return KNOT_EOK;
+}
+
+int stats_notify(stats_dump_ctr_f fcn, stats_dump_ctx_t *ctx)
+{
+	stats_dump_params_t params = { .section = "notify" };
+
+	if (ctx->section != NULL && strcasecmp(ctx->section, params.section) != 0) {
+		return KNOT_EOK;
+	}
+
+	DUMP_VAL(params, "sent", ATOMIC_GET(ctx->server->notify_stats.sent));
+	DUMP_VAL(params, "acked", ATOMIC_GET(ctx->server->notify_stats.acked));
+	DUMP_VAL(params, "failed", ATOMIC_GET(ctx->server->notify_stats.failed));
+	DUMP_VAL(params, "retransmits", ATOMIC_GET(ctx->server->notify_stats.retransmits));
+	DUMP_VAL(params, "retried", ATOMIC_GET(ctx->server->notify_stats.retried));
+	DUMP_VAL(params, "coalesced", ATOMIC_GET(ctx->server->notify_stats.coalesced));
+
+	return KNOT_EOK;
+}
+
+int stats_journal(stats_dump_ctr_f fcn, stats_dump_ctx_t *ctx)
+{
+	stats_dump_params_t params = { .section = "journal" };
+
+	if (ctx->section != NULL && strcasecmp(ctx->section, params.section) != 0) {
+		return KNOT_EOK;
+	}
+
+	uint64_t commits, syncs, batch_max, latency;
+	knot_lmdb_commit_stats(&ctx->server->journaldb, &commits, &syncs,
+	                       &batch_max, &latency);
+
+	DUMP_VAL(params, "commits", commits);
+	DUMP_VAL(params, "syncs", syncs);
+	DUMP_VAL(params, "batch-max", batch_max);
+	DUMP_VAL(params, "commit-latency", latency);
+
+	return KNOT_EOK;
+}
+
 int stats_zone(stats_dump_ctr_f fcn, stats_dump_ctx_t *ctx)
 {
 	knot_dname_txt_storage_t zone;
@@ -338,6 +403,18 @@ static void dump_to_file(conf_t *conf, FILE *fd, server_t *server)
 	// Dump server counters.
 	(void)stats_server(dump_ctr, &dump_ctx);
 
+	// Dump TLS counters.
+	ctx = (dump_ctx_t){ .fd = fd };
+	(void)stats_tls(dump_ctr, &dump_ctx);
+
+	// Dump NOTIFY counters.
+	ctx = (dump_ctx_t){ .fd = fd };
+	(void)stats_notify(dump_ctr, &dump_ctx);
+
+	// Dump journal counters.
+	ctx = (dump_ctx_t){ .fd = fd };
+	(void)stats_journal(dump_ctr, &dump_ctx);
+
 	// Dump XDP counters.
 	ctx = (dump_ctx_t){ .fd = fd };
 	(void)stats_xdp(dump_ctr, &dump_ctx);
@@ -65,6 +65,21 @@ typedef int (*stats_dump_ctr_f)(stats_dump_params_t *, stats_dump_ctx_t *);
  */
 int stats_xdp(stats_dump_ctr_f fcn, stats_dump_ctx_t *ctx);
 
+/*!
+ * \brief TLS (DoT and DoQ) handshake metrics.
+ */
+int stats_tls(stats_dump_ctr_f fcn, stats_dump_ctx_t *ctx);
+
+/*!
+ * \brief Outgoing NOTIFY metrics.
+ */
+int stats_notify(stats_dump_ctr_f fcn, stats_dump_ctx_t *ctx);
+
+/*!
+ * \brief Journal DB metrics.
+ */
+int stats_journal(stats_dump_ctr_f fcn, stats_dump_ctx_t *ctx);
+
 /*!
  * \brief Server metrics.
  */
@@ -119,12 +119,13 @@ static void init_cache(
 {
 	/*
 	 * For UDP, TCP, XDP, and background workers, cache the number of running
-	 * workers. Cache the setting of TCP reuseport too. These values
-	 * can't change in runtime, while config data can.
+	 * workers. Cache the setting of TCP reuseport and io_uring too. These
+	 * values can't change in runtime, while config data can.
 	 */
 
 	static bool   first_init = true;
 	static bool   running_tcp_reuseport;
+	static bool   running_tcp_io_uring;
 	static bool   running_socket_affinity;
 	static bool   running_xdp_udp;
 	static bool   running_xdp_tcp;
@@ -133,6 +134,7 @@ static void init_cache(
 	static uint16_t running_ring_size;
 	static uint16_t running_busypoll_budget;
 	static uint16_t running_busypoll_timeout;
+	static bool   running_tx_multi_buffer;
 	static size_t running_udp_threads;
 	static size_t running_tcp_threads;
 	static size_t running_xdp_threads;
@@ -143,6 +145,7 @@ static void init_cache(
 
 	if (first_init || reinit_cache) {
 		running_tcp_reuseport = conf_get_bool(conf, C_SRV, C_TCP_REUSEPORT);
+		running_tcp_io_uring = conf_get_bool(conf, C_SRV, C_TCP_IO_URING);
 		running_socket_affinity = conf_get_bool(conf, C_SRV, C_SOCKET_AFFINITY);
 		running_xdp_udp = conf_get_bool(conf, C_XDP, C_UDP);
 		running_xdp_tcp = conf_get_bool(conf, C_XDP, C_TCP);
@@ -154,6 +157,7 @@ static void init_cache(
 		running_ring_size = conf_get_int(conf, C_XDP, C_RING_SIZE);
 		running_busypoll_budget = conf_get_int(conf, C_XDP, C_BUSYPOLL_BUDGET);
 		running_busypoll_timeout = conf_get_int(conf, C_XDP, C_BUSYPOLL_TIMEOUT);
+		running_tx_multi_buffer = conf_get_bool(conf, C_XDP, C_TX_MULTI_BUFFER);
 		running_udp_threads = conf_udp_threads(conf);
 		running_tcp_threads = conf_tcp_threads(conf);
 		running_xdp_threads = conf_xdp_threads(conf);
@@ -197,6 +201,8 @@ static void init_cache(
 
 	conf->cache.srv_tcp_reuseport = running_tcp_reuseport;
 
+	conf->cache.srv_tcp_io_uring = running_tcp_io_uring;
+
 	conf->cache.srv_socket_affinity = running_socket_affinity;
 
 	val = conf_get(conf, C_SRV, C_DBUS_EVENT);
@@ -233,6 +239,9 @@ static void init_cache(
 	val = conf_get(conf, C_XDP, C_TCP_RESEND);
 	conf->cache.xdp_tcp_idle_resend = conf_int(&val);
 
+	val = conf_get(conf, C_XDP, C_TCP_INIT_WINDOW);
+	conf->cache.xdp_tcp_init_window = conf_int(&val);
+
 	conf->cache.xdp_udp = running_xdp_udp;
 
 	conf->cache.xdp_tcp = running_xdp_tcp;
@@ -247,6 +256,10 @@ static void init_cache(
 
 	conf->cache.xdp_busypoll_timeout = running_busypoll_timeout;
 
+	conf->cache.xdp_busypoll_adaptive = conf_get_bool(conf, C_XDP, C_BUSYPOLL_ADAPTIVE);
+
+	conf->cache.xdp_tx_multi_buffer = running_tx_multi_buffer;
+
 	val = conf_get(conf, C_CTL, C_TIMEOUT);
 	conf->cache.ctl_timeout = conf_int(&val) * 1000;
 	/* infinite_adjust() call isn't needed, 0 is adjusted later anyway. */
@@ -493,6 +506,7 @@ conf_t *conf_update(
 		if ((flags & CONF_UPD_FCONFIO) && s_conf != NULL) {
 			conf->io.flags = s_conf->io.flags;
 			conf->io.zones = s_conf->io.zones;
+			conf->io.refs = s_conf->io.refs;
 		}
 		if ((flags & CONF_UPD_FMODULES) && s_conf != NULL) {
 			free(conf->query_modules);
@@ -515,6 +529,7 @@ conf_t *conf_update(
 
 		if (flags & CONF_UPD_FCONFIO) {
 			old_conf->io.zones = NULL;
+			old_conf->io.refs = NULL;
 		}
 		if (flags & CONF_UPD_FMODULES) {
 			old_conf->query_modules = NULL;
@@ -550,6 +565,9 @@ void conf_free(
 	if (conf->io.zones != NULL) {
 		trie_free(conf->io.zones);
 	}
+	if (conf->io.refs != NULL) {
+		trie_free(conf->io.refs);
+	}
 
 	conf_mod_load_purge(conf, false);
 	conf_deactivate_modules(conf->query_modules, &conf->query_plan);
@@ -38,9 +38,12 @@
 #define CONF_MAX_TCP_WORKERS	256
 /*! Maximum number of background workers. */
 #define CONF_MAX_BG_WORKERS	512
+/*! Maximum number of control workers. */
+#define CONF_MAX_CTL_WORKERS	64
 /*! Maximum number of concurrent DB readers. */
 #define CONF_MAX_DB_READERS	(CONF_MAX_UDP_WORKERS + CONF_MAX_TCP_WORKERS + \
-				 CONF_MAX_BG_WORKERS + 10 + 128 /* Utils, XDP workers */)
+				 CONF_MAX_BG_WORKERS + CONF_MAX_CTL_WORKERS + \
+				 10 + 128 /* Utils, XDP workers */)
 
 /*! Configuration specific logging. */
 #define CONF_LOG(severity, msg, ...) do { \
@@ -130,6 +133,8 @@ typedef struct {
 		yp_flag_t flags;
 		/*! Changed zones. */
 		trie_t *zones;
+		/*! Changed sections possibly referenced from zone ACLs. */
+		trie_t *refs;
 	} io;
 
 	/*! Current config file (for reload if started with config file). */
@@ -157,6 +162,7 @@ typedef struct {
 		uint32_t xdp_tcp_idle_close;
 		uint32_t xdp_tcp_idle_reset;
 		uint32_t xdp_tcp_idle_resend;
+		uint32_t xdp_tcp_init_window;
 		size_t srv_quic_max_clients;
 		size_t srv_quic_obuf_max_size;
 		const uint8_t *srv_nsid_data;
@@ -172,7 +178,10 @@ typedef struct {
 		bool xdp_udp;
 		bool xdp_tcp;
 		bool xdp_route_check;
+		bool xdp_tx_multi_buffer;
+		bool xdp_busypoll_adaptive;
 		bool srv_tcp_reuseport;
+		bool srv_tcp_io_uring;
 		bool srv_tcp_fastopen;
 		bool srv_socket_affinity;
 		bool srv_ecs;
@@ -1440,6 +1440,70 @@ conf_remote_t conf_remote_txn(
 	val = conf_id_get_txn(conf, txn, C_RMT, C_NO_EDNS, id);
 	out.no_edns = conf_bool(&val);
 
+	val = conf_id_get_txn(conf, txn, C_RMT, C_UDP_SOA_QUERY, id);
+	out.udp_soa_query = conf_bool(&val);
+
+	val = conf_id_get_txn(conf, txn, C_RMT, C_UDP_NOTIFY, id);
+	out.udp_notify = conf_bool(&val);
+
+	return out;
+}
+
+conf_zone_cache_t conf_zone_cache_txn(
+	conf_t *conf,
+	knot_db_txn_t *txn,
+	const knot_dname_t *dname)
+{
+	assert(dname != NULL);
+
+	conf_zone_cache_t out = { 0 };
+
+	conf_val_t val = conf_zone_get_txn(conf, txn, C_MASTER, dname);
+	out.is_slave = (val.code == KNOT_EOK);
+	val = conf_zone_get_txn(conf, txn, C_DNSSEC_SIGNING, dname);
+	out.dnssec_signing = conf_bool(&val);
+	val = conf_zone_get_txn(conf, txn, C_DNSSEC_VALIDATION, dname);
+	out.dnssec_validation = conf_bool(&val);
+	val = conf_zone_get_txn(conf, txn, C_ZONEMD_VERIFY, dname);
+	out.zonemd_verify = conf_bool(&val);
+	val = conf_zone_get_txn(conf, txn, C_IXFR_BENEVOLENT, dname);
+	out.ixfr_benevolent = conf_bool(&val);
+	val = conf_zone_get_txn(conf, txn, C_IXFR_BY_ONE, dname);
+	out.ixfr_by_one = conf_bool(&val);
+	val = conf_zone_get_txn(conf, txn, C_IXFR_FROM_AXFR, dname);
+	out.ixfr_from_axfr = conf_bool(&val);
+	val = conf_zone_get_txn(conf, txn, C_PROVIDE_IXFR, dname);
+	out.provide_ixfr = conf_bool(&val);
+
+	val = conf_zone_get_txn(conf, txn, C_ZONEMD_GENERATE, dname);
+	out.zonemd_generate = conf_opt(&val);
+	val = conf_zone_get_txn(conf, txn, C_SEM_CHECKS, dname);
+	out.semantic_checks = conf_opt(&val);
+	val = conf_zone_get_txn(conf, txn, C_JOURNAL_CONTENT, dname);
+	out.journal_content = conf_opt(&val);
+	val = conf_zone_get_txn(conf, txn, C_ZONEFILE_LOAD, dname);
+	out.zonefile_load = conf_opt(&val);
+
+	val = conf_zone_get_txn(conf, txn, C_ZONEFILE_SYNC, dname);
+	out.zonefile_sync = conf_int(&val);
+	val = conf_zone_get_txn(conf, txn, C_ZONE_MAX_SIZE, dname);
+	out.zone_max_size = conf_int(&val);
+	val = conf_zone_get_txn(conf, txn, C_ADJUST_THR, dname);
+	out.adjust_threads = conf_int(&val);
+
+	val = conf_zone_get_txn(conf, txn, C_REFRESH_MIN_INTERVAL, dname);
+	out.refresh_min_interval = conf_int(&val);
+	val = conf_zone_get_txn(conf, txn, C_REFRESH_MAX_INTERVAL, dname);
+	out.refresh_max_interval = conf_int(&val);
+	val = conf_zone_get_txn(conf, txn, C_RETRY_MIN_INTERVAL, dname);
+	out.retry_min_interval = conf_int(&val);
+	val = conf_zone_get_txn(conf, txn, C_RETRY_MAX_INTERVAL, dname);
+	out.retry_max_interval = conf_int(&val);
+	val = conf_zone_get_txn(conf, txn, C_EXPIRE_MIN_INTERVAL, dname);
+	out.expire_min_interval = conf_int(&val);
+	val = conf_zone_get_txn(conf, txn, C_EXPIRE_MAX_INTERVAL, dname);
+	out.expire_max_interval = conf_int(&val);
+
 	return out;
 }
 
@@ -33,6 +33,7 @@
 #define CONF_IO_FRLD_ZONE	YP_FUSR9  /*!< Reload a specific zone. */
 #define CONF_IO_FRLD_ZONES	YP_FUSR10 /*!< Reload all zones. */
 #define CONF_REF_EMPTY		YP_FUSR11 /*!< Allow empty reference value for zone item. */
+#define CONF_IO_FRLD_ACL	YP_FUSR12 /*!< Recompile zone ACLs. */
 #define CONF_IO_FRLD_ALL	(CONF_IO_FRLD_SRV | CONF_IO_FRLD_LOG | \
 				 CONF_IO_FRLD_MOD | CONF_IO_FRLD_ZONES)
 
@@ -52,6 +53,10 @@ typedef struct {
 	bool block_notify_after_xfr;
 	/*! Disable EDNS on XFR queries. */
 	bool no_edns;
+	/*! Send refresh SOA queries over UDP. */
+	bool udp_soa_query;
+	/*! Send NOTIFY messages over UDP. */
+	bool udp_notify;
 	/*! Possible remote certificate PIN. */
 	const uint8_t *pin;
 	/*! Length of the remote certificate PIN. Zero if PIN not specified. */
@@ -953,6 +958,71 @@ static inline conf_remote_t conf_remote(
 	return conf_remote_txn(conf, &conf->read_txn, id, index);
 }
 
+/*! Flattened zone configuration (templates resolved). */
+typedef struct {
+	/*! Zone has a primary server configured (secondary zone). */
+	bool is_slave;
+	/*! Automatic DNSSEC signing enabled. */
+	bool dnssec_signing;
+	/*! DNSSEC validation enabled. */
+	bool dnssec_validation;
+	/*! ZONEMD verification enabled. */
+	bool zonemd_verify;
+	/*! IXFR applied even if not exactly matching the zone. */
+	bool ixfr_benevolent;
+	/*! IXFR processed changeset by changeset. */
+	bool ixfr_by_one;
+	/*! AXFR stored as IXFR difference. */
+	bool ixfr_from_axfr;
+	/*! Outgoing IXFR allowed. */
+	bool provide_ixfr;
+	/*! ZONEMD generation algorithm. */
+	unsigned zonemd_generate;
+	/*! Semantic checks mode. */
+	unsigned semantic_checks;
+	/*! Journal content mode. */
+	unsigned journal_content;
+	/*! Zone file load mode. */
+	unsigned zonefile_load;
+	/*! Zone file sync timeout (negative for never). */
+	int64_t zonefile_sync;
+	/*! Maximum zone size. */
+	size_t zone_max_size;
+	/*! Number of zone adjusting threads. */
+	size_t adjust_threads;
+	/*! SOA timer limits. */
+	uint32_t refresh_min_interval;
+	uint32_t refresh_max_interval;
+	uint32_t retry_min_interval;
+	uint32_t retry_max_interval;
+	uint32_t expire_min_interval;
+	uint32_t expire_max_interval;
+} conf_zone_cache_t;
+
+/*!
+ * Gets the flattened zone configuration.
+ *
+ * \note The zone items are read at once so that the result can be stored
+ *       and used instead of repeated confdb lookups.
+ *
+ * \param[in] conf   Configuration.
+ * \param[in] txn    Configuration DB transaction.
+ * \param[in] dname  Zone name.
+ *
+ * \return Zone configuration.
+ */
+conf_zone_cache_t conf_zone_cache_txn(
+	conf_t *conf,
+	knot_db_txn_t *txn,
+	const knot_dname_t *dname
+);
+static inline conf_zone_cache_t conf_zone_cache(
+	conf_t *conf,
+	const knot_dname_t *dname)
+{
+	return conf_zone_cache_txn(conf, &conf->read_txn, dname);
+}
+
 /*! XDP interface parameters. */
 typedef struct {
 	/*! Interface name. */
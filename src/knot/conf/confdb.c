@@ -871,6 +871,107 @@ void conf_db_iter_finish(
 	}
 }
 
+typedef yp_name_t db_names_t[KEY1_LAST + 1][1 + YP_MAX_ITEM_NAME_LEN];
+
+static void db_name_set(
+	db_names_t *names,
+	uint8_t code,
+	const uint8_t *name,
+	size_t name_len)
+{
+	if (code <= KEY1_LAST && name_len <= YP_MAX_ITEM_NAME_LEN) {
+		(*names)[code][0] = name_len;
+		memcpy((*names)[code] + 1, name, name_len);
+	}
+}
+
+int conf_db_walk(
+	conf_t *conf,
+	knot_db_txn_t *txn,
+	conf_db_walk_cb cb,
+	void *ctx)
+{
+	if (conf == NULL || txn == NULL || cb == NULL) {
+		return KNOT_EINVAL;
+	}
+
+	// Section names and lazily allocated item names per section.
+	db_names_t *sections = calloc(1, sizeof(*sections));
+	db_names_t *items[KEY1_LAST + 1] = { NULL };
+	if (sections == NULL) {
+		return KNOT_ENOMEM;
+	}
+
+	int ret = KNOT_EOK;
+
+	// Item codes are always stored before the items of the section.
+	knot_db_iter_t *it = conf->api->iter_begin(txn, KNOT_DB_FIRST);
+	while (it != NULL) {
+		knot_db_val_t key;
+		ret = conf->api->iter_key(it, &key);
+		if (ret != KNOT_EOK) {
+			break;
+		}
+
+		knot_db_val_t data;
+		ret = conf->api->iter_val(it, &data);
+		if (ret != KNOT_EOK) {
+			break;
+		}
+
+		const uint8_t *k = key.data;
+		const uint8_t *d = data.data;
+		if (key.len < CONF_MIN_KEY_LEN || k[KEY0_POS] > KEY1_LAST) {
+			ret = KNOT_EMALF;
+			break;
+		}
+
+		if (k[KEY1_POS] == KEY1_ITEMS && data.len > 0) {
+			db_names_t **target = (k[KEY0_POS] == KEY0_ROOT) ?
+			                      &sections : &items[k[KEY0_POS]];
+			if (*target == NULL) {
+				*target = calloc(1, sizeof(**target));
+				if (*target == NULL) {
+					ret = KNOT_ENOMEM;
+					break;
+				}
+			}
+			db_name_set(*target, d[0], k + NAME_POS, key.len - NAME_POS);
+		} else if (k[KEY0_POS] != KEY0_ROOT && k[KEY1_POS] <= KEY1_LAST) {
+			const yp_name_t *key0 = (*sections)[k[KEY0_POS]];
+			const yp_name_t *key1 = NULL;
+			if (k[KEY1_POS] != KEY1_ID) {
+				key1 = (items[k[KEY0_POS]] != NULL) ?
+				       (*items[k[KEY0_POS]])[k[KEY1_POS]] : NULL;
+				if (key1 == NULL || key1[0] == 0) {
+					ret = KNOT_EMALF;
+					break;
+				}
+			}
+			if (key0[0] == 0) {
+				ret = KNOT_EMALF;
+				break;
+			}
+
+			ret = cb(key0, key1, k + CONF_MIN_KEY_LEN,
+			         key.len - CONF_MIN_KEY_LEN, d, data.len, ctx);
+			if (ret != KNOT_EOK) {
+				break;
+			}
+		}
+
+		it = conf->api->iter_next(it);
+	}
+	conf->api->iter_finish(it);
+
+	for (size_t i = 0; i <= KEY1_LAST; i++) {
+		free(items[i]);
+	}
+	free(sections);
+
+	return ret;
+}
+
 int conf_db_raw_dump(
 	conf_t *conf,
 	knot_db_txn_t *txn,
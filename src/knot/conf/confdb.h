@@ -212,6 +212,49 @@ void conf_db_iter_finish(
 	conf_iter_t *iter
 );
 
+/*!
+ * Configuration DB record callback.
+ *
+ * \param[in] key0      Section name.
+ * \param[in] key1      Item name (NULL for a section identifier record).
+ * \param[in] id        Section identifier.
+ * \param[in] id_len    Length of the section identifier.
+ * \param[in] data      Record data.
+ * \param[in] data_len  Length of the record data.
+ * \param[in] ctx       Callback context.
+ *
+ * \return Error code, KNOT_EOK if success.
+ */
+typedef int (*conf_db_walk_cb)(
+	const yp_name_t *key0,
+	const yp_name_t *key1,
+	const uint8_t *id,
+	size_t id_len,
+	const uint8_t *data,
+	size_t data_len,
+	void *ctx
+);
+
+/*!
+ * Calls the callback for each item record of the configuration DB.
+ *
+ * Section and item codes are translated to their names, so records of
+ * different DBs can be compared.
+ *
+ * \param[in] conf  Configuration.
+ * \param[in] txn   Configuration DB transaction.
+ * \param[in] cb    Record callback.
+ * \param[in] ctx   Callback context.
+ *
+ * \return Error code, KNOT_EOK if success.
+ */
+int conf_db_walk(
+	conf_t *conf,
+	knot_db_txn_t *txn,
+	conf_db_walk_cb cb,
+	void *ctx
+);
+
 /*!
  * Dumps the configuration DB in the textual form.
  *
@@ -15,7 +15,10 @@
  */
 
 #include <assert.h>
+#include <string.h>
 
+#include "contrib/mempattern.h"
+#include "contrib/ucw/mempool.h"
 #include "knot/common/log.h"
 #include "knot/conf/confdb.h"
 #include "knot/conf/confio.h"
@@ -92,6 +95,9 @@ int conf_io_begin(
 		if (conf()->io.zones != NULL) {
 			trie_clear(conf()->io.zones);
 		}
+		if (conf()->io.refs != NULL) {
+			trie_clear(conf()->io.refs);
+		}
 	}
 
 	return KNOT_EOK;
@@ -139,6 +145,9 @@ void conf_io_abort(
 		if (conf()->io.zones != NULL) {
 			trie_clear(conf()->io.zones);
 		}
+		if (conf()->io.refs != NULL) {
+			trie_clear(conf()->io.refs);
+		}
 	}
 }
 
@@ -878,6 +887,347 @@ get_error:
 	return ret;
 }
 
+#define DIFF_KEY_LEN	(2 * (1 + YP_MAX_ITEM_NAME_LEN) + YP_MAX_ID_LEN)
+
+typedef struct {
+	const uint8_t *data;
+	size_t len;
+} diff_rec_t;
+
+typedef struct {
+	conf_t *conf;       // Configuration providing the schema.
+	knot_db_txn_t *txn; // New configuration DB transaction.
+	knot_mm_t mm;       // Memory for the old records.
+	trie_t *old;        // Old records not found in the new configuration yet.
+	trie_t *templates;  // Changed templates and their zone change type.
+	trie_t *zones;      // Changed zones and their change type.
+	trie_t *refs;       // Changed sections possibly referenced from zone ACLs.
+	yp_flag_t flags;    // Collected reload flags.
+} diff_ctx_t;
+
+static size_t diff_key(
+	uint8_t *out,
+	const yp_name_t *key0,
+	const yp_name_t *key1,
+	const uint8_t *id,
+	size_t id_len)
+{
+	uint8_t *pos = out;
+
+	memcpy(pos, key0, 1 + key0[0]);
+	pos += 1 + key0[0];
+	if (key1 != NULL) {
+		memcpy(pos, key1, 1 + key1[0]);
+		pos += 1 + key1[0];
+	} else {
+		*pos++ = 0;
+	}
+	if (id_len > 0) {
+		memcpy(pos, id, id_len);
+		pos += id_len;
+	}
+
+	return pos - out;
+}
+
+static void diff_upd(
+	trie_t *changes,
+	const uint8_t *id,
+	size_t id_len,
+	conf_io_type_t type)
+{
+	trie_val_t *val = trie_get_ins(changes, id, id_len);
+	if (val != NULL) {
+		*val = (void *)((uintptr_t)*val | type);
+	}
+}
+
+static void ref_upd(
+	trie_t *refs,
+	const yp_name_t *section,
+	const uint8_t *id,
+	size_t id_len)
+{
+	// No identifier means all identifiers of the section.
+	uint8_t key[DIFF_KEY_LEN];
+	size_t key_len = diff_key(key, section, NULL, id, id_len);
+	diff_upd(refs, key, key_len, CONF_IO_TCHANGE);
+}
+
+static void diff_changes(
+	diff_ctx_t *ctx,
+	const yp_name_t *key0,
+	const yp_name_t *key1,
+	const uint8_t *id,
+	size_t id_len,
+	conf_io_type_t type)
+{
+	const yp_item_t *section = yp_schema_find(key0, NULL, ctx->conf->schema);
+	const yp_item_t *item = NULL;
+	if (section != NULL && key1 != NULL) {
+		item = yp_schema_find(key1, key0, ctx->conf->schema);
+	} else if (section != NULL && (section->flags & YP_FMULTI)) {
+		item = section->var.g.id;
+	}
+
+	// Unknown item (e.g. of a no longer loaded module), reload everything.
+	if (item == NULL) {
+		ctx->flags |= CONF_IO_FRLD_ALL | CONF_IO_FCHECK_ZONES;
+		return;
+	}
+
+	yp_flag_t flags = section->flags | item->flags;
+
+	bool tpl_item = (key1 != NULL && key0[0] == C_TPL[0] &&
+	                 memcmp(key0 + 1, C_TPL + 1, C_TPL[0]) == 0);
+	if (tpl_item) {
+		// Some items affect all zones even if set in a zone (e.g. catalog-zone).
+		const yp_item_t *zone_item = yp_schema_find(key1, C_ZONE, ctx->conf->schema);
+		if (zone_item != NULL && (zone_item->flags & CONF_IO_FRLD_ZONES)) {
+			tpl_item = false;
+		}
+	}
+
+	// A template item affects just the zones using the template.
+	if (tpl_item) {
+		conf_io_type_t tpl_type = CONF_IO_TCHANGE;
+		if (flags & CONF_IO_FRLD_ZONES) {
+			tpl_type |= CONF_IO_TRELOAD;
+		}
+		diff_upd(ctx->templates, id, id_len, tpl_type);
+		ctx->flags |= flags & ~CONF_IO_FRLD_ZONES;
+		return;
+	}
+
+	// Same processing as for a configuration transaction.
+	ctx->flags |= flags;
+
+	if ((flags & CONF_IO_FRLD_ACL) && !(flags & CONF_IO_FZONE)) {
+		ref_upd(ctx->refs, key0, id, id_len);
+	}
+
+	if (flags & CONF_IO_FREF) {
+		// Re-check and reload all zones if a reference has been removed.
+		if (type == CONF_IO_TUNSET) {
+			ctx->flags |= CONF_IO_FCHECK_ZONES | CONF_IO_FRLD_ZONES;
+		}
+		return;
+	} else if (!(flags & CONF_IO_FZONE)) {
+		return;
+	}
+
+	if (type == CONF_IO_TCHANGE && (flags & CONF_IO_FRLD_ZONE)) {
+		type |= CONF_IO_TRELOAD;
+	}
+	diff_upd(ctx->zones, id, id_len, type);
+}
+
+static int diff_old_record(
+	const yp_name_t *key0,
+	const yp_name_t *key1,
+	const uint8_t *id,
+	size_t id_len,
+	const uint8_t *data,
+	size_t data_len,
+	void *ctx)
+{
+	diff_ctx_t *diff = ctx;
+
+	diff_rec_t *rec = mm_alloc(&diff->mm, sizeof(*rec));
+	if (rec == NULL) {
+		return KNOT_ENOMEM;
+	}
+	rec->data = data;
+	rec->len = data_len;
+
+	uint8_t key[DIFF_KEY_LEN];
+	size_t key_len = diff_key(key, key0, key1, id, id_len);
+
+	trie_val_t *val = trie_get_ins(diff->old, key, key_len);
+	if (val == NULL) {
+		return KNOT_ENOMEM;
+	}
+	*val = rec;
+
+	return KNOT_EOK;
+}
+
+static int diff_new_record(
+	const yp_name_t *key0,
+	const yp_name_t *key1,
+	const uint8_t *id,
+	size_t id_len,
+	const uint8_t *data,
+	size_t data_len,
+	void *ctx)
+{
+	diff_ctx_t *diff = ctx;
+
+	uint8_t key[DIFF_KEY_LEN];
+	size_t key_len = diff_key(key, key0, key1, id, id_len);
+
+	conf_io_type_t type = CONF_IO_TCHANGE;
+
+	trie_val_t val;
+	if (trie_del(diff->old, key, key_len, &val) == KNOT_EOK) {
+		const diff_rec_t *rec = val;
+		if (rec->len == data_len &&
+		    (data_len == 0 || memcmp(rec->data, data, data_len) == 0)) {
+			return KNOT_EOK;
+		}
+	} else if (key1 == NULL) {
+		type = CONF_IO_TSET;
+	}
+
+	diff_changes(diff, key0, key1, id, id_len, type);
+
+	return KNOT_EOK;
+}
+
+static void diff_removed(
+	diff_ctx_t *ctx)
+{
+	trie_it_t *it = trie_it_begin(ctx->old);
+	for (; !trie_it_finished(it); trie_it_next(it)) {
+		size_t key_len;
+		const uint8_t *key = (const uint8_t *)trie_it_key(it, &key_len);
+
+		const uint8_t *key1 = key + 1 + key[0];
+		const uint8_t *id = key1 + 1 + key1[0];
+		size_t id_len = key_len - (id - key);
+		if (key1[0] == 0) {
+			key1 = NULL;
+		}
+
+		diff_changes(ctx, (const yp_name_t *)key, (const yp_name_t *)key1,
+		             id, id_len,
+		             (key1 == NULL) ? CONF_IO_TUNSET : CONF_IO_TCHANGE);
+	}
+	trie_it_free(it);
+}
+
+static bool diff_tpl_changed(
+	diff_ctx_t *ctx,
+	conf_val_t *val,
+	conf_io_type_t *type)
+{
+	if (val->code != KNOT_EOK) {
+		return false;
+	}
+
+	conf_val(val);
+	while (val->code == KNOT_EOK) {
+		trie_val_t *tpl = trie_get_try(ctx->templates, val->data, val->len);
+		if (tpl != NULL) {
+			*type = (conf_io_type_t)(uintptr_t)*tpl;
+			return true;
+		}
+		if (!(val->item->flags & YP_FMULTI)) {
+			break;
+		}
+		conf_val_next(val);
+	}
+
+	return false;
+}
+
+static void diff_templates(
+	diff_ctx_t *ctx)
+{
+	if (trie_weight(ctx->templates) == 0) {
+		return;
+	}
+
+	conf_t *conf = ctx->conf;
+	for (conf_iter_t iter = conf_iter_txn(conf, ctx->txn, C_ZONE);
+	     iter.code == KNOT_EOK; conf_iter_next(conf, &iter)) {
+		conf_val_t id = conf_iter_id(conf, &iter);
+		const knot_dname_t *name = conf_dname(&id);
+		size_t name_len = knot_dname_size(name);
+
+		conf_io_type_t type = CONF_IO_TNONE;
+
+		// Member zones of a catalog follow its catalog templates.
+		conf_val_t val = conf_zone_get_txn(conf, ctx->txn, C_CATALOG_TPL, name);
+		if (diff_tpl_changed(ctx, &val, &type)) {
+			ctx->flags |= CONF_IO_FRLD_ZONES;
+			conf_iter_finish(conf, &iter);
+			return;
+		}
+
+		val = conf_rawid_get_txn(conf, ctx->txn, C_ZONE, C_TPL, name, name_len);
+		if (val.code != KNOT_EOK) {
+			trie_val_t *tpl = trie_get_try(ctx->templates, CONF_DEFAULT_ID + 1,
+			                               CONF_DEFAULT_ID[0]);
+			if (tpl != NULL) {
+				type = (conf_io_type_t)(uintptr_t)*tpl;
+			}
+		} else {
+			(void)diff_tpl_changed(ctx, &val, &type);
+		}
+
+		if (type != CONF_IO_TNONE) {
+			diff_upd(ctx->zones, name, name_len, type);
+		}
+	}
+}
+
+static int diff_txns(
+	conf_t *conf,
+	knot_db_txn_t *old_txn,
+	knot_db_txn_t *new_txn,
+	yp_flag_t *flags,
+	trie_t **zones,
+	trie_t **refs)
+{
+	diff_ctx_t ctx = {
+		.conf = conf,
+		.txn = new_txn,
+		.old = trie_create(NULL),
+		.templates = trie_create(NULL),
+		.zones = trie_create(NULL),
+		.refs = trie_create(NULL),
+	};
+	mm_ctx_mempool(&ctx.mm, MM_DEFAULT_BLKSIZE);
+
+	int ret = KNOT_ENOMEM;
+	if (ctx.old == NULL || ctx.templates == NULL || ctx.zones == NULL ||
+	    ctx.refs == NULL || ctx.mm.ctx == NULL) {
+		goto diff_error;
+	}
+
+	// Index the old records, the data stay valid in the old transaction.
+	ret = conf_db_walk(conf, old_txn, diff_old_record, &ctx);
+	if (ret != KNOT_EOK) {
+		goto diff_error;
+	}
+
+	// Compare the new records and drop the unchanged ones from the index.
+	ret = conf_db_walk(conf, new_txn, diff_new_record, &ctx);
+	if (ret != KNOT_EOK) {
+		goto diff_error;
+	}
+
+	// The remaining old records were removed.
+	diff_removed(&ctx);
+
+	diff_templates(&ctx);
+
+	*flags = ctx.flags;
+	*zones = ctx.zones;
+	*refs = ctx.refs;
+	ctx.zones = NULL;
+	ctx.refs = NULL;
+diff_error:
+	trie_free(ctx.refs);
+	trie_free(ctx.zones);
+	trie_free(ctx.templates);
+	trie_free(ctx.old);
+	mp_delete(ctx.mm.ctx);
+
+	return ret;
+}
+
 static void upd_changes(
 	const conf_io_t *io,
 	conf_io_type_t type,
@@ -892,6 +1242,19 @@ static void upd_changes(
 		return;
 	}
 
+	// Remember the changed sections possibly referenced from zone ACLs.
+	if ((flags & CONF_IO_FRLD_ACL) && !(flags & CONF_IO_FZONE)) {
+		if (conf()->io.refs == NULL) {
+			conf()->io.refs = trie_create(NULL);
+		}
+		if (conf()->io.refs != NULL) {
+			ref_upd(conf()->io.refs, io->key0->name, io->id,
+			        any_id ? 0 : io->id_len);
+		} else {
+			conf()->io.flags |= CONF_IO_FDIFF_ZONES;
+		}
+	}
+
 	// Update reference item.
 	if (flags & CONF_IO_FREF) {
 		// Expected an identifier, which cannot be changed.
@@ -967,6 +1330,36 @@ static void upd_changes(
 	}
 }
 
+static int upd_include(
+	const conf_io_t *io)
+{
+	// Only the include has data, the clear is processed generally.
+	if (io->key0->name[0] != C_INCL[0] ||
+	    memcmp(io->key0->name + 1, C_INCL + 1, C_INCL[0]) != 0) {
+		return KNOT_ENOTSUP;
+	}
+
+	// Compare the whole transaction with the current configuration.
+	yp_flag_t flags;
+	trie_t *zones, *refs;
+	int ret = diff_txns(conf(), &conf()->read_txn, conf()->io.txn,
+	                    &flags, &zones, &refs);
+	if (ret != KNOT_EOK) {
+		return ret;
+	}
+
+	trie_free(conf()->io.zones);
+	conf()->io.zones = zones;
+	trie_free(conf()->io.refs);
+	conf()->io.refs = refs;
+	conf()->io.flags |= flags;
+
+	CONF_LOG(LOG_INFO, "included file '%.*s', %zu zones changed in total",
+	         (int)io->data.bin_len, io->data.bin, trie_weight(zones));
+
+	return KNOT_EOK;
+}
+
 static int set_item(
 	conf_io_t *io)
 {
@@ -1128,6 +1521,11 @@ int conf_io_set(
 	ret = set_item(&io);
 
 	if (ret == KNOT_EOK) {
+		// Determine the exact changes of an included file if possible.
+		if (io.key0->type != YP_TGRP && (upd_flags & CONF_IO_FDIFF_ZONES) &&
+		    upd_include(&io) == KNOT_EOK) {
+			goto set_error;
+		}
 		upd_changes(&io, upd_type, upd_flags, false);
 	}
 set_error:
@@ -1610,3 +2008,69 @@ check_error:
 
 	return ret;
 }
+
+int conf_io_diff_reload(
+	conf_t *old_conf,
+	conf_t *new_conf)
+{
+	if (old_conf == NULL || new_conf == NULL) {
+		return KNOT_EINVAL;
+	}
+
+	yp_flag_t flags;
+	trie_t *zones, *refs;
+	int ret = diff_txns(new_conf, &old_conf->read_txn, &new_conf->read_txn,
+	                    &flags, &zones, &refs);
+	if (ret != KNOT_EOK) {
+		return ret;
+	}
+
+	if (new_conf->io.zones != NULL) {
+		trie_free(new_conf->io.zones);
+	}
+	if (new_conf->io.refs != NULL) {
+		trie_free(new_conf->io.refs);
+	}
+	new_conf->io.flags = CONF_IO_FACTIVE | flags;
+	new_conf->io.zones = zones;
+	new_conf->io.refs = refs;
+
+	return KNOT_EOK;
+}
+
+bool conf_io_ref_changed(
+	conf_t *conf,
+	const yp_name_t *section,
+	const uint8_t *id,
+	size_t id_len)
+{
+	if (conf == NULL || section == NULL ||
+	    conf->io.refs == NULL || trie_weight(conf->io.refs) == 0) {
+		return false;
+	}
+
+	uint8_t key[DIFF_KEY_LEN];
+	size_t prefix_len = diff_key(key, section, NULL, NULL, 0);
+
+	// Any identifier of the section, there are just a few changes.
+	if (id == NULL) {
+		bool found = false;
+		trie_it_t *it = trie_it_begin(conf->io.refs);
+		for (; !trie_it_finished(it) && !found; trie_it_next(it)) {
+			size_t key_len;
+			const uint8_t *ref = trie_it_key(it, &key_len);
+			found = (key_len >= prefix_len &&
+			         memcmp(ref, key, prefix_len) == 0);
+		}
+		trie_it_free(it);
+		return found;
+	}
+
+	// All identifiers of the section changed.
+	if (trie_get_try(conf->io.refs, key, prefix_len) != NULL) {
+		return true;
+	}
+
+	size_t key_len = diff_key(key, section, NULL, id, id_len);
+	return trie_get_try(conf->io.refs, key, key_len) != NULL;
+}
@@ -215,3 +215,38 @@ int conf_io_unset(
 int conf_io_check(
 	conf_io_t *io
 );
+
+/*!
+ * Compares two configurations and prepares the reload context of the new one.
+ *
+ * The differences are expressed by the reload flags and the changed zones
+ * as if they were done in a configuration transaction. A template change
+ * marks just the zones using the template.
+ *
+ * \param[in] old_conf  Current configuration.
+ * \param[in] new_conf  New configuration to set the reload context of.
+ *
+ * \return Error code, KNOT_EOK if success.
+ */
+int conf_io_diff_reload(
+	conf_t *old_conf,
+	conf_t *new_conf
+);
+
+/*!
+ * Checks if a section possibly referenced from zone ACLs (ACL, remote, remotes,
+ * key, or template) has changed within the reload context.
+ *
+ * \param[in] conf     Configuration with the reload context.
+ * \param[in] section  Section name.
+ * \param[in] id       Section identifier (NULL for any identifier).
+ * \param[in] id_len   Length of the section identifier.
+ *
+ * \return True if changed.
+ */
+bool conf_io_ref_changed(
+	conf_t *conf,
+	const yp_name_t *section,
+	const uint8_t *id,
+	size_t id_len
+);
@@ -33,6 +33,7 @@
 #define C_BACKLOG		"\x07""backlog"
 #define C_BG_WORKERS		"\x12""background-workers"
 #define C_BLOCK_NOTIFY_XFR	"\x1B""block-notify-after-transfer"
+#define C_BUSYPOLL_ADAPTIVE	"\x11""busypoll-adaptive"
 #define C_BUSYPOLL_BUDGET	"\x0F""busypoll-budget"
 #define C_BUSYPOLL_TIMEOUT	"\x10""busypoll-timeout"
 #define C_CATALOG_DB		"\x0A""catalog-db"
@@ -72,11 +73,14 @@
 #define C_ID			"\x02""id"
 #define C_IDENT			"\x08""identity"
 #define C_INCL			"\x07""include"
+#define C_INCR_RELOAD		"\x12""incremental-reload"
 #define C_IXFR_BENEVOLENT	"\x0F""ixfr-benevolent"
 #define C_IXFR_BY_ONE		"\x0B""ixfr-by-one"
 #define C_IXFR_FROM_AXFR	"\x0E""ixfr-from-axfr"
+#define C_JOURNAL_COMPRESSION	"\x13""journal-compression"
 #define C_JOURNAL_CONTENT	"\x0F""journal-content"
 #define C_JOURNAL_DB		"\x0A""journal-db"
+#define C_JOURNAL_DB_COMMIT_DELAY	"\x17""journal-db-commit-delay"
 #define C_JOURNAL_DB_MAX_SIZE	"\x13""journal-db-max-size"
 #define C_JOURNAL_DB_MODE	"\x0F""journal-db-mode"
 #define C_JOURNAL_MAX_DEPTH	"\x11""journal-max-depth"
@@ -158,6 +162,8 @@
 #define C_TCP_IDLE_RESET	"\x16""tcp-idle-reset-timeout"
 #define C_TCP_IDLE_TIMEOUT	"\x10""tcp-idle-timeout"
 #define C_TCP_INBUF_MAX_SIZE	"\x12""tcp-inbuf-max-size"
+#define C_TCP_INIT_WINDOW	"\x12""tcp-initial-window"
+#define C_TCP_IO_URING		"\x0C""tcp-io-uring"
 #define C_TCP_IO_TIMEOUT	"\x0E""tcp-io-timeout"
 #define C_TCP_MAX_CLIENTS	"\x0F""tcp-max-clients"
 #define C_TCP_OUTBUF_MAX_SIZE	"\x13""tcp-outbuf-max-size"
@@ -165,16 +171,20 @@
 #define C_TCP_REUSEPORT		"\x0D""tcp-reuseport"
 #define C_TCP_RMT_IO_TIMEOUT	"\x15""tcp-remote-io-timeout"
 #define C_TCP_WORKERS		"\x0B""tcp-workers"
+#define C_TICKET_KEY_FILE	"\x0F""ticket-key-file"
 #define C_TIMEOUT		"\x07""timeout"
 #define C_TIMER			"\x05""timer"
 #define C_TIMER_DB		"\x08""timer-db"
 #define C_TIMER_DB_MAX_SIZE	"\x11""timer-db-max-size"
 #define C_TLS			"\x03""tls"
 #define C_TPL			"\x08""template"
+#define C_TX_MULTI_BUFFER	"\x0F""tx-multi-buffer"
 #define C_UDP			"\x03""udp"
 #define C_UDP_MAX_PAYLOAD	"\x0F""udp-max-payload"
 #define C_UDP_MAX_PAYLOAD_IPV4	"\x14""udp-max-payload-ipv4"
 #define C_UDP_MAX_PAYLOAD_IPV6	"\x14""udp-max-payload-ipv6"
+#define C_UDP_NOTIFY		"\x0A""udp-notify"
+#define C_UDP_SOA_QUERY		"\x0D""udp-soa-query"
 #define C_UDP_WORKERS		"\x0B""udp-workers"
 #define C_UNSAFE_OPERATION	"\x10""unsafe-operation"
 #define C_UPDATE_OWNER		"\x0C""update-owner"
@@ -184,7 +194,9 @@
 #define C_USER			"\x04""user"
 #define C_VERSION		"\x07""version"
 #define C_VIA			"\x03""via"
+#define C_WORKERS		"\x07""workers"
 #define C_XDP			"\x03""xdp"
+#define C_XDP_ANSWER		"\x0A""xdp-answer"
 #define C_ZONE			"\x04""zone"
 #define C_ZONEFILE_LOAD		"\x0D""zonefile-load"
 #define C_ZONEFILE_SYNC		"\x0D""zonefile-sync"
@@ -247,6 +259,11 @@ enum {
 	JOURNAL_CONTENT_ALL     = 2,
 };
 
+enum {
+	JOURNAL_COMPRESSION_NONE = 0,
+	JOURNAL_COMPRESSION_ZSTD = 1,
+};
+
 enum {
 	JOURNAL_MODE_ROBUST = 0, // Robust journal DB disk synchronization.
 	JOURNAL_MODE_ASYNC  = 1, // Asynchronous journal DB disk synchronization.
@@ -902,6 +902,14 @@ int check_remote(
 #endif
 	}
 
+	conf_val_t udp_soa = conf_rawid_get_txn(args->extra->conf, args->extra->txn, C_RMT,
+	                                        C_UDP_SOA_QUERY, args->id, args->id_len);
+	conf_val_t key = conf_rawid_get_txn(args->extra->conf, args->extra->txn, C_RMT,
+	                                    C_KEY, args->id, args->id_len);
+	if (udp_soa.code == KNOT_EOK && conf_bool(&udp_soa) && key.code != KNOT_EOK) {
+		CONF_LOG(LOG_NOTICE, "'udp-soa-query' without 'key' is prone to spoofed answers");
+	}
+
 	return KNOT_EOK;
 }
 
@@ -1042,6 +1050,15 @@ int check_zone(
 		}
 	}
 
+#ifndef HAVE_ZSTD
+	conf_val_t compression = conf_zone_get_txn(args->extra->conf, args->extra->txn,
+	                                           C_JOURNAL_COMPRESSION, yp_dname(args->id));
+	if (conf_opt(&compression) == JOURNAL_COMPRESSION_ZSTD) {
+		args->err_str = "'journal-compression: zstd' is not available";
+		return KNOT_ENOTSUP;
+	}
+#endif
+
 	conf_val_t signing = conf_zone_get_txn(args->extra->conf, args->extra->txn,
 	                                       C_DNSSEC_SIGNING, yp_dname(args->id));
 	if (conf_bool(&signing)) {
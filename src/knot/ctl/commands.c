@@ -14,6 +14,7 @@
     along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include <stdlib.h>
 #include <string.h>
 #include <unistd.h>
 #include <sys/time.h>
@@ -39,6 +40,7 @@
 #include "libknot/libknot.h"
 #include "libknot/yparser/yptrafo.h"
 #include "contrib/atomic.h"
+#include "contrib/base64.h"
 #include "contrib/files.h"
 #include "contrib/string.h"
 #include "contrib/strtonum.h"
@@ -46,6 +48,9 @@
 #include "contrib/ucw/lists.h"
 #include "libzscanner/scanner.h"
 
+/*! Maximum size of a wire records chunk so that its Base64 fits a control item. */
+#define WIRE_CHUNK_SIZE	((UINT16_MAX / 4) * 3)
+
 #define MATCH_OR_FILTER(args, code) ((args)->data[KNOT_CTL_IDX_FILTER] == NULL || \
                                      strchr((args)->data[KNOT_CTL_IDX_FILTER], (code)) != NULL)
 
@@ -62,16 +67,22 @@ typedef struct {
 	char ttl[16];
 	char type[32];
 	char rdata[2 * 65536];
+	bool wire;         // Send records in wire format chunks.
+	size_t wire_len;
+	uint8_t wire_buf[WIRE_CHUNK_SIZE];
 } send_ctx_t;
 
-static struct {
+typedef struct {
 	send_ctx_t send_ctx;
 	zs_scanner_t scanner;
 	char txt_rr[sizeof(((send_ctx_t *)0)->owner) +
 	            sizeof(((send_ctx_t *)0)->ttl) +
 	            sizeof(((send_ctx_t *)0)->type) +
 	            sizeof(((send_ctx_t *)0)->rdata)];
-} ctl_globals[CTL_MAX_CONCURRENT + 1];
+} ctl_thread_ctx_t;
+
+static ctl_thread_ctx_t *ctl_globals;
+static size_t ctl_globals_count;
 
 static bool allow_blocking_while_ctl_txn(zone_event_type_t event)
 {
@@ -1017,6 +1028,9 @@ static int init_send_ctx(send_ctx_t *ctx, const knot_dname_t *zone_name,
 		return KNOT_EINVAL;
 	}
 
+	// Set the output format.
+	ctx->wire = ctl_has_flag(args->data[KNOT_CTL_IDX_FLAGS], CTL_FLAG_WIRE);
+
 	// Set the TYPE filter.
 	if (args->data[KNOT_CTL_IDX_TYPE] != NULL) {
 		uint16_t type;
@@ -1031,7 +1045,7 @@ static int init_send_ctx(send_ctx_t *ctx, const knot_dname_t *zone_name,
 	return KNOT_EOK;
 }
 
-static int send_rrset(knot_rrset_t *rrset, send_ctx_t *ctx)
+static int send_rrset_txt(knot_rrset_t *rrset, send_ctx_t *ctx)
 {
 	if (rrset->type != KNOT_RRTYPE_RRSIG) {
 		int ret = snprintf(ctx->ttl, sizeof(ctx->ttl), "%u", rrset->ttl);
@@ -1068,10 +1082,76 @@ static int send_rrset(knot_rrset_t *rrset, send_ctx_t *ctx)
 	return KNOT_EOK;
 }
 
+static int send_wire_flush(send_ctx_t *ctx)
+{
+	if (ctx->wire_len == 0) {
+		return KNOT_EOK;
+	}
+
+	int32_t len = knot_base64_encode(ctx->wire_buf, ctx->wire_len,
+	                                 (uint8_t *)ctx->rdata, sizeof(ctx->rdata) - 1);
+	if (len < 0) {
+		return len;
+	}
+	ctx->rdata[len] = '\0';
+	ctx->wire_len = 0;
+
+	const char *sign = ctx->data[KNOT_CTL_IDX_FLAGS];
+	char flags[8] = CTL_FLAG_WIRE;
+	if (sign != NULL) {
+		strlcat(flags, sign, sizeof(flags));
+	}
+
+	knot_ctl_data_t data = {
+		[KNOT_CTL_IDX_FLAGS] = flags,
+		[KNOT_CTL_IDX_ZONE] = ctx->zone,
+		[KNOT_CTL_IDX_DATA] = ctx->rdata
+	};
+
+	return knot_ctl_send(ctx->args->ctl, KNOT_CTL_TYPE_DATA, &data);
+}
+
+static int send_rrset_wire(knot_rrset_t *rrset, send_ctx_t *ctx)
+{
+	int ret = knot_rrset_to_wire(rrset, ctx->wire_buf + ctx->wire_len,
+	                             sizeof(ctx->wire_buf) - ctx->wire_len, NULL);
+	if (ret == KNOT_ESPACE && ctx->wire_len > 0) {
+		ret = send_wire_flush(ctx);
+		if (ret != KNOT_EOK) {
+			return ret;
+		}
+		ret = knot_rrset_to_wire(rrset, ctx->wire_buf, sizeof(ctx->wire_buf), NULL);
+	}
+
+	// Fall back to the text format if the RRSet doesn't fit the chunk.
+	if (ret == KNOT_ESPACE) {
+		if (knot_dname_to_str(ctx->owner, rrset->owner, sizeof(ctx->owner)) == NULL) {
+			return KNOT_EINVAL;
+		}
+		return send_rrset_txt(rrset, ctx);
+	} else if (ret < 0) {
+		return ret;
+	}
+
+	ctx->wire_len += ret;
+
+	return KNOT_EOK;
+}
+
+static int send_rrset(knot_rrset_t *rrset, send_ctx_t *ctx)
+{
+	if (ctx->wire) {
+		return send_rrset_wire(rrset, ctx);
+	} else {
+		return send_rrset_txt(rrset, ctx);
+	}
+}
+
 static int send_node(zone_node_t *node, void *ctx_void)
 {
 	send_ctx_t *ctx = ctx_void;
-	if (knot_dname_to_str(ctx->owner, node->owner, sizeof(ctx->owner)) == NULL) {
+	if (!ctx->wire &&
+	    knot_dname_to_str(ctx->owner, node->owner, sizeof(ctx->owner)) == NULL) {
 		return KNOT_EINVAL;
 	}
 
@@ -1168,6 +1248,10 @@ static int zone_read(zone_t *zone, ctl_args_t *args)
 	}
 	rcu_read_unlock();
 
+	if (ret == KNOT_EOK) {
+		ret = send_wire_flush(ctx);
+	}
+
 	return ret;
 }
 
@@ -1212,6 +1296,10 @@ static int zone_flag_txn_get(zone_t *zone, ctl_args_t *args, const char *flag)
 		zone_tree_it_free(&it);
 	}
 
+	if (ret == KNOT_EOK) {
+		ret = send_wire_flush(ctx);
+	}
+
 	return ret;
 }
 
@@ -1268,7 +1356,7 @@ static int send_changeset_part(changeset_t *ch, send_ctx_t *ctx, bool from)
 	}
 	changeset_iter_clear(&it);
 
-	return KNOT_EOK;
+	return send_wire_flush(ctx);
 }
 
 static int send_changeset(changeset_t *ch, send_ctx_t *ctx)
@@ -1826,6 +1914,15 @@ static int common_stats(ctl_args_t *args, zone_t *zone)
 		int ret = stats_server(ctl_dump_ctr, &dump_ctx);
 		STATS_CHECK(ret, true);
 
+		ret = stats_tls(ctl_dump_ctr, &dump_ctx);
+		STATS_CHECK(ret, true);
+
+		ret = stats_notify(ctl_dump_ctr, &dump_ctx);
+		STATS_CHECK(ret, true);
+
+		ret = stats_journal(ctl_dump_ctr, &dump_ctx);
+		STATS_CHECK(ret, true);
+
 		ret = stats_xdp(ctl_dump_ctr, &dump_ctx);
 		STATS_CHECK(ret, true);
 
@@ -2461,7 +2558,7 @@ static void ctl_unlock(server_t *server)
 
 int ctl_exec(ctl_cmd_t cmd, ctl_args_t *args)
 {
-	if (args == NULL) {
+	if (args == NULL || args->thread_idx >= ctl_globals_count) {
 		return KNOT_EINVAL;
 	}
 
@@ -2482,3 +2579,28 @@ bool ctl_has_flag(const char *flags, const char *flag)
 
 	return strstr(flags, flag) != NULL;
 }
+
+int ctl_init(size_t threads)
+{
+	if (threads == 0) {
+		return KNOT_EINVAL;
+	}
+
+	ctl_thread_ctx_t *globals = calloc(threads, sizeof(*globals));
+	if (globals == NULL) {
+		return KNOT_ENOMEM;
+	}
+
+	ctl_deinit();
+	ctl_globals = globals;
+	ctl_globals_count = threads;
+
+	return KNOT_EOK;
+}
+
+void ctl_deinit(void)
+{
+	free(ctl_globals);
+	ctl_globals = NULL;
+	ctl_globals_count = 0;
+}
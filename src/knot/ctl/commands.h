@@ -21,6 +21,7 @@
 
 #define CTL_FLAG_FORCE			"F"
 #define CTL_FLAG_BLOCKING		"B"
+#define CTL_FLAG_WIRE			"w"
 
 #define CTL_FLAG_DIFF_ADD		"+"
 #define CTL_FLAG_DIFF_REM		"-"
@@ -165,3 +166,18 @@ int ctl_exec(ctl_cmd_t cmd, ctl_args_t *args);
  * \return True if presented.
  */
 bool ctl_has_flag(const char *flags, const char *flag);
+
+/*!
+ * Allocates per-thread buffers for control command processing.
+ *
+ * \param[in] threads  Number of threads processing control commands
+ *                     INCLUDING the main thread (with index 0).
+ *
+ * \return Error code, KNOT_EOK if successful.
+ */
+int ctl_init(size_t threads);
+
+/*!
+ * Frees per-thread buffers for control command processing.
+ */
+void ctl_deinit(void);
@@ -19,8 +19,6 @@
 #include "libknot/libknot.h"
 #include "knot/server/server.h"
 
-#define CTL_MAX_CONCURRENT 8 // Number of CTL threads EXCLUDING the main thread which can also process CTL.
-
 /*!
  * Processes incoming control commands.
  *
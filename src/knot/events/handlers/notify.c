@@ -17,6 +17,7 @@
 #include <assert.h>
 #include <urcu.h>
 
+#include "contrib/atomic.h"
 #include "contrib/openbsd/siphash.h"
 #include "knot/common/log.h"
 #include "knot/conf/conf.h"
@@ -35,6 +36,17 @@ static notifailed_rmt_hash notifailed_hash(conf_val_t *rmt_id)
 	return SipHash24_End(&ctx);
 }
 
+static bool notified_contains(notifailed_rmt_dynarray_t *notified,
+                              notifailed_rmt_hash hash)
+{
+	knot_dynarray_foreach(notifailed_rmt, notifailed_rmt_hash, i, *notified) {
+		if (*i == hash) {
+			return true;
+		}
+	}
+	return false;
+}
+
 /*!
  * \brief NOTIFY message processing data.
  */
@@ -87,6 +99,8 @@ static const knot_layer_api_t NOTIFY_API = {
 	       flags2proto(flags), ((flags) & KNOT_REQUESTOR_REUSED), (remote)->key.name, \
 	       fmt, ## __VA_ARGS__)
 
+#define NOTIFY_UDP_ATTEMPTS 3
+
 static int send_notify(conf_t *conf, zone_t *zone, const knot_rrset_t *soa,
                        const conf_remote_t *slave, int timeout, bool retry)
 {
@@ -97,25 +111,47 @@ static int send_notify(conf_t *conf, zone_t *zone, const knot_rrset_t *soa,
 		.edns = query_edns_data_init(conf, slave, 0)
 	};
 
+	knot_request_flag_t flags = conf->cache.srv_tcp_fastopen ? KNOT_REQUEST_TFO : 0;
+	int attempts = 1;
+	if (slave->udp_notify && !slave->quic && !slave->tls) {
+		// Unanswered NOTIFY over UDP is retransmitted within the timeout.
+		flags = KNOT_REQUEST_UDP;
+		attempts = NOTIFY_UDP_ATTEMPTS;
+		timeout = MAX(timeout / attempts, 1);
+	}
+
 	knot_requestor_t requestor;
-	knot_requestor_init(&requestor, &NOTIFY_API, &data, NULL);
+	knot_request_t *req = NULL;
+	int ret;
 
-	knot_pkt_t *pkt = knot_pkt_new(NULL, KNOT_WIRE_MAX_PKTSIZE, NULL);
-	if (pkt == NULL) {
-		knot_requestor_clear(&requestor);
-		return KNOT_ENOMEM;
-	}
+	for (int attempt = 1; ; attempt++) {
+		knot_requestor_init(&requestor, &NOTIFY_API, &data, NULL);
 
-	knot_request_flag_t flags = conf->cache.srv_tcp_fastopen ? KNOT_REQUEST_TFO : 0;
-	knot_request_t *req = knot_request_make(NULL, slave, pkt,
-	                                        zone->server->quic_creds, &data.edns, flags);
-	if (req == NULL) {
+		knot_pkt_t *pkt = knot_pkt_new(NULL, KNOT_WIRE_MAX_PKTSIZE, NULL);
+		if (pkt == NULL) {
+			knot_requestor_clear(&requestor);
+			return KNOT_ENOMEM;
+		}
+
+		req = knot_request_make(NULL, slave, pkt, zone->server->quic_creds,
+		                        &data.edns, flags);
+		if (req == NULL) {
+			knot_requestor_clear(&requestor);
+			return KNOT_ENOMEM;
+		}
+
+		ATOMIC_ADD(zone->server->notify_stats.sent, 1);
+		ret = knot_requestor_exec(&requestor, req, timeout);
+		if (ret == KNOT_EOK || attempt >= attempts ||
+		    !(requestor.layer.flags & KNOT_REQUESTOR_IOFAIL)) {
+			break;
+		}
+
+		ATOMIC_ADD(zone->server->notify_stats.retransmits, 1);
+		knot_request_free(req, NULL);
 		knot_requestor_clear(&requestor);
-		return KNOT_ENOMEM;
 	}
 
-	int ret = knot_requestor_exec(&requestor, req, timeout);
-
 	const char *log_retry = retry ? "retry, " : "";
 
 	if (ret == KNOT_EOK && knot_pkt_ext_rcode(req->resp) == 0) {
@@ -123,6 +159,7 @@ static int send_notify(conf_t *conf, zone_t *zone, const knot_rrset_t *soa,
 		               requestor.layer.flags,
 		               "%sserial %u", log_retry, knot_soa_serial(soa->rrs.rdata));
 		zone->timers.last_notified_serial = (knot_soa_serial(soa->rrs.rdata) | LAST_NOTIFIED_SERIAL_VALID);
+		ATOMIC_ADD(zone->server->notify_stats.acked, 1);
 	} else if (knot_pkt_ext_rcode(req->resp) == 0) {
 		NOTIFY_OUT_LOG(LOG_WARNING, zone->name, slave,
 		               requestor.layer.flags,
@@ -160,6 +197,9 @@ int event_notify(conf_t *conf, zone_t *zone)
 		return KNOT_ENOMEM;
 	}
 
+	// remotes already notified in this round (e.g. listed also in a group)
+	notifailed_rmt_dynarray_t notified = { 0 };
+
 	// in case of re-try, NOTIFY only failed remotes
 	pthread_mutex_lock(&zone->preferred_lock);
 	bool retry = (zone->notifailed.size > 0);
@@ -174,6 +214,12 @@ int event_notify(conf_t *conf, zone_t *zone)
 			conf_mix_iter_next(&iter);
 			continue;
 		}
+		if (notified_contains(&notified, rmt_hash)) {
+			ATOMIC_ADD(zone->server->notify_stats.coalesced, 1);
+			conf_mix_iter_next(&iter);
+			continue;
+		}
+		notifailed_rmt_dynarray_add(&notified, &rmt_hash);
 		pthread_mutex_unlock(&zone->preferred_lock);
 
 		conf_val_t addr = conf_id_get(conf, C_RMT, C_ADDR, iter.id);
@@ -189,8 +235,13 @@ int event_notify(conf_t *conf, zone_t *zone)
 			}
 		}
 
+		if (retry) {
+			ATOMIC_ADD(zone->server->notify_stats.retried, 1);
+		}
+
 		pthread_mutex_lock(&zone->preferred_lock);
 		if (ret != KNOT_EOK) {
+			ATOMIC_ADD(zone->server->notify_stats.failed, 1);
 			failed = true;
 			notifailed_rmt_dynarray_add(&zone->notifailed, &rmt_hash);
 		} else {
@@ -203,15 +254,15 @@ int event_notify(conf_t *conf, zone_t *zone)
 	if (failed) {
 		notifailed_rmt_dynarray_sort_dedup(&zone->notifailed);
 
+		conf_zone_cache_t zconf = zone_conf_cache(conf, zone);
 		uint32_t retry_in = knot_soa_retry(soa_cpy->rrs.rdata);
-		conf_val_t val = conf_zone_get(conf, C_RETRY_MIN_INTERVAL, zone->name);
-		retry_in = MAX(retry_in, conf_int(&val));
-		val = conf_zone_get(conf, C_RETRY_MAX_INTERVAL, zone->name);
-		retry_in = MIN(retry_in, conf_int(&val));
+		retry_in = MAX(retry_in, zconf.retry_min_interval);
+		retry_in = MIN(retry_in, zconf.retry_max_interval);
 
 		zone_events_schedule_at(zone, ZONE_EVENT_NOTIFY, time(NULL) + retry_in);
 	}
 	pthread_mutex_unlock(&zone->preferred_lock);
+	notifailed_rmt_dynarray_free(&notified);
 	knot_rrset_free(soa_cpy, NULL);
 
 	return failed ? KNOT_ERROR : KNOT_EOK;
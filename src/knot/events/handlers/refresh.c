@@ -87,6 +87,8 @@
 	       &(data)->remote->addr, flags2proto((data)->layer->flags), \
 	       (data)->layer->flags & KNOT_REQUESTOR_REUSED, (data)->remote->key.name, msg)
 
+#define REFRESH_UDP_ATTEMPTS 3
+
 enum state {
 	REFRESH_STATE_INVALID = 0,
 	STATE_SOA_QUERY,
@@ -109,6 +111,7 @@ struct refresh_data {
 
 	zone_t *zone;                     //!< Zone to eventually updated.
 	conf_t *conf;                     //!< Server configuration.
+	const conf_zone_cache_t *zconf;   //!< Flattened zone configuration.
 	const conf_remote_t *remote;      //!< Remote endpoint.
 	const knot_rrset_t *soa;          //!< Local SOA (NULL for AXFR).
 	const size_t max_zone_size;       //!< Maximal zone size.
@@ -117,6 +120,7 @@ struct refresh_data {
 	bool fallback_axfr;               //!< Flag allowing fallback to AXFR,
 	bool ixfr_by_one;                 //!< Allow only single changeset within IXFR.
 	bool ixfr_from_axfr;              //!< Diff computation of incremental update from AXFR allowed.
+	bool soa_udp;                     //!< SOA query over UDP, transfer over TCP.
 	uint32_t expire_timer;            //!< Result: expire timer from answer EDNS.
 
 	// internal state, initialize with zeroes:
@@ -166,17 +170,9 @@ static time_t bootstrap_next(uint8_t *count)
 	return increment + dnssec_random_uint16_t() % 30;
 }
 
-static void limit_timer(conf_t *conf, const knot_dname_t *zone, uint32_t *timer,
-                        const char *tm_name, const yp_name_t *low, const yp_name_t *upp)
+static void limit_timer(const knot_dname_t *zone, uint32_t *timer, const char *tm_name,
+                        uint32_t tlow, uint32_t tupp)
 {
-	uint32_t tlow = 0;
-	if (low > 0) {
-		conf_val_t val1 = conf_zone_get(conf, low, zone);
-		tlow = conf_int(&val1);
-	}
-	conf_val_t val2 = conf_zone_get(conf, upp, zone);
-	uint32_t tupp = conf_int(&val2);
-
 	const char *msg = "%s timer trimmed to '%s-%s-interval'";
 	if (*timer < tlow) {
 		*timer = tlow;
@@ -213,7 +209,6 @@ static void consume_edns_expire(struct refresh_data *data, knot_pkt_t *pkt, bool
 
 static void finalize_timers_base(struct refresh_data *data, bool also_expire)
 {
-	conf_t *conf = data->conf;
 	zone_t *zone = data->zone;
 
 	// EDNS EXPIRE -- RFC 7314, section 4, fourth paragraph.
@@ -224,8 +219,8 @@ static void finalize_timers_base(struct refresh_data *data, bool also_expire)
 	const knot_rdataset_t *soa = zone_soa(zone);
 
 	uint32_t soa_refresh = knot_soa_refresh(soa->rdata);
-	limit_timer(conf, zone->name, &soa_refresh, "refresh",
-	            C_REFRESH_MIN_INTERVAL, C_REFRESH_MAX_INTERVAL);
+	limit_timer(zone->name, &soa_refresh, "refresh",
+	            data->zconf->refresh_min_interval, data->zconf->refresh_max_interval);
 	zone->timers.next_refresh = now + soa_refresh;
 	zone->timers.last_refresh_ok = true;
 
@@ -233,11 +228,11 @@ static void finalize_timers_base(struct refresh_data *data, bool also_expire)
 		// It's already zero in most cases.
 		zone->timers.next_expire = 0;
 	} else if (also_expire) {
-		limit_timer(conf, zone->name, &data->expire_timer, "expire",
+		limit_timer(zone->name, &data->expire_timer, "expire",
 		            // Limit min if not received as EDNS Expire.
 		            data->expire_timer == knot_soa_expire(soa->rdata) ?
-			      C_EXPIRE_MIN_INTERVAL : 0,
-		            C_EXPIRE_MAX_INTERVAL);
+			      data->zconf->expire_min_interval : 0,
+		            data->zconf->expire_max_interval);
 		zone->timers.next_expire = now + data->expire_timer;
 	}
 }
@@ -339,8 +334,7 @@ static int axfr_finalize(struct refresh_data *data)
 {
 	zone_contents_t *new_zone = data->axfr.zone;
 
-	conf_val_t val = conf_zone_get(data->conf, C_DNSSEC_SIGNING, data->zone->name);
-	bool dnssec_enable = conf_bool(&val);
+	bool dnssec_enable = data->zconf->dnssec_signing;
 	uint32_t old_serial = zone_contents_serial(data->zone->contents), master_serial = 0;
 	bool bootstrap = (data->zone->contents == NULL);
 
@@ -372,8 +366,7 @@ static int axfr_finalize(struct refresh_data *data)
 		return ret;
 	}
 
-	val = conf_zone_get(data->conf, C_ZONEMD_GENERATE, data->zone->name);
-	unsigned digest_alg = conf_opt(&val);
+	unsigned digest_alg = data->zconf->zonemd_generate;
 
 	if (dnssec_enable) {
 		zone_sign_reschedule_t resch = { 0 };
@@ -600,8 +593,7 @@ static int ixfr_slave_sign_serial(list_t *changesets, zone_t *zone,
 
 static int ixfr_finalize(struct refresh_data *data)
 {
-	conf_val_t val = conf_zone_get(data->conf, C_DNSSEC_SIGNING, data->zone->name);
-	bool dnssec_enable = conf_bool(&val);
+	bool dnssec_enable = data->zconf->dnssec_signing;
 	uint32_t master_serial = 0, old_serial = zone_contents_serial(data->zone->contents);
 
 	if (dnssec_enable) {
@@ -616,8 +608,7 @@ static int ixfr_finalize(struct refresh_data *data)
 		}
 	}
 
-	val = conf_zone_get(data->conf, C_IXFR_BENEVOLENT, data->zone->name);
-	zone_update_flags_t strict = conf_bool(&val) ? 0 : UPDATE_STRICT;
+	zone_update_flags_t strict = data->zconf->ixfr_benevolent ? 0 : UPDATE_STRICT;
 
 	zone_update_t up = { 0 };
 	int ret = zone_update_init(&up, data->zone, UPDATE_INCREMENTAL | UPDATE_NO_CHSET | strict);
@@ -651,8 +642,7 @@ static int ixfr_finalize(struct refresh_data *data)
 		return ret;
 	}
 
-	val = conf_zone_get(data->conf, C_ZONEMD_GENERATE, data->zone->name);
-	unsigned digest_alg = conf_opt(&val);
+	unsigned digest_alg = data->zconf->zonemd_generate;
 
 	if (dnssec_enable) {
 		ret = knot_dnssec_sign_update(&up, data->conf);
@@ -1083,6 +1073,12 @@ static int soa_query_consume(knot_layer_t *layer, knot_pkt_t *pkt)
 {
 	struct refresh_data *data = layer->data;
 
+	// Truncated answer over UDP, repeat the query over TCP.
+	if (data->soa_udp && knot_wire_get_tc(pkt->wire)) {
+		data->soa_udp = false;
+		return KNOT_STATE_DONE;
+	}
+
 	if (knot_pkt_ext_rcode(pkt) != KNOT_RCODE_NOERROR) {
 		REFRESH_LOG_PROTO(LOG_WARNING, data,
 		                  "server responded with error '%s'",
@@ -1095,8 +1091,7 @@ static int soa_query_consume(knot_layer_t *layer, knot_pkt_t *pkt)
 	const knot_rrset_t *rr = answer->count == 1 ? knot_pkt_rr(answer, 0) : NULL;
 	if (!rr || rr->type != KNOT_RRTYPE_SOA || rr->rrs.count != 1) {
 		REFRESH_LOG_PROTO(LOG_WARNING, data, "malformed message");
-		conf_val_t val = conf_zone_get(data->conf, C_SEM_CHECKS, data->zone->name);
-		if (conf_opt(&val) == SEMCHECKS_SOFT) {
+		if (data->zconf->semantic_checks == SEMCHECKS_SOFT) {
 			data->xfr_type = XFR_TYPE_AXFR;
 			data->state = STATE_TRANSFER;
 			return KNOT_STATE_RESET;
@@ -1265,15 +1260,14 @@ static int refresh_begin(knot_layer_t *layer, void *_data)
 	struct refresh_data *data = _data;
 	data->layer = layer;
 
-	if (data->soa) {
-		data->state = STATE_SOA_QUERY;
-		data->xfr_type = XFR_TYPE_IXFR;
-		data->initial_soa_copy = NULL;
-	} else {
+	if (data->soa == NULL) {
 		data->state = STATE_TRANSFER;
 		data->xfr_type = XFR_TYPE_AXFR;
-		data->initial_soa_copy = NULL;
-	}
+	} else if (data->state != STATE_TRANSFER) {
+		data->state = STATE_SOA_QUERY;
+		data->xfr_type = XFR_TYPE_IXFR;
+	} // else the SOA has already been queried over UDP.
+	data->initial_soa_copy = NULL;
 
 	data->started = time_now();
 
@@ -1300,8 +1294,15 @@ static int refresh_consume(knot_layer_t *layer, knot_pkt_t *pkt)
 
 	data->fallback->address = false; // received something, other address not needed
 
+	int next;
 	switch (data->state) {
-	case STATE_SOA_QUERY: return soa_query_consume(layer, pkt);
+	case STATE_SOA_QUERY:
+		next = soa_query_consume(layer, pkt);
+		// The transfer isn't continued over UDP but requested over TCP.
+		if (data->soa_udp && next == KNOT_STATE_RESET) {
+			next = KNOT_STATE_DONE;
+		}
+		return next;
 	case STATE_TRANSFER:  return transfer_consume(layer, pkt);
 	default:
 		return KNOT_STATE_FAIL;
@@ -1333,17 +1334,55 @@ static const knot_layer_api_t REFRESH_API = {
 	.finish = refresh_finish,
 };
 
-static size_t max_zone_size(conf_t *conf, const knot_dname_t *zone)
+static int refresh_exec(zone_t *zone, const conf_remote_t *master,
+                        struct refresh_data *data, knot_request_flag_t flags,
+                        int timeout, bool *iofail)
 {
-	conf_val_t val = conf_zone_get(conf, C_ZONE_MAX_SIZE, zone);
-	return conf_int(&val);
+	knot_requestor_t requestor;
+	knot_requestor_init(&requestor, &REFRESH_API, data, NULL);
+
+	knot_pkt_t *pkt = knot_pkt_new(NULL, KNOT_WIRE_MAX_PKTSIZE, NULL);
+	if (pkt == NULL) {
+		knot_requestor_clear(&requestor);
+		return KNOT_ENOMEM;
+	}
+
+	knot_request_t *req = knot_request_make(NULL, master, pkt, zone->server->quic_creds,
+	                                        &data->edns, flags);
+	if (req == NULL) {
+		knot_requestor_clear(&requestor);
+		return KNOT_ENOMEM;
+	}
+
+	int ret;
+
+	// while loop runs 0x or 1x; IXFR to AXFR failover
+	while (ret = knot_requestor_exec(&requestor, req, timeout),
+	       ret = (data->ret == KNOT_EOK ? ret : data->ret),
+	       !(requestor.layer.flags & KNOT_REQUESTOR_IOFAIL) &&
+	       data->fallback_axfr && ret != KNOT_EOK) {
+		REFRESH_LOG(LOG_WARNING, data,
+		            "fallback to AXFR (%s)", knot_strerror(ret));
+		ixfr_cleanup(data);
+		data->ret = KNOT_EOK;
+		data->xfr_type = XFR_TYPE_AXFR;
+		data->fallback_axfr = false,
+		requestor.layer.state = KNOT_STATE_RESET;
+		requestor.layer.flags |= KNOT_REQUESTOR_CLOSE;
+	}
+	if (iofail != NULL) {
+		*iofail = (requestor.layer.flags & KNOT_REQUESTOR_IOFAIL);
+	}
+	knot_request_free(req, NULL);
+	knot_requestor_clear(&requestor);
+
+	return ret;
 }
 
 typedef struct {
+	conf_zone_cache_t zconf;
 	bool force_axfr;
 	bool send_notify;
-	bool ixfr_by_one;
-	bool ixfr_from_axfr;
 	bool more_xfr;
 } try_refresh_ctx_t;
 
@@ -1373,56 +1412,46 @@ static int try_refresh(conf_t *conf, zone_t *zone, const conf_remote_t *master,
 	struct refresh_data data = {
 		.zone = zone,
 		.conf = conf,
+		.zconf = &trctx->zconf,
 		.remote = master,
 		.soa = zone->contents && !trctx->force_axfr ? soa : NULL,
-		.max_zone_size = max_zone_size(conf, zone->name),
+		.max_zone_size = trctx->zconf.zone_max_size,
 		.edns = query_edns_data_init(conf, master, QUERY_EDNS_OPT_EXPIRE),
 		.expire_timer = EXPIRE_TIMER_INVALID,
 		.fallback = fallback,
 		.fallback_axfr = false, // will be set upon IXFR consume
-		.ixfr_by_one = trctx->ixfr_by_one,
-		.ixfr_from_axfr = trctx->ixfr_from_axfr,
+		.ixfr_by_one = trctx->zconf.ixfr_by_one,
+		.ixfr_from_axfr = trctx->zconf.ixfr_from_axfr,
 	};
 
-	knot_requestor_t requestor;
-	knot_requestor_init(&requestor, &REFRESH_API, &data, NULL);
-
-	knot_pkt_t *pkt = knot_pkt_new(NULL, KNOT_WIRE_MAX_PKTSIZE, NULL);
-	if (pkt == NULL) {
-		knot_requestor_clear(&requestor);
-		knot_rrset_free(soa, NULL);
-		return KNOT_ENOMEM;
-	}
+	data.soa_udp = data.soa != NULL && master->udp_soa_query &&
+	               !master->quic && !master->tls;
 
 	knot_request_flag_t flags = conf->cache.srv_tcp_fastopen ? KNOT_REQUEST_TFO : 0;
-	knot_request_t *req = knot_request_make(NULL, master, pkt, zone->server->quic_creds,
-	                                        &data.edns, flags);
-	if (req == NULL) {
-		knot_requestor_clear(&requestor);
-		knot_rrset_free(soa, NULL);
-		return KNOT_ENOMEM;
-	}
-
 	int timeout = conf->cache.srv_tcp_remote_io_timeout;
 
 	int ret;
-
-	// while loop runs 0x or 1x; IXFR to AXFR failover
-	while (ret = knot_requestor_exec(&requestor, req, timeout),
-	       ret = (data.ret == KNOT_EOK ? ret : data.ret),
-	       !(requestor.layer.flags & KNOT_REQUESTOR_IOFAIL) &&
-	       data.fallback_axfr && ret != KNOT_EOK) {
-		REFRESH_LOG(LOG_WARNING, &data,
-		            "fallback to AXFR (%s)", knot_strerror(ret));
-		ixfr_cleanup(&data);
-		data.ret = KNOT_EOK;
-		data.xfr_type = XFR_TYPE_AXFR;
-		data.fallback_axfr = false,
-		requestor.layer.state = KNOT_STATE_RESET;
-		requestor.layer.flags |= KNOT_REQUESTOR_CLOSE;
+	if (data.soa_udp) {
+		// Unanswered SOA query over UDP is retransmitted within the timeout.
+		int udp_timeout = MAX(timeout / REFRESH_UDP_ATTEMPTS, 1);
+		bool iofail = false;
+		for (int attempt = 1; attempt <= REFRESH_UDP_ATTEMPTS; attempt++) {
+			ret = refresh_exec(zone, master, &data, KNOT_REQUEST_UDP,
+			                   udp_timeout, &iofail);
+			if (!iofail) {
+				break;
+			}
+		}
+		// Continue over TCP with the transfer, if the answer was truncated,
+		// or if the query over UDP remained unanswered.
+		if (iofail ||
+		    (ret == KNOT_EOK && (data.state == STATE_TRANSFER || !data.soa_udp))) {
+			data.soa_udp = false;
+			ret = refresh_exec(zone, master, &data, flags, timeout, NULL);
+		}
+	} else {
+		ret = refresh_exec(zone, master, &data, flags, timeout, NULL);
 	}
-	knot_request_free(req, NULL);
-	knot_requestor_clear(&requestor);
 	knot_rrset_free(soa, NULL);
 
 	if (ret == KNOT_EOK) {
@@ -1438,23 +1467,17 @@ int event_refresh(conf_t *conf, zone_t *zone)
 {
 	assert(zone);
 
-	if (!zone_is_slave(conf, zone)) {
+	try_refresh_ctx_t trctx = { .zconf = zone_conf_cache(conf, zone) };
+	if (!trctx.zconf.is_slave) {
 		return KNOT_ENOTSUP;
 	}
 
-	try_refresh_ctx_t trctx = { 0 };
-
 	// TODO: Flag on zone is ugly. Event specific parameters would be nice.
 	if (zone_get_flag(zone, ZONE_FORCE_AXFR, true)) {
 		trctx.force_axfr = true;
 		zone->zonefile.retransfer = true;
 	}
 
-	conf_val_t val = conf_zone_get(conf, C_IXFR_BY_ONE, zone->name);
-	trctx.ixfr_by_one = conf_bool(&val);
-	val = conf_zone_get(conf, C_IXFR_FROM_AXFR, zone->name);
-	trctx.ixfr_from_axfr = conf_bool(&val);
-
 	int ret = zone_master_try(conf, zone, try_refresh, &trctx, "refresh");
 	zone_clear_preferred_master(zone);
 	if (ret != KNOT_EOK) {
@@ -1467,8 +1490,8 @@ int event_refresh(conf_t *conf, zone_t *zone)
 			next = bootstrap_next(&zone->zonefile.bootstrap_cnt);
 		}
 
-		limit_timer(conf, zone->name, &next, "retry",
-		            C_RETRY_MIN_INTERVAL, C_RETRY_MAX_INTERVAL);
+		limit_timer(zone->name, &next, "retry",
+		            trctx.zconf.retry_min_interval, trctx.zconf.retry_max_interval);
 		zone->timers.next_refresh = time(NULL) + next;
 		zone->timers.last_refresh_ok = false;
 
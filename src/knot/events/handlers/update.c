@@ -191,10 +191,9 @@ static int process_normal(conf_t *conf, zone_t *zone, list_t *requests)
 	}
 
 	// Sign update.
-	conf_val_t val = conf_zone_get(conf, C_DNSSEC_SIGNING, zone->name);
-	bool dnssec_enable = conf_bool(&val);
-	val = conf_zone_get(conf, C_ZONEMD_GENERATE, zone->name);
-	unsigned digest_alg = conf_opt(&val);
+	conf_zone_cache_t zconf = zone_conf_cache(conf, zone);
+	bool dnssec_enable = zconf.dnssec_signing;
+	unsigned digest_alg = zconf.zonemd_generate;
 	if (dnssec_enable) {
 		ret = knot_dnssec_sign_update(&up, conf);
 	} else if (digest_alg != ZONE_DIGEST_NONE) {
@@ -101,9 +101,10 @@ void replan_from_timers(conf_t *conf, zone_t *zone)
 	assert(zone);
 
 	time_t now = time(NULL);
+	conf_zone_cache_t zconf = zone_conf_cache(conf, zone);
 
 	time_t refresh = TIME_CANCEL;
-	if (zone_is_slave(conf, zone)) {
+	if (zconf.is_slave) {
 		refresh = zone->timers.next_refresh;
 		if (zone->contents == NULL && zone->timers.last_refresh_ok) { // zone disappeared w/o expiry
 			refresh = now;
@@ -116,28 +117,25 @@ void replan_from_timers(conf_t *conf, zone_t *zone)
 
 	time_t expire_pre = TIME_IGNORE;
 	time_t expire = TIME_IGNORE;
-	if (zone_is_slave(conf, zone) && zone->contents != NULL) {
+	if (zconf.is_slave && zone->contents != NULL) {
 		expire_pre = TIME_CANCEL;
 		expire = zone->timers.next_expire;
 	}
 
 	time_t flush = TIME_IGNORE;
-	if (!zone_is_slave(conf, zone) || zone->contents != NULL) {
-		conf_val_t val = conf_zone_get(conf, C_ZONEFILE_SYNC, zone->name);
-		int64_t sync_timeout = conf_int(&val);
-		if (sync_timeout > 0) {
-			flush = zone->timers.last_flush + sync_timeout;
+	if (!zconf.is_slave || zone->contents != NULL) {
+		if (zconf.zonefile_sync > 0) {
+			flush = zone->timers.last_flush + zconf.zonefile_sync;
 		}
 	}
 
 	time_t resalt = TIME_IGNORE;
 	time_t ds_check = TIME_CANCEL;
 	time_t ds_push = TIME_CANCEL;
-	conf_val_t val = conf_zone_get(conf, C_DNSSEC_SIGNING, zone->name);
-	if (conf_bool(&val)) {
+	if (zconf.dnssec_signing) {
 		conf_val_t policy = conf_zone_get(conf, C_DNSSEC_POLICY, zone->name);
 		conf_id_fix_default(&policy);
-		val = conf_id_get(conf, C_POLICY, C_NSEC3, &policy);
+		conf_val_t val = conf_id_get(conf, C_POLICY, C_NSEC3, &policy);
 		if (conf_bool(&val)) {
 			knot_time_t last_resalt = 0;
 			if (knot_lmdb_open(zone_kaspdb(zone)) == KNOT_EOK) {
@@ -400,6 +400,7 @@ typedef enum {
 typedef enum {
 	KNOTD_QUERY_FLAG_COOKIE     = 1 << 0, /*!< Valid DNS Cookie indication. */
 	KNOTD_QUERY_FLAG_AUTHORIZED = 1 << 1, /*!< Successfully authorized operation. */
+	KNOTD_QUERY_FLAG_EARLY_DATA = 1 << 2, /*!< Received in replayable 0-RTT data. */
 } knotd_query_flag_t;
 
 /*! Query processing data context parameters. */
@@ -471,6 +472,22 @@ inline static const struct sockaddr_storage *knotd_qdata_remote_addr(const knotd
  */
 uint32_t knotd_qdata_rtt(knotd_qdata_t *qdata);
 
+/*!
+ * Requests blocking of the remote prefix directly in the XDP BPF program.
+ *
+ * The block is applied asynchronously, so some subsequent queries can still
+ * pass. Only available if the query was received over XDP UDP.
+ *
+ * \param[in] qdata     Query data.
+ * \param[in] prefix    Prefix length of the remote address to be blocked.
+ * \param[in] duration  Block duration in milliseconds.
+ * \param[in] slip      Answer every Nth blocked query with TC bit (0 means none).
+ *
+ * \return Error code, KNOT_ENOTSUP if not available.
+ */
+int knotd_qdata_xdp_block(knotd_qdata_t *qdata, unsigned prefix, uint32_t duration,
+                          uint16_t slip);
+
 /*!
  * Gets the current zone name.
  *
@@ -54,11 +54,12 @@ void journal_del_zone(knot_lmdb_txn_t *txn, const knot_dname_t *zone)
 	free(prefix.mv_data);
 }
 
-void journal_make_header(void *chunk, uint32_t ch_serial_to, uint64_t now)
+void journal_make_header(void *chunk, uint32_t ch_serial_to, uint64_t now,
+                         unsigned codec, uint32_t raw_size)
 {
-	knot_lmdb_make_key_part(chunk, JOURNAL_HEADER_SIZE, "IILLL", ch_serial_to,
+	knot_lmdb_make_key_part(chunk, JOURNAL_HEADER_SIZE, "IIIILL", ch_serial_to,
 	                        (uint32_t)0 /* we no longer care for # of chunks */,
-	                        (uint64_t)0, now, (uint64_t)0);
+	                        (uint32_t)codec, raw_size, now, (uint64_t)0);
 }
 
 uint32_t journal_next_serial(const MDB_val *chunk)
@@ -66,6 +67,16 @@ uint32_t journal_next_serial(const MDB_val *chunk)
 	return knot_wire_read_u32(chunk->mv_data);
 }
 
+unsigned journal_chunk_codec(const MDB_val *chunk, uint32_t *raw_size)
+{
+	// Older chunks have zeros here, which means no compression.
+	const uint8_t *codec_pos = chunk->mv_data + sizeof(uint32_t) + sizeof(uint32_t);
+	if (raw_size != NULL) {
+		*raw_size = knot_wire_read_u32(codec_pos + sizeof(uint32_t));
+	}
+	return knot_wire_read_u32(codec_pos);
+}
+
 uint64_t journal_ch_timestamp(const MDB_val *chunk)
 {
 	return knot_wire_read_u64(chunk->mv_data + sizeof(uint32_t) + sizeof(uint32_t) + sizeof(uint64_t));
@@ -100,3 +111,9 @@ size_t journal_conf_max_changesets(zone_journal_t j)
 	conf_val_t val = conf_zone_get(j.conf, C_JOURNAL_MAX_DEPTH, j.zone);
 	return conf_int(&val);
 }
+
+unsigned journal_conf_compression(zone_journal_t j)
+{
+	conf_val_t val = conf_zone_get(j.conf, C_JOURNAL_COMPRESSION, j.zone);
+	return conf_opt(&val);
+}
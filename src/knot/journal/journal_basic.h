@@ -84,11 +84,14 @@ void journal_del_zone(knot_lmdb_txn_t *txn, const knot_dname_t *zone);
 /*!
  * \brief Initialise chunk header.
  *
- * \param chunk   Pointer to the changeset chunk. It must be at least JOURNAL_HEADER_SIZE, perhaps more.
- * \param ch      Serial-to of the changeset being serialized.
- * \param now     Current timestamp.
+ * \param chunk      Pointer to the changeset chunk. It must be at least JOURNAL_HEADER_SIZE, perhaps more.
+ * \param ch         Serial-to of the changeset being serialized.
+ * \param now        Current timestamp.
+ * \param codec      Compression of the chunk payload (JOURNAL_COMPRESSION_*).
+ * \param raw_size   Size of the uncompressed chunk payload, ignored if not compressed.
  */
-void journal_make_header(void *chunk, uint32_t ch_serial_to, uint64_t now);
+void journal_make_header(void *chunk, uint32_t ch_serial_to, uint64_t now,
+                         unsigned codec, uint32_t raw_size);
 
 /*!
  * \brief Obtain serial-to of the serialized changeset.
@@ -99,6 +102,16 @@ void journal_make_header(void *chunk, uint32_t ch_serial_to, uint64_t now);
  */
 uint32_t journal_next_serial(const MDB_val *chunk);
 
+/*!
+ * \brief Obtain compression of the chunk payload.
+ *
+ * \param chunk      Any chunk of a serialized changeset.
+ * \param raw_size   Optional output: size of the uncompressed chunk payload.
+ *
+ * \return Compression algorithm (JOURNAL_COMPRESSION_*).
+ */
+unsigned journal_chunk_codec(const MDB_val *chunk, uint32_t *raw_size);
+
 /*!
  * \brief Obtain timestamp of the serialized changeset.
  *
@@ -136,3 +149,6 @@ size_t journal_conf_max_usage(zone_journal_t j);
 
 /*! \brief Return configured maximal depth of journal. */
 size_t journal_conf_max_changesets(zone_journal_t j);
+
+/*! \brief Return configured compression of newly stored changesets. */
+unsigned journal_conf_compression(zone_journal_t j);
@@ -26,6 +26,10 @@
 
 #include <stdlib.h>
 
+#ifdef HAVE_ZSTD
+#include <zstd.h>
+#endif
+
 struct journal_read {
 	knot_lmdb_txn_t txn;
 	MDB_val key_prefix;
@@ -35,6 +39,10 @@ struct journal_read {
 	uint32_t next;
 	uint32_t changesets_read;
 	uint32_t changesets_total;
+	uint8_t *unpacked;
+#ifdef HAVE_ZSTD
+	ZSTD_DCtx *dctx;
+#endif
 };
 
 int journal_read_get_error(const journal_read_t *ctx, int another_error)
@@ -42,10 +50,55 @@ int journal_read_get_error(const journal_read_t *ctx, int another_error)
 	return (ctx == NULL || ctx->txn.ret == KNOT_EOK ? another_error : ctx->txn.ret);
 }
 
-static void update_ctx_wire(journal_read_t *ctx)
+static int unpack_chunk(journal_read_t *ctx, unsigned codec, uint32_t raw_size)
 {
-	ctx->wire = wire_ctx_init_const(ctx->txn.cur_val.mv_data, ctx->txn.cur_val.mv_size);
-	wire_ctx_skip(&ctx->wire, JOURNAL_HEADER_SIZE);
+	if (raw_size > JOURNAL_CHUNK_MAX || ctx->txn.cur_val.mv_size < JOURNAL_HEADER_SIZE) {
+		return KNOT_EMALF;
+	}
+	const uint8_t *packed = ctx->txn.cur_val.mv_data + JOURNAL_HEADER_SIZE;
+	size_t packed_size = ctx->txn.cur_val.mv_size - JOURNAL_HEADER_SIZE;
+
+#ifdef HAVE_ZSTD
+	if (codec == JOURNAL_COMPRESSION_ZSTD) {
+		if (ctx->unpacked == NULL) {
+			ctx->unpacked = malloc(JOURNAL_CHUNK_MAX);
+			ctx->dctx = ZSTD_createDCtx();
+			if (ctx->unpacked == NULL || ctx->dctx == NULL) {
+				return KNOT_ENOMEM;
+			}
+		}
+		size_t ret = ZSTD_decompressDCtx(ctx->dctx, ctx->unpacked, raw_size,
+		                                 packed, packed_size);
+		if (ZSTD_isError(ret) || ret != raw_size) {
+			return KNOT_EMALF;
+		}
+		ctx->wire = wire_ctx_init_const(ctx->unpacked, raw_size);
+		return KNOT_EOK;
+	}
+#else
+	(void)packed;
+	(void)packed_size;
+#endif
+	return KNOT_ENOTSUP;
+}
+
+static bool update_ctx_wire(journal_read_t *ctx)
+{
+	uint32_t raw_size = 0;
+	unsigned codec = journal_chunk_codec(&ctx->txn.cur_val, &raw_size);
+	if (codec == JOURNAL_COMPRESSION_NONE) {
+		ctx->wire = wire_ctx_init_const(ctx->txn.cur_val.mv_data, ctx->txn.cur_val.mv_size);
+		wire_ctx_skip(&ctx->wire, JOURNAL_HEADER_SIZE);
+		return true;
+	}
+
+	int ret = unpack_chunk(ctx, codec, raw_size);
+	if (ret != KNOT_EOK) {
+		ctx->wire = wire_ctx_init_const(NULL, 0);
+		ctx->txn.ret = ret;
+		return false;
+	}
+	return true;
 }
 
 static bool go_correct_prefix(journal_read_t *ctx)
@@ -78,8 +131,7 @@ static bool go_next_changeset(journal_read_t *ctx, bool go_zone, const knot_dnam
 	}
 	ctx->next = journal_next_serial(&ctx->txn.cur_val);
 	ctx->timestamp = journal_ch_timestamp(&ctx->txn.cur_val);
-	update_ctx_wire(ctx);
-	return true;
+	return update_ctx_wire(ctx);
 }
 
 int journal_read_begin(zone_journal_t j, bool read_zone, uint32_t serial_from, journal_read_t **ctx)
@@ -120,6 +172,10 @@ void journal_read_end(journal_read_t *ctx)
 	if (ctx != NULL) {
 		free(ctx->key_prefix.mv_data);
 		knot_lmdb_abort(&ctx->txn);
+		free(ctx->unpacked);
+#ifdef HAVE_ZSTD
+		ZSTD_freeDCtx(ctx->dctx);
+#endif
 		free(ctx);
 	}
 }
@@ -138,7 +194,7 @@ static bool make_data_available(journal_read_t *ctx)
 			ctx->txn.ret = KNOT_EMALF;
 			return false;
 		}
-		update_ctx_wire(ctx);
+		return update_ctx_wire(ctx);
 	}
 	return true;
 }
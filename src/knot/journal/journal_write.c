@@ -24,35 +24,120 @@
 #include "knot/zone/serial.h"
 #include "libknot/error.h"
 
-static void journal_write_serialize(knot_lmdb_txn_t *txn, serialize_ctx_t *ser,
+#ifdef HAVE_ZSTD
+#include <zstd.h>
+
+// Favour speed, the journal is written on the zone update path.
+#define JOURNAL_ZSTD_LEVEL 1
+#endif
+
+typedef struct {
+	unsigned codec;
+	uint8_t *raw;
+	uint8_t *packed;
+	size_t packed_max;
+#ifdef HAVE_ZSTD
+	ZSTD_CCtx *cctx;
+#endif
+} chunk_packer_t;
+
+static int packer_init(chunk_packer_t *pk, unsigned codec)
+{
+	memset(pk, 0, sizeof(*pk));
+	if (codec == JOURNAL_COMPRESSION_NONE) {
+		return KNOT_EOK;
+	}
+#ifdef HAVE_ZSTD
+	if (codec == JOURNAL_COMPRESSION_ZSTD) {
+		pk->packed_max = ZSTD_compressBound(JOURNAL_CHUNK_MAX);
+		pk->raw = malloc(JOURNAL_CHUNK_MAX);
+		pk->packed = malloc(pk->packed_max);
+		pk->cctx = ZSTD_createCCtx();
+		if (pk->raw == NULL || pk->packed == NULL || pk->cctx == NULL) {
+			return KNOT_ENOMEM; // cleaned up by packer_deinit()
+		}
+		pk->codec = codec;
+		return KNOT_EOK;
+	}
+#endif
+	return KNOT_ENOTSUP;
+}
+
+static void packer_deinit(chunk_packer_t *pk)
+{
+	free(pk->raw);
+	free(pk->packed);
+#ifdef HAVE_ZSTD
+	ZSTD_freeCCtx(pk->cctx);
+#endif
+}
+
+/*! \brief Compress pk->raw, return zero if not worth it. */
+static size_t packer_pack(chunk_packer_t *pk, size_t raw_size)
+{
+#ifdef HAVE_ZSTD
+	if (pk->codec == JOURNAL_COMPRESSION_ZSTD) {
+		size_t ret = ZSTD_compressCCtx(pk->cctx, pk->packed, pk->packed_max,
+		                               pk->raw, raw_size, JOURNAL_ZSTD_LEVEL);
+		if (!ZSTD_isError(ret) && ret < raw_size) {
+			return ret;
+		}
+	}
+#endif
+	return 0;
+}
+
+static void journal_write_serialize(zone_journal_t j, knot_lmdb_txn_t *txn, serialize_ctx_t *ser,
                                     const knot_dname_t *apex, bool zij, uint32_t ch_from, uint32_t ch_to)
 {
+	chunk_packer_t pk;
+	int ret = packer_init(&pk, journal_conf_compression(j));
+	if (ret != KNOT_EOK) {
+		txn->ret = ret;
+	}
+
 	MDB_val chunk;
+	size_t raw_size, packed_size = 0;
 	uint32_t i = 0;
 	uint64_t now = knot_time();
 	while (serialize_unfinished(ser) && txn->ret == KNOT_EOK) {
 		serialize_prepare(ser, JOURNAL_CHUNK_THRESH - JOURNAL_HEADER_SIZE,
-		                  JOURNAL_CHUNK_MAX - JOURNAL_HEADER_SIZE, &chunk.mv_size);
-		if (chunk.mv_size == 0) {
+		                  JOURNAL_CHUNK_MAX - JOURNAL_HEADER_SIZE, &raw_size);
+		if (raw_size == 0) {
 			break; // beware! If this is omitted, it creates empty chunk => EMALF when reading.
 		}
-		chunk.mv_size += JOURNAL_HEADER_SIZE;
+		if (pk.codec != JOURNAL_COMPRESSION_NONE) {
+			serialize_chunk(ser, pk.raw, raw_size);
+			packed_size = packer_pack(&pk, raw_size);
+		}
+		chunk.mv_size = JOURNAL_HEADER_SIZE + (packed_size > 0 ? packed_size : raw_size);
 		chunk.mv_data = NULL;
 		MDB_val key = journal_make_chunk_key(apex, ch_from, zij, i);
 		if (knot_lmdb_insert(txn, &key, &chunk)) {
-			journal_make_header(chunk.mv_data, ch_to, now);
-			serialize_chunk(ser, chunk.mv_data + JOURNAL_HEADER_SIZE, chunk.mv_size - JOURNAL_HEADER_SIZE);
+			uint8_t *payload = chunk.mv_data + JOURNAL_HEADER_SIZE;
+			if (packed_size > 0) {
+				journal_make_header(chunk.mv_data, ch_to, now, pk.codec, raw_size);
+				memcpy(payload, pk.packed, packed_size);
+			} else {
+				journal_make_header(chunk.mv_data, ch_to, now, JOURNAL_COMPRESSION_NONE, 0);
+				if (pk.codec != JOURNAL_COMPRESSION_NONE) {
+					memcpy(payload, pk.raw, raw_size);
+				} else {
+					serialize_chunk(ser, payload, raw_size);
+				}
+			}
 		}
 		free(key.mv_data);
 		i++;
 	}
-	int ret = serialize_deinit(ser);
+	packer_deinit(&pk);
+	ret = serialize_deinit(ser);
 	if (txn->ret == KNOT_EOK) {
 		txn->ret = ret;
 	}
 }
 
-void journal_write_changeset(knot_lmdb_txn_t *txn, const changeset_t *ch)
+void journal_write_changeset(zone_journal_t j, knot_lmdb_txn_t *txn, const changeset_t *ch)
 {
 	serialize_ctx_t *ser = serialize_init(ch);
 	if (ser == NULL) {
@@ -60,30 +145,30 @@ void journal_write_changeset(knot_lmdb_txn_t *txn, const changeset_t *ch)
 		return;
 	}
 	if (ch->remove == NULL) {
-		journal_write_serialize(txn, ser, ch->soa_to->owner, true, 0, changeset_to(ch));
+		journal_write_serialize(j, txn, ser, ch->soa_to->owner, true, 0, changeset_to(ch));
 	} else {
-		journal_write_serialize(txn, ser, ch->soa_to->owner, false, changeset_from(ch), changeset_to(ch));
+		journal_write_serialize(j, txn, ser, ch->soa_to->owner, false, changeset_from(ch), changeset_to(ch));
 	}
 }
 
-void journal_write_zone(knot_lmdb_txn_t *txn, const zone_contents_t *z)
+void journal_write_zone(zone_journal_t j, knot_lmdb_txn_t *txn, const zone_contents_t *z)
 {
 	serialize_ctx_t *ser = serialize_zone_init(z);
 	if (ser == NULL) {
 		txn->ret = KNOT_ENOMEM;
 		return;
 	}
-	journal_write_serialize(txn, ser, z->apex->owner, true, 0, zone_contents_serial(z));
+	journal_write_serialize(j, txn, ser, z->apex->owner, true, 0, zone_contents_serial(z));
 }
 
-void journal_write_zone_diff(knot_lmdb_txn_t *txn, const zone_diff_t *z)
+void journal_write_zone_diff(zone_journal_t j, knot_lmdb_txn_t *txn, const zone_diff_t *z)
 {
 	serialize_ctx_t *ser = serialize_zone_diff_init(z);
 	if (ser == NULL) {
 		txn->ret = KNOT_ENOMEM;
 		return;
 	}
-	journal_write_serialize(txn, ser, z->apex->owner, false, zone_diff_from(z), zone_diff_to(z));
+	journal_write_serialize(j, txn, ser, z->apex->owner, false, zone_diff_from(z), zone_diff_to(z));
 }
 
 static bool delete_one(knot_lmdb_txn_t *txn, bool del_zij, uint32_t del_serial,
@@ -136,7 +221,7 @@ void journal_merge(zone_journal_t j, knot_lmdb_txn_t *txn, bool merge_zij,
 		assert(del_next_serial == *original_serial_to);
 	}
 
-	journal_write_changeset(txn, &merge);
+	journal_write_changeset(j, txn, &merge);
 	journal_read_clear_changeset(&merge);
 }
 
@@ -253,7 +338,7 @@ int journal_insert_zone(zone_journal_t j, const zone_contents_t *z)
 	update_last_inserter(&txn, j.zone);
 	journal_del_zone_txn(&txn, j.zone);
 
-	journal_write_zone(&txn, z);
+	journal_write_zone(j, &txn, z);
 
 	journal_metadata_t md = { 0 };
 	md.flags = JOURNAL_SERIAL_TO_VALID;
@@ -330,14 +415,14 @@ int journal_insert(zone_journal_t j, const changeset_t *ch, const changeset_t *e
 	}
 
 	if (zdiff == NULL) {
-		journal_write_changeset(&txn, ch);
+		journal_write_changeset(j, &txn, ch);
 	} else {
-		journal_write_zone_diff(&txn, zdiff);
+		journal_write_zone_diff(j, &txn, zdiff);
 	}
 	journal_metadata_after_insert(&md, ch_from, ch_to);
 
 	if (extra != NULL) {
-		journal_write_changeset(&txn, extra);
+		journal_write_changeset(j, &txn, extra);
 		journal_metadata_after_extra(&md, extra_from, extra_to);
 	}
 
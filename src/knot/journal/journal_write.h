@@ -23,18 +23,20 @@
 /*!
  * \brief Serialize a changeset into chunks and write it into DB with no checks and metadata update.
  *
+ * \param j     Zone journal.
  * \param txn   Journal DB transaction.
  * \param ch    Changeset to be written.
  */
-void journal_write_changeset(knot_lmdb_txn_t *txn, const changeset_t *ch);
+void journal_write_changeset(zone_journal_t j, knot_lmdb_txn_t *txn, const changeset_t *ch);
 
 /*!
  * \brief Serialize zone contents aka "bootstrap" changeset into journal, no checks.
  *
+ * \param j     Zone journal.
  * \param txn   Journal DB transaction.
  * \param z     Zone contents to be written.
  */
-void journal_write_zone(knot_lmdb_txn_t *txn, const zone_contents_t *z);
+void journal_write_zone(zone_journal_t j, knot_lmdb_txn_t *txn, const zone_contents_t *z);
 
 /*!
  * \brief Merge all following changeset into one of journal changeset.
@@ -24,6 +24,7 @@
 
 #include "knot/conf/conf.h"
 #include "contrib/files.h"
+#include "contrib/macros.h"
 #include "contrib/time.h"
 #include "contrib/wire_ctx.h"
 #include "libknot/dname.h"
@@ -81,7 +82,16 @@ void knot_lmdb_init(knot_lmdb_db_t *db, const char *path, size_t mapsize, unsign
 	pthread_mutex_init(&db->opening_mutex, NULL);
 	db->maxdbs = 2;
 	db->maxreaders = conf_lmdb_readers(conf());
+	db->group_commit = false;
 	db->last_readlock_clean = 0;
+	memset(&db->gc, 0, sizeof(db->gc));
+	pthread_mutex_init(&db->gc.mutex, NULL);
+	pthread_cond_init(&db->gc.cond, NULL);
+}
+
+static bool group_commit(knot_lmdb_db_t *db)
+{
+	return db->group_commit && !(db->env_flags & (MDB_RDONLY | MDB_MAPASYNC));
 }
 
 static int lmdb_stat(const char *lmdb_path, struct stat *st)
@@ -175,7 +185,8 @@ static int lmdb_open(knot_lmdb_db_t *db)
 		ret = mdb_env_set_maxreaders(db->env, db->maxreaders);
 	}
 	if (ret == MDB_SUCCESS) {
-		ret = mdb_env_open(db->env, db->path, db->env_flags, LMDB_FILE_MODE);
+		unsigned env_flags = db->env_flags | (group_commit(db) ? MDB_NOSYNC : 0);
+		ret = mdb_env_open(db->env, db->path, env_flags, LMDB_FILE_MODE);
 	}
 	if (ret == MDB_SUCCESS) {
 		unsigned init_txn_flags = (db->env_flags & MDB_RDONLY);
@@ -275,9 +286,29 @@ void knot_lmdb_deinit(knot_lmdb_db_t *db)
 {
 	knot_lmdb_close(db);
 	pthread_mutex_destroy(&db->opening_mutex);
+	pthread_mutex_destroy(&db->gc.mutex);
+	pthread_cond_destroy(&db->gc.cond);
 	free(db->path);
 }
 
+void knot_lmdb_set_commit_delay(knot_lmdb_db_t *db, unsigned delay_ms)
+{
+	pthread_mutex_lock(&db->gc.mutex);
+	db->gc.delay_ms = delay_ms;
+	pthread_mutex_unlock(&db->gc.mutex);
+}
+
+void knot_lmdb_commit_stats(knot_lmdb_db_t *db, uint64_t *commits, uint64_t *syncs,
+                            uint64_t *batch_max, uint64_t *latency_us)
+{
+	pthread_mutex_lock(&db->gc.mutex);
+	*commits = db->gc.synced;
+	*syncs = db->gc.syncs;
+	*batch_max = db->gc.batch_max;
+	*latency_us = db->gc.synced > 0 ? db->gc.latency_us / db->gc.synced : 0;
+	pthread_mutex_unlock(&db->gc.mutex);
+}
+
 void knot_lmdb_begin(knot_lmdb_db_t *db, knot_lmdb_txn_t *txn, bool rw)
 {
 	uint64_t next_readlock_clean = db->last_readlock_clean + READER_LOCK_CLEAN_MAX_FREQ, now = knot_time();
@@ -319,6 +350,56 @@ static bool txn_semcheck(knot_lmdb_txn_t *txn)
 	return true;
 }
 
+static void gc_wait(knot_lmdb_gc_t *gc, unsigned delay_ms)
+{
+	struct timespec until;
+	clock_gettime(CLOCK_REALTIME, &until);
+	until.tv_nsec += (long)delay_ms * 1000000;
+	until.tv_sec += until.tv_nsec / 1000000000;
+	until.tv_nsec %= 1000000000;
+	(void)pthread_cond_timedwait(&gc->cond, &gc->mutex, &until);
+}
+
+static int group_sync(knot_lmdb_db_t *db, const struct timespec *begin)
+{
+	knot_lmdb_gc_t *gc = &db->gc;
+
+	pthread_mutex_lock(&gc->mutex);
+	uint64_t seq = ++gc->committed;
+	int ret = KNOT_EOK;
+	while (gc->synced < seq) {
+		if (gc->syncing) {
+			pthread_cond_wait(&gc->cond, &gc->mutex);
+			ret = gc->sync_ret;
+			continue;
+		}
+
+		// Become the leader and sync the commits collected so far.
+		gc->syncing = true;
+		if (gc->delay_ms > 0) {
+			gc_wait(gc, gc->delay_ms);
+		}
+		uint64_t upto = gc->committed;
+		pthread_mutex_unlock(&gc->mutex);
+
+		ret = mdb_env_sync(db->env, 1);
+		err_to_knot(&ret);
+
+		pthread_mutex_lock(&gc->mutex);
+		gc->batch_max = MAX(gc->batch_max, upto - gc->synced);
+		gc->synced = upto;
+		gc->syncs++;
+		gc->sync_ret = ret;
+		gc->syncing = false;
+		pthread_cond_broadcast(&gc->cond);
+	}
+	struct timespec end = time_now();
+	gc->latency_us += time_diff_ms(begin, &end) * 1000;
+	pthread_mutex_unlock(&gc->mutex);
+
+	return ret;
+}
+
 void knot_lmdb_commit(knot_lmdb_txn_t *txn)
 {
 	if (!txn_semcheck(txn)) {
@@ -328,9 +409,13 @@ void knot_lmdb_commit(knot_lmdb_txn_t *txn)
 		mdb_cursor_close(txn->cursor);
 		txn->cursor = NULL;
 	}
+	struct timespec begin = time_now();
 	txn->ret = mdb_txn_commit(txn->txn);
 	err_to_knot(&txn->ret);
 	txn->opened = false;
+	if (txn->ret == KNOT_EOK && txn->is_rw && group_commit(txn->db)) {
+		txn->ret = group_sync(txn->db, &begin);
+	}
 }
 
 // save the programmer's frequent checking for ENOMEM when creating search keys
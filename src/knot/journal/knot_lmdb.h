@@ -23,6 +23,28 @@
 #include <stdlib.h>
 #include <pthread.h>
 
+/*!
+ * \brief Group commit state.
+ *
+ * RW transactions are committed without a disk sync and the committing
+ * threads wait for a shared sync performed by one of them, so concurrent
+ * commits are made durable by a single fsync.
+ */
+typedef struct {
+	pthread_mutex_t mutex;
+	pthread_cond_t cond;
+	unsigned delay_ms;     // Maximal delay of the sync to collect more commits.
+	bool syncing;          // A sync is being performed.
+	int sync_ret;          // Result of the last sync.
+	uint64_t committed;    // Sequence number of the last commit.
+	uint64_t synced;       // Sequence number of the last synced commit.
+
+	// statistics
+	uint64_t syncs;        // Number of performed syncs.
+	uint64_t batch_max;    // Maximal number of commits per sync.
+	uint64_t latency_us;   // Total commit latency in microseconds.
+} knot_lmdb_gc_t;
+
 typedef struct knot_lmdb_db {
 	MDB_dbi dbi;
 	MDB_env *env;
@@ -31,6 +53,9 @@ typedef struct knot_lmdb_db {
 	// those are static options. Set them after knot_lmdb_init().
 	unsigned maxdbs;
 	unsigned maxreaders;
+	bool group_commit; // Opt-in, ignored if MDB_RDONLY or MDB_MAPASYNC.
+
+	knot_lmdb_gc_t gc;
 
 	// those are internal options. Please don't touch them directly.
 	size_t mapsize;
@@ -150,6 +175,26 @@ int knot_lmdb_reinit(knot_lmdb_db_t *db, const char *path, size_t mapsize, unsig
  */
 int knot_lmdb_reconfigure(knot_lmdb_db_t *db, const char *path, size_t mapsize, unsigned env_flags);
 
+/*!
+ * \brief Set maximal delay of group commit sync.
+ *
+ * \param db         The DB with group commit enabled.
+ * \param delay_ms   Delay in milliseconds.
+ */
+void knot_lmdb_set_commit_delay(knot_lmdb_db_t *db, unsigned delay_ms);
+
+/*!
+ * \brief Group commit statistics.
+ *
+ * \param db             The DB.
+ * \param commits        Output: number of group-committed transactions.
+ * \param syncs          Output: number of performed syncs.
+ * \param batch_max      Output: maximal number of transactions synced at once.
+ * \param latency_us     Output: average commit latency in microseconds.
+ */
+void knot_lmdb_commit_stats(knot_lmdb_db_t *db, uint64_t *commits, uint64_t *syncs,
+                            uint64_t *batch_max, uint64_t *latency_us);
+
 /*!
  * \brief Close and de-initialise DB.
  *
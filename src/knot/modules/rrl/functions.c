@@ -131,7 +131,8 @@ rrl_table_t *rrl_create(size_t size, uint32_t instant_limit, uint32_t rate_limit
 	return rrl;
 }
 
-int rrl_query(rrl_table_t *rrl, const struct sockaddr_storage *remote, knotd_mod_t *mod)
+int rrl_query(rrl_table_t *rrl, const struct sockaddr_storage *remote, knotd_mod_t *mod,
+              uint8_t *limited_prefix)
 {
 	assert(rrl);
 	assert(remote);
@@ -192,6 +193,10 @@ int rrl_query(rrl_table_t *rrl, const struct sockaddr_storage *remote, knotd_mod
 		} while (now - log_time_orig + 1024 >= rrl->log_period + 1024);
 	}
 
+	if (limited_prefix != NULL) {
+		*limited_prefix = prefix;
+	}
+
 	return KNOT_ELIMIT;
 }
 
@@ -245,6 +250,45 @@ bool rrl_slip_roll(int n_slip)
 	}
 }
 
+bool rrl_prefix_overlap(const knotd_conf_t *range, const struct sockaddr_storage *addr,
+                        unsigned prefix)
+{
+	if (range == NULL || addr == NULL) {
+		return false;
+	}
+
+	// The first address of the prefix.
+	struct sockaddr_storage first = *addr;
+	size_t raw_len = 0;
+	uint8_t *raw = sockaddr_raw(&first, &raw_len);
+	if (raw == NULL) {
+		return false;
+	}
+	prefix = MIN(prefix, raw_len * 8);
+	for (size_t i = prefix / 8; i < raw_len; i++) {
+		raw[i] &= (i == prefix / 8) ? (uint8_t)(0xff << (8 - prefix % 8)) : 0;
+	}
+
+	for (size_t i = 0; i < range->count; i++) {
+		const knotd_conf_val_t *val = &range->multi[i];
+		if (val->addr_max.ss_family == AF_UNSPEC) {
+			// Two prefixes overlap if they match on the shorter one.
+			unsigned mask = (val->addr_mask < 0) ? raw_len * 8 : val->addr_mask;
+			if (sockaddr_net_match(addr, &val->addr, MIN(prefix, mask))) {
+				return true;
+			}
+		} else {
+			// A range and a prefix overlap if either starts in the other.
+			if (sockaddr_net_match(&val->addr, addr, prefix) ||
+			    sockaddr_range_match(&first, &val->addr, &val->addr_max)) {
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
 void rrl_destroy(rrl_table_t *rrl)
 {
 	free(rrl);
@@ -45,11 +45,13 @@ rrl_table_t *rrl_create(size_t size, uint32_t instant_limit, uint32_t rate_limit
  * \param rrl RRL table.
  * \param remote Source address.
  * \param mod Query module (needed for logging).
+ * \param limited_prefix Optional output: length of the limited address prefix.
  *
  * \retval KNOT_EOK if passed.
  * \retval KNOT_ELIMIT when the limit is reached.
  */
-int rrl_query(rrl_table_t *rrl, const struct sockaddr_storage *remote, knotd_mod_t *mod);
+int rrl_query(rrl_table_t *rrl, const struct sockaddr_storage *remote, knotd_mod_t *mod,
+              uint8_t *limited_prefix);
 
 /*!
  * \brief Update the RRL table.
@@ -71,6 +73,18 @@ void rrl_update(rrl_table_t *rrl, const struct sockaddr_storage *remote, size_t
  */
 bool rrl_slip_roll(int n_slip);
 
+/*!
+ * \brief Check if an address prefix overlaps any of the address ranges.
+ *
+ * \param range   Configured addresses, networks, or address ranges.
+ * \param addr    Address from the prefix.
+ * \param prefix  Prefix length.
+ *
+ * \return true if some address of the prefix is in the range.
+ */
+bool rrl_prefix_overlap(const knotd_conf_t *range, const struct sockaddr_storage *addr,
+                        unsigned prefix);
+
 /*!
  * \brief Destroy RRL table.
  *
@@ -28,6 +28,7 @@
 #define MOD_WHITELIST		"\x09""whitelist"
 #define MOD_LOG_PERIOD		"\x0A""log-period"
 #define MOD_DRY_RUN		"\x07""dry-run"
+#define MOD_XDP_BLOCK		"\x09""xdp-block"
 
 const yp_item_t rrl_conf[] = {
 	{ MOD_INST_LIMIT,    YP_TINT, YP_VINT = { 1,  (1ll << 32) / 768 - 1, 50 } },
@@ -39,6 +40,7 @@ const yp_item_t rrl_conf[] = {
 	{ MOD_WHITELIST,     YP_TNET, YP_VNONE, YP_FMULTI },
 	{ MOD_LOG_PERIOD,    YP_TINT, YP_VINT = { 0, INT32_MAX, 0 } },
 	{ MOD_DRY_RUN,       YP_TBOOL, YP_VNONE },
+	{ MOD_XDP_BLOCK,     YP_TINT, YP_VINT = { 0, 3600, 0, YP_STIME } },
 	{ NULL }
 };
 
@@ -74,6 +76,7 @@ typedef struct {
 	thrd_ctx_t *thrd_ctx;
 	int slip;
 	bool dry_run;
+	uint32_t xdp_block; // In milliseconds.
 	knotd_conf_t whitelist;
 } rrl_ctx_t;
 
@@ -104,7 +107,7 @@ static knotd_proto_state_t protolimit_start(knotd_proto_state_t state,
 	}
 
 	// Check if the packet is limited.
-	if (rrl_query(ctx->time_table, params->remote, mod) != KNOT_EOK) {
+	if (rrl_query(ctx->time_table, params->remote, mod, NULL) != KNOT_EOK) {
 		thrd->skip = true;
 		knotd_mod_stats_incr(mod, params->thread_id, 2, 0, 1);
 		return ctx->dry_run ? state : KNOTD_PROTO_STATE_BLOCK;
@@ -171,11 +174,19 @@ static knotd_state_t ratelimit_apply(knotd_state_t state, knot_pkt_t *pkt,
 		return state;
 	}
 
-	if (rrl_query(ctx->rate_table, knotd_qdata_remote_addr(qdata), mod) == KNOT_EOK) {
+	uint8_t prefix = 0;
+	if (rrl_query(ctx->rate_table, knotd_qdata_remote_addr(qdata), mod, &prefix) == KNOT_EOK) {
 		// Rate limiting not applied.
 		return state;
 	}
 
+	// Let the XDP program handle the following queries from the prefix,
+	// unless the block would also cover some whitelisted client.
+	if (ctx->xdp_block > 0 && !ctx->dry_run && qdata->params->xdp_msg != NULL &&
+	    !rrl_prefix_overlap(&ctx->whitelist, qdata->params->remote, prefix)) {
+		(void)knotd_qdata_xdp_block(qdata, prefix, ctx->xdp_block, ctx->slip);
+	}
+
 	if (rrl_slip_roll(ctx->slip)) {
 		// Slip the answer.
 		knotd_mod_stats_incr(mod, qdata->params->thread_id, 0, 0, 1);
@@ -227,6 +238,12 @@ int rrl_load(knotd_mod_t *mod)
 			return KNOT_ENOMEM;
 		}
 		ctx->slip = knotd_conf_mod(mod, MOD_SLIP).single.integer;
+		ctx->xdp_block = knotd_conf_mod(mod, MOD_XDP_BLOCK).single.integer * 1000;
+		// The block is server-wide, thus not applicable to a zone module.
+		if (ctx->xdp_block > 0 && knotd_mod_zone(mod) != NULL) {
+			knotd_mod_log(mod, LOG_WARNING, "option 'xdp-block' is ignored in a zone module");
+			ctx->xdp_block = 0;
+		}
 	}
 
 	uint32_t time_limit = knotd_conf_mod(mod, MOD_T_RATE_LIMIT).single.integer;
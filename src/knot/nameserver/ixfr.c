@@ -199,9 +199,7 @@ static int ixfr_answer_init(knotd_qdata_t *qdata, uint32_t *serial_from)
 		return KNOT_EAGAIN;
 	}
 
-	conf_val_t provide = conf_zone_get(conf(), C_PROVIDE_IXFR,
-	                                   qdata->extra->zone->name);
-	if (!conf_bool(&provide)) {
+	if (!zone_conf_cache(conf(), qdata->extra->zone).provide_ixfr) {
 		return KNOT_ENOTSUP;
 	}
 
@@ -14,6 +14,7 @@
     along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include <string.h>
 #include <urcu.h>
 
 #include "libdnssec/tsig.h"
@@ -100,6 +101,7 @@ static int process_query_reset(knot_layer_t *ctx)
 	/* Free allocated data. */
 	knot_rrset_clear(&qdata->opt_rr, qdata->mm);
 	ptrlist_free(&extra->wildcards, qdata->mm);
+	mm_free(qdata->mm, qdata->sign.tsig_key.secret.data);
 	nsec_clear_rrsigs(qdata);
 	if (extra->ext_cleanup != NULL) {
 		extra->ext_cleanup(qdata);
@@ -151,6 +153,13 @@ static knot_layer_state_t query_internet(knot_pkt_t *pkt, knot_layer_t *ctx)
 {
 	knotd_qdata_t *data = QUERY_DATA(ctx);
 
+	/* Early data can be replayed, allow only idempotent queries. */
+	if ((data->params->flags & KNOTD_QUERY_FLAG_EARLY_DATA) &&
+	    data->type != KNOTD_QUERY_TYPE_NORMAL) {
+		data->rcode = KNOT_RCODE_REFUSED;
+		return KNOT_STATE_FAIL;
+	}
+
 	switch (data->type) {
 	case KNOTD_QUERY_TYPE_NORMAL: return internet_process_query(pkt, data);
 	case KNOTD_QUERY_TYPE_NOTIFY: return notify_process_query(pkt, data);
@@ -725,9 +734,16 @@ bool process_query_acl_check(conf_t *conf, acl_action_t action,
 		automatic = allowed;
 	}
 	if (!allowed) {
-		conf_val_t acl = conf_zone_get(conf, C_ACL, zone_name);
-		allowed = acl_allowed(conf, &acl, action, query_source, &tsig,
-		                      zone_name, query, tls_session);
+		/* Prefer the ACL compiled upon the zone database reload. */
+		const acl_compiled_t *compiled = rcu_dereference(qdata->extra->zone->acl);
+		if (compiled != NULL) {
+			allowed = acl_compiled_allowed(compiled, action, query_source, &tsig,
+			                               zone_name, query, tls_session);
+		} else {
+			conf_val_t acl = conf_zone_get(conf, C_ACL, zone_name);
+			allowed = acl_allowed(conf, &acl, action, query_source, &tsig,
+			                      zone_name, query, tls_session);
+		}
 	}
 
 	if (log_enabled_debug()) {
@@ -770,8 +786,18 @@ bool process_query_acl_check(conf_t *conf, acl_action_t action,
 		return false;
 	}
 
-	/* Remember used TSIG key (can be empty when DDNS forwarding). */
+	/* Remember used TSIG key (can be empty when DDNS forwarding). The secret
+	 * is copied as the ACL (or configuration) it points to can be replaced
+	 * while a multi-message response is still being signed. */
 	if (tsig.secret.size > 0) {
+		uint8_t *secret = mm_alloc(qdata->mm, tsig.secret.size);
+		if (secret == NULL) {
+			qdata->rcode = KNOT_RCODE_SERVFAIL;
+			qdata->rcode_tsig = KNOT_RCODE_NOERROR;
+			return false;
+		}
+		memcpy(secret, tsig.secret.data, tsig.secret.size);
+		tsig.secret.data = secret;
 		qdata->sign.tsig_key = tsig;
 	}
 
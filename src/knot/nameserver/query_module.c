@@ -31,6 +31,7 @@
 #include "knot/dnssec/zone-sign.h"
 #include "knot/nameserver/query_module.h"
 #include "knot/nameserver/process_query.h"
+#include "knot/server/xdp-handler.h"
 
 _public_
 int knotd_conf_check_ref(knotd_conf_check_args_t *args)
@@ -637,6 +638,35 @@ uint32_t knotd_qdata_rtt(knotd_qdata_t *qdata)
 	}
 }
 
+_public_
+int knotd_qdata_xdp_block(knotd_qdata_t *qdata, unsigned prefix, uint32_t duration,
+                          uint16_t slip)
+{
+	if (qdata == NULL) {
+		return KNOT_EINVAL;
+	}
+
+#ifdef ENABLE_XDP
+	if (qdata->params->xdp_msg == NULL ||
+	    qdata->params->proto != KNOTD_QUERY_PROTO_UDP) {
+		return KNOT_ENOTSUP;
+	}
+
+	server_t *server = qdata->params->server;
+	if (server->xdp_blocks == NULL) {
+		return KNOT_ENOTSUP;
+	}
+
+	return xdp_blocks_push(server->xdp_blocks, qdata->params->remote,
+	                       prefix, duration, slip);
+#else
+	(void)prefix;
+	(void)duration;
+	(void)slip;
+	return KNOT_ENOTSUP;
+#endif
+}
+
 _public_
 const knot_dname_t *knotd_qdata_zone_name(const knotd_qdata_t *qdata)
 {
@@ -60,9 +60,17 @@ static int request_ensure_connected(knot_request_t *request, bool *reused_fd, in
 	int sock_type = use_tcp(request) ? SOCK_STREAM : SOCK_DGRAM;
 
 	if (sock_type == SOCK_STREAM) {
-		request->fd = (int)conn_pool_get(global_conn_pool,
-		                                 &request->source,
-		                                 &request->remote);
+		if (use_tls(request)) {
+			request->fd = knot_tls_req_ctx_pool_get(&request->tls_req_ctx,
+			                                        &request->source,
+			                                        &request->remote,
+			                                        request->pin,
+			                                        request->pin_len);
+		} else {
+			request->fd = (int)conn_pool_get(global_conn_pool,
+			                                 &request->source,
+			                                 &request->remote);
+		}
 		if (request->fd >= 0) {
 			if (reused_fd != NULL) {
 				*reused_fd = true;
@@ -301,7 +309,14 @@ void knot_request_free(knot_request_t *request, knot_mm_t *mm)
 		assert(0);
 #endif // ENABLE_QUIC
 	} else if (use_tls(request) && request->tls_req_ctx.conn != NULL) {
-		knot_tls_req_ctx_deinit(&request->tls_req_ctx);
+		if (request->fd >= 0 && (request->flags & KNOT_REQUEST_KEEP) &&
+		    knot_tls_req_ctx_pool_put(&request->tls_req_ctx,
+		                              &request->source, &request->remote,
+		                              request->pin, request->pin_len)) {
+			request->fd = -1; // Owned by the pool now.
+		} else {
+			knot_tls_req_ctx_deinit(&request->tls_req_ctx);
+		}
 	} else {
 		assert(request->quic_ctx == NULL);
 		assert(request->quic_conn == NULL);
@@ -415,6 +430,8 @@ static int request_produce(knot_requestor_t *req, knot_request_t *last,
 		}
 		if (last->flags & KNOT_REQUEST_QUIC) {
 			req->layer.flags |= KNOT_REQUESTOR_QUIC;
+		} else if (last->flags & KNOT_REQUEST_UDP) {
+			req->layer.flags |= KNOT_REQUESTOR_UDP;
 		}
 		if (last->flags & KNOT_REQUEST_TLS) {
 			req->layer.flags |= KNOT_REQUESTOR_TLS;
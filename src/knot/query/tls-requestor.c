@@ -14,7 +14,9 @@
     along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include <stdlib.h>
 #include <string.h>
+#include <unistd.h>
 
 #include "knot/query/tls-requestor.h"
 #include "knot/query/requestor.h"
@@ -85,3 +87,80 @@ void knot_tls_req_ctx_deinit(knot_tls_req_ctx_t *ctx)
 		memset(ctx, 0, sizeof(*ctx));
 	}
 }
+
+/*! \brief Pooled TLS connection with the peer pin it was established with. */
+typedef struct {
+	knot_tls_req_ctx_t ctx;
+	size_t pin_len;
+	uint8_t pin[];
+} pooled_ctx_t;
+
+int knot_tls_req_ctx_pool_get(knot_tls_req_ctx_t *ctx,
+                              const struct sockaddr_storage *local,
+                              const struct sockaddr_storage *remote,
+                              const uint8_t *pin, size_t pin_len)
+{
+	while (true) {
+		intptr_t ptr = conn_pool_get(global_tls_conn_pool, local, remote);
+		if (ptr == CONN_POOL_FD_INVALID) {
+			return -1;
+		}
+
+		// The same address may be configured for remotes with different pins.
+		pooled_ctx_t *pooled = (pooled_ctx_t *)ptr;
+		if (pooled->pin_len != pin_len ||
+		    (pin_len > 0 && memcmp(pooled->pin, pin, pin_len) != 0)) {
+			knot_tls_req_ctx_pool_close_cb(ptr);
+			continue;
+		}
+
+		*ctx = pooled->ctx;
+		free(pooled);
+
+		return ctx->conn->fd;
+	}
+}
+
+bool knot_tls_req_ctx_pool_put(knot_tls_req_ctx_t *ctx,
+                               const struct sockaddr_storage *local,
+                               const struct sockaddr_storage *remote,
+                               const uint8_t *pin, size_t pin_len)
+{
+	if (global_tls_conn_pool == NULL || ctx->conn == NULL) {
+		return false;
+	}
+
+	pooled_ctx_t *pooled = malloc(sizeof(*pooled) + pin_len);
+	if (pooled == NULL) {
+		return false;
+	}
+	pooled->ctx = *ctx;
+	pooled->pin_len = pin_len;
+	if (pin_len > 0) {
+		memcpy(pooled->pin, pin, pin_len);
+	}
+	memset(ctx, 0, sizeof(*ctx));
+
+	intptr_t tofree = conn_pool_put(global_tls_conn_pool, local, remote,
+	                                (intptr_t)pooled);
+	global_tls_conn_pool->close_cb(tofree);
+
+	return true;
+}
+
+void knot_tls_req_ctx_pool_close_cb(intptr_t ptr)
+{
+	if (ptr != CONN_POOL_FD_INVALID) {
+		pooled_ctx_t *pooled = (pooled_ctx_t *)ptr;
+		int fd = pooled->ctx.conn->fd;
+		knot_tls_req_ctx_deinit(&pooled->ctx);
+		close(fd);
+		free(pooled);
+	}
+}
+
+bool knot_tls_req_ctx_pool_invalid_cb(intptr_t ptr)
+{
+	pooled_ctx_t *pooled = (pooled_ctx_t *)ptr;
+	return conn_pool_invalid_cb_dflt(pooled->ctx.conn->fd);
+}
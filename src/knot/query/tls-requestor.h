@@ -62,3 +62,50 @@ void knot_tls_req_ctx_maint(knot_tls_req_ctx_t *ctx, struct knot_request *r);
  * \brief De-initialize TLS requestor context.
  */
 void knot_tls_req_ctx_deinit(knot_tls_req_ctx_t *ctx);
+
+/*!
+ * \brief Take an established TLS connection from the connection pool.
+ *
+ * \param ctx     Context structure to be filled.
+ * \param local   Local address of the connection.
+ * \param remote  Remote address of the connection.
+ * \param pin     Required remote certificate pin.
+ * \param pin_len Length of the pin, 0 if not required.
+ *
+ * \note Pooled connections established with another pin are closed.
+ *
+ * \return File descriptor of the reused connection, -1 if none available.
+ */
+int knot_tls_req_ctx_pool_get(knot_tls_req_ctx_t *ctx,
+                              const struct sockaddr_storage *local,
+                              const struct sockaddr_storage *remote,
+                              const uint8_t *pin, size_t pin_len);
+
+/*!
+ * \brief Put an established TLS connection to the connection pool.
+ *
+ * \note On success, the context is reset and the connection (including
+ *       its file descriptor) is owned by the pool.
+ *
+ * \param ctx     Context structure with the connection.
+ * \param local   Local address of the connection.
+ * \param remote  Remote address of the connection.
+ * \param pin     Remote certificate pin the connection was verified with.
+ * \param pin_len Length of the pin, 0 if none.
+ *
+ * \return True if the connection was handed over to the pool.
+ */
+bool knot_tls_req_ctx_pool_put(knot_tls_req_ctx_t *ctx,
+                               const struct sockaddr_storage *local,
+                               const struct sockaddr_storage *remote,
+                               const uint8_t *pin, size_t pin_len);
+
+/*!
+ * \brief Connection pool callback closing a pooled TLS connection.
+ */
+void knot_tls_req_ctx_pool_close_cb(intptr_t ptr);
+
+/*!
+ * \brief Connection pool callback detecting an unusable pooled TLS connection.
+ */
+bool knot_tls_req_ctx_pool_invalid_cb(intptr_t ptr);
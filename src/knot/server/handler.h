@@ -65,6 +65,11 @@ inline static void params_update_quic(knotd_qdata_params_t *params, uint32_t rtt
 	params->quic_conn = conn;
 	params->quic_stream = stream_id;
 	params->measured_rtt = rtt;
+	if (conn->flags & KNOT_QUIC_CONN_HANDSHAKE_DONE) {
+		params->flags &= ~KNOTD_QUERY_FLAG_EARLY_DATA;
+	} else {
+		params->flags |= KNOTD_QUERY_FLAG_EARLY_DATA;
+	}
 }
 #endif // ENABLE_QUIC
 
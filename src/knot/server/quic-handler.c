@@ -18,9 +18,12 @@
 #define __APPLE_USE_RFC_3542 // IPV6_PKTINFO
 #endif
 
+#include <errno.h>
 #include <netinet/in.h>
+#include <netinet/udp.h>
 #include <string.h>
 
+#include "contrib/atomic.h"
 #include "contrib/macros.h"
 #include "contrib/net.h"
 #include "knot/common/log.h"
@@ -33,19 +36,141 @@
 
 #define SWEEP_BUF_SIZE 4096
 
+/*! \brief Max number of QUIC packets coalesced into one UDP GSO send (kernel limit). */
+#define GSO_MAX_SEGS 64
+/*! \brief Max size of coalesced QUIC packets (UDP payload limit over IPv6). */
+#define GSO_MAX_LEN  (UINT16_MAX - 40 - 8)
+
 typedef union {
 	struct cmsghdr cmsg;
 	uint8_t buf[CMSG_SPACE(sizeof(struct in6_pktinfo))];
 } cmsg_pktinfo_t;
 
+/*! \brief Control message to fit the received IP_PKTINFO/ECN and UDP_SEGMENT. */
+typedef union {
+	struct cmsghdr cmsg;
+	uint8_t buf[CMSG_SPACE(sizeof(struct in6_pktinfo)) + CMSG_SPACE(sizeof(int)) +
+	            CMSG_SPACE(sizeof(uint16_t))];
+} cmsg_gso_t;
+
+/*! \brief Outgoing QUIC packets for one client waiting to be sent at once. */
+typedef struct {
+	struct msghdr *msg;  /*!< Reply message (remote address, control data). */
+	int *p_ecn;          /*!< ECN value in the control data. */
+	uint8_t *buf;        /*!< Buffer with the coalesced packets. */
+	size_t buf_size;     /*!< Buffer size. */
+	size_t pkt_max;      /*!< Max size of a QUIC packet. */
+	size_t used;         /*!< Size of the coalesced packets. */
+	size_t seg_size;     /*!< Size of each packet except the last one. */
+	unsigned segs;       /*!< Number of coalesced packets. */
+	uint8_t ecn;         /*!< ECN of the coalesced packets. */
+	bool closed;         /*!< No more packets can be appended. */
+} uq_gso_t;
+
+#ifdef UDP_SEGMENT
+/*! \brief Cleared if the kernel or the interface doesn't support UDP GSO. */
+static knot_atomic_bool gso_supported = true;
+#endif
+
 static void quic_log_cb(const char *line)
 {
 	log_fmt(LOG_DEBUG, LOG_SOURCE_QUIC, "QUIC, %s", line);
 }
 
+static int uq_sendmsg(int fd, struct msghdr *msg, size_t len)
+{
+	int ret = sendmsg(fd, msg, 0);
+	if (ret < 0) {
+		return knot_map_errno();
+	} else if (ret == len) {
+		return KNOT_EOK;
+	} else {
+		return KNOT_EAGAIN;
+	}
+}
+
+#ifdef UDP_SEGMENT
+static int uq_send_gso(int fd, uq_gso_t *gso)
+{
+	struct msghdr msg = *gso->msg;
+	struct iovec iov = { .iov_base = gso->buf, .iov_len = gso->used };
+	msg.msg_iov = &iov;
+	msg.msg_iovlen = 1;
+
+	// Append the segment size to the control data of the reply.
+	cmsg_gso_t ctrl = { 0 };
+	size_t ctrl_len = CMSG_ALIGN(msg.msg_controllen);
+	if (ctrl_len + CMSG_SPACE(sizeof(uint16_t)) > sizeof(ctrl)) {
+		return KNOT_ESPACE;
+	}
+	if (ctrl_len > 0) {
+		memcpy(ctrl.buf, msg.msg_control, msg.msg_controllen);
+	}
+	struct cmsghdr *cmsg = (struct cmsghdr *)(ctrl.buf + ctrl_len);
+	cmsg->cmsg_level = SOL_UDP;
+	cmsg->cmsg_type = UDP_SEGMENT;
+	cmsg->cmsg_len = CMSG_LEN(sizeof(uint16_t));
+	uint16_t seg_size = gso->seg_size;
+	memcpy(CMSG_DATA(cmsg), &seg_size, sizeof(seg_size));
+	msg.msg_control = ctrl.buf;
+	msg.msg_controllen = ctrl_len + CMSG_SPACE(sizeof(uint16_t));
+
+	return uq_sendmsg(fd, &msg, gso->used);
+}
+#endif
+
+static int uq_flush(int fd, uq_gso_t *gso)
+{
+	if (gso->segs == 0) {
+		return KNOT_EOK;
+	}
+
+	if (gso->p_ecn != NULL) {
+		*gso->p_ecn = gso->ecn; // set ECN for outgoing CMSG
+	}
+
+	int ret = KNOT_ENOTSUP;
+#ifdef UDP_SEGMENT
+	if (gso->segs > 1 && ATOMIC_GET(gso_supported)) {
+		ret = uq_send_gso(fd, gso);
+		if (ret != KNOT_EOK && ret != KNOT_EAGAIN && ret != KNOT_ESPACE &&
+		    (errno == EINVAL || errno == EIO || errno == ENOPROTOOPT)) {
+			ATOMIC_SET(gso_supported, false);
+		}
+	}
+#endif
+	if (ret != KNOT_EOK && ret != KNOT_EAGAIN) {
+		// Send the packets one by one.
+		struct iovec *iov = gso->msg->msg_iov;
+		for (size_t off = 0; off < gso->used; off += gso->seg_size) {
+			iov->iov_base = gso->buf + off;
+			iov->iov_len = MIN(gso->seg_size, gso->used - off);
+			ret = uq_sendmsg(fd, gso->msg, iov->iov_len);
+			if (ret != KNOT_EOK) {
+				break;
+			}
+		}
+	}
+
+	gso->used = 0;
+	gso->segs = 0;
+	gso->closed = false;
+
+	return ret;
+}
+
 static int uq_alloc_reply(knot_quic_reply_t *r)
 {
-	r->out_payload->iov_len = KNOT_WIRE_MAX_PKTSIZE;
+	uq_gso_t *gso = r->out_ctx;
+
+	// Flush if another packet of any size wouldn't fit.
+	if (gso->segs > 0 && (gso->closed || gso->segs == GSO_MAX_SEGS ||
+	                      gso->buf_size - gso->used < gso->pkt_max)) {
+		(void)uq_flush(*(int *)r->sock, gso);
+	}
+
+	r->out_payload->iov_base = gso->buf + gso->used;
+	r->out_payload->iov_len = gso->buf_size - gso->used;
 
 	return KNOT_EOK;
 }
@@ -53,18 +178,32 @@ static int uq_alloc_reply(knot_quic_reply_t *r)
 static int uq_send_reply(knot_quic_reply_t *r)
 {
 	int fd = *(int *)r->sock;
+	uq_gso_t *gso = r->out_ctx;
+	size_t len = r->out_payload->iov_len;
+
+	// Segments must have the same ECN and mustn't exceed the first one.
+	if (gso->segs > 0 && (len > gso->seg_size || r->ecn != gso->ecn)) {
+		uint8_t *pkt = r->out_payload->iov_base;
+		int ret = uq_flush(fd, gso);
+		if (ret != KNOT_EOK) {
+			return ret;
+		}
+		memmove(gso->buf, pkt, len);
+	}
 
-	if (r->in_ctx != NULL) {
-		*(int *)r->in_ctx = r->ecn; // set ECN for outgoing CMSG
+	if (gso->segs == 0) {
+		gso->seg_size = len;
+		gso->ecn = r->ecn;
 	}
-	int ret = sendmsg(fd, r->out_ctx, 0);
-	if (ret < 0) {
-		return knot_map_errno();
-	} else if (ret == r->out_payload->iov_len) {
-		return KNOT_EOK;
-	} else {
-		return KNOT_EAGAIN;
+	gso->used += len;
+	gso->segs++;
+
+	// A shorter packet must be the last segment.
+	if (len < gso->seg_size) {
+		gso->closed = true;
 	}
+
+	return KNOT_EOK;
 }
 
 static void uq_free_reply(knot_quic_reply_t *r)
@@ -77,6 +216,15 @@ void quic_handler(knotd_qdata_params_t *params, knot_layer_t *layer,
                   uint64_t idle_close, knot_quic_table_t *table,
                   struct iovec *rx, struct msghdr *mh_out, int *p_ecn)
 {
+	// Outgoing packets are coalesced in the reply buffer and sent at once.
+	uq_gso_t gso = {
+		.msg = mh_out,
+		.p_ecn = p_ecn,
+		.buf = mh_out->msg_iov->iov_base,
+		.buf_size = MIN(mh_out->msg_iov->iov_len, GSO_MAX_LEN),
+		.pkt_max = (table != NULL) ? table->udp_payload_limit : GSO_MAX_LEN,
+	};
+
 	knot_quic_reply_t rpl = {
 		.ip_rem = params->remote,
 		.ip_loc = params->local,
@@ -84,7 +232,7 @@ void quic_handler(knotd_qdata_params_t *params, knot_layer_t *layer,
 		.out_payload = mh_out->msg_iov,
 		.sock = &params->socket,
 		.in_ctx = p_ecn,
-		.out_ctx = mh_out,
+		.out_ctx = &gso,
 		.ecn = (p_ecn == NULL ? 0 : (*p_ecn & 0x3)),
 		.alloc_reply = uq_alloc_reply,
 		.send_reply = uq_send_reply,
@@ -108,6 +256,12 @@ void quic_handler(knotd_qdata_params_t *params, knot_layer_t *layer,
 		knot_quic_cleanup(&conn, 1);
 	}
 
+	(void)uq_flush(params->socket, &gso);
+
+	// Restore the reply buffer, everything has already been sent.
+	mh_out->msg_iov->iov_base = gso.buf;
+	mh_out->msg_iov->iov_len = 0;
+
 	(void)process_query_proto(params, KNOTD_STAGE_PROTO_END);
 }
 
@@ -40,9 +40,11 @@
 #include "knot/conf/module.h"
 #include "knot/dnssec/kasp/kasp_db.h"
 #include "knot/journal/journal_basic.h"
+#include "knot/query/tls-requestor.h"
 #include "knot/server/server.h"
 #include "knot/server/udp-handler.h"
 #include "knot/server/tcp-handler.h"
+#include "knot/server/xdp-handler.h"
 #include "knot/updates/acl.h"
 #include "knot/zone/timers.h"
 #include "knot/zone/zonedb-load.h"
@@ -155,6 +157,39 @@ static bool server_attach_reuseport_bpf(const int sock, const int sock_count)
 #endif
 }
 
+bool server_attach_quic_reuseport_bpf(const int sock, const int sock_count)
+{
+#ifdef SO_ATTACH_REUSEPORT_CBPF
+	struct sock_filter code[] = {
+		/* A = first byte of the QUIC packet. */
+		{ BPF_LD  | BPF_B | BPF_ABS, 0, 0, 0 },
+		/* Short header (form bit not set) continues at (6). */
+		{ BPF_JMP | BPF_JSET | BPF_K, 0, 4, 0x80 },
+		/* Long header: A = DCID length, fall back at (9) if too short. */
+		{ BPF_LD  | BPF_B | BPF_ABS, 0, 0, 5 },
+		{ BPF_JMP | BPF_JGE | BPF_K, 0, 5, sizeof(uint16_t) },
+		/* A = first two bytes of the DCID, continue at (7). */
+		{ BPF_LD  | BPF_H | BPF_ABS, 0, 0, 6 },
+		{ BPF_JMP | BPF_JA, 0, 0, 1 },
+		/* (6) Short header: A = first two bytes of the DCID. */
+		{ BPF_LD  | BPF_H | BPF_ABS, 0, 0, 1 },
+		/* (7) Adjust the value to socket group size and return it. */
+		{ BPF_ALU | BPF_MOD | BPF_K, 0, 0, sock_count },
+		{ BPF_RET | BPF_A, 0, 0, 0 },
+		/* (9) Out-of-range index selects the socket by the default hash. */
+		{ BPF_RET | BPF_K, 0, 0, UINT32_MAX },
+	};
+
+	struct sock_fprog prog = { 0 };
+	prog.len = sizeof(code) / sizeof(*code);
+	prog.filter = code;
+
+	return setsockopt(sock, SOL_SOCKET, SO_ATTACH_REUSEPORT_CBPF, &prog, sizeof(prog)) == 0;
+#else
+	return true;
+#endif
+}
+
 /*! \brief Set lower bound for socket option. */
 static bool setsockopt_min(int sock, int option, int min)
 {
@@ -256,8 +291,29 @@ static size_t quic_rmt_count(conf_t *conf, const yp_name_t *proto)
 }
 
 #ifdef ENABLE_XDP
+/*! \brief Check if some zone or template enables the kernel XDP answers. */
+static bool xdp_answer_configured(conf_t *conf)
+{
+	static const yp_name_t *sections[] = { C_TPL, C_ZONE };
+
+	for (size_t i = 0; i < sizeof(sections) / sizeof(sections[0]); i++) {
+		for (conf_iter_t iter = conf_iter(conf, sections[i]); iter.code == KNOT_EOK;
+		     conf_iter_next(conf, &iter)) {
+			conf_val_t id = conf_iter_id(conf, &iter);
+			conf_val_t val = conf_id_get(conf, sections[i], C_XDP_ANSWER, &id);
+			if (conf_bool(&val)) {
+				conf_iter_finish(conf, &iter);
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
 static iface_t *server_init_xdp_iface(struct sockaddr_storage *addr, bool route_check,
-                                      bool udp, bool tcp, uint16_t quic, unsigned *thread_id_start,
+                                      bool udp, bool tcp, uint16_t quic, bool answer,
+                                      unsigned *thread_id_start,
                                       const knot_xdp_config_t *xdp_config)
 {
 	conf_xdp_iface_t iface;
@@ -285,7 +341,10 @@ static iface_t *server_init_xdp_iface(struct sockaddr_storage *addr, bool route_
 	new_if->xdp_first_thread_id = *thread_id_start;
 	*thread_id_start += iface.queues;
 
-	knot_xdp_filter_flag_t xdp_flags = udp ? KNOT_XDP_FILTER_UDP : 0;
+	knot_xdp_filter_flag_t xdp_flags = udp ? (KNOT_XDP_FILTER_UDP | KNOT_XDP_FILTER_BLOCK) : 0;
+	if (udp && answer) {
+		xdp_flags |= KNOT_XDP_FILTER_ANSWER;
+	}
 	if (tcp) {
 		xdp_flags |= KNOT_XDP_FILTER_TCP;
 	}
@@ -428,8 +487,14 @@ static iface_t *server_init_iface(struct sockaddr_storage *addr, bool tls,
 			return NULL;
 		}
 
-		if ((udp_bind_flags & NET_BIND_MULTIPLE) && socket_affinity &&
-		    addr->ss_family != AF_UNIX) {
+		if ((udp_bind_flags & NET_BIND_MULTIPLE) && tls) {
+			if (!server_attach_quic_reuseport_bpf(sock, udp_socket_count) &&
+			    warn_cbpf) {
+				log_warning("cannot steer QUIC connections to their UDP workers");
+				warn_cbpf = false;
+			}
+		} else if ((udp_bind_flags & NET_BIND_MULTIPLE) && socket_affinity &&
+		           addr->ss_family != AF_UNIX) {
 			if (!server_attach_reuseport_bpf(sock, udp_socket_count) &&
 			    warn_cbpf) {
 				log_warning("cannot ensure optimal CPU locality for UDP");
@@ -631,6 +696,16 @@ static int init_creds(conf_t *conf, server_t *server)
 		}
 	}
 
+	char *ticket_file = conf_tls(conf, C_TICKET_KEY_FILE);
+	ret = knot_creds_update_ticket_key(server->quic_creds, ticket_file);
+	if (ret != KNOT_EOK) {
+		log_error(QUIC_LOG "failed to load session ticket key '%s' (%s)",
+		          ticket_file, knot_strerror(ret));
+		free(ticket_file);
+		goto failed;
+	}
+	free(ticket_file);
+
 	uint8_t pin[128];
 	size_t pin_len = server_cert_pin(server, pin, sizeof(pin));
 	if (pin_len > 0 && (pin_len != prev_pin_len || memcmp(pin, prev_pin, pin_len) != 0)) {
@@ -763,9 +838,12 @@ static int configure_sockets(conf_t *conf, server_t *s)
 		.ring_size = conf->cache.xdp_ring_size,
 		.busy_poll_budget = conf->cache.xdp_busypoll_budget,
 		.busy_poll_timeout = conf->cache.xdp_busypoll_timeout,
+		.tx_multi_buffer = conf->cache.xdp_tx_multi_buffer,
 	};
 	unsigned thread_id = s->handlers[IO_UDP].handler.unit->size +
 	                     s->handlers[IO_TCP].handler.unit->size;
+	// Spare the answer map lookup of each query if no kernel answers are used.
+	bool xdp_answer = lisxdp_val.code == KNOT_EOK && xdp_answer_configured(conf);
 	while (lisxdp_val.code == KNOT_EOK) {
 		struct sockaddr_storage addr = conf_addr(&lisxdp_val, NULL);
 		char addr_str[SOCKADDR_STRLEN] = { 0 };
@@ -774,8 +852,8 @@ static int configure_sockets(conf_t *conf, server_t *s)
 
 		iface_t *new_if = server_init_xdp_iface(&addr, conf->cache.xdp_route_check,
 		                                        conf->cache.xdp_udp, conf->cache.xdp_tcp,
-		                                        conf->cache.xdp_quic, &thread_id,
-		                                        &xdp_config);
+		                                        conf->cache.xdp_quic, xdp_answer,
+		                                        &thread_id, &xdp_config);
 		if (new_if == NULL) {
 			server_deinit_iface_list(newlist, nifs);
 			return KNOT_ERROR;
@@ -856,7 +934,10 @@ int server_init(server_t *server, int bg_workers)
 	char *journal_dir = conf_db(conf(), C_JOURNAL_DB);
 	conf_val_t journal_size = conf_db_param(conf(), C_JOURNAL_DB_MAX_SIZE);
 	conf_val_t journal_mode = conf_db_param(conf(), C_JOURNAL_DB_MODE);
+	conf_val_t journal_delay = conf_db_param(conf(), C_JOURNAL_DB_COMMIT_DELAY);
 	knot_lmdb_init(&server->journaldb, journal_dir, conf_int(&journal_size), journal_env_flags(conf_opt(&journal_mode), false), NULL);
+	server->journaldb.group_commit = (conf_int(&journal_delay) > 0);
+	knot_lmdb_set_commit_delay(&server->journaldb, conf_int(&journal_delay));
 	free(journal_dir);
 
 	kasp_db_ensure_init(&server->kaspdb, conf());
@@ -866,6 +947,11 @@ int server_init(server_t *server, int bg_workers)
 	knot_lmdb_init(&server->timerdb, timer_dir, conf_int(&timer_size), 0, NULL);
 	free(timer_dir);
 
+#ifdef ENABLE_XDP
+	/* Optional, the modules just can't block clients in XDP if missing. */
+	server->xdp_blocks = xdp_blocks_new();
+#endif
+
 	return KNOT_EOK;
 }
 
@@ -902,6 +988,11 @@ void server_deinit(server_t *server)
 	/* Deinit locks. */
 	pthread_rwlock_destroy(&server->ctl_lock);
 
+#ifdef ENABLE_XDP
+	/* Free pending XDP client blocks. */
+	xdp_blocks_free(server->xdp_blocks);
+#endif
+
 	/* Free catalog zone context. */
 	catalog_update_clear(&server->catalog_upd);
 	catalog_update_deinit(&server->catalog_upd);
@@ -919,6 +1010,8 @@ void server_deinit(server_t *server)
 	/* Close and deinit connection pool. */
 	conn_pool_deinit(global_conn_pool);
 	global_conn_pool = NULL;
+	conn_pool_deinit(global_tls_conn_pool);
+	global_tls_conn_pool = NULL;
 	conn_pool_deinit(global_sessticket_pool);
 	global_sessticket_pool = NULL;
 	knot_unreachables_deinit(&global_unreachables);
@@ -1200,6 +1293,7 @@ static void warn_server_reconfigure(conf_t *conf, server_t *server)
 	static bool warn_ring_size = true;
 	static bool warn_busypoll_budget = true;
 	static bool warn_busypoll_timeout = true;
+	static bool warn_tx_multi_buffer = true;
 	static bool warn_rmt_pool_limit = true;
 
 	if (warn_tcp_reuseport && conf->cache.srv_tcp_reuseport != conf_get_bool(conf, C_SRV, C_TCP_REUSEPORT)) {
@@ -1273,6 +1367,11 @@ static void warn_server_reconfigure(conf_t *conf, server_t *server)
 		warn_busypoll_timeout = false;
 	}
 
+	if (warn_tx_multi_buffer && conf->cache.xdp_tx_multi_buffer != conf_get_bool(conf, C_XDP, C_TX_MULTI_BUFFER)) {
+		log_warning(msg, &C_TX_MULTI_BUFFER[1]);
+		warn_tx_multi_buffer = false;
+	}
+
 	if (warn_rmt_pool_limit && global_conn_pool != NULL &&
 	    global_conn_pool->capacity != conf_get_int(conf, C_SRV, C_RMT_POOL_LIMIT)) {
 		log_warning(msg, &C_RMT_POOL_LIMIT[1]);
@@ -1280,6 +1379,23 @@ static void warn_server_reconfigure(conf_t *conf, server_t *server)
 	}
 }
 
+static bool reload_diff(conf_t *new_conf)
+{
+	conf_val_t val = conf_get(new_conf, C_SRV, C_INCR_RELOAD);
+	if (!conf_bool(&val)) {
+		return false;
+	}
+
+	int ret = conf_io_diff_reload(conf(), new_conf);
+	if (ret != KNOT_EOK) {
+		log_warning("failed to compare configurations, reloading all (%s)",
+		            knot_strerror(ret));
+		return false;
+	}
+
+	return true;
+}
+
 int server_reload(server_t *server, reload_t mode)
 {
 	if (server == NULL) {
@@ -1307,6 +1423,7 @@ int server_reload(server_t *server, reload_t mode)
 	yp_flag_t flags = conf()->io.flags;
 	bool full = !(flags & CONF_IO_FACTIVE);
 	bool reuse_modules = !full && !(flags & CONF_IO_FRLD_MOD);
+	bool diff = false;
 
 	/* Reload configuration and modules if full reload or a module change. */
 	if (full || !reuse_modules) {
@@ -1317,12 +1434,25 @@ int server_reload(server_t *server, reload_t mode)
 			return ret;
 		}
 
-		conf_activate_modules(new_conf, server, NULL, new_conf->query_modules,
-		                      &new_conf->query_plan);
+		/* Limit the full reload to the configuration changes if enabled. */
+		if (full && reload_diff(new_conf)) {
+			flags = new_conf->io.flags;
+			full = false;
+			diff = true;
+			reuse_modules = !(flags & CONF_IO_FRLD_MOD);
+		}
+
+		if (reuse_modules) {
+			/* Keep the running modules instead of the just loaded ones. */
+			conf_mod_unload_shared(new_conf);
+		} else {
+			conf_activate_modules(new_conf, server, NULL, new_conf->query_modules,
+			                      &new_conf->query_plan);
+		}
 	}
 
 	conf_update_flag_t upd_flags = CONF_UPD_FNOFREE;
-	if (!full) {
+	if (!full && !diff) {
 		upd_flags |= CONF_UPD_FCONFIO;
 	}
 	if (reuse_modules) {
@@ -1342,7 +1472,12 @@ int server_reload(server_t *server, reload_t mode)
 		stats_reconfigure(conf(), server);
 	}
 	if (full || (flags & (CONF_IO_FRLD_ZONES | CONF_IO_FRLD_ZONE))) {
-		server_update_zones(conf(), server, mode);
+		/* The compared reload is processed like a configuration commit: the
+		 * changed zones are re-created and reloaded from their zone files,
+		 * the unchanged ones are kept without checking their zone files. */
+		server_update_zones(conf(), server, diff ? RELOAD_COMMIT : mode);
+	} else if (flags & CONF_IO_FRLD_ACL) {
+		zonedb_update_confs(conf(), server);
 	}
 
 	/* Free old config needed for module unload in zone reload. */
@@ -1351,11 +1486,18 @@ int server_reload(server_t *server, reload_t mode)
 	if (full) {
 		log_info("configuration reloaded");
 	} else {
+		if (diff) {
+			log_info("configuration reloaded, %zu zones changed",
+			         (conf()->io.zones != NULL) ? trie_weight(conf()->io.zones) : 0);
+		}
 		// Reset confio reload context.
 		conf()->io.flags = YP_FNONE;
 		if (conf()->io.zones != NULL) {
 			trie_clear(conf()->io.zones);
 		}
+		if (conf()->io.refs != NULL) {
+			trie_clear(conf()->io.refs);
+		}
 	}
 
 	systemd_ready_notify();
@@ -1419,6 +1561,9 @@ static int reconfigure_journal_db(conf_t *conf, server_t *server)
 	}
 	free(journal_dir);
 
+	conf_val_t journal_delay = conf_db_param(conf, C_JOURNAL_DB_COMMIT_DELAY);
+	knot_lmdb_set_commit_delay(&server->journaldb, conf_int(&journal_delay));
+
 	return KNOT_EOK; // not "ret"
 }
 
@@ -1469,6 +1614,18 @@ static int reconfigure_remote_pool(conf_t *conf, server_t *server)
 		(void)conn_pool_timeout(global_conn_pool, timeout);
 	}
 
+	if (global_tls_conn_pool == NULL && limit > 0 && server->tls_active) {
+		conn_pool_t *new_pool = conn_pool_init(limit, timeout,
+		                                       knot_tls_req_ctx_pool_close_cb,
+		                                       knot_tls_req_ctx_pool_invalid_cb);
+		if (new_pool == NULL) {
+			return KNOT_ENOMEM;
+		}
+		global_tls_conn_pool = new_pool;
+	} else {
+		(void)conn_pool_timeout(global_tls_conn_pool, timeout);
+	}
+
 	if (global_sessticket_pool == NULL && (server->quic_active || server->tls_active)) {
 		size_t rmt_count = quic_rmt_count(conf, C_QUIC) + quic_rmt_count(conf, C_TLS);
 		if (rmt_count > 0) {
@@ -1610,3 +1767,125 @@ size_t server_cert_pin(server_t *server, uint8_t *out, size_t out_size)
 
 	return (pin_size >= 0) ? pin_size : 0;
 }
+
+#ifdef ENABLE_XDP
+static int xdp_answer_build(const zone_contents_t *contents, uint16_t type,
+                            uint8_t *wire, size_t *len)
+{
+	knot_rrset_t rrset = node_rrset(contents->apex, type);
+	if (knot_rrset_empty(&rrset)) {
+		return KNOT_ENOENT;
+	}
+
+	// Leave space for the OPT record appended by the library.
+	knot_pkt_t *pkt = knot_pkt_new(wire, KNOT_WIRE_MIN_PKTSIZE - KNOT_XDP_ANSWER_OPT_LEN, NULL);
+	if (pkt == NULL) {
+		return KNOT_ENOMEM;
+	}
+
+	int ret = knot_pkt_put_question(pkt, contents->apex->owner, KNOT_CLASS_IN, type);
+	if (ret == KNOT_EOK) {
+		knot_wire_set_qr(pkt->wire);
+		knot_wire_set_aa(pkt->wire);
+		ret = knot_pkt_begin(pkt, KNOT_ANSWER);
+	}
+	if (ret == KNOT_EOK) {
+		ret = knot_pkt_put(pkt, KNOT_COMPR_HINT_QNAME, &rrset, 0);
+	}
+
+	// Add the optional glue as the server does, as much as fits.
+	if (ret == KNOT_EOK && rrset.additional != NULL) {
+		ret = knot_pkt_begin(pkt, KNOT_ADDITIONAL);
+		const additional_t *additional = rrset.additional;
+		for (uint16_t i = 0; i < additional->count && ret == KNOT_EOK; i++) {
+			const zone_node_t *node = glue_node(&additional->glues[i], contents->apex);
+			knot_rrset_t glue = node_rrset(node, KNOT_RRTYPE_A);
+			if (!knot_rrset_empty(&glue)) {
+				ret = knot_pkt_put(pkt, KNOT_COMPR_HINT_NONE, &glue, KNOT_PF_NOTRUNC);
+			}
+			glue = node_rrset(node, KNOT_RRTYPE_AAAA);
+			if (ret == KNOT_EOK && !knot_rrset_empty(&glue)) {
+				ret = knot_pkt_put(pkt, KNOT_COMPR_HINT_NONE, &glue, KNOT_PF_NOTRUNC);
+			}
+		}
+		if (ret == KNOT_ESPACE) {
+			ret = KNOT_EOK;
+		}
+	}
+	*len = pkt->size;
+
+	knot_pkt_free(pkt);
+	return ret;
+}
+#endif
+
+void server_update_xdp_answers(conf_t *conf, server_t *server, zone_t *zone,
+                               const zone_contents_t *contents)
+{
+#ifdef ENABLE_XDP
+	if (server == NULL || zone == NULL) {
+		return;
+	}
+
+	bool enable = false;
+	if (conf != NULL && contents != NULL) {
+		conf_val_t val = conf_zone_get(conf, C_XDP_ANSWER, zone->name);
+		enable = conf_bool(&val);
+	}
+	if (!enable) {
+		if (!zone_get_flag(zone, ZONE_XDP_ANSWERS, false)) {
+			return;
+		}
+		contents = NULL;
+	}
+
+	static const uint16_t types[] = {
+		KNOT_RRTYPE_SOA, KNOT_RRTYPE_NS, KNOT_RRTYPE_A, KNOT_RRTYPE_AAAA
+	};
+
+	uint16_t edns_payload = enable ? MIN(conf->cache.srv_udp_max_payload_ipv4,
+	                                     conf->cache.srv_udp_max_payload_ipv6) : 0;
+
+	bool stored = false;
+	for (const iface_t *i = server->ifaces;
+	     i != server->ifaces + server->n_ifaces; i++) {
+		if (i->fd_xdp_count == 0) {
+			continue;
+		}
+		// The answer map is shared by all the queues of the interface.
+		knot_xdp_socket_t *sock = i->xdp_sockets[0];
+
+		for (size_t j = 0; j < sizeof(types) / sizeof(types[0]); j++) {
+			uint8_t wire[KNOT_WIRE_MIN_PKTSIZE];
+			size_t len = 0;
+			int ret = KNOT_ENOENT;
+			if (contents != NULL) {
+				ret = xdp_answer_build(contents, types[j], wire, &len);
+			}
+			if (ret == KNOT_EOK) {
+				ret = knot_xdp_answer_set(sock, wire, len, edns_payload);
+			}
+			if (ret == KNOT_EOK) {
+				stored = true;
+				continue;
+			} else if (ret == KNOT_ENOTSUP) {
+				log_zone_warning(zone->name, "XDP, kernel answers not supported "
+				                 "by the loaded BPF program");
+				break;
+			}
+			(void)knot_xdp_answer_del(sock, zone->name, types[j]);
+		}
+	}
+
+	if (stored) {
+		zone_set_flag(zone, ZONE_XDP_ANSWERS);
+	} else {
+		zone_unset_flag(zone, ZONE_XDP_ANSWERS);
+	}
+#else
+	(void)conf;
+	(void)server;
+	(void)zone;
+	(void)contents;
+#endif
+}
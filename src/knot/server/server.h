@@ -133,6 +133,19 @@ typedef struct server {
 
 	/*! \brief Crendentials context for QUIC. */
 	struct knot_creds *quic_creds;
+
+	/*! \brief Pending client blocks for the XDP BPF programs. */
+	struct xdp_blocks *xdp_blocks;
+
+	/*! \brief Outgoing NOTIFY counters. */
+	struct {
+		knot_atomic_uint64_t sent;        /*!< Sent NOTIFY messages. */
+		knot_atomic_uint64_t acked;       /*!< Successfully answered NOTIFYs. */
+		knot_atomic_uint64_t failed;      /*!< Failed remote notifications. */
+		knot_atomic_uint64_t retransmits; /*!< Retransmitted unanswered NOTIFYs over UDP. */
+		knot_atomic_uint64_t retried;     /*!< Remote notifications retried after a failure. */
+		knot_atomic_uint64_t coalesced;   /*!< Skipped duplicate remote notifications. */
+	} notify_stats;
 } server_t;
 
 /*!
@@ -220,3 +233,29 @@ void server_update_zones(conf_t *conf, server_t *server, reload_t mode);
  * \return Length of the output PIN string.
  */
 size_t server_cert_pin(server_t *server, uint8_t *out, size_t out_size);
+
+/*!
+ * \brief Attach SO_REUSEPORT socket filter steering QUIC packets by DCID.
+ *
+ * Server-chosen CIDs encode the index of the owning worker in their first
+ * two bytes (see knot_quic_table_set_shard()), so all packets of a connection
+ * reach the same socket even if the client address changes. Packets without
+ * a usable DCID fall back to the default reuseport hashing.
+ *
+ * \param sock        Socket where to attach the CBPF filter to.
+ * \param sock_count  Number of sockets in the reuseport group.
+ *
+ * \return False if the filter couldn't be attached.
+ */
+bool server_attach_quic_reuseport_bpf(const int sock, const int sock_count);
+
+/*!
+ * \brief Updates the pre-built zone apex answers in the XDP answer maps.
+ *
+ * \param conf      Configuration (NULL to remove the answers).
+ * \param server    Server instance.
+ * \param zone      Zone.
+ * \param contents  Zone contents to be answered from (NULL to remove the answers).
+ */
+void server_update_xdp_answers(conf_t *conf, server_t *server, zone_t *zone,
+                               const zone_contents_t *contents);
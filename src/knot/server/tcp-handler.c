@@ -25,6 +25,9 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <urcu.h>
+#ifdef ENABLE_IO_URING
+#include <liburing.h>
+#endif // ENABLE_IO_URING
 #ifdef HAVE_SYS_UIO_H	// struct iovec (OpenBSD)
 #include <sys/uio.h>
 #endif // HAVE_SYS_UIO_H
@@ -43,6 +46,7 @@
 #include "contrib/openbsd/strlcpy.h"
 #include "contrib/sockaddr.h"
 #include "contrib/time.h"
+#include "contrib/ucw/lists.h"
 #include "contrib/ucw/mempool.h"
 
 /*! \brief TCP context data. */
@@ -58,10 +62,22 @@ typedef struct tcp_context {
 	unsigned max_worker_fds;         /*!< Max TCP clients per worker configuration + no. of ifaces. */
 	int idle_timeout;                /*!< [s] TCP idle timeout configuration. */
 	int io_timeout;                  /*!< [ms] TCP send/recv timeout configuration. */
+	int tls_hs_timeout;              /*!< [s] DoT handshake timeout. */
 	struct knot_tls_ctx *tls_ctx;    /*!< DoT answering context. */
 } tcp_context_t;
 
+/*! \brief Per-connection state kept across queries. */
+typedef struct {
+	struct sockaddr_storage remote;  /*!< Remote address. */
+	struct sockaddr_storage local;   /*!< Local address. */
+	knot_tls_conn_t *tls_conn;       /*!< DoT session. */
+} tcp_conn_t;
+
 #define TCP_SWEEP_INTERVAL 2 /*!< [secs] granularity of connection sweeping. */
+#define TCP_ACCEPT_BATCH  16 /*!< Max connections accepted per listener event. */
+
+/*! \brief DoT handshake timeout [ms], it can take up to 4 round-trips. */
+#define TLS_HS_TIMEOUT(io_timeout) (8 * (io_timeout))
 
 static void update_sweep_timer(struct timespec *timer)
 {
@@ -79,15 +95,51 @@ static void update_tcp_conf(tcp_context_t *tcp)
 	tcp->io_timeout = pconf->cache.srv_tcp_io_timeout;
 	rcu_read_unlock();
 
+	/* The handshake deadline is enforced by the watchdog (in seconds). */
+	tcp->tls_hs_timeout = MAX((TLS_HS_TIMEOUT(tcp->io_timeout) + 999) / 1000, 1);
+
 	if (tcp->tls_ctx != NULL) {
 		tcp->tls_ctx->io_timeout = tcp->io_timeout;
+		tcp->tls_ctx->handshake_timeout = TLS_HS_TIMEOUT(tcp->io_timeout);
+	}
+}
+
+static void tcp_conn_init(tcp_conn_t *conn, int fd, const struct sockaddr_storage *remote,
+                          const iface_t *iface)
+{
+	/* The addresses don't change during the connection, resolve them once. */
+	conn->local = iface->addr;
+	if (iface->anyaddr) {
+		socklen_t local_len = sizeof(conn->local);
+		if (getsockname(fd, (struct sockaddr *)&conn->local, &local_len) != 0) {
+			conn->local = iface->addr;
+		}
+	}
+
+	conn->remote = (iface->addr.ss_family != AF_UNIX) ? *remote : iface->addr;
+}
+
+static tcp_conn_t *tcp_conn_new(int fd, const struct sockaddr_storage *remote,
+                                const iface_t *iface)
+{
+	tcp_conn_t *conn = calloc(1, sizeof(*conn));
+	if (conn == NULL) {
+		return NULL;
 	}
+
+	tcp_conn_init(conn, fd, remote, iface);
+
+	return conn;
 }
 
-static void free_tls_ctx(fdset_t *set, int idx)
+static void free_conn(fdset_t *set, int idx)
 {
-	void *tls_conn = *fdset_ctx2(set, idx);
-	knot_tls_conn_del(tls_conn);
+	tcp_conn_t *conn = *fdset_ctx2(set, idx);
+	if (conn != NULL) {
+		knot_tls_conn_del(conn->tls_conn);
+		free(conn);
+		*fdset_ctx2(set, idx) = NULL;
+	}
 }
 
 /*! \brief Sweep TCP connection. */
@@ -105,7 +157,7 @@ static fdset_sweep_state_t tcp_sweep(fdset_t *set, int idx, _unused_ void *data)
 		log_notice("TCP, terminated inactive client, address %s", addr_str);
 	}
 
-	free_tls_ctx(set, idx);
+	free_conn(set, idx);
 
 	return FDSET_SWEEP;
 }
@@ -164,11 +216,15 @@ static int tcp_handle(tcp_context_t *tcp, knotd_qdata_params_t *params,
 	/* Receive data. */
 	int recv;
 	if (params->tls_conn != NULL) {
+		bool established = (params->tls_conn->flags & KNOT_TLS_CONN_HANDSHAKE_DONE);
 		int ret = knot_tls_handshake(params->tls_conn, true);
 		switch (ret) {
-		case KNOT_EAGAIN: // Unfinished handshake, continue later.
-			return KNOT_EOK;
+		case KNOT_EAGAIN: // Unfinished handshake, continue on next socket event.
+			return KNOT_EAGAIN;
 		case KNOT_EOK: // Finished handshake, continue with receiving message.
+			if (!established && !knot_tls_pending(params->tls_conn)) {
+				return KNOT_EOK; // Don't wait for the query, it triggers an event.
+			}
 			recv = knot_tls_recv_dns(params->tls_conn, rx->iov_base, rx->iov_len);
 			break;
 		default: // E.g. handshake timeout.
@@ -214,50 +270,48 @@ static int tcp_handle(tcp_context_t *tcp, knotd_qdata_params_t *params,
 
 static void tcp_event_accept(tcp_context_t *tcp, unsigned i, const iface_t *iface)
 {
-	/* Accept client. */
 	int fd = fdset_get_fd(&tcp->set, i);
-	int client = net_accept(fd, NULL);
-	if (client >= 0) {
+
+	/* Accept pending clients, but not more than configured. */
+	for (unsigned n = 0; n < TCP_ACCEPT_BATCH &&
+	     fdset_get_length(&tcp->set) < tcp->max_worker_fds; n++) {
+		struct sockaddr_storage remote;
+		int client = net_accept(fd, &remote);
+		if (client < 0) {
+			return;
+		}
+
+		tcp_conn_t *conn = tcp_conn_new(client, &remote, iface);
+		if (conn == NULL) {
+			close(client);
+			return;
+		}
+
 		/* Assign to fdset. */
 		int idx = fdset_add(&tcp->set, client, FDSET_POLLIN, (void *)iface);
 		if (idx < 0) {
+			free(conn);
 			close(client);
 			return;
 		}
+		*fdset_ctx2(&tcp->set, idx) = conn;
 
-		/* Update watchdog timer. */
-		(void)fdset_set_watchdog(&tcp->set, idx, tcp->idle_timeout);
+		/* Update watchdog timer, DoT handshake must finish in time. */
+		(void)fdset_set_watchdog(&tcp->set, idx, iface->tls ? tcp->tls_hs_timeout
+		                                                    : tcp->idle_timeout);
 	}
 }
 
 static int tcp_event_serve(tcp_context_t *tcp, unsigned i, const iface_t *iface)
 {
 	int fd = fdset_get_fd(&tcp->set, i);
-
-	/* Get local address. */
-	sockaddr_t *local = (sockaddr_t *)&iface->addr;
-	sockaddr_t local_buf;
-	if (iface->anyaddr) {
-		socklen_t local_len = sizeof(local_buf);
-		if (getsockname(fd, &local_buf.ip, &local_len) == 0) {
-			local = &local_buf;
-		}
-	}
-
-	/* Get remote address. */
-	sockaddr_t *remote = (sockaddr_t *)&iface->addr;
-	sockaddr_t remote_buf;
-	if (iface->addr.ss_family != AF_UNIX) {
-		socklen_t remote_len = sizeof(remote_buf);
-		if (getpeername(fd, &remote_buf.ip, &remote_len) == 0) {
-			remote = &remote_buf;
-		}
-	}
+	tcp_conn_t *conn = *fdset_ctx2(&tcp->set, i);
+	assert(conn != NULL);
 
 	knotd_qdata_params_t params = params_init(iface->tls ? KNOTD_QUERY_PROTO_TLS
 	                                                     : KNOTD_QUERY_PROTO_TCP,
-	                                          remote, local, fd, tcp->server,
-	                                          tcp->thread_id);
+	                                          &conn->remote, &conn->local, fd,
+	                                          tcp->server, tcp->thread_id);
 
 	// NOTE there is no way to avoid calling accept() on unwanted connections:
 	// - it's not possible to read out the remote IP beforehand
@@ -271,21 +325,27 @@ static int tcp_event_serve(tcp_context_t *tcp, unsigned i, const iface_t *iface)
 	/* Establish a TLS session. */
 	if (iface->tls) {
 		assert(tcp->tls_ctx != NULL);
-		knot_tls_conn_t *tls_conn = *fdset_ctx2(&tcp->set, i);
-		if (tls_conn == NULL) {
-			tls_conn = knot_tls_conn_new(tcp->tls_ctx, fd);
-			if (tls_conn == NULL) {
+		if (conn->tls_conn == NULL) {
+			conn->tls_conn = knot_tls_conn_new(tcp->tls_ctx, fd);
+			if (conn->tls_conn == NULL) {
 				return KNOT_ENOMEM;
 			}
-			*fdset_ctx2(&tcp->set, i) = tls_conn;
 		}
-		params_update_tls(&params, tls_conn);
+		params_update_tls(&params, conn->tls_conn);
 	}
 
-	int ret = tcp_handle(tcp, &params, &tcp->iov[0], &tcp->iov[1]);
+	/* Also serve queries already read into the TLS buffer. */
+	int ret;
+	do {
+		ret = tcp_handle(tcp, &params, &tcp->iov[0], &tcp->iov[1]);
+	} while (ret == KNOT_EOK && knot_tls_pending(conn->tls_conn));
+
 	if (ret == KNOT_EOK) {
 		/* Update socket activity timer. */
 		(void)fdset_set_watchdog(&tcp->set, i, tcp->idle_timeout);
+	} else if (ret == KNOT_EAGAIN) {
+		/* Handshake in progress, keep its deadline. */
+		ret = KNOT_EOK;
 	}
 
 	(void)process_query_proto(&params, KNOTD_STAGE_PROTO_END);
@@ -335,13 +395,606 @@ static void tcp_wait_for_events(tcp_context_t *tcp)
 
 		/* Evaluate. */
 		if (should_close) {
-			free_tls_ctx(set, idx);
+			free_conn(set, idx);
 			fdset_it_remove(&it);
 		}
 	}
 	fdset_it_commit(&it);
 }
 
+#ifdef ENABLE_IO_URING
+/*
+ * Completion-based serving of plain TCP interfaces. Each listener has a
+ * multishot accept and each connection a multishot receive into a shared
+ * ring of provided buffers. The responses of a connection are sent as
+ * a chain of linked sends, so there is at most one chain in flight per
+ * connection and the stream is never interleaved. DoT interfaces are
+ * served by the epoll loop.
+ */
+
+#define URING_ENTRIES    1024      /*!< Submission queue size. */
+#define URING_BUF_GROUP  0         /*!< Provided buffer group ID. */
+#define URING_BUF_COUNT  256       /*!< Number of provided receive buffers. */
+#define URING_BUF_SIZE   4096      /*!< Size of a provided receive buffer. */
+#define URING_CHAIN_MAX  64        /*!< Max linked sends submitted at once. */
+#define URING_QUEUE_MAX  (1 << 20) /*!< [B] Queued output per connection before waiting. */
+
+/*! \brief Request type, stored in the low bits of the request user data. */
+typedef enum {
+	URING_ACCEPT = 1,
+	URING_RECV   = 2,
+	URING_SEND   = 3,
+} uring_op_t;
+
+#define URING_DATA(ptr, op) ((uint64_t)(uintptr_t)(ptr) | (op))
+#define URING_PTR(data)     ((void *)(uintptr_t)((data) & ~(uint64_t)3))
+#define URING_OP(data)      ((uring_op_t)((data) & 3))
+
+/*! \brief Copy of a completion, the completion queue entry is released early. */
+typedef struct {
+	uint64_t user_data;
+	int32_t res;
+	uint32_t flags;
+} uring_cqe_t;
+
+typedef struct {
+	int fd;
+	const iface_t *iface;
+} uring_listener_t;
+
+typedef struct {
+	node_t n;
+	list_t sendq;           /*!< Responses to send, the first 'inflight' are submitted. */
+	tcp_conn_t addr;        /*!< Connection addresses. */
+	int fd;                 /*!< Client socket. */
+	bool receiving;         /*!< Multishot receive is armed. */
+	bool closing;           /*!< Connection is being closed. */
+	unsigned inflight;      /*!< Number of submitted sends. */
+	size_t queued;          /*!< [B] Size of all responses in the send queue. */
+	size_t rx_len;          /*!< Length of the incomplete message. */
+	uint8_t *rx;            /*!< Incomplete message including its length. */
+	time_t last_active;     /*!< Time of the last socket activity. */
+} uring_conn_t;
+
+typedef struct {
+	node_t n;
+	uring_conn_t *conn;
+	size_t len;
+	uint8_t data[];         /*!< Message prefixed with its length. */
+} uring_send_t;
+
+typedef struct {
+	struct io_uring ring;
+	struct io_uring_buf_ring *br;
+	uint8_t *bufs;                   /*!< Provided receive buffers. */
+	uring_listener_t *listeners;
+	unsigned n_listeners;
+	list_t conns;
+	unsigned n_conns;
+	uring_cqe_t *deferred;           /*!< Completions postponed while waiting for sends. */
+	size_t n_deferred;
+	size_t max_deferred;
+} tcp_uring_t;
+
+static struct io_uring_sqe *uring_sqe(tcp_uring_t *u)
+{
+	struct io_uring_sqe *sqe = io_uring_get_sqe(&u->ring);
+	if (sqe == NULL) {
+		(void)io_uring_submit(&u->ring);
+		sqe = io_uring_get_sqe(&u->ring);
+	}
+	assert(sqe != NULL);
+	return sqe;
+}
+
+static void uring_arm_accept(tcp_uring_t *u, uring_listener_t *l)
+{
+	struct io_uring_sqe *sqe = uring_sqe(u);
+	io_uring_prep_multishot_accept(sqe, l->fd, NULL, NULL, 0);
+	io_uring_sqe_set_data64(sqe, URING_DATA(l, URING_ACCEPT));
+}
+
+static void uring_arm_recv(tcp_uring_t *u, uring_conn_t *conn)
+{
+	struct io_uring_sqe *sqe = uring_sqe(u);
+	io_uring_prep_recv_multishot(sqe, conn->fd, NULL, 0, 0);
+	sqe->flags |= IOSQE_BUFFER_SELECT;
+	sqe->buf_group = URING_BUF_GROUP;
+	io_uring_sqe_set_data64(sqe, URING_DATA(conn, URING_RECV));
+	conn->receiving = true;
+}
+
+static void uring_buf_recycle(tcp_uring_t *u, unsigned bid)
+{
+	io_uring_buf_ring_add(u->br, u->bufs + bid * URING_BUF_SIZE, URING_BUF_SIZE,
+	                      bid, io_uring_buf_ring_mask(URING_BUF_COUNT), 0);
+	io_uring_buf_ring_advance(u->br, 1);
+}
+
+static void uring_send_flush(tcp_uring_t *u, uring_conn_t *conn)
+{
+	if (conn->inflight > 0 || conn->closing || EMPTY_LIST(conn->sendq)) {
+		return;
+	}
+
+	/* A link chain must not be split into more submissions. */
+	if (io_uring_sq_space_left(&u->ring) < URING_CHAIN_MAX) {
+		(void)io_uring_submit(&u->ring);
+	}
+
+	struct io_uring_sqe *sqe = NULL;
+	uring_send_t *s;
+	WALK_LIST(s, conn->sendq) {
+		if (conn->inflight == URING_CHAIN_MAX) {
+			break;
+		}
+		if (sqe != NULL) {
+			sqe->flags |= IOSQE_IO_LINK;
+		}
+		sqe = uring_sqe(u);
+		io_uring_prep_send(sqe, conn->fd, s->data, s->len, MSG_WAITALL | MSG_NOSIGNAL);
+		io_uring_sqe_set_data64(sqe, URING_DATA(s, URING_SEND));
+		conn->inflight++;
+	}
+}
+
+static void uring_conn_release(tcp_uring_t *u, uring_conn_t *conn)
+{
+	if (!conn->closing || conn->receiving || conn->inflight > 0) {
+		return;
+	}
+
+	uring_send_t *s, *nxt;
+	WALK_LIST_DELSAFE(s, nxt, conn->sendq) {
+		free(s);
+	}
+	close(conn->fd);
+	rem_node(&conn->n);
+	u->n_conns--;
+	free(conn->rx);
+	free(conn);
+}
+
+/*! \brief Start closing, the connection is freed with its last completion. */
+static void uring_conn_close(uring_conn_t *conn)
+{
+	if (!conn->closing) {
+		conn->closing = true;
+		/* Terminates the pending receive and sends. */
+		(void)shutdown(conn->fd, SHUT_RDWR);
+	}
+}
+
+static void uring_on_send(tcp_uring_t *u, uring_send_t *s, const uring_cqe_t *cqe)
+{
+	uring_conn_t *conn = s->conn;
+	bool sent = (cqe->res >= 0 && (size_t)cqe->res == s->len);
+
+	rem_node(&s->n);
+	conn->queued -= s->len;
+	conn->inflight--;
+	free(s);
+
+	if (!sent) {
+		tcp_log_error(&conn->addr.remote, "send",
+		              (cqe->res == -ETIMEDOUT) ? KNOT_ETIMEOUT : KNOT_ECONN);
+		uring_conn_close(conn);
+	} else {
+		conn->last_active = time_now().tv_sec;
+		uring_send_flush(u, conn);
+	}
+
+	uring_conn_release(u, conn);
+}
+
+static bool uring_defer(tcp_uring_t *u, const uring_cqe_t *cqe)
+{
+	if (u->n_deferred == u->max_deferred) {
+		size_t max = MAX(2 * u->max_deferred, 64);
+		uring_cqe_t *deferred = realloc(u->deferred, max * sizeof(*deferred));
+		if (deferred == NULL) {
+			return false;
+		}
+		u->deferred = deferred;
+		u->max_deferred = max;
+	}
+
+	u->deferred[u->n_deferred++] = *cqe;
+	return true;
+}
+
+/*!
+ * \brief Wait until the connection's send queue gets below the limit.
+ *
+ * Other than send completions are deferred, the response processing
+ * can't be reentered.
+ */
+static void uring_wait_sent(tcp_context_t *tcp, tcp_uring_t *u, uring_conn_t *conn)
+{
+	struct __kernel_timespec ts = {
+		.tv_sec = tcp->io_timeout / 1000,
+		.tv_nsec = (tcp->io_timeout % 1000) * 1000000
+	};
+
+	while (conn->queued >= URING_QUEUE_MAX && !conn->closing) {
+		uring_send_flush(u, conn);
+
+		struct io_uring_cqe *cqe;
+		int ret = io_uring_submit_and_wait_timeout(&u->ring, &cqe, 1,
+		                                           (tcp->io_timeout > 0) ? &ts : NULL,
+		                                           NULL);
+		if (ret == -ETIME) {
+			tcp_log_error(&conn->addr.remote, "send", KNOT_ETIMEOUT);
+			uring_conn_close(conn);
+			break;
+		} else if (ret < 0 && ret != -EINTR) {
+			uring_conn_close(conn);
+			break;
+		}
+
+		while (io_uring_peek_cqe(&u->ring, &cqe) == 0) {
+			uring_cqe_t copy = { cqe->user_data, cqe->res, cqe->flags };
+			if (URING_OP(copy.user_data) != URING_SEND && !uring_defer(u, &copy)) {
+				/* Leave the completion for the main loop. */
+				uring_conn_close(conn);
+				return;
+			}
+			io_uring_cqe_seen(&u->ring, cqe);
+			if (URING_OP(copy.user_data) == URING_SEND) {
+				uring_on_send(u, URING_PTR(copy.user_data), &copy);
+			}
+		}
+	}
+}
+
+static int uring_send_queue(tcp_context_t *tcp, tcp_uring_t *u, uring_conn_t *conn,
+                            const uint8_t *wire, size_t len)
+{
+	uring_send_t *s = malloc(sizeof(*s) + sizeof(uint16_t) + len);
+	if (s == NULL) {
+		return KNOT_ENOMEM;
+	}
+	s->conn = conn;
+	s->len = sizeof(uint16_t) + len;
+	knot_wire_write_u16(s->data, len);
+	memcpy(s->data + sizeof(uint16_t), wire, len);
+
+	add_tail(&conn->sendq, &s->n);
+	conn->queued += s->len;
+
+	/* Limit the memory consumed by long responses (e.g. zone transfers). */
+	if (conn->queued >= URING_QUEUE_MAX) {
+		uring_wait_sent(tcp, u, conn);
+	}
+
+	return conn->closing ? KNOT_ECONN : KNOT_EOK;
+}
+
+static int uring_query(tcp_context_t *tcp, tcp_uring_t *u, uring_conn_t *conn,
+                       const uint8_t *msg, size_t len)
+{
+	if (len == 0) {
+		return KNOT_EMALF;
+	}
+
+	knotd_qdata_params_t params = params_init(KNOTD_QUERY_PROTO_TCP,
+	                                          &conn->addr.remote, &conn->addr.local,
+	                                          conn->fd, tcp->server, tcp->thread_id);
+	if (process_query_proto(&params, KNOTD_STAGE_PROTO_BEGIN) == KNOTD_PROTO_STATE_BLOCK) {
+		return KNOT_EDENIED;
+	}
+
+	/* The message may be in a provided buffer or in the connection one. */
+	struct iovec *rx = &tcp->iov[0], *tx = &tcp->iov[1];
+	memcpy(rx->iov_base, msg, len);
+	rx->iov_len = len;
+	tx->iov_len = KNOT_WIRE_MAX_PKTSIZE;
+
+	handle_query(&params, &tcp->layer, rx, NULL);
+
+	/* Resolve until NOOP or finished. */
+	int ret = KNOT_EOK;
+	knot_pkt_t *ans = knot_pkt_new(tx->iov_base, tx->iov_len, tcp->layer.mm);
+	while (active_state(tcp->layer.state)) {
+		knot_layer_produce(&tcp->layer, ans);
+		/* Send, if response generation passed and wasn't ignored. */
+		if (ans->size > 0 && send_state(tcp->layer.state)) {
+			ret = uring_send_queue(tcp, u, conn, ans->wire, ans->size);
+			if (ret != KNOT_EOK) {
+				break;
+			}
+		}
+	}
+
+	handle_finish(&tcp->layer);
+	uring_send_flush(u, conn);
+
+	(void)process_query_proto(&params, KNOTD_STAGE_PROTO_END);
+
+	return ret;
+}
+
+/*! \brief Split the received stream into messages and answer them. */
+static int uring_conn_input(tcp_context_t *tcp, tcp_uring_t *u, uring_conn_t *conn,
+                            const uint8_t *data, size_t len)
+{
+	while (len > 0 && !conn->closing) {
+		const uint8_t *msg;
+		size_t msg_len;
+
+		if (conn->rx_len == 0 && len >= sizeof(uint16_t) &&
+		    len >= sizeof(uint16_t) + knot_wire_read_u16(data)) {
+			/* Whole message in the received data, no copy. */
+			msg_len = knot_wire_read_u16(data);
+			msg = data + sizeof(uint16_t);
+			data += sizeof(uint16_t) + msg_len;
+			len -= sizeof(uint16_t) + msg_len;
+		} else {
+			if (conn->rx == NULL) {
+				conn->rx = malloc(sizeof(uint16_t) + KNOT_WIRE_MAX_PKTSIZE);
+				if (conn->rx == NULL) {
+					return KNOT_ENOMEM;
+				}
+			}
+
+			size_t need = (conn->rx_len < sizeof(uint16_t))
+			              ? sizeof(uint16_t) - conn->rx_len
+			              : sizeof(uint16_t) + knot_wire_read_u16(conn->rx) - conn->rx_len;
+			size_t chunk = MIN(need, len);
+			memcpy(conn->rx + conn->rx_len, data, chunk);
+			conn->rx_len += chunk;
+			data += chunk;
+			len -= chunk;
+
+			if (conn->rx_len < sizeof(uint16_t) ||
+			    conn->rx_len < sizeof(uint16_t) + knot_wire_read_u16(conn->rx)) {
+				continue;
+			}
+			msg = conn->rx + sizeof(uint16_t);
+			msg_len = conn->rx_len - sizeof(uint16_t);
+			conn->rx_len = 0;
+		}
+
+		int ret = uring_query(tcp, u, conn, msg, msg_len);
+		if (ret != KNOT_EOK) {
+			return ret;
+		}
+	}
+
+	return KNOT_EOK;
+}
+
+static void uring_on_accept(tcp_context_t *tcp, tcp_uring_t *u, uring_listener_t *l,
+                            const uring_cqe_t *cqe)
+{
+	/* The multishot accept terminates on errors, keep it armed. */
+	if (!(cqe->flags & IORING_CQE_F_MORE)) {
+		uring_arm_accept(u, l);
+	}
+
+	int client = cqe->res;
+	if (client < 0) {
+		return;
+	}
+
+	/* Don't serve more clients than configured. */
+	if (u->n_conns >= tcp->max_worker_fds - tcp->client_threshold) {
+		close(client);
+		return;
+	}
+
+	struct sockaddr_storage remote = { 0 };
+	socklen_t remote_len = sizeof(remote);
+	if (l->iface->addr.ss_family != AF_UNIX &&
+	    getpeername(client, (struct sockaddr *)&remote, &remote_len) != 0) {
+		close(client);
+		return;
+	}
+
+	uring_conn_t *conn = calloc(1, sizeof(*conn));
+	if (conn == NULL) {
+		close(client);
+		return;
+	}
+	tcp_conn_init(&conn->addr, client, &remote, l->iface);
+	conn->fd = client;
+	conn->last_active = time_now().tv_sec;
+	init_list(&conn->sendq);
+	add_tail(&u->conns, &conn->n);
+	u->n_conns++;
+
+	uring_arm_recv(u, conn);
+}
+
+static void uring_on_recv(tcp_context_t *tcp, tcp_uring_t *u, uring_conn_t *conn,
+                          const uring_cqe_t *cqe)
+{
+	if (cqe->res > 0) {
+		assert(cqe->flags & IORING_CQE_F_BUFFER);
+		unsigned bid = cqe->flags >> IORING_CQE_BUFFER_SHIFT;
+		if (!conn->closing) {
+			conn->last_active = time_now().tv_sec;
+			int ret = uring_conn_input(tcp, u, conn, u->bufs + bid * URING_BUF_SIZE,
+			                           cqe->res);
+			if (ret != KNOT_EOK) {
+				uring_conn_close(conn);
+			}
+		}
+		uring_buf_recycle(u, bid);
+
+		/* The multishot receive may terminate, e.g. on a full completion queue. */
+		if (!(cqe->flags & IORING_CQE_F_MORE)) {
+			conn->receiving = false;
+			if (!conn->closing) {
+				uring_arm_recv(u, conn);
+			}
+		}
+	} else {
+		conn->receiving = (cqe->flags & IORING_CQE_F_MORE);
+		if (cqe->res == -ENOBUFS && !conn->closing) {
+			/* All provided buffers in use, they are recycled soon. */
+			if (!conn->receiving) {
+				uring_arm_recv(u, conn);
+			}
+		} else {
+			/* Closed by the client or failed. */
+			uring_conn_close(conn);
+		}
+	}
+
+	uring_conn_release(u, conn);
+}
+
+static void uring_handle(tcp_context_t *tcp, tcp_uring_t *u, const uring_cqe_t *cqe)
+{
+	void *ptr = URING_PTR(cqe->user_data);
+	switch (URING_OP(cqe->user_data)) {
+	case URING_ACCEPT:
+		uring_on_accept(tcp, u, ptr, cqe);
+		break;
+	case URING_RECV:
+		uring_on_recv(tcp, u, ptr, cqe);
+		break;
+	case URING_SEND:
+		uring_on_send(u, ptr, cqe);
+		break;
+	default:
+		break;
+	}
+}
+
+static void uring_sweep(tcp_context_t *tcp, tcp_uring_t *u)
+{
+	time_t now = time_now().tv_sec;
+
+	uring_conn_t *conn, *nxt;
+	WALK_LIST_DELSAFE(conn, nxt, u->conns) {
+		if (conn->closing || now - conn->last_active < tcp->idle_timeout) {
+			continue;
+		}
+
+		char addr_str[SOCKADDR_STRLEN];
+		sockaddr_tostr(addr_str, sizeof(addr_str), &conn->addr.remote);
+		log_notice("TCP, terminated inactive client, address %s", addr_str);
+
+		uring_conn_close(conn);
+	}
+}
+
+static void uring_deinit(tcp_uring_t *u)
+{
+	/* Pending requests are cancelled by the ring teardown. */
+	if (u->br != NULL) {
+		(void)io_uring_free_buf_ring(&u->ring, u->br, URING_BUF_COUNT, URING_BUF_GROUP);
+	}
+	io_uring_queue_exit(&u->ring);
+
+	uring_conn_t *conn, *nxt;
+	WALK_LIST_DELSAFE(conn, nxt, u->conns) {
+		conn->closing = true;
+		conn->receiving = false;
+		conn->inflight = 0;
+		uring_conn_release(u, conn);
+	}
+
+	free(u->bufs);
+	free(u->listeners);
+	free(u->deferred);
+}
+
+static int uring_init(tcp_uring_t *u, tcp_context_t *tcp)
+{
+	memset(u, 0, sizeof(*u));
+	init_list(&u->conns);
+
+	/* Single issuer setup needs Linux 6.0, as the multishot receive does. */
+	int ret = io_uring_queue_init(URING_ENTRIES, &u->ring,
+	                              IORING_SETUP_SUBMIT_ALL | IORING_SETUP_COOP_TASKRUN |
+	                              IORING_SETUP_SINGLE_ISSUER);
+	if (ret < 0) {
+		return knot_map_errno_code(-ret);
+	}
+
+	u->bufs = malloc(URING_BUF_COUNT * URING_BUF_SIZE);
+	u->listeners = calloc(tcp->client_threshold, sizeof(*u->listeners));
+	if (u->bufs == NULL || u->listeners == NULL) {
+		uring_deinit(u);
+		return KNOT_ENOMEM;
+	}
+
+	u->br = io_uring_setup_buf_ring(&u->ring, URING_BUF_COUNT, URING_BUF_GROUP, 0, &ret);
+	if (u->br == NULL) {
+		uring_deinit(u);
+		return knot_map_errno_code(-ret);
+	}
+	for (unsigned i = 0; i < URING_BUF_COUNT; i++) {
+		io_uring_buf_ring_add(u->br, u->bufs + i * URING_BUF_SIZE, URING_BUF_SIZE,
+		                      i, io_uring_buf_ring_mask(URING_BUF_COUNT), i);
+	}
+	io_uring_buf_ring_advance(u->br, URING_BUF_COUNT);
+
+	/* The listening sockets are the first in the set. */
+	for (unsigned i = 0; i < tcp->client_threshold; i++) {
+		uring_listener_t *l = &u->listeners[u->n_listeners++];
+		l->fd = fdset_get_fd(&tcp->set, i);
+		l->iface = tcp->set.ctx[i];
+		uring_arm_accept(u, l);
+	}
+
+	return KNOT_EOK;
+}
+
+static void uring_serve(tcp_context_t *tcp, tcp_uring_t *u, dthread_t *thread)
+{
+	struct timespec next_sweep;
+	update_sweep_timer(&next_sweep);
+
+	for (;;) {
+		/* Check for cancellation. */
+		if (dt_is_cancelled(thread)) {
+			break;
+		}
+
+		/* Serve completions deferred while waiting for sends. */
+		for (size_t i = 0; i < u->n_deferred; i++) {
+			uring_cqe_t copy = u->deferred[i];
+			uring_handle(tcp, u, &copy);
+		}
+		u->n_deferred = 0;
+
+		struct __kernel_timespec ts = { .tv_sec = TCP_SWEEP_INTERVAL };
+		struct io_uring_cqe *cqe;
+		int ret = io_uring_submit_and_wait_timeout(&u->ring, &cqe, 1, &ts, NULL);
+		if (ret < 0 && ret != -ETIME && ret != -EINTR) {
+			log_error("TCP, failed to wait for io_uring completions (%s)",
+			          knot_strerror(knot_map_errno_code(-ret)));
+			break;
+		}
+
+		/* Serve client requests, in order after the deferred ones. */
+		while (io_uring_peek_cqe(&u->ring, &cqe) == 0) {
+			uring_cqe_t copy = { cqe->user_data, cqe->res, cqe->flags };
+			if (u->n_deferred > 0) {
+				if (!uring_defer(u, &copy)) {
+					break;
+				}
+				io_uring_cqe_seen(&u->ring, cqe);
+				continue;
+			}
+			io_uring_cqe_seen(&u->ring, cqe);
+			uring_handle(tcp, u, &copy);
+		}
+
+		/* Sweep inactive clients and refresh TCP configuration. */
+		if (time_now().tv_sec >= next_sweep.tv_sec) {
+			uring_sweep(tcp, u);
+			update_sweep_timer(&next_sweep);
+			update_tcp_conf(tcp);
+		}
+	}
+}
+#endif // ENABLE_IO_URING
+
 int tcp_master(dthread_t *thread)
 {
 	if (thread == NULL || thread->data == NULL) {
@@ -408,15 +1061,33 @@ int tcp_master(dthread_t *thread)
 
 	/* Initialize TLS context. */
 	if (tls) {
-		// Set the HS timeout to 8x the RMT IO one as the HS duration can be up to 4*roundtrip.
-		tcp.tls_ctx = knot_tls_ctx_new(handler->server->quic_creds,
-		                               tcp.io_timeout, 8 * tcp.io_timeout, true);
+		tcp.tls_ctx = knot_tls_ctx_new(handler->server->quic_creds, tcp.io_timeout,
+		                               TLS_HS_TIMEOUT(tcp.io_timeout), true);
 		if (tcp.tls_ctx == NULL) {
 			ret = KNOT_ENOMEM;
 			goto finish;
 		}
 	}
 
+#ifdef ENABLE_IO_URING
+	/* Serve plain TCP by io_uring if enabled and supported by the kernel. */
+	if (conf()->cache.srv_tcp_io_uring && !tls) {
+		tcp_uring_t uring;
+		int uret = uring_init(&uring, &tcp);
+		if (uret == KNOT_EOK) {
+			uring_serve(&tcp, &uring, thread);
+			uring_deinit(&uring);
+			goto finish;
+		}
+		log_warning("TCP, failed to initialize io_uring (%s), using epoll",
+		            knot_strerror(uret));
+	}
+#else
+	if (conf()->cache.srv_tcp_io_uring && dt_get_id(thread) == 0) {
+		log_warning("TCP, io_uring not supported by this build, using epoll");
+	}
+#endif // ENABLE_IO_URING
+
 	for (;;) {
 		/* Check for cancellation. */
 		if (dt_is_cancelled(thread)) {
@@ -435,6 +1106,9 @@ int tcp_master(dthread_t *thread)
 	}
 
 finish:
+	for (unsigned i = tcp.client_threshold; i < fdset_get_length(&tcp.set); i++) {
+		free_conn(&tcp.set, i);
+	}
 	knot_tls_ctx_free(tcp.tls_ctx);
 	free(tcp.iov[0].iov_base);
 	free(tcp.iov[1].iov_base);
@@ -603,6 +603,13 @@ int udp_master(dthread_t *thread)
 		if (udp.quic_table == NULL) {
 			goto finish;
 		}
+#ifdef ENABLE_REUSEPORT
+		/* Let the reuseport filter steer the connections to this thread. */
+		if (!is_xdp_thread(handler->server, thread_id)) {
+			knot_quic_table_set_shard(udp.quic_table, thread_id,
+			                          conf()->cache.srv_udp_threads);
+		}
+#endif
 	}
 #endif // ENABLE_QUIC
 
@@ -17,7 +17,10 @@
 #ifdef ENABLE_XDP
 
 #include <assert.h>
+#include <pthread.h>
 #include <stdlib.h>
+#include <string.h>
+#include <time.h>
 #include <urcu.h>
 
 #include "knot/nameserver/process_query.h"
@@ -32,14 +35,64 @@
 #endif // ENABLE_QUIC
 #include "libknot/xdp/tcp.h"
 #include "libknot/xdp/tcp_iobuf.h"
+#include "contrib/atomic.h"
+#include "contrib/macros.h"
+#include "contrib/sockaddr.h"
+#include "contrib/time.h"
+
+#define BUSYPOLL_PERIOD       100 /*!< Busy polling adaptation period (ms). */
+#define BUSYPOLL_MIN_BUDGET     8 /*!< Lower limit of adapted busy poll budget. */
+#define BUSYPOLL_MIN_TIMEOUT   10 /*!< Lower limit of adapted busy poll timeout (us). */
+#define BUSYPOLL_IDLE_MSGS     XDP_BATCHLEN /*!< Fewer packets per period mean idle. */
+#define BUSYPOLL_IDLE_PERIODS  10 /*!< Idle periods before switching to interrupts. */
+#define BUSYPOLL_BUSY_PERIODS   2 /*!< Busy periods before switching to polling. */
+
+typedef struct {
+	struct sockaddr_storage addr;
+	unsigned prefix;
+	uint32_t duration;
+	uint16_t slip;
+} xdp_block_t;
+
+typedef struct xdp_blocks {
+	pthread_mutex_t mx;
+	xdp_block_t queue[XDP_BLOCKS_MAX];
+	unsigned count;
+	knot_atomic_size_t pending; // Lock-free copy of 'count' for the sweep.
+	time_t last_sweep;
+} xdp_blocks_t;
+
+typedef struct {
+	bool enabled;         // Adaptation is active.
+	bool failed;          // Setting the socket failed, give up until restart.
+	bool polling;         // Busy polling (true) or interrupt driven mode.
+	uint16_t budget;      // Current busy poll budget.
+	uint16_t timeout;     // Current busy poll timeout (us).
+	uint16_t max_budget;  // Configured busy poll budget.
+	uint16_t max_timeout; // Configured busy poll timeout.
+	unsigned idle;        // Consecutive idle periods in polling mode.
+	unsigned busy;        // Consecutive busy periods in interrupt mode.
+	uint32_t batches;     // Non-empty received batches in this period.
+	uint32_t msgs;        // Received packets in this period.
+	struct timespec last; // Beginning of this period.
+} busypoll_ctl_t;
 
 typedef struct xdp_handle_ctx {
+	server_t *server;
 	knot_xdp_socket_t *sock;
 	knot_xdp_msg_t msg_recv[XDP_BATCHLEN];
 	knot_xdp_msg_t msg_send_udp[XDP_BATCHLEN];
 	knot_tcp_relay_t relays[XDP_BATCHLEN];
 	uint32_t msg_recv_count;
 	uint32_t msg_udp_count;
+
+	// Indices into msg_recv, per protocol, filled by classify_msgs().
+	uint8_t udp_idx[XDP_BATCHLEN];
+	uint8_t tcp_idx[XDP_BATCHLEN];
+	uint8_t quic_idx[XDP_BATCHLEN];
+	uint32_t udp_idx_count;
+	uint32_t tcp_idx_count;
+	uint32_t quic_idx_count;
 	knot_tcp_table_t *tcp_table;
 	knot_tcp_table_t *syn_table;
 
@@ -58,13 +111,132 @@ typedef struct xdp_handle_ctx {
 	uint32_t tcp_idle_close;  // In microseconds.
 	uint32_t tcp_idle_reset;  // In microseconds.
 	uint32_t tcp_idle_resend; // In microseconds.
+	uint32_t tcp_init_cwnd;   // In segments.
 
 	uint16_t quic_port;       // Network-byte order!
 	uint64_t quic_idle_close; // In nanoseconds.
 
 	knot_sweep_stats_t tcp_closed;
+
+	busypoll_ctl_t busypoll;
+
+	time_t blocks_check;      // Last check of the block sweep by this thread.
 } xdp_handle_ctx_t;
 
+static void busypoll_apply(xdp_handle_ctx_t *ctx, bool polling, uint16_t budget,
+                           uint16_t timeout)
+{
+	busypoll_ctl_t *bp = &ctx->busypoll;
+
+	int ret = knot_xdp_busy_poll_set(ctx->sock, timeout, polling ? budget : 0);
+	if (ret != KNOT_EOK) {
+		log_warning("XDP, failed to adapt busy polling, keeping the current "
+		            "setting (%s)", knot_strerror(ret));
+		bp->enabled = false;
+		bp->failed = true;
+		return;
+	}
+
+	bp->polling = polling;
+	bp->budget = budget;
+	bp->timeout = timeout;
+}
+
+static void busypoll_reconfigure(xdp_handle_ctx_t *ctx, const conf_t *pconf)
+{
+	busypoll_ctl_t *bp = &ctx->busypoll;
+
+	// The socket was created with the configured busy polling.
+	if (bp->max_budget == 0) {
+		bp->max_budget = pconf->cache.xdp_busypoll_budget;
+		bp->max_timeout = pconf->cache.xdp_busypoll_timeout;
+		bp->budget = bp->max_budget;
+		bp->timeout = bp->max_timeout;
+		bp->polling = (bp->max_budget > 0);
+	}
+
+	bool enable = pconf->cache.xdp_busypoll_adaptive && bp->max_budget > 0 &&
+	              !bp->failed;
+	if (enable == bp->enabled) {
+		return;
+	}
+
+	bp->enabled = enable;
+	if (enable) {
+		bp->idle = 0;
+		bp->busy = 0;
+		bp->batches = 0;
+		bp->msgs = 0;
+		bp->last = time_now();
+	} else {
+		// Restore the static setting.
+		busypoll_apply(ctx, true, bp->max_budget, bp->max_timeout);
+	}
+}
+
+/*!
+ * Tune the busy polling according to the batch fill rate and RX ring occupancy
+ * in the last period. Switch to interrupts if idle for a while and back to
+ * polling if the traffic rises.
+ */
+static void busypoll_adapt(xdp_handle_ctx_t *ctx)
+{
+	busypoll_ctl_t *bp = &ctx->busypoll;
+	if (!bp->enabled) {
+		return;
+	}
+
+	struct timespec now = time_now();
+	if (time_diff_ms(&bp->last, &now) < BUSYPOLL_PERIOD) {
+		return;
+	}
+	bp->last = now;
+
+	const uint32_t pending = knot_xdp_rx_pending(ctx->sock);
+	const uint32_t capacity = bp->batches * XDP_BATCHLEN;
+	const uint32_t msgs = bp->msgs;
+	bp->batches = 0;
+	bp->msgs = 0;
+
+	const uint16_t min_budget = MIN(BUSYPOLL_MIN_BUDGET, bp->max_budget);
+	const uint16_t min_timeout = MIN(BUSYPOLL_MIN_TIMEOUT, bp->max_timeout);
+	const bool idle = (msgs < BUSYPOLL_IDLE_MSGS && pending == 0);
+
+	bool polling = bp->polling;
+	uint16_t budget = bp->budget;
+	uint16_t timeout = bp->timeout;
+
+	if (!polling) {
+		bp->busy = idle ? 0 : bp->busy + 1;
+		if (bp->busy < BUSYPOLL_BUSY_PERIODS) {
+			return;
+		}
+		bp->busy = 0;
+		bp->idle = 0;
+		polling = true;
+		budget = MAX(bp->max_budget / 2, min_budget);
+		timeout = MAX(bp->max_timeout / 2, min_timeout);
+	} else {
+		bp->idle = idle ? bp->idle + 1 : 0;
+		if (bp->idle >= BUSYPOLL_IDLE_PERIODS) {
+			bp->idle = 0;
+			polling = false;
+		} else if (pending >= XDP_BATCHLEN || (capacity > 0 && 4 * msgs >= 3 * capacity)) {
+			// Full batches or a backlog, poll more.
+			budget = MIN(2 * budget, bp->max_budget);
+			timeout = MIN(2 * timeout, bp->max_timeout);
+		} else if (4 * msgs < capacity) {
+			// Mostly empty batches, poll less.
+			budget = MAX(budget / 2, min_budget);
+			timeout = MAX(timeout / 2, min_timeout);
+		}
+	}
+
+	if (polling != bp->polling || budget != bp->budget || timeout != bp->timeout) {
+		busypoll_apply(ctx, polling, budget, timeout);
+	}
+}
+
 void xdp_handle_reconfigure(xdp_handle_ctx_t *ctx)
 {
 	rcu_read_lock();
@@ -78,8 +250,15 @@ void xdp_handle_reconfigure(xdp_handle_ctx_t *ctx)
 	ctx->tcp_idle_close = pconf->cache.xdp_tcp_idle_close * 1000000;
 	ctx->tcp_idle_reset = pconf->cache.xdp_tcp_idle_reset * 1000000;
 	ctx->tcp_idle_resend= pconf->cache.xdp_tcp_idle_resend * 1000000;
+	ctx->tcp_init_cwnd  = pconf->cache.xdp_tcp_init_window;
 	ctx->quic_idle_close= pconf->cache.srv_quic_idle_close * 1000000000LU;
+	busypoll_reconfigure(ctx, pconf);
 	rcu_read_unlock();
+
+	if (ctx->tcp_table != NULL) {
+		ctx->tcp_table->init_cwnd = ctx->tcp_init_cwnd;
+		ctx->syn_table->init_cwnd = ctx->tcp_init_cwnd;
+	}
 }
 
 void xdp_handle_free(xdp_handle_ctx_t *ctx)
@@ -132,6 +311,7 @@ xdp_handle_ctx_t *xdp_handle_init(server_t *server, knot_xdp_socket_t *xdp_sock)
 	if (ctx == NULL) {
 		return NULL;
 	}
+	ctx->server = server;
 	ctx->sock = xdp_sock;
 
 	xdp_handle_reconfigure(ctx);
@@ -148,6 +328,8 @@ xdp_handle_ctx_t *xdp_handle_init(server_t *server, knot_xdp_socket_t *xdp_sock)
 			xdp_handle_free(ctx);
 			return NULL;
 		}
+		ctx->tcp_table->init_cwnd = ctx->tcp_init_cwnd;
+		ctx->syn_table->init_cwnd = ctx->tcp_init_cwnd;
 	}
 
 	if (ctx->quic_port > 0) {
@@ -176,9 +358,53 @@ int xdp_handle_recv(xdp_handle_ctx_t *ctx)
 {
 	int ret = knot_xdp_recv(ctx->sock, ctx->msg_recv, XDP_BATCHLEN,
 	                        &ctx->msg_recv_count, NULL);
+	if (ret == KNOT_EOK && ctx->msg_recv_count > 0) {
+		ctx->busypoll.batches++;
+		ctx->busypoll.msgs += ctx->msg_recv_count;
+	}
 	return ret == KNOT_EOK ? ctx->msg_recv_count : ret;
 }
 
+/*!
+ * \brief Sort the received batch by protocol in a single pass.
+ *
+ * The payloads are prefetched one message ahead so that the parsing later
+ * doesn't stall on each UMEM frame.
+ */
+static void classify_msgs(xdp_handle_ctx_t *ctx)
+{
+	ctx->udp_idx_count = 0;
+	ctx->tcp_idx_count = 0;
+	ctx->quic_idx_count = 0;
+
+	for (uint32_t i = 0; i < ctx->msg_recv_count; i++) {
+		knot_xdp_msg_t *msg_recv = &ctx->msg_recv[i];
+
+		if (i + 1 < ctx->msg_recv_count) {
+			__builtin_prefetch(ctx->msg_recv[i + 1].payload.iov_base, 0);
+		}
+
+		if (msg_recv->flags & KNOT_XDP_MSG_TCP) {
+			if (ctx->tcp) {
+				ctx->tcp_idx[ctx->tcp_idx_count++] = i;
+			}
+			continue;
+		}
+
+		// Skip marked (zero length) message.
+		if (msg_recv->payload.iov_len == 0) {
+			continue;
+		}
+
+		if (msg_recv->ip_to.sin6_port == ctx->quic_port) {
+			ctx->quic_idx[ctx->quic_idx_count++] = i;
+			continue;
+		}
+
+		ctx->udp_idx[ctx->udp_idx_count++] = i;
+	}
+}
+
 static void handle_udp(xdp_handle_ctx_t *ctx, knot_layer_t *layer,
                        knotd_qdata_params_t *params)
 {
@@ -186,17 +412,10 @@ static void handle_udp(xdp_handle_ctx_t *ctx, knot_layer_t *layer,
 
 	ctx->msg_udp_count = 0;
 
-	for (uint32_t i = 0; i < ctx->msg_recv_count; i++) {
-		knot_xdp_msg_t *msg_recv = &ctx->msg_recv[i];
+	for (uint32_t k = 0; k < ctx->udp_idx_count; k++) {
+		knot_xdp_msg_t *msg_recv = &ctx->msg_recv[ctx->udp_idx[k]];
 		knot_xdp_msg_t *msg_send = &ctx->msg_send_udp[ctx->msg_udp_count];
 
-		// Skip TCP or QUIC or marked (zero length) message.
-		if ((msg_recv->flags & KNOT_XDP_MSG_TCP) ||
-		    msg_recv->ip_to.sin6_port == ctx->quic_port ||
-		    msg_recv->payload.iov_len == 0) {
-			continue;
-		}
-
 		params_xdp_update(params, KNOTD_QUERY_PROTO_UDP, msg_recv);
 
 		if (process_query_proto(params, KNOTD_STAGE_PROTO_BEGIN) == KNOTD_PROTO_STATE_BLOCK) {
@@ -226,14 +445,11 @@ static void handle_tcp(xdp_handle_ctx_t *ctx, knot_layer_t *layer,
 
 	uint8_t ans_buf[KNOT_WIRE_MAX_PKTSIZE];
 
-	for (uint32_t i = 0; i < ctx->msg_recv_count; i++) {
+	for (uint32_t k = 0; k < ctx->tcp_idx_count; k++) {
+		uint32_t i = ctx->tcp_idx[k];
 		knot_xdp_msg_t *msg_recv = &ctx->msg_recv[i];
 		knot_tcp_relay_t *rl = &ctx->relays[i];
 
-		if (!(msg_recv->flags & KNOT_XDP_MSG_TCP)) {
-			continue;
-		}
-
 		params_xdp_update(params, KNOTD_QUERY_PROTO_TCP, msg_recv);
 
 		if (process_query_proto(params, KNOTD_STAGE_PROTO_BEGIN) == KNOTD_PROTO_STATE_BLOCK) {
@@ -255,24 +471,25 @@ static void handle_tcp(xdp_handle_ctx_t *ctx, knot_layer_t *layer,
 		params_update_tcp(params, rl->conn->establish_rtt);
 
 		// Process all complete DNS queries in one TCP stream.
-		for (size_t j = 0; rl->inbf != NULL && j < rl->inbf->n_inbufs; j++) {
-			// Consume the query.
-			struct iovec *inbufs = rl->inbf->inbufs;
-			handle_query(params, layer, &inbufs[j], NULL);
-
-			// Process the reply.
-			knot_pkt_t *ans = knot_pkt_new(ans_buf, sizeof(ans_buf), layer->mm);
-			while (active_state(layer->state)) {
-				knot_layer_produce(layer, ans);
-				if (!send_state(layer->state)) {
-					continue;
+		for (knot_tcp_inbufs_upd_res_t *inbf = rl->inbf; inbf != NULL; inbf = inbf->next) {
+			for (size_t j = 0; j < inbf->n_inbufs; j++) {
+				// Consume the query.
+				handle_query(params, layer, &inbf->inbufs[j], NULL);
+
+				// Process the reply.
+				knot_pkt_t *ans = knot_pkt_new(ans_buf, sizeof(ans_buf), layer->mm);
+				while (active_state(layer->state)) {
+					knot_layer_produce(layer, ans);
+					if (!send_state(layer->state)) {
+						continue;
+					}
+
+					(void)knot_tcp_reply_data(rl, ctx->tcp_table, false,
+					                          ans->wire, ans->size);
 				}
 
-				(void)knot_tcp_reply_data(rl, ctx->tcp_table, false,
-				                          ans->wire, ans->size);
+				handle_finish(layer);
 			}
-
-			handle_finish(layer);
 		}
 
 		(void)process_query_proto(params, KNOTD_STAGE_PROTO_END);
@@ -287,15 +504,11 @@ static void handle_quic(xdp_handle_ctx_t *ctx, knot_layer_t *layer,
 		return;
 	}
 
-	for (uint32_t i = 0; i < ctx->msg_recv_count; i++) {
-		knot_xdp_msg_t *msg_recv = &ctx->msg_recv[i];
-		ctx->quic_relays[i] = NULL;
+	memset(ctx->quic_relays, 0, ctx->msg_recv_count * sizeof(ctx->quic_relays[0]));
 
-		if ((msg_recv->flags & KNOT_XDP_MSG_TCP) ||
-		    msg_recv->ip_to.sin6_port != ctx->quic_port ||
-		    msg_recv->payload.iov_len == 0) {
-			continue;
-		}
+	for (uint32_t k = 0; k < ctx->quic_idx_count; k++) {
+		uint32_t i = ctx->quic_idx[k];
+		knot_xdp_msg_t *msg_recv = &ctx->msg_recv[i];
 
 		params_xdp_update(params, KNOTD_QUERY_PROTO_QUIC, msg_recv);
 
@@ -339,6 +552,8 @@ void xdp_handle_msgs(xdp_handle_ctx_t *ctx, knot_layer_t *layer,
 
 	knot_xdp_send_prepare(ctx->sock);
 
+	classify_msgs(ctx);
+
 	handle_udp(ctx, layer, &params);
 	if (ctx->tcp) {
 		handle_tcp(ctx, layer, &params);
@@ -384,8 +599,125 @@ void xdp_handle_send(xdp_handle_ctx_t *ctx)
 	}
 }
 
+xdp_blocks_t *xdp_blocks_new(void)
+{
+	xdp_blocks_t *blocks = calloc(1, sizeof(*blocks));
+	if (blocks == NULL) {
+		return NULL;
+	}
+	pthread_mutex_init(&blocks->mx, NULL);
+
+	return blocks;
+}
+
+void xdp_blocks_free(xdp_blocks_t *blocks)
+{
+	if (blocks == NULL) {
+		return;
+	}
+	pthread_mutex_destroy(&blocks->mx);
+	free(blocks);
+}
+
+int xdp_blocks_push(xdp_blocks_t *blocks, const struct sockaddr_storage *addr,
+                    unsigned prefix, uint32_t duration, uint16_t slip)
+{
+	if (blocks == NULL || addr == NULL) {
+		return KNOT_EINVAL;
+	}
+
+	// Never wait for the lock in the query processing.
+	if (pthread_mutex_trylock(&blocks->mx) != 0) {
+		return KNOT_EBUSY;
+	}
+
+	int ret = KNOT_EOK;
+	for (unsigned i = 0; i < blocks->count; i++) {
+		xdp_block_t *blk = &blocks->queue[i];
+		if (blk->prefix == prefix && sockaddr_net_match(&blk->addr, addr, prefix)) {
+			goto unlock; // Already pending.
+		}
+	}
+
+	if (blocks->count < XDP_BLOCKS_MAX) {
+		xdp_block_t *blk = &blocks->queue[blocks->count++];
+		memcpy(&blk->addr, addr, sizeof(*addr));
+		blk->prefix = prefix;
+		blk->duration = duration;
+		blk->slip = slip;
+		ATOMIC_SET(blocks->pending, blocks->count);
+	} else {
+		ret = KNOT_ESPACE;
+	}
+unlock:
+	pthread_mutex_unlock(&blocks->mx);
+
+	return ret;
+}
+
+static void apply_blocks(xdp_handle_ctx_t *ctx)
+{
+	server_t *server = ctx->server;
+	xdp_blocks_t *blocks = server->xdp_blocks;
+	if (blocks == NULL) {
+		return;
+	}
+
+	// Don't touch the shared lock unless there is something to do.
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC_COARSE, &now);
+	if (ATOMIC_GET(blocks->pending) == 0 && now.tv_sec == ctx->blocks_check) {
+		return;
+	}
+	if (pthread_mutex_trylock(&blocks->mx) != 0) {
+		return; // Another thread is on it.
+	}
+	ctx->blocks_check = now.tv_sec;
+
+	bool sweep = (now.tv_sec != blocks->last_sweep);
+	if (blocks->count == 0 && !sweep) {
+		pthread_mutex_unlock(&blocks->mx);
+		return;
+	}
+	blocks->last_sweep = now.tv_sec;
+
+	for (const iface_t *i = server->ifaces;
+	     i != server->ifaces + server->n_ifaces; i++) {
+		if (i->fd_xdp_count == 0) {
+			continue;
+		}
+		// The block map is shared by all the queues of the interface.
+		knot_xdp_socket_t *sock = i->xdp_sockets[0];
+
+		for (unsigned j = 0; j < blocks->count; j++) {
+			xdp_block_t *blk = &blocks->queue[j];
+			int ret = knot_xdp_block_set(sock, &blk->addr, blk->prefix,
+			                             blk->duration, blk->slip);
+			if (ret != KNOT_EOK) {
+				if (ret != KNOT_ENOTSUP) {
+					log_debug("XDP, failed to block a client (%s)",
+					          knot_strerror(ret));
+				}
+				break;
+			}
+		}
+
+		if (sweep) {
+			unsigned removed = 0;
+			(void)knot_xdp_block_sweep(sock, &removed);
+		}
+	}
+	blocks->count = 0;
+	ATOMIC_SET(blocks->pending, 0);
+
+	pthread_mutex_unlock(&blocks->mx);
+}
+
 void xdp_handle_sweep(xdp_handle_ctx_t *ctx)
 {
+	apply_blocks(ctx);
+	busypoll_adapt(ctx);
+
 #ifdef ENABLE_QUIC
 	knot_quic_table_sweep(ctx->quic_table, NULL, &ctx->quic_closed);
 	log_swept(&ctx->quic_closed, false);
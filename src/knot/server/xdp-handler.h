@@ -22,10 +22,41 @@
 #include "libknot/xdp/xdp.h"
 
 #define XDP_BATCHLEN  32 /*!< XDP receive batch size. */
+#define XDP_BLOCKS_MAX 64 /*!< Maximum number of pending client blocks. */
 
 struct xdp_handle_ctx;
+struct xdp_blocks;
 struct server;
 
+/*!
+ * \brief Create a queue of client blocks to be applied in the BPF programs.
+ */
+struct xdp_blocks *xdp_blocks_new(void);
+
+/*!
+ * \brief Free the queue of client blocks.
+ */
+void xdp_blocks_free(struct xdp_blocks *blocks);
+
+/*!
+ * \brief Request blocking of a client prefix in the BPF programs.
+ *
+ * The block is applied asynchronously by some XDP thread during its sweep.
+ *
+ * \param blocks    Queue of client blocks.
+ * \param addr      Client address.
+ * \param prefix    Prefix length of the address to be blocked.
+ * \param duration  Block duration in milliseconds.
+ * \param slip      Slip every Nth query (0 means drop all).
+ *
+ * \retval KNOT_EBUSY if the queue is being processed.
+ * \retval KNOT_ESPACE if the queue is full.
+ *
+ * \return KNOT_E*
+ */
+int xdp_blocks_push(struct xdp_blocks *blocks, const struct sockaddr_storage *addr,
+                    unsigned prefix, uint32_t duration, uint16_t slip);
+
 /*!
  * \brief Initialize XDP packet handling context.
  */
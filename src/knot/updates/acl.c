@@ -15,8 +15,13 @@
  */
 
 #include "knot/updates/acl.h"
+#include "knot/conf/confio.h"
 
+#include "contrib/macros.h"
+#include "contrib/mempattern.h"
+#include "contrib/sockaddr.h"
 #include "contrib/string.h"
+#include "contrib/ucw/mempool.h"
 #include "contrib/wire_ctx.h"
 
 static bool cert_pin_check(const uint8_t *session_pin, size_t session_pin_size,
@@ -449,3 +454,706 @@ next_remote:
 
 	return false;
 }
+
+/*! \brief Address range in network byte order. */
+typedef struct {
+	uint8_t len; // 4 or 16.
+	uint8_t min[16];
+	uint8_t max[16];
+} acl_range_t;
+
+/*! \brief TSIG key of a compiled matcher. */
+typedef struct {
+	dnssec_tsig_algorithm_t alg;
+	dnssec_binary_t secret;
+} acl_key_t;
+
+/*! \brief Certificate pin of a compiled matcher. */
+typedef struct {
+	size_t len;
+	uint8_t data[KNOT_TLS_PIN_LEN];
+} acl_pin_t;
+
+/*! \brief Address, key, and pin requirements of one ACL or one ACL remote. */
+typedef struct {
+	acl_range_t *ranges; // Sorted, disjoint. NULL if any address matches.
+	size_t range_count;
+	trie_t *keys;        // Key name -> acl_key_t. NULL if no key configured.
+	acl_pin_t *pins;     // NULL if no pin required.
+	size_t pin_count;
+} acl_matcher_t;
+
+struct acl_rule {
+	knot_mm_t mm;      // All the rule items are allocated from this pool.
+	unsigned refs;     // Compiled zone ACLs and cache referencing the rule.
+	bool deny;
+	bool remote;       // Matchers compiled from remotes, exact addresses.
+	bool no_action;    // Empty action list.
+	uint8_t actions;   // Bitmap of (1 << acl_action_t).
+	acl_matcher_t *matchers;
+	size_t matcher_count;
+
+	uint16_t *types;   // Update types, NULL if any.
+	size_t type_count;
+	acl_update_owner_t owner;
+	acl_update_owner_match_t match;
+	uint8_t **names;   // Update owner names, possibly relative to the zone.
+	size_t *name_lens;
+	size_t name_count;
+};
+
+static int range_cmp(const void *a, const void *b)
+{
+	const acl_range_t *r1 = a, *r2 = b;
+	if (r1->len != r2->len) {
+		return (int)r1->len - (int)r2->len;
+	}
+	return memcmp(r1->min, r2->min, r1->len);
+}
+
+static void range_set(acl_range_t *range, const struct sockaddr_storage *min,
+                      const struct sockaddr_storage *max, int prefix)
+{
+	size_t len = 0;
+	const uint8_t *raw = sockaddr_raw(min, &len);
+	range->len = len;
+	memcpy(range->min, raw, len);
+	memcpy(range->max, raw, len);
+
+	if (max != NULL && max->ss_family == min->ss_family) {
+		raw = sockaddr_raw(max, &len);
+		memcpy(range->max, raw, len);
+	} else if (prefix >= 0 && prefix < 8 * (int)len) {
+		for (unsigned i = 0; i < len; i++) {
+			int bits = prefix - 8 * i;
+			uint8_t mask = (bits >= 8) ? 0xff : (bits <= 0) ? 0 : (0xff << (8 - bits));
+			range->min[i] &= mask;
+			range->max[i] |= ~mask;
+		}
+	}
+}
+
+static int compile_addrs(acl_rule_t *rule, acl_matcher_t *matcher, conf_val_t *val,
+                         bool exact)
+{
+	if (val->code == KNOT_ENOENT) {
+		return KNOT_EOK;
+	}
+
+	size_t count = conf_val_count(val);
+	acl_range_t *ranges = mm_calloc(&rule->mm, MAX(count, 1), sizeof(*ranges));
+	if (ranges == NULL) {
+		return KNOT_ENOMEM;
+	}
+
+	size_t used = 0;
+	while (val->code == KNOT_EOK) {
+		struct sockaddr_storage min, max;
+		int prefix = -1;
+		if (exact) {
+			min = conf_addr(val, NULL);
+			max.ss_family = AF_UNSPEC;
+		} else {
+			min = conf_addr_range(val, &max, &prefix);
+		}
+		if (min.ss_family == AF_INET || min.ss_family == AF_INET6) {
+			range_set(&ranges[used++], &min, &max, prefix);
+		}
+		conf_val_next(val);
+	}
+
+	// Merge overlapping ranges so that binary search is possible.
+	qsort(ranges, used, sizeof(*ranges), range_cmp);
+	size_t merged = 0;
+	for (size_t i = 0; i < used; i++) {
+		acl_range_t *last = (merged > 0) ? &ranges[merged - 1] : NULL;
+		if (last != NULL && last->len == ranges[i].len &&
+		    memcmp(ranges[i].min, last->max, last->len) <= 0) {
+			if (memcmp(ranges[i].max, last->max, last->len) > 0) {
+				memcpy(last->max, ranges[i].max, last->len);
+			}
+		} else {
+			ranges[merged++] = ranges[i];
+		}
+	}
+
+	matcher->ranges = ranges;
+	matcher->range_count = merged;
+
+	return KNOT_EOK;
+}
+
+static int compile_keys(conf_t *conf, acl_rule_t *rule, acl_matcher_t *matcher,
+                        conf_val_t *val)
+{
+	if (val->code == KNOT_ENOENT) {
+		return KNOT_EOK;
+	}
+
+	matcher->keys = trie_create(&rule->mm);
+	if (matcher->keys == NULL) {
+		return KNOT_ENOMEM;
+	}
+
+	while (val->code == KNOT_EOK) {
+		const knot_dname_t *name = conf_dname(val);
+		trie_val_t *item = trie_get_ins(matcher->keys, name, knot_dname_size(name));
+		acl_key_t *key = mm_calloc(&rule->mm, 1, sizeof(*key));
+		if (item == NULL || key == NULL) {
+			return KNOT_ENOMEM;
+		}
+
+		conf_val_t alg_val = conf_id_get(conf, C_KEY, C_ALG, val);
+		key->alg = conf_opt(&alg_val);
+
+		size_t secret_len = 0;
+		conf_val_t secret_val = conf_id_get(conf, C_KEY, C_SECRET, val);
+		const uint8_t *secret = conf_bin(&secret_val, &secret_len);
+		key->secret.data = mm_alloc(&rule->mm, MAX(secret_len, 1));
+		if (key->secret.data == NULL) {
+			return KNOT_ENOMEM;
+		}
+		memcpy(key->secret.data, secret, secret_len);
+		key->secret.size = secret_len;
+
+		*item = key;
+
+		if (!(val->item->flags & YP_FMULTI)) {
+			break;
+		}
+		conf_val_next(val);
+	}
+
+	return KNOT_EOK;
+}
+
+static int compile_pins(acl_rule_t *rule, acl_matcher_t *matcher, conf_val_t *val)
+{
+	if (val->code == KNOT_ENOENT) {
+		return KNOT_EOK;
+	}
+
+	size_t count = conf_val_count(val);
+	matcher->pins = mm_calloc(&rule->mm, MAX(count, 1), sizeof(*matcher->pins));
+	if (matcher->pins == NULL) {
+		return KNOT_ENOMEM;
+	}
+
+	while (val->code == KNOT_EOK) {
+		size_t pin_len = 0;
+		const uint8_t *pin = conf_bin(val, &pin_len);
+		// A longer pin can't match any session pin.
+		if (pin_len <= KNOT_TLS_PIN_LEN) {
+			acl_pin_t *out = &matcher->pins[matcher->pin_count++];
+			memcpy(out->data, pin, pin_len);
+			out->len = pin_len;
+		}
+		conf_val_next(val);
+	}
+
+	return KNOT_EOK;
+}
+
+static int compile_matcher(conf_t *conf, acl_rule_t *rule, acl_matcher_t *matcher,
+                           bool remote, conf_val_t *id)
+{
+	const yp_name_t *section = remote ? C_RMT : C_ACL;
+
+	conf_val_t val = conf_id_get(conf, section, C_ADDR, id);
+	int ret = compile_addrs(rule, matcher, &val, remote);
+	if (ret != KNOT_EOK) {
+		return ret;
+	}
+
+	val = conf_id_get(conf, section, C_KEY, id);
+	ret = compile_keys(conf, rule, matcher, &val);
+	if (ret != KNOT_EOK) {
+		return ret;
+	}
+
+	val = conf_id_get(conf, section, C_CERT_KEY, id);
+	return compile_pins(rule, matcher, &val);
+}
+
+static int compile_update(conf_t *conf, acl_rule_t *rule, conf_val_t *acl)
+{
+	conf_val_t val = conf_id_get(conf, C_ACL, C_UPDATE_TYPE, acl);
+	size_t count = conf_val_count(&val);
+	if (count > 0) {
+		rule->types = mm_alloc(&rule->mm, count * sizeof(*rule->types));
+		if (rule->types == NULL) {
+			return KNOT_ENOMEM;
+		}
+		while (val.code == KNOT_EOK) {
+			rule->types[rule->type_count++] = knot_wire_read_u64(val.data);
+			conf_val_next(&val);
+		}
+	}
+
+	val = conf_id_get(conf, C_ACL, C_UPDATE_OWNER, acl);
+	rule->owner = conf_opt(&val);
+	rule->match = ACL_UPDATE_MATCH_SUBEQ;
+	if (rule->owner != ACL_UPDATE_OWNER_NONE) {
+		val = conf_id_get(conf, C_ACL, C_UPDATE_OWNER_MATCH, acl);
+		rule->match = conf_opt(&val);
+	}
+
+	if (rule->owner == ACL_UPDATE_OWNER_NAME) {
+		val = conf_id_get(conf, C_ACL, C_UPDATE_OWNER_NAME, acl);
+		count = conf_val_count(&val);
+		if (count > 0) {
+			rule->names = mm_alloc(&rule->mm, count * sizeof(*rule->names));
+			rule->name_lens = mm_alloc(&rule->mm, count * sizeof(*rule->name_lens));
+			if (rule->names == NULL || rule->name_lens == NULL) {
+				return KNOT_ENOMEM;
+			}
+		}
+		while (val.code == KNOT_EOK) {
+			size_t len;
+			const uint8_t *name = conf_data(&val, &len);
+			uint8_t *copy = mm_alloc(&rule->mm, len);
+			if (copy == NULL) {
+				return KNOT_ENOMEM;
+			}
+			memcpy(copy, name, len);
+			rule->names[rule->name_count] = copy;
+			rule->name_lens[rule->name_count++] = len;
+			conf_val_next(&val);
+		}
+	}
+
+	return KNOT_EOK;
+}
+
+static void rule_free(acl_rule_t *rule)
+{
+	if (rule != NULL && --rule->refs == 0) {
+		mp_delete(rule->mm.ctx);
+	}
+}
+
+static acl_rule_t *rule_compile(conf_t *conf, conf_val_t *acl)
+{
+	knot_mm_t mm;
+	mm_ctx_mempool(&mm, MM_DEFAULT_BLKSIZE);
+	acl_rule_t *rule = mm_calloc(&mm, 1, sizeof(*rule));
+	if (rule == NULL) {
+		mp_delete(mm.ctx);
+		return NULL;
+	}
+	rule->mm = mm;
+	rule->refs = 1;
+
+	conf_val_t val = conf_id_get(conf, C_ACL, C_DENY, acl);
+	rule->deny = conf_bool(&val);
+
+	val = conf_id_get(conf, C_ACL, C_ACTION, acl);
+	rule->no_action = (val.code == KNOT_ENOENT);
+	while (val.code == KNOT_EOK) {
+		rule->actions |= 1 << conf_opt(&val);
+		conf_val_next(&val);
+	}
+
+	int ret = compile_update(conf, rule, acl);
+
+	conf_val_t rmt_val = conf_id_get(conf, C_ACL, C_RMT, acl);
+	rule->remote = (rmt_val.code == KNOT_EOK);
+	if (ret == KNOT_EOK && rule->remote) {
+		size_t count = 0;
+		conf_mix_iter_t iter;
+		conf_mix_iter_init(conf, &rmt_val, &iter);
+		while (iter.id->code == KNOT_EOK) {
+			count++;
+			conf_mix_iter_next(&iter);
+		}
+
+		rule->matchers = mm_calloc(&rule->mm, MAX(count, 1), sizeof(*rule->matchers));
+		if (rule->matchers == NULL) {
+			ret = KNOT_ENOMEM;
+		}
+
+		conf_val_reset(&rmt_val);
+		conf_mix_iter_init(conf, &rmt_val, &iter);
+		while (ret == KNOT_EOK && iter.id->code == KNOT_EOK) {
+			acl_matcher_t *matcher = &rule->matchers[rule->matcher_count++];
+			ret = compile_matcher(conf, rule, matcher, true, iter.id);
+			conf_mix_iter_next(&iter);
+		}
+	} else if (ret == KNOT_EOK) {
+		rule->matchers = mm_calloc(&rule->mm, 1, sizeof(*rule->matchers));
+		if (rule->matchers == NULL) {
+			ret = KNOT_ENOMEM;
+		} else {
+			rule->matcher_count = 1;
+			ret = compile_matcher(conf, rule, rule->matchers, false, acl);
+		}
+	}
+
+	if (ret != KNOT_EOK) {
+		rule_free(rule);
+		return NULL;
+	}
+
+	return rule;
+}
+
+static int cache_rule_free(trie_val_t *val, _unused_ void *ctx)
+{
+	rule_free(*val);
+	return KNOT_EOK;
+}
+
+void acl_cache_free(trie_t *cache)
+{
+	if (cache == NULL) {
+		return;
+	}
+
+	(void)trie_apply(cache, cache_rule_free, NULL);
+	trie_free(cache);
+}
+
+acl_compiled_t *acl_compile(conf_t *conf, const knot_dname_t *zone_name, trie_t *cache)
+{
+	if (conf == NULL || zone_name == NULL) {
+		return NULL;
+	}
+
+	conf_val_t acl = conf_zone_get(conf, C_ACL, zone_name);
+	size_t count = conf_val_count(&acl);
+
+	acl_compiled_t *out = calloc(1, sizeof(*out) + count * sizeof(out->rules[0]));
+	if (out == NULL) {
+		return NULL;
+	}
+
+	conf_val_t val = conf_zone_get(conf, C_MASTER, zone_name);
+	if (val.code == KNOT_EOK) {
+		val = conf_zone_get(conf, C_DDNS_MASTER, zone_name);
+		if (val.code != KNOT_EOK || *conf_str(&val) != '\0') {
+			out->forward = true;
+		}
+	}
+
+	while (acl.code == KNOT_EOK) {
+		trie_val_t *cached = NULL;
+		if (cache != NULL) {
+			conf_val(&acl);
+			cached = trie_get_ins(cache, acl.data, acl.len);
+			if (cached == NULL) {
+				acl_compiled_free(out);
+				return NULL;
+			}
+		}
+
+		acl_rule_t *rule = (cached != NULL) ? *cached : NULL;
+		if (rule == NULL) {
+			rule = rule_compile(conf, &acl);
+			if (rule == NULL) {
+				acl_compiled_free(out);
+				return NULL;
+			}
+			if (cached != NULL) {
+				*cached = rule; // Keep the initial reference for the cache.
+				rule->refs++;
+			}
+		} else {
+			rule->refs++;
+		}
+		out->rules[out->count++] = rule;
+
+		conf_val_next(&acl);
+	}
+
+	return out;
+}
+
+static bool ref_changed(conf_t *conf, const yp_name_t *section, conf_val_t *id)
+{
+	conf_val(id);
+	return conf_io_ref_changed(conf, section, id->data, id->len);
+}
+
+static bool keys_changed(conf_t *conf, conf_val_t *val)
+{
+	while (val->code == KNOT_EOK) {
+		if (ref_changed(conf, C_KEY, val)) {
+			return true;
+		}
+		conf_val_next(val);
+	}
+
+	return false;
+}
+
+bool acl_rule_changed(conf_t *conf, conf_val_t *acl)
+{
+	if (conf == NULL || acl == NULL) {
+		return true;
+	}
+
+	if (ref_changed(conf, C_ACL, acl)) {
+		return true;
+	}
+
+	conf_val_t val = conf_id_get(conf, C_ACL, C_KEY, acl);
+	if (keys_changed(conf, &val)) {
+		return true;
+	}
+
+	conf_val_t rmt_val = conf_id_get(conf, C_ACL, C_RMT, acl);
+	conf_mix_iter_t iter;
+	conf_mix_iter_init(conf, &rmt_val, &iter);
+	while (iter.id->code == KNOT_EOK) {
+		if ((iter.nested && ref_changed(conf, C_RMTS, iter.mix_id)) ||
+		    ref_changed(conf, C_RMT, iter.id)) {
+			return true;
+		}
+
+		val = conf_id_get(conf, C_RMT, C_KEY, iter.id);
+		if (keys_changed(conf, &val)) {
+			return true;
+		}
+
+		conf_mix_iter_next(&iter);
+	}
+
+	return false;
+}
+
+void acl_compiled_free(acl_compiled_t *acl)
+{
+	if (acl == NULL) {
+		return;
+	}
+
+	for (size_t i = 0; i < acl->count; i++) {
+		rule_free(acl->rules[i]);
+	}
+	free(acl);
+}
+
+static bool match_range(const acl_matcher_t *matcher, const struct sockaddr_storage *addr)
+{
+	if (matcher->ranges == NULL) {
+		return true;
+	}
+
+	if (addr->ss_family != AF_INET && addr->ss_family != AF_INET6) {
+		return false;
+	}
+
+	acl_range_t key = { 0 };
+	size_t len = 0;
+	const uint8_t *raw = sockaddr_raw(addr, &len);
+	key.len = len;
+	memcpy(key.min, raw, len);
+
+	// Find the last range beginning at or before the address.
+	size_t lo = 0, hi = matcher->range_count;
+	while (lo < hi) {
+		size_t mid = lo + (hi - lo) / 2;
+		if (range_cmp(&matcher->ranges[mid], &key) <= 0) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+	if (lo == 0) {
+		return false;
+	}
+
+	const acl_range_t *range = &matcher->ranges[lo - 1];
+	return range->len == len && memcmp(raw, range->max, len) <= 0;
+}
+
+static bool match_pins(const acl_matcher_t *matcher, const uint8_t *session_pin,
+                       size_t session_pin_size)
+{
+	if (matcher->pins == NULL) { // No certificate pin authentication required.
+		return true;
+	} else if (session_pin_size == 0) { // Not a TLS/QUIC connection.
+		return false;
+	}
+
+	for (size_t i = 0; i < matcher->pin_count; i++) {
+		const acl_pin_t *pin = &matcher->pins[i];
+		if (pin->len == session_pin_size &&
+		    const_time_memcmp(pin->data, session_pin, pin->len) == 0) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static bool compiled_check_addr_key(const acl_matcher_t *matcher,
+                                    const struct sockaddr_storage *addr,
+                                    const knot_tsig_key_t *tsig,
+                                    const uint8_t *session_pin, size_t session_pin_size,
+                                    bool deny, bool forward, const acl_key_t **key)
+{
+	if (!match_range(matcher, addr) ||
+	    !match_pins(matcher, session_pin, session_pin_size)) {
+		return false;
+	}
+
+	*key = NULL;
+	if (matcher->keys == NULL) {
+		// Empty list without key provided, forwarded DDNS, or denied.
+		return tsig->name == NULL || forward || deny;
+	} else if (tsig->name == NULL) {
+		return false;
+	}
+
+	trie_val_t *val = trie_get_try(matcher->keys, tsig->name,
+	                               knot_dname_size(tsig->name));
+	if (val == NULL || ((acl_key_t *)*val)->alg != tsig->algorithm) {
+		return false;
+	}
+	*key = *val;
+
+	return true;
+}
+
+static bool compiled_match_names(const acl_rule_t *rule, const knot_dname_t *rr_owner,
+                                 const knot_dname_t *zone_name)
+{
+	if (rule->names == NULL) {
+		return true;
+	}
+
+	for (size_t i = 0; i < rule->name_count; i++) {
+		knot_dname_storage_t full_name;
+		const uint8_t *name = rule->names[i];
+		size_t len = rule->name_lens[i];
+		if (name[len - 1] != '\0') {
+			// Append zone name if non-FQDN.
+			wire_ctx_t ctx = wire_ctx_init(full_name, sizeof(full_name));
+			wire_ctx_write(&ctx, name, len);
+			wire_ctx_write(&ctx, zone_name, knot_dname_size(zone_name));
+			if (ctx.error != KNOT_EOK) {
+				return false;
+			}
+			name = full_name;
+		}
+		if (match_name(rr_owner, name, rule->match)) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static bool compiled_update_match(const acl_rule_t *rule, const knot_dname_t *key_name,
+                                  const knot_dname_t *zone_name, knot_pkt_t *query)
+{
+	if (query == NULL ||
+	    (rule->types == NULL && rule->owner == ACL_UPDATE_OWNER_NONE)) {
+		return true;
+	}
+
+	uint16_t pos = query->sections[KNOT_AUTHORITY].pos;
+	uint16_t count = query->sections[KNOT_AUTHORITY].count;
+
+	for (int i = pos; i < pos + count; i++) {
+		knot_rrset_t *rr = &query->rr[i];
+		if (rule->types != NULL) {
+			size_t j = 0;
+			while (j < rule->type_count && rule->types[j] != rr->type) {
+				j++;
+			}
+			if (j == rule->type_count) {
+				return false;
+			}
+		}
+
+		switch (rule->owner) {
+		case ACL_UPDATE_OWNER_NAME:
+			if (!compiled_match_names(rule, rr->owner, zone_name)) {
+				return false;
+			}
+			break;
+		case ACL_UPDATE_OWNER_KEY:
+			if (!match_name(rr->owner, key_name, rule->match)) {
+				return false;
+			}
+			break;
+		case ACL_UPDATE_OWNER_ZONE:
+			if (!match_name(rr->owner, zone_name, rule->match)) {
+				return false;
+			}
+			break;
+		default:
+			break;
+		}
+	}
+
+	return true;
+}
+
+bool acl_compiled_allowed(const acl_compiled_t *acl, acl_action_t action,
+                          const struct sockaddr_storage *addr, knot_tsig_key_t *tsig,
+                          const knot_dname_t *zone_name, knot_pkt_t *query,
+                          struct gnutls_session_int *tls_session)
+{
+	if (acl == NULL || addr == NULL || tsig == NULL) {
+		return false;
+	}
+
+	uint8_t session_pin[KNOT_TLS_PIN_LEN];
+	size_t session_pin_size = sizeof(session_pin);
+	knot_tls_pin(tls_session, session_pin, &session_pin_size, false);
+
+	bool forward = (action == ACL_ACTION_UPDATE) && acl->forward;
+
+	for (size_t i = 0; i < acl->count; i++) {
+		const acl_rule_t *rule = acl->rules[i];
+
+		/* Check if the action is allowed, cheap so first. */
+		if (action != ACL_ACTION_QUERY && !(rule->actions & (1 << action))) {
+			if (!rule->no_action) {
+				continue;
+			}
+		}
+
+		/* Check if a remote or acl address/key matches given address and key. */
+		const acl_key_t *key = NULL;
+		size_t j = 0;
+		while (j < rule->matcher_count &&
+		       !compiled_check_addr_key(&rule->matchers[j], addr, tsig,
+		                                session_pin, session_pin_size,
+		                                rule->deny, forward, &key)) {
+			j++;
+		}
+		if (j == rule->matcher_count) {
+			continue;
+		}
+
+		/* Empty action list allowed with deny only. */
+		if (action != ACL_ACTION_QUERY && rule->no_action) {
+			return false;
+		}
+
+		/* If the action is update, check for update rule match. */
+		if (action == ACL_ACTION_UPDATE &&
+		    !compiled_update_match(rule, tsig->name, zone_name, query)) {
+			continue;
+		}
+
+		/* Check if denied. */
+		if (rule->deny) {
+			return false;
+		}
+
+		/* Fill the output with tsig secret if provided. */
+		if (tsig->name != NULL && key != NULL) {
+			tsig->secret.data = key->secret.data;
+			tsig->secret.size = key->secret.size;
+		}
+
+		return true;
+	}
+
+	return false;
+}
@@ -21,6 +21,7 @@
 
 #include "libknot/quic/tls_common.h"
 #include "libknot/tsig.h"
+#include "contrib/qp-trie/trie.h"
 #include "knot/conf/conf.h"
 
 /*! \brief ACL actions. */
@@ -86,3 +87,78 @@ bool acl_allowed(conf_t *conf, conf_val_t *acl, acl_action_t action,
  */
 bool rmt_allowed(conf_t *conf, conf_val_t *rmts, const struct sockaddr_storage *addr,
                  knot_tsig_key_t *tsig, struct gnutls_session_int *tls_session);
+
+/*! \brief Compiled ACL rule (shared among zones referencing the same ACL). */
+typedef struct acl_rule acl_rule_t;
+
+/*!
+ * \brief Immutable zone ACL compiled from the configuration.
+ *
+ * Address ranges are kept sorted, keys are indexed by name, and actions
+ * are stored as a bitmap, so no configuration lookups are needed when
+ * evaluating a request.
+ */
+typedef struct {
+	bool forward;          /*!< DDNS is forwarded to the primary. */
+	size_t count;          /*!< Number of rules. */
+	acl_rule_t *rules[];   /*!< Rules in the configured order. */
+} acl_compiled_t;
+
+/*!
+ * \brief Compiles the zone ACL list.
+ *
+ * \note The cache and the compiled ACLs aren't thread-safe to create or free,
+ *       use them from a single thread only (evaluation is thread-safe).
+ *
+ * \param conf       Configuration.
+ * \param zone_name  Zone name.
+ * \param cache      Optional cache of already compiled rules (ACL id -> rule).
+ *
+ * \return Compiled ACL, NULL if failed.
+ */
+acl_compiled_t *acl_compile(conf_t *conf, const knot_dname_t *zone_name, trie_t *cache);
+
+/*!
+ * \brief Checks if the ACL rule depends on a section changed within the current
+ *        configuration reload context.
+ *
+ * \param conf  Configuration.
+ * \param acl   ACL identifier.
+ *
+ * \return True if the rule needs to be compiled again.
+ */
+bool acl_rule_changed(conf_t *conf, conf_val_t *acl);
+
+/*!
+ * \brief Frees the compiled ACL.
+ */
+void acl_compiled_free(acl_compiled_t *acl);
+
+/*!
+ * \brief Frees the cache of compiled rules.
+ *
+ * \note Rules still referenced by some compiled ACL are kept.
+ */
+void acl_cache_free(trie_t *cache);
+
+/*!
+ * \brief Checks if the address and/or tsig key matches the compiled ACL.
+ *
+ * Equivalent to acl_allowed() evaluated over the configuration the ACL
+ * was compiled from. If tsig.name is not empty, tsig.secret is filled
+ * with data valid until the compiled ACL is freed.
+ *
+ * \param acl          Compiled ACL.
+ * \param action       ACL action.
+ * \param addr         IP address.
+ * \param tsig         TSIG parameters.
+ * \param zone_name    Zone name.
+ * \param query        Update query.
+ * \param tls_session  Possible TLS session.
+ *
+ * \retval True if authenticated.
+ */
+bool acl_compiled_allowed(const acl_compiled_t *acl, acl_action_t action,
+                          const struct sockaddr_storage *addr, knot_tsig_key_t *tsig,
+                          const knot_dname_t *zone_name, knot_pkt_t *query,
+                          struct gnutls_session_int *tls_session);
@@ -678,8 +678,7 @@ static void get_zone_diff(zone_diff_t *zdiff, zone_update_t *up)
 
 static int commit_journal(conf_t *conf, zone_update_t *update)
 {
-	conf_val_t val = conf_zone_get(conf, C_JOURNAL_CONTENT, update->zone->name);
-	unsigned content = conf_opt(&val);
+	unsigned content = zone_conf_cache(conf, update->zone).journal_content;
 	int ret = KNOT_EOK;
 	if (update->flags & UPDATE_NO_CHSET) {
 		zone_diff_t diff;
@@ -863,8 +862,8 @@ int zone_update_semcheck(conf_t *conf, zone_update_t *update)
 		.cb = err_handler_logger
 	};
 
-	conf_val_t val = conf_zone_get(conf, C_SEM_CHECKS, update->zone->name);
-	semcheck_optional_t mode = (conf_opt(&val) == SEMCHECKS_SOFT) ?
+	unsigned checks = zone_conf_cache(conf, update->zone).semantic_checks;
+	semcheck_optional_t mode = (checks == SEMCHECKS_SOFT) ?
 	                           SEMCHECK_MANDATORY_SOFT : SEMCHECK_MANDATORY_ONLY;
 
 	ret = sem_checks_process(update->new_cont, mode, &handler, time(NULL));
@@ -878,8 +877,7 @@ int zone_update_semcheck(conf_t *conf, zone_update_t *update)
 
 int zone_update_verify_digest(conf_t *conf, zone_update_t *update)
 {
-	conf_val_t val = conf_zone_get(conf, C_ZONEMD_VERIFY, update->zone->name);
-	if (!conf_bool(&val)) {
+	if (!zone_conf_cache(conf, update->zone).zonemd_verify) {
 		return KNOT_EOK;
 	}
 
@@ -916,14 +914,13 @@ int zone_update_commit(conf_t *conf, zone_update_t *update)
 		return ret;
 	}
 
-	conf_val_t val = conf_zone_get(conf, C_DNSSEC_SIGNING, update->zone->name);
-	bool dnssec = conf_bool(&val);
+	conf_zone_cache_t zconf = zone_conf_cache(conf, update->zone);
+	bool dnssec = zconf.dnssec_signing;
 
-	conf_val_t thr = conf_zone_get(conf, C_ADJUST_THR, update->zone->name);
 	if ((update->flags & (UPDATE_HYBRID | UPDATE_FULL))) {
-		ret = zone_adjust_full(update->new_cont, conf_int(&thr));
+		ret = zone_adjust_full(update->new_cont, zconf.adjust_threads);
 	} else {
-		ret = zone_adjust_incremental_update(update, conf_int(&thr));
+		ret = zone_adjust_incremental_update(update, zconf.adjust_threads);
 	}
 	if (ret != KNOT_EOK) {
 		discard_adds_tree(update);
@@ -931,16 +928,12 @@ int zone_update_commit(conf_t *conf, zone_update_t *update)
 	}
 
 	/* Check the zone size. */
-	val = conf_zone_get(conf, C_ZONE_MAX_SIZE, update->zone->name);
-	size_t size_limit = conf_int(&val);
-
-	if (update->new_cont->size > size_limit) {
+	if (update->new_cont->size > zconf.zone_max_size) {
 		discard_adds_tree(update);
 		return KNOT_EZONESIZE;
 	}
 
-	val = conf_zone_get(conf, C_DNSSEC_VALIDATION, update->zone->name);
-	if (conf_bool(&val)) {
+	if (zconf.dnssec_validation) {
 		bool incr_valid = update->flags & UPDATE_INCREMENTAL;
 		ret = knot_dnssec_validate_zone(update, conf, 0, incr_valid, true);
 		if (ret != KNOT_EOK) {
@@ -976,6 +969,7 @@ int zone_update_commit(conf_t *conf, zone_update_t *update)
 	/* Switch zone contents. */
 	zone_contents_t *old_contents;
 	old_contents = zone_switch_contents(update->zone, update->new_cont);
+	server_update_xdp_answers(conf, update->zone->server, update->zone, update->new_cont);
 
 	if (update->flags & (UPDATE_INCREMENTAL | UPDATE_HYBRID)) {
 		changeset_clear(&update->change);
@@ -1001,8 +995,7 @@ int zone_update_commit(conf_t *conf, zone_update_t *update)
 	zone_local_notify(update->zone);
 
 	/* Sync zonefile immediately if configured. */
-	val = conf_zone_get(conf, C_ZONEFILE_SYNC, update->zone->name);
-	if (conf_int(&val) == 0) {
+	if (zconf.zonefile_sync == 0) {
 		zone_events_schedule_now(update->zone, ZONE_EVENT_FLUSH);
 	}
 
@@ -14,8 +14,17 @@
     along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include <errno.h>
 #include <inttypes.h>
-
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "contrib/macros.h"
+#include "contrib/time.h"
 #include "knot/dnssec/zone-nsec.h"
 #include "knot/zone/zone-dump.h"
 #include "libknot/libknot.h"
@@ -23,9 +32,29 @@
 /*! \brief Size of auxiliary buffer. */
 #define DUMP_BUF_LEN (70 * 1024)
 
+/*! \brief Number and size of buffers passed to the background writer. */
+#define WRITER_BUFS	4
+#define WRITER_BUF_LEN	(1024 * 1024)
+
+/*! \brief Background writer of formatted zone contents. */
+typedef struct {
+	int fd;
+	pthread_t thread;
+	pthread_mutex_t mx;
+	pthread_cond_t cond;
+	char *bufs[WRITER_BUFS];
+	size_t lens[WRITER_BUFS];
+	unsigned fill;     // Buffer being filled by the formatter.
+	unsigned write;    // Next buffer to be written by the writer.
+	unsigned pending;  // Number of buffers passed to the writer.
+	bool finish;
+	int ret;
+} dump_writer_t;
+
 /*! \brief Dump parameters. */
 typedef struct {
 	FILE     *file;
+	dump_writer_t *writer;
 	char     *buf;
 	size_t   buflen;
 	uint64_t rr_count;
@@ -36,20 +65,172 @@ typedef struct {
 	const char *first_comment;
 } dump_params_t;
 
+static int write_all(int fd, const char *data, size_t len)
+{
+	while (len > 0) {
+		ssize_t ret = write(fd, data, len);
+		if (ret < 0) {
+			if (errno == EINTR) {
+				continue;
+			}
+			return knot_map_errno();
+		}
+		data += ret;
+		len -= ret;
+	}
+
+	return KNOT_EOK;
+}
+
+static void *writer_thread(void *arg)
+{
+	dump_writer_t *w = arg;
+
+	pthread_mutex_lock(&w->mx);
+	while (true) {
+		while (w->pending == 0 && !w->finish) {
+			pthread_cond_wait(&w->cond, &w->mx);
+		}
+		if (w->pending == 0) {
+			break;
+		}
+		unsigned idx = w->write;
+		bool failed = (w->ret != KNOT_EOK);
+		pthread_mutex_unlock(&w->mx);
+
+		int ret = KNOT_EOK;
+		if (!failed) { // Skip writing after an error.
+			ret = write_all(w->fd, w->bufs[idx], w->lens[idx]);
+		}
+
+		pthread_mutex_lock(&w->mx);
+		if (ret != KNOT_EOK) {
+			w->ret = ret;
+		}
+		w->lens[idx] = 0;
+		w->write = (w->write + 1) % WRITER_BUFS;
+		w->pending--;
+		pthread_cond_broadcast(&w->cond);
+	}
+	pthread_mutex_unlock(&w->mx);
+
+	return NULL;
+}
+
+static int writer_init(dump_writer_t *w, int fd)
+{
+	memset(w, 0, sizeof(*w));
+	w->fd = fd;
+
+	for (int i = 0; i < WRITER_BUFS; i++) {
+		w->bufs[i] = malloc(WRITER_BUF_LEN);
+		if (w->bufs[i] == NULL) {
+			for (int j = 0; j < i; j++) {
+				free(w->bufs[j]);
+			}
+			return KNOT_ENOMEM;
+		}
+	}
+
+	pthread_mutex_init(&w->mx, NULL);
+	pthread_cond_init(&w->cond, NULL);
+	if (pthread_create(&w->thread, NULL, writer_thread, w) != 0) {
+		pthread_mutex_destroy(&w->mx);
+		pthread_cond_destroy(&w->cond);
+		for (int i = 0; i < WRITER_BUFS; i++) {
+			free(w->bufs[i]);
+		}
+		return KNOT_ERROR;
+	}
+
+	return KNOT_EOK;
+}
+
+/*! \brief Pass the filled buffer to the writer and wait for a free one. */
+static int writer_flush(dump_writer_t *w)
+{
+	pthread_mutex_lock(&w->mx);
+	if (w->lens[w->fill] > 0) {
+		w->fill = (w->fill + 1) % WRITER_BUFS;
+		w->pending++;
+		pthread_cond_broadcast(&w->cond);
+	}
+	while (w->pending == WRITER_BUFS) {
+		pthread_cond_wait(&w->cond, &w->mx);
+	}
+	int ret = w->ret;
+	pthread_mutex_unlock(&w->mx);
+
+	return ret;
+}
+
+static int writer_deinit(dump_writer_t *w)
+{
+	(void)writer_flush(w);
+
+	pthread_mutex_lock(&w->mx);
+	w->finish = true;
+	pthread_cond_broadcast(&w->cond);
+	pthread_mutex_unlock(&w->mx);
+
+	pthread_join(w->thread, NULL);
+	pthread_mutex_destroy(&w->mx);
+	pthread_cond_destroy(&w->cond);
+	for (int i = 0; i < WRITER_BUFS; i++) {
+		free(w->bufs[i]);
+	}
+
+	return w->ret;
+}
+
+static int dump_write(dump_params_t *params, const char *str, size_t len)
+{
+	dump_writer_t *w = params->writer;
+	if (w == NULL) {
+		return (fwrite(str, 1, len, params->file) == len) ? KNOT_EOK : KNOT_EFILE;
+	}
+
+	while (len > 0) {
+		size_t avail = WRITER_BUF_LEN - w->lens[w->fill];
+		if (avail == 0) {
+			int ret = writer_flush(w);
+			if (ret != KNOT_EOK) {
+				return ret;
+			}
+			continue;
+		}
+		size_t chunk = MIN(len, avail);
+		memcpy(w->bufs[w->fill] + w->lens[w->fill], str, chunk);
+		w->lens[w->fill] += chunk;
+		str += chunk;
+		len -= chunk;
+	}
+
+	return KNOT_EOK;
+}
+
+static int dump_rrset(dump_params_t *params, const knot_rrset_t *rrset)
+{
+	int ret = knot_rrset_txt_dump(rrset, &params->buf, &params->buflen,
+	                              params->style);
+	if (ret < 0) {
+		return ret;
+	}
+	params->rr_count += rrset->rrs.count;
+
+	return dump_write(params, params->buf, ret);
+}
+
 static int apex_node_dump_text(zone_node_t *node, dump_params_t *params)
 {
 	knot_rrset_t soa = node_rrset(node, KNOT_RRTYPE_SOA);
 
 	// Dump SOA record as a first.
 	if (!params->dump_nsec) {
-		int ret = knot_rrset_txt_dump(&soa, &params->buf, &params->buflen,
-		                              params->style);
-		if (ret < 0) {
+		int ret = dump_rrset(params, &soa);
+		if (ret != KNOT_EOK) {
 			return ret;
 		}
-		params->rr_count += soa.rrs.count;
-		fprintf(params->file, "%s", params->buf);
-		params->buf[0] = '\0';
 	}
 
 	// Dump other records.
@@ -66,14 +247,10 @@ static int apex_node_dump_text(zone_node_t *node, dump_params_t *params)
 			break;
 		}
 
-		int ret = knot_rrset_txt_dump(&rrset, &params->buf, &params->buflen,
-		                              params->style);
-		if (ret < 0) {
+		int ret = dump_rrset(params, &rrset);
+		if (ret != KNOT_EOK) {
 			return ret;
 		}
-		params->rr_count +=  rrset.rrs.count;
-		fprintf(params->file, "%s", params->buf);
-		params->buf[0] = '\0';
 	}
 
 	return KNOT_EOK;
@@ -86,8 +263,7 @@ static int node_dump_text(zone_node_t *node, void *data)
 	// Zone apex rrsets.
 	if (node->owner == params->origin && !params->dump_rrsig &&
 	    !params->dump_nsec) {
-		apex_node_dump_text(node, params);
-		return KNOT_EOK;
+		return apex_node_dump_text(node, params);
 	}
 
 	// Dump non-apex rrsets.
@@ -118,101 +294,74 @@ static int node_dump_text(zone_node_t *node, void *data)
 
 		// Dump block comment if available.
 		if (params->first_comment != NULL) {
-			fprintf(params->file, "%s", params->first_comment);
+			int ret = dump_write(params, params->first_comment,
+			                     strlen(params->first_comment));
+			if (ret != KNOT_EOK) {
+				return ret;
+			}
 			params->first_comment = NULL;
 		}
 
-		int ret = knot_rrset_txt_dump(&rrset, &params->buf, &params->buflen,
-		                              params->style);
-		if (ret < 0) {
+		int ret = dump_rrset(params, &rrset);
+		if (ret != KNOT_EOK) {
 			return ret;
 		}
-		params->rr_count += rrset.rrs.count;
-		fprintf(params->file, "%s", params->buf);
-		params->buf[0] = '\0';
 	}
 
 	return KNOT_EOK;
 }
 
-int zone_dump_text(zone_contents_t *zone, FILE *file, bool comments, const char *color)
+static int dump_zone(zone_contents_t *zone, dump_params_t *params, bool comments)
 {
-	if (file == NULL) {
-		return KNOT_EINVAL;
-	}
-
-	if (zone == NULL) {
-		return KNOT_EEMPTYZONE;
-	}
-
-	// Allocate auxiliary buffer for dumping operations.
-	char *buf = malloc(DUMP_BUF_LEN);
-	if (buf == NULL) {
-		return KNOT_ENOMEM;
-	}
+	char tmp[128];
 
 	if (comments) {
-		fprintf(file, ";; Zone dump (Knot DNS %s)\n", PACKAGE_VERSION);
+		int len = snprintf(tmp, sizeof(tmp), ";; Zone dump (Knot DNS %s)\n",
+		                   PACKAGE_VERSION);
+		int ret = dump_write(params, tmp, len);
+		if (ret != KNOT_EOK) {
+			return ret;
+		}
 	}
 
-	// Set structure with parameters.
-	knot_dump_style_t style = KNOT_DUMP_STYLE_DEFAULT;
-	style.color = color;
-	style.now = knot_time();
-	dump_params_t params = {
-		.file = file,
-		.buf = buf,
-		.buflen = DUMP_BUF_LEN,
-		.rr_count = 0,
-		.origin = zone->apex->owner,
-		.style = &style,
-		.dump_rrsig = false,
-		.dump_nsec = false
-	};
-
 	// Dump standard zone records without RRSIGS.
-	int ret = zone_contents_apply(zone, node_dump_text, &params);
+	int ret = zone_contents_apply(zone, node_dump_text, params);
 	if (ret != KNOT_EOK) {
-		free(params.buf);
 		return ret;
 	}
 
 	// Dump RRSIG records if available.
-	params.dump_rrsig = true;
-	params.dump_nsec = false;
-	params.first_comment = comments ? ";; DNSSEC signatures\n" : NULL;
-	ret = zone_contents_apply(zone, node_dump_text, &params);
+	params->dump_rrsig = true;
+	params->dump_nsec = false;
+	params->first_comment = comments ? ";; DNSSEC signatures\n" : NULL;
+	ret = zone_contents_apply(zone, node_dump_text, params);
 	if (ret != KNOT_EOK) {
-		free(params.buf);
 		return ret;
 	}
 
 	// Dump NSEC chain if available.
-	params.dump_rrsig = false;
-	params.dump_nsec = true;
-	params.first_comment = comments ? ";; DNSSEC NSEC chain\n" : NULL;
-	ret = zone_contents_apply(zone, node_dump_text, &params);
+	params->dump_rrsig = false;
+	params->dump_nsec = true;
+	params->first_comment = comments ? ";; DNSSEC NSEC chain\n" : NULL;
+	ret = zone_contents_apply(zone, node_dump_text, params);
 	if (ret != KNOT_EOK) {
-		free(params.buf);
 		return ret;
 	}
 
 	// Dump NSEC3 chain if available.
-	params.dump_rrsig = false;
-	params.dump_nsec = true;
-	params.first_comment = comments ? ";; DNSSEC NSEC3 chain\n" : NULL;
-	ret = zone_contents_nsec3_apply(zone, node_dump_text, &params);
+	params->dump_rrsig = false;
+	params->dump_nsec = true;
+	params->first_comment = comments ? ";; DNSSEC NSEC3 chain\n" : NULL;
+	ret = zone_contents_nsec3_apply(zone, node_dump_text, params);
 	if (ret != KNOT_EOK) {
-		free(params.buf);
 		return ret;
 	}
 
-	params.dump_rrsig = true;
-	params.dump_nsec = false;
-	params.first_comment = comments ? ";; DNSSEC NSEC3 signatures\n" : NULL;
-	ret = zone_contents_nsec3_apply(zone, node_dump_text, &params);
+	params->dump_rrsig = true;
+	params->dump_nsec = false;
+	params->first_comment = comments ? ";; DNSSEC NSEC3 signatures\n" : NULL;
+	ret = zone_contents_nsec3_apply(zone, node_dump_text, params);
 	if (ret != KNOT_EOK) {
-		free(params.buf);
 		return ret;
 	}
 
@@ -225,12 +374,74 @@ int zone_dump_text(zone_contents_t *zone, FILE *file, bool comments, const char
 		strftime(date, sizeof(date), "%Y-%m-%d %H:%M:%S %Z", &tm);
 
 		// Dump trailing statistics.
-		fprintf(file, ";; Written %"PRIu64" records\n"
-		              ";; Time %s\n",
-		        params.rr_count, date);
+		int len = snprintf(tmp, sizeof(tmp), ";; Written %"PRIu64" records\n"
+		                                     ";; Time %s\n",
+		                   params->rr_count, date);
+		ret = dump_write(params, tmp, len);
 	}
 
+	return ret;
+}
+
+static int dump_text(zone_contents_t *zone, FILE *file, dump_writer_t *writer,
+                     bool comments, const char *color)
+{
+	if (zone == NULL) {
+		return KNOT_EEMPTYZONE;
+	}
+
+	// Allocate auxiliary buffer for dumping operations.
+	char *buf = malloc(DUMP_BUF_LEN);
+	if (buf == NULL) {
+		return KNOT_ENOMEM;
+	}
+
+	// Set structure with parameters.
+	knot_dump_style_t style = KNOT_DUMP_STYLE_DEFAULT;
+	style.color = color;
+	style.now = knot_time();
+	dump_params_t params = {
+		.file = file,
+		.writer = writer,
+		.buf = buf,
+		.buflen = DUMP_BUF_LEN,
+		.rr_count = 0,
+		.origin = zone->apex->owner,
+		.style = &style,
+		.dump_rrsig = false,
+		.dump_nsec = false
+	};
+
+	int ret = dump_zone(zone, &params, comments);
+
 	free(params.buf); // params.buf may be != buf because of knot_rrset_txt_dump_dynamic()
 
-	return KNOT_EOK;
+	return ret;
+}
+
+int zone_dump_text(zone_contents_t *zone, FILE *file, bool comments, const char *color)
+{
+	if (file == NULL) {
+		return KNOT_EINVAL;
+	}
+
+	return dump_text(zone, file, NULL, comments, color);
+}
+
+int zone_dump_text_fd(zone_contents_t *zone, int fd, bool comments)
+{
+	if (fd < 0) {
+		return KNOT_EINVAL;
+	}
+
+	dump_writer_t writer;
+	int ret = writer_init(&writer, fd);
+	if (ret != KNOT_EOK) {
+		return ret;
+	}
+
+	ret = dump_text(zone, NULL, &writer, comments, NULL);
+	int wret = writer_deinit(&writer);
+
+	return (ret == KNOT_EOK) ? wret : ret;
 }
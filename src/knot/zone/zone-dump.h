@@ -30,3 +30,23 @@
  * \retval < 0 if error.
  */
 int zone_dump_text(zone_contents_t *zone, FILE *file, bool comments, const char *color);
+
+/*!
+ * \brief Dumps given zone to a file descriptor.
+ *
+ * The records are formatted into large buffers, which are written to the file
+ * by a background thread, so that the formatting overlaps with the file I/O.
+ *
+ * \note The function returns after all the data is written. The contents must
+ *       not change during the dump and the zone flush records the flushed
+ *       serial only once the file is complete, so the calling zone event
+ *       can't be released earlier.
+ *
+ * \param zone      Zone to be saved.
+ * \param fd        File descriptor to write to.
+ * \param comments  Add separating comments indicator.
+ *
+ * \retval KNOT_EOK on success.
+ * \retval < 0 if error.
+ */
+int zone_dump_text_fd(zone_contents_t *zone, int fd, bool comments);
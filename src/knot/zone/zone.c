@@ -72,8 +72,7 @@ static int flush_journal(conf_t *conf, zone_t *zone, bool allow_empty_zone, bool
 	bool force = zone_get_flag(zone, ZONE_FORCE_FLUSH, true);
 	bool user_flush = zone_get_flag(zone, ZONE_USER_FLUSH, true);
 
-	conf_val_t val = conf_zone_get(conf, C_ZONEFILE_SYNC, zone->name);
-	int64_t sync_timeout = conf_int(&val);
+	int64_t sync_timeout = zone_conf_cache(conf, zone).zonefile_sync;
 
 	if (zone_contents_is_empty(zone->contents)) {
 		if (allow_empty_zone && journal_is_existing(j)) {
@@ -241,6 +240,9 @@ void zone_free(zone_t **zone_ptr)
 
 	conf_deactivate_modules(&zone->query_modules, &zone->query_plan);
 
+	acl_compiled_free(zone->acl);
+	free(zone->conf_cache);
+
 	ptrlist_free(&zone->internal_notify, NULL);
 
 	free(zone);
@@ -477,9 +479,33 @@ zone_contents_t *zone_switch_contents(zone_t *zone, zone_contents_t *new_content
 	zone_contents_t **current_contents = &zone->contents;
 	old_contents = rcu_xchg_pointer(current_contents, new_contents);
 
+	if (new_contents == NULL) {
+		server_update_xdp_answers(NULL, zone->server, zone, NULL);
+	}
+
 	return old_contents;
 }
 
+conf_zone_cache_t zone_conf_cache(conf_t *conf, const zone_t *zone)
+{
+	assert(conf != NULL && zone != NULL);
+
+	conf_zone_cache_t out;
+
+	rcu_read_lock();
+	const conf_zone_cache_t *cache = rcu_dereference(zone->conf_cache);
+	if (cache != NULL) {
+		out = *cache;
+	}
+	rcu_read_unlock();
+
+	if (cache == NULL) {
+		out = conf_zone_cache(conf, zone->name);
+	}
+
+	return out;
+}
+
 bool zone_is_slave(conf_t *conf, const zone_t *zone)
 {
 	if (conf == NULL || zone == NULL) {
@@ -824,8 +850,7 @@ int slave_zone_serial(zone_t *zone, conf_t *conf, uint32_t *serial)
 	assert(zone->contents != NULL);
 	*serial = zone_contents_serial(zone->contents);
 
-	conf_val_t val = conf_zone_get(conf, C_DNSSEC_SIGNING, zone->name);
-	if (conf_bool(&val)) {
+	if (zone_conf_cache(conf, zone).dnssec_signing) {
 		ret = zone_get_master_serial(zone, serial);
 	}
 
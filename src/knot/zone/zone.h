@@ -24,6 +24,7 @@
 #include "knot/journal/journal_basic.h"
 #include "knot/journal/serialization.h"
 #include "knot/events/events.h"
+#include "knot/updates/acl.h"
 #include "knot/updates/changesets.h"
 #include "knot/zone/contents.h"
 #include "knot/zone/timers.h"
@@ -49,6 +50,7 @@ typedef enum {
 	ZONE_IS_CAT_MEMBER  = 1 << 6, /*!< This zone exists according to a catalog. */
 	ZONE_XFR_FROZEN     = 1 << 7, /*!< Outgoing AXFR/IXFR temporarily disabled. */
 	ZONE_USER_FLUSH     = 1 << 8, /*!< User-triggered flush. */
+	ZONE_XDP_ANSWERS    = 1 << 9, /*!< Apex answers are in the XDP answer map. */
 } zone_flag_t;
 
 /*!
@@ -143,6 +145,12 @@ typedef struct zone
 	/*! \brief Query modules. */
 	list_t query_modules;
 	struct query_plan *query_plan;
+
+	/*! \brief Compiled zone ACL (RCU protected, NULL if not compiled). */
+	acl_compiled_t *acl;
+
+	/*! \brief Flattened zone configuration (RCU protected, NULL if not set). */
+	conf_zone_cache_t *conf_cache;
 } zone_t;
 
 /*!
@@ -229,6 +237,14 @@ void zone_schedule_notify(zone_t *zone, time_t delay);
  */
 zone_contents_t *zone_switch_contents(zone_t *zone, zone_contents_t *new_contents);
 
+/*!
+ * \brief Returns the flattened zone configuration.
+ *
+ * The snapshot taken upon the last zone database reload is used if available,
+ * otherwise the configuration is read.
+ */
+conf_zone_cache_t zone_conf_cache(conf_t *conf, const zone_t *zone);
+
 /*! \brief Checks if the zone is slave. */
 bool zone_is_slave(conf_t *conf, const zone_t *zone);
 
@@ -20,9 +20,11 @@
 
 #include "knot/catalog/generate.h"
 #include "knot/common/log.h"
+#include "knot/conf/confio.h"
 #include "knot/conf/module.h"
 #include "knot/events/replan.h"
 #include "knot/journal/journal_metadata.h"
+#include "knot/server/server.h"
 #include "knot/zone/digest.h"
 #include "knot/zone/timers.h"
 #include "knot/zone/zone-load.h"
@@ -112,6 +114,7 @@ static zone_t *create_zone_reload(conf_t *conf, const knot_dname_t *name,
 
 	zone->contents = old_zone->contents;
 	zone_set_flag(zone, zone_get_flag(old_zone, ~0, false));
+	server_update_xdp_answers(conf, server, zone, zone->contents);
 
 	zone->timers = old_zone->timers;
 	zone_timers_sanitize(conf, zone);
@@ -554,8 +557,10 @@ static void remove_old_zonedb(conf_t *conf, knot_zonedb_t *db_old,
 			if (new_zone != NULL) {
 				replan_events(conf, new_zone, zone);
 				zone->contents = NULL;
+			} else {
+				/* Removed zone. */
+				server_update_xdp_answers(NULL, server, zone, NULL);
 			}
-			/* Completely new zone. */
 		} else {
 			/* Check if reloaded (reused contents). */
 			if (zone->change_type & CONF_IO_TRELOAD) {
@@ -566,6 +571,7 @@ static void remove_old_zonedb(conf_t *conf, knot_zonedb_t *db_old,
 				zone_free(&zone);
 			/* Check if removed (drop also contents). */
 			} else if (zone->change_type & CONF_IO_TUNSET) {
+				server_update_xdp_answers(NULL, server, zone, NULL);
 				zone_free(&zone);
 			}
 			/* Completely reused zone. */
@@ -593,6 +599,149 @@ static void zone_contents_deep_free_wrap(void *contents)
 	zone_contents_deep_free((zone_contents_t *)contents);
 }
 
+// UBSAN type punning workaround
+static void acl_compiled_free_wrap(void *acl)
+{
+	acl_compiled_free((acl_compiled_t *)acl);
+}
+
+#define RULE_CHANGED	((trie_val_t)1)
+#define RULE_UNCHANGED	((trie_val_t)2)
+
+/*!
+ * \brief Checks if the zone configuration has changed within the reload context.
+ *
+ * \param conf     New server configuration.
+ * \param zone     Zone to be checked.
+ * \param checked  Already checked ACL rules.
+ */
+static bool zone_conf_changed(conf_t *conf, zone_t *zone, trie_t *checked)
+{
+	/* Just created zone. */
+	if (zone->conf_cache == NULL) {
+		return true;
+	}
+
+	size_t name_size = knot_dname_size(zone->name);
+	if (conf->io.zones != NULL &&
+	    trie_get_try(conf->io.zones, zone->name, name_size) != NULL) {
+		return true;
+	}
+
+	if (conf->io.refs == NULL || trie_weight(conf->io.refs) == 0) {
+		return false;
+	}
+
+	conf_val_t val = conf_rawid_get(conf, C_ZONE, C_TPL, zone->name, name_size);
+	if (val.code == KNOT_EOK) {
+		conf_val(&val);
+		if (conf_io_ref_changed(conf, C_TPL, val.data, val.len)) {
+			return true;
+		}
+	} else if (zone_get_flag(zone, ZONE_IS_CAT_MEMBER, false)) {
+		/* The catalog template isn't resolved here. */
+		if (conf_io_ref_changed(conf, C_TPL, NULL, 0)) {
+			return true;
+		}
+	} else if (conf_io_ref_changed(conf, C_TPL, CONF_DEFAULT_ID + 1,
+	                               CONF_DEFAULT_ID[0])) {
+		return true;
+	}
+
+	val = conf_zone_get(conf, C_ACL, zone->name);
+	while (val.code == KNOT_EOK) {
+		conf_val(&val);
+		trie_val_t *rule = trie_get_ins(checked, val.data, val.len);
+		if (rule == NULL) {
+			return true;
+		}
+		if (*rule == NULL) {
+			*rule = acl_rule_changed(conf, &val) ? RULE_CHANGED : RULE_UNCHANGED;
+		}
+		if (*rule == RULE_CHANGED) {
+			return true;
+		}
+		conf_val_next(&val);
+	}
+
+	return false;
+}
+
+/*!
+ * \brief Prepares compiled ACLs and flattened configuration of zones.
+ *
+ * \param conf          New server configuration.
+ * \param db            Zone database.
+ * \param changed_only  Update just the zones affected by the reload context.
+ * \param acl_tofree    List of replaced compiled ACLs.
+ * \param cache_tofree  List of replaced configuration snapshots.
+ */
+static void update_zone_confs(conf_t *conf, knot_zonedb_t *db, bool changed_only,
+                              list_t *acl_tofree, list_t *cache_tofree)
+{
+	/* Rules are shared by all zones referencing the same ACL. */
+	trie_t *acl_cache = trie_create(NULL);
+
+	/* Everything is updated if any zone might have changed. */
+	trie_t *checked = NULL;
+	if (changed_only && !(conf->io.flags & CONF_IO_FDIFF_ZONES)) {
+		checked = trie_create(NULL);
+	}
+
+	knot_zonedb_iter_t *it = knot_zonedb_iter_begin(db);
+	while (!knot_zonedb_iter_finished(it)) {
+		zone_t *zone = knot_zonedb_iter_val(it);
+
+		if (checked != NULL && !zone_conf_changed(conf, zone, checked)) {
+			knot_zonedb_iter_next(it);
+			continue;
+		}
+
+		acl_compiled_t *acl = acl_compile(conf, zone->name, acl_cache);
+		if (acl == NULL) {
+			log_zone_warning(zone->name, "failed to compile ACL, "
+			                 "using slower configuration lookups");
+		}
+		acl_compiled_t *old_acl = rcu_xchg_pointer(&zone->acl, acl);
+		if (old_acl != NULL) {
+			ptrlist_add(acl_tofree, old_acl, NULL);
+		}
+
+		conf_zone_cache_t *cache = malloc(sizeof(*cache));
+		if (cache != NULL) {
+			*cache = conf_zone_cache(conf, zone->name);
+		}
+		conf_zone_cache_t *old_cache = rcu_xchg_pointer(&zone->conf_cache, cache);
+		if (old_cache != NULL) {
+			ptrlist_add(cache_tofree, old_cache, NULL);
+		}
+
+		knot_zonedb_iter_next(it);
+	}
+	knot_zonedb_iter_free(it);
+
+	trie_free(checked);
+	acl_cache_free(acl_cache);
+}
+
+void zonedb_update_confs(conf_t *conf, server_t *server)
+{
+	if (conf == NULL || server == NULL || server->zone_db == NULL) {
+		return;
+	}
+
+	list_t acl_tofree, cache_tofree;
+	init_list(&acl_tofree);
+	init_list(&cache_tofree);
+
+	update_zone_confs(conf, server->zone_db, true, &acl_tofree, &cache_tofree);
+
+	synchronize_rcu();
+
+	ptrlist_free_custom(&acl_tofree, NULL, acl_compiled_free_wrap);
+	ptrlist_free_custom(&cache_tofree, NULL, free);
+}
+
 void zonedb_reload(conf_t *conf, server_t *server, reload_t mode)
 {
 	if (conf == NULL || server == NULL) {
@@ -606,8 +755,10 @@ void zonedb_reload(conf_t *conf, server_t *server, reload_t mode)
 		}
 	}
 
-	list_t contents_tofree;
+	list_t contents_tofree, acl_tofree, cache_tofree;
 	init_list(&contents_tofree);
+	init_list(&acl_tofree);
+	init_list(&cache_tofree);
 
 	catalog_update_finalize(&server->catalog_upd, &server->catalog, conf);
 	size_t cat_upd_size = trie_weight(server->catalog_upd.upd);
@@ -624,6 +775,9 @@ void zonedb_reload(conf_t *conf, server_t *server, reload_t mode)
 
 	catalogs_generate(db_new, server->zone_db);
 
+	update_zone_confs(conf, db_new, mode & (RELOAD_COMMIT | RELOAD_CATALOG),
+	                  &acl_tofree, &cache_tofree);
+
 	/* Switch the databases. */
 	knot_zonedb_t **db_current = &server->zone_db;
 	knot_zonedb_t *db_old = rcu_xchg_pointer(db_current, db_new);
@@ -632,6 +786,8 @@ void zonedb_reload(conf_t *conf, server_t *server, reload_t mode)
 	synchronize_rcu();
 
 	ptrlist_free_custom(&contents_tofree, NULL, zone_contents_deep_free_wrap);
+	ptrlist_free_custom(&acl_tofree, NULL, acl_compiled_free_wrap);
+	ptrlist_free_custom(&cache_tofree, NULL, free);
 
 	/* Remove old zone DB. */
 	remove_old_zonedb(conf, db_old, server, mode);
@@ -655,6 +811,11 @@ int zone_reload_modules(conf_t *conf, server_t *server, const knot_dname_t *zone
 	knot_sem_wait(&newzone->cow_lock);
 	conf_activate_modules(conf, server, newzone->name, &newzone->query_modules,
 	                      &newzone->query_plan);
+	newzone->acl = acl_compile(conf, newzone->name, NULL);
+	newzone->conf_cache = malloc(sizeof(*newzone->conf_cache));
+	if (newzone->conf_cache != NULL) {
+		*newzone->conf_cache = conf_zone_cache(conf, newzone->name);
+	}
 
 	zone_t *oldzone = rcu_xchg_pointer(zone, newzone);
 	synchronize_rcu();
@@ -28,6 +28,17 @@
  */
 void zonedb_reload(conf_t *conf, server_t *server, reload_t mode);
 
+/*!
+ * \brief Refresh compiled ACLs and configuration snapshots of the zones affected
+ *        by the configuration changes.
+ *
+ * Used if an ACL, remote, or key has changed without a need to reload zones.
+ *
+ * \param conf    Configuration.
+ * \param server  Server instance.
+ */
+void zonedb_update_confs(conf_t *conf, server_t *server);
+
 /*!
  * \brief Re-create zone_t struct in zoneDB so that the zone is reloaded incl modules.
  *
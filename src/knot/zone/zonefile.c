@@ -297,8 +297,10 @@ int zonefile_write(const char *path, zone_contents_t *zone)
 		return ret;
 	}
 
-	ret = zone_dump_text(zone, file, true, NULL);
-	fclose(file);
+	ret = zone_dump_text_fd(zone, fileno(file), true);
+	if (fclose(file) != 0 && ret == KNOT_EOK) {
+		ret = knot_map_errno();
+	}
 	if (ret != KNOT_EOK) {
 		unlink(tmp_name);
 		free(tmp_name);
@@ -30,6 +30,7 @@
 #include <time.h>
 
 #include "libknot/quic/quic.h"
+#include "libknot/quic/tls_common_internal.h"
 
 #include "contrib/macros.h"
 #include "contrib/sockaddr.h"
@@ -245,10 +246,22 @@ static void init_random_cid(ngtcp2_cid *cid, size_t len)
 	}
 }
 
+static void init_shard_cid(ngtcp2_cid *cid, size_t len, const knot_quic_table_t *table)
+{
+	init_random_cid(cid, len);
+
+	// Keep the CID random, just make it map to the owning worker.
+	if (table->cid_shards > 0 && cid->datalen >= sizeof(uint16_t)) {
+		uint32_t span = (UINT16_MAX + 1) / table->cid_shards;
+		uint32_t val = knot_wire_read_u16(cid->data) % span;
+		knot_wire_write_u16(cid->data, val * table->cid_shards + table->cid_shard);
+	}
+}
+
 static bool init_unique_cid(ngtcp2_cid *cid, size_t len, knot_quic_table_t *table)
 {
 	do {
-		if (init_random_cid(cid, len), cid->datalen == 0) {
+		if (init_shard_cid(cid, len, table), cid->datalen == 0) {
 			return false;
 		}
 	} while (quic_table_lookup(cid, table) != NULL);
@@ -307,6 +320,8 @@ static int handshake_completed_cb(ngtcp2_conn *conn, void *user_data)
 		       == KNOT_EOK ? 0 : NGTCP2_ERR_CALLBACK_FAILURE;
 	}
 
+	knot_creds_handshake_done(ctx->quic_table->creds, ctx->tls_session);
+
 	if (gnutls_session_ticket_send(ctx->tls_session, 1, 0) != GNUTLS_E_SUCCESS) {
 		return TLS_CALLBACK_ERR;
 	}
@@ -876,7 +891,8 @@ static int send_special(knot_quic_table_t *quic_table, knot_quic_reply_t *rpl,
 		ngtcp2_cid_init(&dcid, decoded_cids.dcid, decoded_cids.dcidlen);
 		ngtcp2_cid_init(&scid, decoded_cids.scid, decoded_cids.scidlen);
 
-		init_random_cid(&new_dcid, 0);
+		// The retried Initial must return to this worker to validate the token.
+		init_shard_cid(&new_dcid, 0, quic_table);
 
 		ret = ngtcp2_crypto_generate_retry_token(
 			retry_token, (const uint8_t *)quic_table->hash_secret,
@@ -87,6 +87,17 @@ knot_quic_table_t *knot_quic_table_new(size_t max_conns, size_t max_ibufs, size_
 	return res;
 }
 
+_public_
+void knot_quic_table_set_shard(knot_quic_table_t *table, uint16_t shard,
+                               uint16_t shards)
+{
+	if (table != NULL) {
+		assert(shards == 0 || shard < shards);
+		table->cid_shard = shard;
+		table->cid_shards = shards;
+	}
+}
+
 _public_
 void knot_quic_table_free(knot_quic_table_t *table)
 {
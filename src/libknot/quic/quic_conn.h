@@ -123,6 +123,8 @@ typedef struct knot_quic_table {
 	struct knot_creds *creds;
 	struct gnutls_priority_st *priority;
 	struct heap *expiry_heap;
+	uint16_t cid_shard;  // index of the owning worker encoded in generated CIDs
+	uint16_t cid_shards; // number of workers, 0 if CID steering is disabled
 	knot_quic_cid_t *conns[];
 } knot_quic_table_t;
 
@@ -140,6 +142,21 @@ typedef struct knot_quic_table {
 knot_quic_table_t *knot_quic_table_new(size_t max_conns, size_t max_ibufs, size_t max_obufs,
                                        size_t udp_payload, struct knot_creds *creds);
 
+/*!
+ * \brief Make locally generated CIDs encode the owning worker.
+ *
+ * The first two bytes of each server-chosen CID (in network byte order)
+ * modulo \a shards equal \a shard, so that a SO_REUSEPORT socket filter
+ * can steer all packets of a connection to the same worker regardless of
+ * the client address.
+ *
+ * \param table    QUIC table of the worker.
+ * \param shard    Index of the worker.
+ * \param shards   Number of workers (0 disables the encoding).
+ */
+void knot_quic_table_set_shard(knot_quic_table_t *table, uint16_t shard,
+                               uint16_t shards);
+
 /*!
  * \brief Free QUIC table including its contents.
  *
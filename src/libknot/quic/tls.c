@@ -30,6 +30,7 @@
 #include "libknot/attribute.h"
 #include "libknot/error.h"
 #include "libknot/quic/tls_common.h"
+#include "libknot/quic/tls_common_internal.h"
 
 typedef struct knot_tls_session {
 	node_t n;
@@ -83,7 +84,7 @@ knot_tls_conn_t *knot_tls_conn_new(knot_tls_ctx_t *ctx, int sock_fd)
 	res->fd = sock_fd;
 
 	int ret = knot_tls_session(&res->session, ctx->creds, ctx->priority,
-	                           "\x03""dot", true, ctx->server);
+	                           "\x03""dot", false, ctx->server);
 	if (ret != KNOT_EOK) {
 		goto fail;
 	}
@@ -107,6 +108,12 @@ void knot_tls_conn_del(knot_tls_conn_t *conn)
 	}
 }
 
+_public_
+bool knot_tls_pending(knot_tls_conn_t *conn)
+{
+	return conn != NULL && gnutls_record_check_pending(conn->session) > 0;
+}
+
 _public_
 bool knot_tls_session_available(knot_tls_conn_t *conn)
 {
@@ -172,6 +179,12 @@ int knot_tls_handshake(knot_tls_conn_t *conn, bool oneshot)
 		return KNOT_NET_ECONNECT;
 	}
 
+	if (oneshot) {
+		/* Never wait for the peer, the caller drives the handshake by
+		   socket events and is responsible for its timeout. */
+		gnutls_handshake_set_timeout(conn->session, 0);
+	}
+
 	gnutls_record_set_timeout(conn->session, conn->ctx->io_timeout);
 	do {
 		ret = gnutls_handshake(conn->session);
@@ -180,6 +193,9 @@ int knot_tls_handshake(knot_tls_conn_t *conn, bool oneshot)
 	switch (ret) {
 	case GNUTLS_E_SUCCESS:
 		conn->flags |= KNOT_TLS_CONN_HANDSHAKE_DONE;
+		if (conn->ctx->server) {
+			knot_creds_handshake_done(conn->ctx->creds, conn->session);
+		}
 		return knot_tls_pin_check(conn->session, conn->ctx->creds);
 	case GNUTLS_E_TIMEDOUT:
 		return KNOT_NET_ETIMEOUT;
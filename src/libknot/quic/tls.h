@@ -88,6 +88,13 @@ knot_tls_conn_t *knot_tls_conn_new(knot_tls_ctx_t *ctx, int sock_fd);
  */
 void knot_tls_conn_del(knot_tls_conn_t *conn);
 
+/*!
+ * \brief Check if there are received data buffered in the TLS layer.
+ *
+ * \note Such data don't trigger any socket event.
+ */
+bool knot_tls_pending(knot_tls_conn_t *conn);
+
 /*!
  * \brief Check if session ticket can be taken out of this connection.
  */
@@ -118,7 +125,8 @@ int knot_tls_session_load(knot_tls_conn_t *conn, struct knot_tls_session *sessio
  * \note This is also done by the recv/send functions.
  *
  * \param conn     DoT connection.
- * \param oneshot  If set, don't wait untill the handshake is finished.
+ * \param oneshot  If set, don't wait for the peer at all, the handshake
+ *                 timeout must be enforced by the caller.
  *
  * \retval KNOT_EOK           Handshake successfully finished.
  * \retval KNOT_EGAIN         Handshake not finished, call me again.
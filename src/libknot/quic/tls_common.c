@@ -25,6 +25,7 @@
 #include <unistd.h>
 
 #include "libknot/quic/tls_common.h"
+#include "libknot/quic/tls_common_internal.h"
 
 #include "contrib/atomic.h"
 #include "contrib/sockaddr.h"
@@ -36,7 +37,11 @@ typedef struct knot_creds {
 	knot_atomic_ptr_t cert_creds; // Current credentials.
 	gnutls_certificate_credentials_t cert_creds_prev; // Previous credentials (for pending connections).
 	gnutls_anti_replay_t tls_anti_replay;
-	gnutls_datum_t tls_ticket_key;
+	knot_atomic_ptr_t tls_ticket_key; // Current session ticket master key.
+	gnutls_datum_t *tls_ticket_key_prev; // Previous ticket key (for pending sessions).
+	knot_atomic_uint64_t hs_full; // Full handshakes.
+	knot_atomic_uint64_t hs_resumed; // Handshakes resumed using a session ticket.
+	knot_atomic_uint64_t hs_early_data; // Resumed handshakes with accepted early data.
 	bool peer;
 	uint8_t peer_pin_len;
 	uint8_t peer_pin[];
@@ -51,8 +56,42 @@ static int tls_anti_replay_db_add_func(void *dbf, time_t exp_time,
 
 static void tls_session_ticket_key_free(gnutls_datum_t *ticket)
 {
-	memzero(ticket->data, ticket->size);
-	gnutls_free(ticket->data);
+	if (ticket != NULL) {
+		memzero(ticket->data, ticket->size);
+		gnutls_free(ticket->data);
+		free(ticket);
+	}
+}
+
+static int tls_session_ticket_key_load(gnutls_datum_t *ticket, const char *key_file)
+{
+	// Generate a random key of the proper size first.
+	int ret = gnutls_session_ticket_key_generate(ticket);
+	if (ret != GNUTLS_E_SUCCESS || key_file == NULL) {
+		return ret;
+	}
+
+	int fd = open(key_file, O_RDONLY);
+	if (fd != -1) {
+		struct stat stat;
+		if (fstat(fd, &stat) != 0 || stat.st_size != ticket->size ||
+		    read(fd, ticket->data, ticket->size) != ticket->size) {
+			ret = GNUTLS_E_KEYFILE_ERROR;
+		}
+	} else if ((fd = open(key_file, O_WRONLY | O_CREAT | O_EXCL, 0600)) == -1 ||
+	           write(fd, ticket->data, ticket->size) != ticket->size) {
+		ret = GNUTLS_E_KEYFILE_ERROR;
+	}
+
+	if (fd > -1) {
+		close(fd);
+	}
+	if (ret != GNUTLS_E_SUCCESS) {
+		memzero(ticket->data, ticket->size);
+		gnutls_free(ticket->data);
+		ticket->data = NULL;
+	}
+	return ret;
 }
 
 static int self_key(gnutls_x509_privkey_t *privkey, const char *key_file)
@@ -171,8 +210,8 @@ struct knot_creds *knot_creds_init(const char *key_file, const char *cert_file)
 	gnutls_anti_replay_set_add_function(creds->tls_anti_replay, tls_anti_replay_db_add_func);
 	gnutls_anti_replay_set_ptr(creds->tls_anti_replay, NULL);
 
-	ret = gnutls_session_ticket_key_generate(&creds->tls_ticket_key);
-	if (ret != GNUTLS_E_SUCCESS) {
+	ret = knot_creds_update_ticket_key(creds, NULL);
+	if (ret != KNOT_EOK) {
 		goto fail;
 	}
 
@@ -325,6 +364,61 @@ int knot_creds_update(struct knot_creds *creds, const char *key_file, const char
 	return KNOT_EOK;
 }
 
+_public_
+int knot_creds_update_ticket_key(struct knot_creds *creds, const char *key_file)
+{
+	if (creds == NULL || creds->peer) {
+		return KNOT_EINVAL;
+	}
+
+	// Keep the current key if no key file is configured.
+	if (key_file == NULL && ATOMIC_GET(creds->tls_ticket_key) != NULL) {
+		return KNOT_EOK;
+	}
+
+	gnutls_datum_t *new_key = calloc(1, sizeof(*new_key));
+	if (new_key == NULL) {
+		return KNOT_ENOMEM;
+	}
+
+	int ret = tls_session_ticket_key_load(new_key, key_file);
+	if (ret != GNUTLS_E_SUCCESS) {
+		free(new_key);
+		return (ret == GNUTLS_E_KEYFILE_ERROR) ? KNOT_EFILE : KNOT_ERROR;
+	}
+
+	tls_session_ticket_key_free(creds->tls_ticket_key_prev);
+	creds->tls_ticket_key_prev = ATOMIC_XCHG(creds->tls_ticket_key, new_key);
+
+	return KNOT_EOK;
+}
+
+_public_
+void knot_creds_stats(const struct knot_creds *creds, knot_creds_stats_t *stats)
+{
+	if (creds == NULL || stats == NULL) {
+		return;
+	}
+
+	stats->handshakes = ATOMIC_GET(creds->hs_full);
+	stats->resumed = ATOMIC_GET(creds->hs_resumed);
+	stats->early_data = ATOMIC_GET(creds->hs_early_data);
+}
+
+void knot_creds_handshake_done(struct knot_creds *creds,
+                               struct gnutls_session_int *session)
+{
+	if (gnutls_session_is_resumed(session) == 0) {
+		ATOMIC_ADD(creds->hs_full, 1);
+		return;
+	}
+
+	ATOMIC_ADD(creds->hs_resumed, 1);
+	if (gnutls_session_get_flags(session) & GNUTLS_SFLAGS_EARLY_DATA) {
+		ATOMIC_ADD(creds->hs_early_data, 1);
+	}
+}
+
 _public_
 int knot_creds_cert(struct knot_creds *creds, struct gnutls_x509_crt_int **cert)
 {
@@ -349,9 +443,8 @@ void knot_creds_free(struct knot_creds *creds)
 		}
 	}
 	gnutls_anti_replay_deinit(creds->tls_anti_replay);
-	if (creds->tls_ticket_key.data != NULL) {
-		tls_session_ticket_key_free(&creds->tls_ticket_key);
-	}
+	tls_session_ticket_key_free(creds->tls_ticket_key);
+	tls_session_ticket_key_free(creds->tls_ticket_key_prev);
 	free(creds);
 }
 
@@ -382,7 +475,8 @@ int knot_tls_session(struct gnutls_session_int **session,
 		ret = gnutls_priority_set(*session, priority);
 	}
 	if (server && ret == GNUTLS_E_SUCCESS) {
-		ret = gnutls_session_ticket_enable_server(*session, &creds->tls_ticket_key);
+		ret = gnutls_session_ticket_enable_server(*session,
+		                                          ATOMIC_GET(creds->tls_ticket_key));
 	}
 	if (ret == GNUTLS_E_SUCCESS) {
 		const gnutls_datum_t alpn_datum = { (void *)&alpn[1], alpn[0] };
@@ -40,6 +40,13 @@ struct gnutls_x509_crt_int;
 struct knot_creds;
 struct knot_tls_session;
 
+/*! \brief Statistics of completed server-side TLS handshakes. */
+typedef struct {
+	uint64_t handshakes; /*!< Full handshakes. */
+	uint64_t resumed;    /*!< Handshakes resumed using a session ticket. */
+	uint64_t early_data; /*!< Resumed handshakes with accepted early data (0-RTT). */
+} knot_creds_stats_t;
+
 /*!
  * \brief Init server TLS key and certificate for DoQ.
  *
@@ -74,6 +81,30 @@ struct knot_creds *knot_creds_init_peer(const struct knot_creds *local_creds,
  */
 int knot_creds_update(struct knot_creds *creds, const char *key_file, const char *cert_file);
 
+/*!
+ * \brief Set the session ticket master key for server TLS sessions.
+ *
+ * The ticket encryption keys are derived from the master key and rotated
+ * by GnuTLS automatically. Servers sharing the key file can resume each
+ * other's sessions. If the key file doesn't exist, it's created with a new
+ * random key.
+ *
+ * \param creds     Server credentials.
+ * \param key_file  Ticket key file path/name (NULL to keep the current or
+ *                  generate a random key).
+ *
+ * \return KNOT_E*
+ */
+int knot_creds_update_ticket_key(struct knot_creds *creds, const char *key_file);
+
+/*!
+ * \brief Gets statistics of completed server-side handshakes.
+ *
+ * \param creds  Server credentials.
+ * \param stats  Output statistics.
+ */
+void knot_creds_stats(const struct knot_creds *creds, knot_creds_stats_t *stats);
+
 /*!
  * \brief Gets the certificate from credentials.
  *
@@ -0,0 +1,35 @@
+/*  Copyright (C) 2024 CZ.NIC, z.s.p.o. <knot-dns@labs.nic.cz>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/*!
+ * \file
+ *
+ * \brief Library internal TLS credentials interface.
+ */
+
+#pragma once
+
+struct gnutls_session_int;
+struct knot_creds;
+
+/*!
+ * \brief Account a completed server-side handshake.
+ *
+ * \param creds    Server credentials.
+ * \param session  TLS session after successful handshake.
+ */
+void knot_creds_handshake_done(struct knot_creds *creds,
+                               struct gnutls_session_int *session);
@@ -124,11 +124,47 @@ static void dump_string(rrset_dump_params_t *p, const char *str)
 	p->total += in_len;
 }
 
+/*! \brief Equivalent of snprintf(dst, maxlen, "%"PRIu64, num) without its overhead. */
+static int uint_to_str(char *dst, size_t maxlen, uint64_t num)
+{
+	static const char digits[] =
+		"00010203040506070809101112131415161718192021222324"
+		"25262728293031323334353637383940414243444546474849"
+		"50515253545556575859606162636465666768697071727374"
+		"75767778798081828384858687888990919293949596979899";
+
+	char buf[20];
+	char *pos = buf + sizeof(buf);
+
+	while (num >= 100) {
+		unsigned idx = 2 * (num % 100);
+		num /= 100;
+		*--pos = digits[idx + 1];
+		*--pos = digits[idx];
+	}
+	if (num >= 10) {
+		*--pos = digits[2 * num + 1];
+		*--pos = digits[2 * num];
+	} else {
+		*--pos = '0' + num;
+	}
+
+	size_t len = buf + sizeof(buf) - pos;
+	if (len >= maxlen) {
+		return -1;
+	}
+	memcpy(dst, pos, len);
+	dst[len] = '\0';
+
+	return len;
+}
+
 static void dump_str_uint(rrset_dump_params_t *p, const char *str, uint64_t num)
 {
+	dump_string(p, str);
 	CHECK_PRET
 
-	int ret = snprintf(p->out, p->out_max, "%s%"PRIu64"", str, num);
+	int ret = uint_to_str(p->out, p->out_max, num);
 	CHECK_RET_OUTMAX_SNPRINTF
 
 	p->out += ret;
@@ -268,7 +304,6 @@ static void wire_type_to_str(rrset_dump_params_t *p)
 	char     type[32];
 	uint16_t data;
 	size_t   in_len = sizeof(data);
-	size_t   out_len = 0;
 
 	CHECK_INMAX(in_len)
 
@@ -279,16 +314,12 @@ static void wire_type_to_str(rrset_dump_params_t *p)
 	CHECK_RET_POSITIVE
 
 	// Write string.
-	ret = snprintf(p->out, p->out_max, "%s", type);
-	CHECK_RET_OUTMAX_SNPRINTF
-	out_len = ret;
+	dump_string(p, type);
+	CHECK_PRET
 
 	// Fill in output.
 	p->in += in_len;
 	p->in_max -= in_len;
-	p->out += out_len;
-	p->out_max -= out_len;
-	p->total += out_len;
 }
 
 static int hex_encode(const uint8_t  *in,
@@ -338,8 +369,8 @@ static int num48_encode(const uint8_t  *in,
 
 	uint64_t data = knot_wire_read_u48(in);
 
-	int ret = snprintf((char *)out, out_len, "%"PRIu64"", data);
-	if (ret <= 0 || (size_t)ret >= out_len) {
+	int ret = uint_to_str((char *)out, out_len, data);
+	if (ret <= 0) {
 		return -1;
 	}
 
@@ -703,6 +734,34 @@ static void wire_text_to_str(rrset_dump_params_t *p, size_t in_len,
 	p->in_max -= in_len;
 }
 
+/*! \brief Equivalent of strftime(dst, maxlen, "%Y%m%d%H%M%S", tm). */
+static int timestamp_to_str(char *dst, size_t maxlen, const struct tm *tm)
+{
+	if (tm == NULL) {
+		return -1;
+	}
+
+	int year = tm->tm_year + 1900;
+	if (year < 1000 || year > 9999) {
+		return strftime(dst, maxlen, "%Y%m%d%H%M%S", tm);
+	}
+
+	const int fields[] = { year / 100, year % 100, tm->tm_mon + 1,
+	                       tm->tm_mday, tm->tm_hour, tm->tm_min, tm->tm_sec };
+	const size_t len = 2 * sizeof(fields) / sizeof(fields[0]);
+	if (len >= maxlen) {
+		return 0;
+	}
+
+	for (size_t i = 0; i < len / 2; i++) {
+		dst[2 * i]     = '0' + fields[i] / 10;
+		dst[2 * i + 1] = '0' + fields[i] % 10;
+	}
+	dst[len] = '\0';
+
+	return len;
+}
+
 static void wire_timestamp_to_str(rrset_dump_params_t *p)
 {
 	CHECK_PRET
@@ -724,12 +783,12 @@ static void wire_timestamp_to_str(rrset_dump_params_t *p)
 	if (p->style->human_timestamp) {
 		struct tm result;
 		// Write timestamp in YYYYMMDDhhmmss format.
-		ret = strftime(p->out, p->out_max, "%Y%m%d%H%M%S",
-		               gmtime_r(&timestamp, &result));
+		ret = timestamp_to_str(p->out, p->out_max,
+		                       gmtime_r(&timestamp, &result));
 		CHECK_RET_POSITIVE
 	} else {
 		// Write timestamp only.
-		ret = snprintf(p->out, p->out_max, "%u", ntohl(data));
+		ret = uint_to_str(p->out, p->out_max, ntohl(data));
 		CHECK_RET_OUTMAX_SNPRINTF
 	}
 	out_len = ret;
@@ -775,7 +834,7 @@ static void wire_ttl_to_str(rrset_dump_params_t *p)
 		CHECK_RET_POSITIVE
 	} else {
 		// Write timestamp only.
-		ret = snprintf(p->out, p->out_max, "%u", ntohl(data));
+		ret = uint_to_str(p->out, p->out_max, ntohl(data));
 		CHECK_RET_OUTMAX_SNPRINTF
 	}
 	out_len = ret;
@@ -796,7 +855,7 @@ static void wire_bitmap_to_str(rrset_dump_params_t *p)
 	char   type[32];
 	size_t i = 0;
 	size_t in_len = p->in_max;
-	size_t out_len = 0;
+	bool   first = true;
 
 	// Loop over bitmap window array (can be empty).
 	while (i < in_len) {
@@ -827,17 +886,12 @@ static void wire_bitmap_to_str(rrset_dump_params_t *p)
 				CHECK_RET_POSITIVE
 
 				// Print type name to type list.
-				if (out_len > 0) {
-					ret = snprintf(p->out, p->out_max,
-					               " %s", type);
-				} else {
-					ret = snprintf(p->out, p->out_max,
-					               "%s", type);
+				if (!first) {
+					dump_string(p, " ");
 				}
-				CHECK_RET_OUTMAX_SNPRINTF
-				out_len += ret;
-				p->out += ret;
-				p->out_max -= ret;
+				dump_string(p, type);
+				CHECK_PRET
+				first = false;
 			}
 		}
 
@@ -847,7 +901,6 @@ static void wire_bitmap_to_str(rrset_dump_params_t *p)
 	// Fill in output.
 	p->in += in_len;
 	p->in_max -= in_len;
-	p->total += out_len;
 }
 
 static void wire_dname_to_str(rrset_dump_params_t *p)
@@ -2472,16 +2525,35 @@ int knot_rrset_txt_dump_header(const knot_rrset_t      *rrset,
 	char   buf[32];
 	int    ret;
 
-	// Dump rrset owner.
-	char *name = knot_dname_to_str_alloc(rrset->owner);
-	if (style->ascii_to_idn != NULL) {
+	// Dump rrset owner (the allocation is needed only for IDN conversion).
+	knot_dname_txt_storage_t name_buf;
+	char *name;
+	if (style->ascii_to_idn == NULL) {
+		name = knot_dname_to_str(name_buf, rrset->owner, sizeof(name_buf));
+	} else {
+		name = knot_dname_to_str_alloc(rrset->owner);
 		style->ascii_to_idn(&name);
 	}
-	char sep = strlen(name) < 4 * TAB_WIDTH ? '\t' : ' ';
-	ret = snprintf(dst + len, maxlen - len, "%-20s%c", name, sep);
-	free(name);
-	SNPRINTF_CHECK(ret, maxlen - len);
-	len += ret;
+	if (name == NULL) {
+		return KNOT_EINVAL;
+	}
+	size_t name_len = strlen(name);
+	size_t pad_len = name_len < 20 ? 20 - name_len : 0;
+	char sep = name_len < 4 * TAB_WIDTH ? '\t' : ' ';
+	if (name_len + pad_len + 1 >= maxlen) {
+		if (name != name_buf) {
+			free(name);
+		}
+		return KNOT_ESPACE;
+	}
+	memcpy(dst, name, name_len);
+	memset(dst + name_len, ' ', pad_len);
+	len = name_len + pad_len;
+	dst[len++] = sep;
+	dst[len] = '\0';
+	if (name != name_buf) {
+		free(name);
+	}
 
 	// Set white space separation character.
 	sep = style->wrap ? ' ' : '\t';
@@ -2498,7 +2570,13 @@ int knot_rrset_txt_dump_header(const knot_rrset_t      *rrset,
 			ret = snprintf(dst + len, maxlen - len, "%s%c",
 			               buf, sep);
 		} else {
-			ret = snprintf(dst + len, maxlen - len, "%u%c", ttl, sep);
+			ret = uint_to_str(dst + len, maxlen - len, ttl);
+			if (ret > 0 && len + ret + 1 < maxlen) {
+				dst[len + ret++] = sep;
+				dst[len + ret] = '\0';
+			} else {
+				ret = -1;
+			}
 		}
 		SNPRINTF_CHECK(ret, maxlen - len);
 		len += ret;
@@ -2522,13 +2600,16 @@ int knot_rrset_txt_dump_header(const knot_rrset_t      *rrset,
 	} else if (knot_rrtype_to_string(rrset->type, buf, sizeof(buf)) < 0) {
 		return KNOT_ESPACE;
 	}
+	size_t type_len = strlen(buf);
+	if (len + type_len + 1 >= maxlen) {
+		return KNOT_ESPACE;
+	}
+	memcpy(dst + len, buf, type_len);
+	len += type_len;
 	if (rrset->rrs.count > 0) {
-		ret = snprintf(dst + len, maxlen - len, "%s%c", buf, sep);
-	} else {
-		ret = snprintf(dst + len, maxlen - len, "%s", buf);
+		dst[len++] = sep;
 	}
-	SNPRINTF_CHECK(ret, maxlen - len);
-	len += ret;
+	dst[len] = '\0';
 
 	return len;
 }
@@ -2546,6 +2627,11 @@ static int rrset_txt_dump(const knot_rrset_t      *rrset,
 	size_t color_len = (style->color != NULL ? strlen(style->color) : 0);
 	size_t reset_len = (color_len > 0 ? strlen(COL_RST(true)) : 0);
 
+	// Position of the last dumped header, which is reused for next records.
+	size_t hdr_pos = 0;
+	size_t hdr_len = 0;
+	uint32_t hdr_ttl = 0;
+
 	dst[0] = '\0';
 
 	// Loop over rdata in rrset.
@@ -2565,10 +2651,22 @@ static int rrset_txt_dump(const knot_rrset_t      *rrset,
 		uint32_t ttl = ((style->original_ttl && rrset->type == KNOT_RRTYPE_RRSIG) ?
 		                knot_rrsig_original_ttl(rr) : rrset->ttl);
 
-		int ret = knot_rrset_txt_dump_header(rrset, ttl, dst + len,
-		                                     maxlen - len, style);
-		if (ret < 0) {
-			return KNOT_ESPACE;
+		int ret;
+		if (hdr_len > 0 && ttl == hdr_ttl) {
+			if (len + hdr_len >= maxlen) {
+				return KNOT_ESPACE;
+			}
+			memcpy(dst + len, dst + hdr_pos, hdr_len);
+			ret = hdr_len;
+		} else {
+			ret = knot_rrset_txt_dump_header(rrset, ttl, dst + len,
+			                                 maxlen - len, style);
+			if (ret < 0) {
+				return KNOT_ESPACE;
+			}
+			hdr_pos = len;
+			hdr_len = ret;
+			hdr_ttl = ttl;
 		}
 		len += ret;
 
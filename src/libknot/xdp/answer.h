@@ -0,0 +1,113 @@
+/*  Copyright (C) 2024 CZ.NIC, z.s.p.o. <knot-dns@labs.nic.cz>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+#include "libknot/consts.h"
+#include "libknot/descriptor.h"
+#include "libknot/dname.h"
+#include "libknot/endian.h"
+#include "libknot/errcode.h"
+#include "libknot/packet/wire.h"
+#include "libknot/xdp/bpf-consts.h"
+
+/*! \brief Ones' complement sum of the data in network byte order words. */
+inline static uint16_t answer_csum(const uint8_t *data, size_t len)
+{
+	uint32_t sum = 0;
+	for (size_t i = 0; i + 1 < len; i += 2) {
+		uint16_t word;
+		memcpy(&word, data + i, sizeof(word));
+		sum += word;
+	}
+	if (len % 2 != 0) {
+		uint8_t last[2] = { data[len - 1], 0 };
+		uint16_t word;
+		memcpy(&word, last, sizeof(word));
+		sum += word;
+	}
+
+	while (sum >> 16) {
+		sum = (sum & 0xffff) + (sum >> 16);
+	}
+	return sum;
+}
+
+/*! \brief Fill the answer map key with the lower-cased QNAME, return its length. */
+inline static int answer_key(knot_xdp_answer_key_t *key, const uint8_t *qname,
+                             const uint8_t *end)
+{
+	int qlen = knot_dname_wire_check(qname, end, NULL);
+	if (qlen <= 0) {
+		return KNOT_EMALF;
+	} else if (qlen > KNOT_XDP_ANSWER_QNAME_MAX) {
+		return KNOT_ESPACE;
+	}
+
+	memset(key, 0, sizeof(*key));
+	knot_dname_copy_lower(key->qname, qname);
+
+	return qlen;
+}
+
+/*! \brief Convert a response into the answer map item and its key. */
+inline static int answer_build(knot_xdp_answer_key_t *key, knot_xdp_answer_t *answer,
+                               const uint8_t *wire, size_t len, uint16_t edns_payload)
+{
+	if (len < KNOT_WIRE_HEADER_SIZE || knot_wire_get_qdcount(wire) != 1) {
+		return KNOT_EMALF;
+	}
+
+	if (len < KNOT_WIRE_HEADER_SIZE + 2 * sizeof(uint16_t)) {
+		return KNOT_EMALF;
+	}
+
+	const uint8_t *qname = wire + KNOT_WIRE_HEADER_SIZE;
+	int qlen = answer_key(key, qname, wire + len - 2 * sizeof(uint16_t));
+	if (qlen < 0) {
+		return qlen;
+	}
+	key->qtype = htobe16(knot_wire_read_u16(qname + qlen));
+	size_t q_end = KNOT_WIRE_HEADER_SIZE + qlen + 2 * sizeof(uint16_t);
+
+	size_t rr_len = len - q_end;
+	if (rr_len + KNOT_XDP_ANSWER_OPT_LEN > KNOT_XDP_ANSWER_DATA_MAX ||
+	    len + KNOT_XDP_ANSWER_OPT_LEN > KNOT_WIRE_MIN_PKTSIZE) {
+		return KNOT_ESPACE;
+	}
+
+	memset(answer, 0, sizeof(*answer));
+	answer->ancount = htobe16(knot_wire_get_ancount(wire));
+	answer->nscount = htobe16(knot_wire_get_nscount(wire));
+	answer->arcount = htobe16(knot_wire_get_arcount(wire));
+	answer->len = rr_len + KNOT_XDP_ANSWER_OPT_LEN;
+	answer->rcode = knot_wire_get_rcode(wire);
+	memcpy(answer->data, wire + q_end, rr_len);
+
+	// Bare OPT record: root owner, type, UDP payload, zero TTL and RDLENGTH.
+	uint8_t *opt = answer->data + rr_len;
+	opt[0] = '\0';
+	knot_wire_write_u16(opt + 1, KNOT_RRTYPE_OPT);
+	knot_wire_write_u16(opt + 3, edns_payload);
+
+	answer->csum = answer_csum(answer->data, rr_len);
+	answer->opt_csum = answer_csum(opt, KNOT_XDP_ANSWER_OPT_LEN);
+
+	return KNOT_EOK;
+}
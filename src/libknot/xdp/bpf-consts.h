@@ -29,6 +29,10 @@
 
 #define KNOT_XDP_PKT_ALIGNMENT	2 /*!< Fix for misaligned access to packet structures. */
 
+#define KNOT_XDP_ANSWER_QNAME_MAX	64  /*!< Maximum QNAME length of a kernel answer. */
+#define KNOT_XDP_ANSWER_DATA_MAX	496 /*!< Maximum record data length of a kernel answer. */
+#define KNOT_XDP_ANSWER_OPT_LEN		11  /*!< Length of a bare EDNS OPT record. */
+
 /*! \brief XDP filter configuration flags. */
 typedef enum {
 	KNOT_XDP_FILTER_ON    = 1 << 0,  /*!< Filter enabled. */
@@ -38,6 +42,8 @@ typedef enum {
 	KNOT_XDP_FILTER_PASS  = 1 << 4,  /*!< Pass incoming messages to ports >= port value. */
 	KNOT_XDP_FILTER_DROP  = 1 << 5,  /*!< Drop incoming messages to ports >= port value. */
 	KNOT_XDP_FILTER_ROUTE = 1 << 6,  /*!< Consider routing information from kernel. */
+	KNOT_XDP_FILTER_ANSWER = 1 << 7, /*!< Answer matching UDP queries from the answer map. */
+	KNOT_XDP_FILTER_BLOCK  = 1 << 8, /*!< Drop or slip UDP queries from the block map. */
 } knot_xdp_filter_flag_t;
 
 /*! \brief XDP map item for the filter configuration. */
@@ -54,4 +60,47 @@ struct knot_xdp_info {
 	__u16 out_if_index; /*!< Index of the output interface (if routing enabled). */
 };
 
+/*! \brief XDP answer map key. */
+typedef struct knot_xdp_answer_key knot_xdp_answer_key_t;
+struct knot_xdp_answer_key {
+	__u8 qname[KNOT_XDP_ANSWER_QNAME_MAX]; /*!< Lower-case QNAME in wire format, zero padded. */
+	__u16 qtype;                           /*!< QTYPE in network byte order. */
+} __attribute__((packed));
+
+/*! \brief XDP answer map item, a pre-built response to a query without DO bit. */
+typedef struct knot_xdp_answer knot_xdp_answer_t;
+struct knot_xdp_answer {
+	__u16 ancount;  /*!< ANCOUNT in network byte order. */
+	__u16 nscount;  /*!< NSCOUNT in network byte order. */
+	__u16 arcount;  /*!< ARCOUNT (without OPT) in network byte order. */
+	__u16 csum;     /*!< Ones' complement sum of the record data without OPT. */
+	__u16 opt_csum; /*!< Ones' complement sum of the trailing OPT record. */
+	__u16 len;      /*!< Length of the record data including the trailing OPT. */
+	__u8 rcode;     /*!< RCODE of the response. */
+	__u8 data[KNOT_XDP_ANSWER_DATA_MAX]; /*!< Record data following the question, OPT last. */
+} __attribute__((packed));
+
+/*! \brief XDP block map key (LPM), IPv4 addresses are IPv4-mapped IPv6 ones. */
+typedef struct knot_xdp_block_key knot_xdp_block_key_t;
+struct knot_xdp_block_key {
+	__u32 prefixlen; /*!< Prefix length in bits. */
+	__u8 addr[16];   /*!< IPv6 address. */
+};
+
+/*! \brief XDP block map item. */
+typedef struct knot_xdp_block knot_xdp_block_t;
+struct knot_xdp_block {
+	__u64 expire; /*!< Expiration time (CLOCK_MONOTONIC in nanoseconds). */
+	__u16 slip;   /*!< Answer every Nth query with TC bit set, drop the others. */
+};
+
+/*! \brief XDP kernel statistics map item (per queue). */
+typedef struct knot_xdp_kernel_stats knot_xdp_kernel_stats_t;
+struct knot_xdp_kernel_stats {
+	__u64 answered; /*!< Queries answered from the answer map. */
+	__u64 missed;   /*!< Eligible queries without an answer map item. */
+	__u64 dropped;  /*!< Queries dropped according to the block map. */
+	__u64 slipped;  /*!< Queries answered with TC bit according to the block map. */
+};
+
 /*! @} */
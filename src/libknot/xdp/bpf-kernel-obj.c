@@ -2,208 +2,999 @@ unsigned char bpf_kernel_o[] = {
   0x7f, 0x45, 0x4c, 0x46, 0x02, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf7, 0x00, 0x01, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xb8, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x48, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
-  0x0d, 0x00, 0x01, 0x00, 0xbf, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x61, 0x61, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x1a, 0xfc, 0xff,
+  0x0e, 0x00, 0x01, 0x00, 0xbf, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x61, 0x61, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x1a, 0x98, 0xff,
   0x00, 0x00, 0x00, 0x00, 0xbf, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x07, 0x02, 0x00, 0x00, 0xfc, 0xff, 0xff, 0xff, 0x18, 0x01, 0x00, 0x00,
+  0x07, 0x02, 0x00, 0x00, 0x98, 0xff, 0xff, 0xff, 0x18, 0x01, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x85, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xbf, 0x01, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x15, 0x01, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x71, 0x12, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x71, 0x19, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x67, 0x09, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x4f, 0x29, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xbf, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x15, 0x01, 0xc0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x71, 0x12, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x71, 0x17, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x67, 0x07, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x4f, 0x27, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x57, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x15, 0x02, 0x08, 0x01, 0x00, 0x00, 0x00, 0x00,
-  0x71, 0x12, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x2a, 0xa0, 0xff,
+  0x02, 0x00, 0x00, 0x00, 0x15, 0x02, 0xb8, 0x02, 0x00, 0x00, 0x00, 0x00,
+  0x71, 0x12, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x2a, 0x78, 0xff,
   0x00, 0x00, 0x00, 0x00, 0x71, 0x12, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x7b, 0x2a, 0x98, 0xff, 0x00, 0x00, 0x00, 0x00, 0x71, 0x18, 0x03, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x71, 0x11, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x7b, 0x1a, 0xa8, 0xff, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x61, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x18, 0x02, 0x00, 0x00, 0xfc, 0xff, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00,
-  0x36, 0x00, 0x00, 0x00, 0x61, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x61, 0x61, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x12, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x07, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0xb7, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x72, 0x01, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xbf, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x7b, 0x3a, 0xb0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x61, 0x62, 0x04, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xbf, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x07, 0x01, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x2d, 0x21, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x71, 0x74, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x73, 0x0d, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x67, 0x03, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
-  0x4f, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x03, 0x0b, 0x00,
-  0x81, 0x00, 0x00, 0x00, 0xbf, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x07, 0x01, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x2d, 0x21, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xb7, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x79, 0xa3, 0xb0, 0xff,
-  0x00, 0x00, 0x00, 0x00, 0x15, 0x03, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x71, 0x74, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x73, 0x11, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x67, 0x03, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
-  0x4f, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x03, 0x00, 0x00,
-  0xff, 0xff, 0x00, 0x00, 0x15, 0x03, 0x1e, 0x00, 0x86, 0xdd, 0x00, 0x00,
-  0xb7, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x55, 0x03, 0xdc, 0x00,
-  0x08, 0x00, 0x00, 0x00, 0xbf, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x07, 0x03, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x2d, 0x23, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x71, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x34, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x57, 0x04, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00,
-  0xb7, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x55, 0x04, 0xd3, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0xbf, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x1f, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x15, 0x02, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xdc, 0x05, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0xb7, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x6d, 0x45, 0xcd, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x69, 0x15, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x57, 0x05, 0x00, 0x00, 0xbf, 0xff, 0x00, 0x00, 0xb7, 0x04, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x7b, 0x4a, 0x90, 0xff, 0x00, 0x00, 0x00, 0x00,
-  0xb7, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x55, 0x05, 0x01, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xb7, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x67, 0x03, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x57, 0x03, 0x00, 0x00,
-  0x3c, 0x00, 0x00, 0x00, 0xbf, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x0f, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x10, 0x09, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xbf, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x05, 0x00, 0x00,
+  0x7b, 0x2a, 0x70, 0xff, 0x00, 0x00, 0x00, 0x00, 0x71, 0x12, 0x03, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x7b, 0x2a, 0x88, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x71, 0x11, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x1a, 0x80, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x18, 0x02, 0x00, 0x00, 0xfc, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00,
+  0x61, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0x08, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xb7, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2d, 0x82, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x3a, 0x90, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x09, 0x00, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x2d, 0x19, 0x9f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x71, 0x83, 0x0c, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x71, 0x82, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x67, 0x02, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x4f, 0x32, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xb7, 0x03, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x55, 0x02, 0x0c, 0x00, 0x81, 0x00, 0x00, 0x00, 0xbf, 0x89, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x09, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00,
+  0xb7, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2d, 0x19, 0x95, 0x02,
+  0x00, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x79, 0xa2, 0x90, 0xff, 0x00, 0x00, 0x00, 0x00, 0x15, 0x02, 0x92, 0x02,
+  0x00, 0x00, 0x00, 0x00, 0x71, 0x83, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x71, 0x82, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x02, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x4f, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xb7, 0x03, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x7b, 0x3a, 0x68, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x57, 0x02, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,
+  0x15, 0x02, 0x21, 0x00, 0x86, 0xdd, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x55, 0x02, 0x88, 0x02, 0x08, 0x00, 0x00, 0x00,
+  0xbf, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x02, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x2d, 0x12, 0x84, 0x02, 0x00, 0x00, 0x00, 0x00, 0x71, 0x94, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x57, 0x02, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x55, 0x02, 0x7f, 0x02, 0x40, 0x00, 0x00, 0x00,
+  0xbf, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x92, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x69, 0x93, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xdc, 0x03, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x6d, 0x23, 0x79, 0x02, 0x00, 0x00, 0x00, 0x00,
+  0x69, 0x93, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x03, 0x00, 0x00,
+  0xbf, 0xff, 0x00, 0x00, 0xb7, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x7b, 0x2a, 0x58, 0xff, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x02, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x55, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xb7, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x2a, 0x60, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x67, 0x04, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x57, 0x04, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x79, 0xa5, 0x68, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x43, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x71, 0x90, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x93, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x03, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0xb7, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2d, 0x13, 0x65, 0x02,
+  0x00, 0x00, 0x00, 0x00, 0x71, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x57, 0x02, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x55, 0x02, 0x61, 0x02, 0x60, 0x00, 0x00, 0x00,
+  0xbf, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x92, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x69, 0x94, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xdc, 0x04, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x07, 0x04, 0x00, 0x00,
   0x28, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x2d, 0x25, 0xbc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x13, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x57, 0x03, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00,
-  0xb7, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x55, 0x03, 0xb8, 0x00,
-  0x60, 0x00, 0x00, 0x00, 0xbf, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x1f, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x14, 0x04, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xdc, 0x04, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x07, 0x04, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x2d, 0x34, 0xb1, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xb7, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x7b, 0x3a, 0x90, 0xff,
-  0x00, 0x00, 0x00, 0x00, 0xb7, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x71, 0x10, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x08, 0x00,
-  0x2c, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0xbf, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x05, 0x00, 0x00,
-  0x30, 0x00, 0x00, 0x00, 0x2d, 0x25, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xb7, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x71, 0x10, 0x28, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xb7, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x7b, 0x3a, 0x90, 0xff, 0x00, 0x00, 0x00, 0x00, 0x67, 0x08, 0x00, 0x00,
-  0x08, 0x00, 0x00, 0x00, 0x79, 0xa3, 0xa8, 0xff, 0x00, 0x00, 0x00, 0x00,
-  0x4f, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x03, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x15, 0x03, 0x17, 0x00, 0x11, 0x00, 0x00, 0x00,
-  0xb7, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x55, 0x03, 0x9d, 0x00,
-  0x06, 0x00, 0x00, 0x00, 0xbf, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x07, 0x03, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x2d, 0x23, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xbf, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x02, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x15, 0x02, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x52, 0x02, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xdc, 0x02, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0xbf, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x03, 0x00, 0x00,
-  0xff, 0xff, 0x00, 0x00, 0x1d, 0x32, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xbf, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x03, 0x00, 0x00,
-  0x30, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x15, 0x03, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x08, 0x00, 0x00,
-  0xff, 0xff, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x2d, 0x28, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x28, 0x00,
+  0x2d, 0x24, 0x5a, 0x02, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x71, 0x90, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xb7, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x2a, 0x60, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x09, 0x00, 0x2c, 0x00, 0x00, 0x00,
+  0xbf, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x05, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x2d, 0x15, 0x51, 0x02, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x02, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x7b, 0x2a, 0x60, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0xb7, 0x04, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x71, 0x30, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0xbf, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x07, 0x03, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x2d, 0x23, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x1f, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x53, 0x04, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xdc, 0x03, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0xb7, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x6d, 0x23, 0x7f, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x69, 0x52, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xdc, 0x02, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xbf, 0x93, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x57, 0x03, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x15, 0x03, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x83, 0x00, 0x00,
+  0x79, 0xa5, 0x68, 0xff, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x45, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xb7, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x7b, 0x4a, 0x58, 0xff, 0x00, 0x00, 0x00, 0x00, 0x07, 0x05, 0x00, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x79, 0xa4, 0x88, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x67, 0x04, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x79, 0xa2, 0x80, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x4f, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x7b, 0x4a, 0x88, 0xff, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x0a, 0x80, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x57, 0x04, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x15, 0x04, 0x1a, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x55, 0x04, 0x3c, 0x02, 0x06, 0x00, 0x00, 0x00, 0xbf, 0x34, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x04, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0xb7, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2d, 0x14, 0x38, 0x02,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x57, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x15, 0x01, 0x34, 0x02, 0x00, 0x00, 0x00, 0x00,
+  0x69, 0x31, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0x01, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x79, 0xa4, 0x88, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x03, 0x00, 0x00,
+  0xff, 0xff, 0x00, 0x00, 0x1d, 0x31, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x03, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x15, 0x03, 0x2a, 0x02, 0x00, 0x00, 0x00, 0x00, 0x79, 0xa3, 0x88, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x57, 0x03, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,
+  0xbf, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x2d, 0x13, 0x25, 0x02, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x34, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x04, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0xb7, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2d, 0x14, 0x20, 0x02,
+  0x00, 0x00, 0x00, 0x00, 0x1f, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x69, 0x34, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0x04, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x6d, 0x14, 0x1b, 0x02, 0x00, 0x00, 0x00, 0x00, 0x69, 0x31, 0x02, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xdc, 0x01, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0xbf, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x03, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x15, 0x03, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x79, 0xa4, 0x88, 0xff, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x43, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x57, 0x03, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,
-  0x1d, 0x32, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x93, 0x00, 0x00,
+  0x1d, 0x31, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x73, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x57, 0x03, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-  0x15, 0x03, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x08, 0x00, 0x00,
-  0xff, 0xff, 0x00, 0x00, 0x3d, 0x82, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xbf, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x03, 0x00, 0x00,
-  0x08, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x15, 0x03, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xa3, 0xa0, 0xff,
-  0x00, 0x00, 0x00, 0x00, 0x67, 0x03, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
-  0x79, 0xa5, 0x98, 0xff, 0x00, 0x00, 0x00, 0x00, 0x4f, 0x53, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xbf, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x57, 0x03, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x1d, 0x32, 0x07, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xbf, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x15, 0x03, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xa3, 0x88, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x57, 0x03, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,
+  0xbf, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3d, 0x31, 0x15, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x57, 0x03, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x15, 0x03, 0x07, 0x02, 0x00, 0x00, 0x00, 0x00,
+  0x79, 0xa4, 0x78, 0xff, 0x00, 0x00, 0x00, 0x00, 0x67, 0x04, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x79, 0xa3, 0x70, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x4f, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x43, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x57, 0x03, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,
+  0x7b, 0x4a, 0x78, 0xff, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x31, 0x09, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x57, 0x03, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x15, 0x03, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x57, 0x05, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x2d, 0x25, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xbf, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x02, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x55, 0x02, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x04, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x15, 0x03, 0xfb, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x79, 0xa3, 0x78, 0xff, 0x00, 0x00, 0x00, 0x00, 0x57, 0x03, 0x00, 0x00,
+  0xff, 0xff, 0x00, 0x00, 0xbf, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xb7, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x2d, 0x13, 0xf6, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x57, 0x01, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x55, 0x01, 0xf2, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x79, 0xa1, 0x60, 0xff, 0x00, 0x00, 0x00, 0x00, 0x57, 0x01, 0x00, 0x00,
   0xff, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x55, 0x04, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x09, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x15, 0x09, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xb7, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x2a, 0xc0, 0xff,
-  0x00, 0x00, 0x00, 0x00, 0x7b, 0x2a, 0xf0, 0xff, 0x00, 0x00, 0x00, 0x00,
-  0x7b, 0x2a, 0xe8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x2a, 0xe0, 0xff,
-  0x00, 0x00, 0x00, 0x00, 0x7b, 0x2a, 0xd8, 0xff, 0x00, 0x00, 0x00, 0x00,
-  0x7b, 0x2a, 0xd0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x2a, 0xc8, 0xff,
-  0x00, 0x00, 0x00, 0x00, 0x7b, 0x2a, 0xb8, 0xff, 0x00, 0x00, 0x00, 0x00,
-  0xb7, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x63, 0x2a, 0xc0, 0xff,
-  0x00, 0x00, 0x00, 0x00, 0x79, 0xa2, 0x90, 0xff, 0x00, 0x00, 0x00, 0x00,
-  0x55, 0x02, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x02, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x73, 0x2a, 0xb8, 0xff, 0x00, 0x00, 0x00, 0x00,
-  0x61, 0x12, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x2a, 0xc8, 0xff,
-  0x00, 0x00, 0x00, 0x00, 0x61, 0x11, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x63, 0x1a, 0xd8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x16, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xb7, 0x02, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
-  0x73, 0x2a, 0xb8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x61, 0x12, 0x1c, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x67, 0x02, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0x61, 0x13, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0x32, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x7b, 0x2a, 0xc8, 0xff, 0x00, 0x00, 0x00, 0x00,
-  0x61, 0x12, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x02, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0x61, 0x13, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x4f, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x2a, 0xd0, 0xff,
-  0x00, 0x00, 0x00, 0x00, 0x61, 0x12, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x67, 0x02, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x61, 0x13, 0x10, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x4f, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x7b, 0x2a, 0xe0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x61, 0x12, 0x08, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x61, 0x11, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x67, 0x01, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x4f, 0x21, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x7b, 0x1a, 0xd8, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x55, 0x01, 0xee, 0x01, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x71, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x57, 0x01, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x15, 0x01, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x4a, 0x78, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0xb7, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x7b, 0x1a, 0xa8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x1a, 0xd8, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x7b, 0x1a, 0xd0, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x7b, 0x1a, 0xc8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x1a, 0xc0, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x7b, 0x1a, 0xb8, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x7b, 0x1a, 0xb0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x1a, 0xa0, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0xb7, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x63, 0x1a, 0xa8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x79, 0xa1, 0x58, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x7b, 0x5a, 0x50, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x55, 0x01, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x01, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x73, 0x1a, 0xa0, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x61, 0x91, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x1a, 0xb0, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x61, 0x91, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x63, 0x1a, 0xc0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x16, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xb7, 0x01, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x73, 0x1a, 0xa0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x61, 0x91, 0x1c, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x67, 0x01, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x61, 0x92, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0x21, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x7b, 0x1a, 0xb0, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x61, 0x91, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x01, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x61, 0x92, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x4f, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x1a, 0xb8, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x61, 0x91, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x67, 0x01, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x61, 0x92, 0x10, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x4f, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x7b, 0x1a, 0xc8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x61, 0x91, 0x08, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x61, 0x92, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x67, 0x02, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x4f, 0x12, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x7b, 0x2a, 0xc0, 0xff, 0x00, 0x00, 0x00, 0x00,
   0xbf, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x02, 0x00, 0x00,
-  0xb8, 0xff, 0xff, 0xff, 0xbf, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xa0, 0xff, 0xff, 0xff, 0xbf, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0xb7, 0x03, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xb7, 0x04, 0x00, 0x00,
   0x01, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00,
   0xbf, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x01, 0x00, 0x00,
   0x20, 0x00, 0x00, 0x00, 0x77, 0x01, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0x15, 0x01, 0x24, 0x00, 0x07, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x15, 0x01, 0x21, 0x00, 0x05, 0x00, 0x00, 0x00,
-  0x55, 0x01, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x69, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x69, 0xa2, 0xec, 0xff, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x21, 0x1c, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x69, 0x71, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x69, 0xa2, 0xee, 0xff, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x21, 0x19, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x69, 0x71, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x69, 0xa2, 0xf0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x21, 0x16, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x79, 0xa1, 0xb0, 0xff, 0x00, 0x00, 0x00, 0x00,
-  0x15, 0x01, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0xa1, 0xc0, 0xff,
-  0x00, 0x00, 0x00, 0x00, 0x79, 0xa2, 0xb0, 0xff, 0x00, 0x00, 0x00, 0x00,
-  0x6b, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0xa1, 0xf6, 0xff,
-  0x00, 0x00, 0x00, 0x00, 0x73, 0x17, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x77, 0x01, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x73, 0x17, 0x0b, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x69, 0xa1, 0xf4, 0xff, 0x00, 0x00, 0x00, 0x00,
-  0x73, 0x17, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x01, 0x00, 0x00,
-  0x08, 0x00, 0x00, 0x00, 0x73, 0x17, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x69, 0xa1, 0xf2, 0xff, 0x00, 0x00, 0x00, 0x00, 0x73, 0x17, 0x06, 0x00,
+  0x15, 0x01, 0x54, 0x00, 0x07, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x01, 0xb3, 0x01, 0x05, 0x00, 0x00, 0x00,
+  0x55, 0x01, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x69, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x69, 0xa2, 0xd4, 0xff, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x21, 0xae, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x69, 0x81, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x69, 0xa2, 0xd6, 0xff, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x21, 0xab, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x69, 0x81, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x69, 0xa2, 0xd8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x21, 0xa8, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x79, 0xa1, 0x90, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x15, 0x01, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0xa1, 0xa8, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x79, 0xa2, 0x90, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x6b, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0xa1, 0xde, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x73, 0x18, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x77, 0x01, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x73, 0x18, 0x0b, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x69, 0xa1, 0xdc, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x73, 0x18, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x01, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x73, 0x18, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x69, 0xa1, 0xda, 0xff, 0x00, 0x00, 0x00, 0x00, 0x73, 0x18, 0x06, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x77, 0x01, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
-  0x73, 0x17, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x62, 0x10, 0x00,
+  0x73, 0x18, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xa5, 0x50, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x79, 0xa4, 0x78, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x79, 0xa1, 0x80, 0xff, 0x00, 0x00, 0x00, 0x00, 0x57, 0x01, 0x00, 0x00,
+  0xff, 0x00, 0x00, 0x00, 0x55, 0x01, 0x8d, 0x01, 0x11, 0x00, 0x00, 0x00,
+  0x79, 0xa1, 0x88, 0xff, 0x00, 0x00, 0x00, 0x00, 0x57, 0x01, 0x00, 0x00,
+  0xff, 0xff, 0x00, 0x00, 0x57, 0x04, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,
+  0x5d, 0x14, 0x89, 0x01, 0x00, 0x00, 0x00, 0x00, 0x79, 0xa1, 0x58, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x55, 0x01, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x71, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x01, 0x00, 0x00,
+  0x0f, 0x00, 0x00, 0x00, 0x55, 0x01, 0x84, 0x01, 0x05, 0x00, 0x00, 0x00,
+  0x7b, 0x5a, 0x50, 0xff, 0x00, 0x00, 0x00, 0x00, 0x69, 0x91, 0x06, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x57, 0x01, 0x00, 0x00, 0x3f, 0xff, 0x00, 0x00,
+  0xb7, 0x08, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x15, 0x01, 0x06, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x7b, 0x5a, 0x50, 0xff, 0x00, 0x00, 0x00, 0x00, 0x71, 0x91, 0x06, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xb7, 0x08, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x15, 0x01, 0x01, 0x00, 0x11, 0x00, 0x00, 0x00, 0xb7, 0x08, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x57, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x15, 0x01, 0x84, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x57, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x15, 0x01, 0x81, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x61, 0x62, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x61, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xb7, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x67, 0x04, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0xbf, 0x45, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x47, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x7b, 0x5a, 0xa8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x47, 0x04, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x7b, 0x4a, 0xa0, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x79, 0xa4, 0x68, 0xff, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x41, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x63, 0x3a, 0xb0, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x79, 0xa3, 0x58, 0xff, 0x00, 0x00, 0x00, 0x00, 0x55, 0x03, 0x0a, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x03, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x2d, 0x23, 0x6f, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xb7, 0x02, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,
+  0x6b, 0x2a, 0xae, 0xff, 0x00, 0x00, 0x00, 0x00, 0x61, 0x11, 0x0c, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x63, 0x1a, 0xb0, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x05, 0x00, 0x5f, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x03, 0x00, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x2d, 0x23, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x61, 0x12, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x2a, 0xb0, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x61, 0x12, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x63, 0x2a, 0xac, 0xff, 0x00, 0x00, 0x00, 0x00, 0x61, 0x12, 0x0c, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x63, 0x2a, 0xa8, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x61, 0x11, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x1a, 0xa4, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x02, 0x00, 0x00, 0xa0, 0xff, 0xff, 0xff, 0x18, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x85, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xbf, 0x09, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x79, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x1a, 0x90, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x79, 0xa1, 0x90, 0xff, 0x00, 0x00, 0x00, 0x00, 0x3d, 0x10, 0x51, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x69, 0x97, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x61, 0x61, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x1a, 0x9c, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x02, 0x00, 0x00, 0x9c, 0xff, 0xff, 0xff, 0x18, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x85, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x7b, 0x0a, 0x90, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x07, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x85, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0xbf, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x71, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2f, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1f, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x3b, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x79, 0xa1, 0x50, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x25, 0x01, 0x39, 0x00, 0x40, 0x00, 0x00, 0x00, 0x61, 0x61, 0x04, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x61, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xa4, 0x50, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x04, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x2d, 0x14, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x05, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x2d, 0x15, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x71, 0x45, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x05, 0x2c, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x71, 0x45, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x71, 0x40, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x4f, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x55, 0x00, 0x27, 0x00, 0x00, 0x01, 0x00, 0x00, 0x71, 0x45, 0x06, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x71, 0x40, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x67, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x4f, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x71, 0x45, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x05, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x71, 0x40, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x4f, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x40, 0x08, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x71, 0x44, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x67, 0x04, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x4f, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x57, 0x05, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00,
+  0x4f, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x04, 0x00, 0x00,
+  0xff, 0xff, 0x00, 0x00, 0x55, 0x04, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xb7, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0f, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
+  0x2d, 0x10, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x40, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x77, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x5d, 0x07, 0x08, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x71, 0x55, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x15, 0x05, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x54, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x57, 0x04, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00,
+  0x55, 0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x74, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0x07, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x15, 0x07, 0x01, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0xec, 0xff, 0x00, 0x00, 0x00, 0x00, 0x79, 0xa1, 0x90, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x55, 0x01, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xb7, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0xf7, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x57, 0x07, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x77, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x5f, 0x87, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x79, 0xa2, 0x50, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x55, 0x07, 0xed, 0x00, 0x01, 0x00, 0x00, 0x00, 0x25, 0x02, 0xec, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x61, 0x67, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x61, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x89, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x2d, 0x71, 0xe5, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x7b, 0x2a, 0x50, 0xff, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x12, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x02, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x2d, 0x72, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x12, 0x02, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x25, 0x02, 0xdf, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x71, 0x12, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x13, 0x05, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x67, 0x03, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x4f, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x03, 0xda, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x71, 0x12, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x71, 0x13, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x03, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x4f, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x55, 0x03, 0xd5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x12, 0x0b, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x67, 0x02, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x71, 0x13, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0x32, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x71, 0x13, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x71, 0x14, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x04, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x4f, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x57, 0x02, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x4f, 0x24, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x57, 0x04, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,
+  0x55, 0x04, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x6b, 0x3a, 0xe0, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x7b, 0x3a, 0xd8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x3a, 0xd0, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x7b, 0x3a, 0xc8, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x7b, 0x3a, 0xc0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x3a, 0xb8, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x7b, 0x3a, 0xb0, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x7b, 0x3a, 0xa8, 0xff, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x7b, 0x2a, 0x90, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x7b, 0x3a, 0xa0, 0xff, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x79, 0xa4, 0x90, 0xff, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x43, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x04, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x2d, 0x74, 0xb6, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x71, 0x33, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x04, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x77, 0x04, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x79, 0xa5, 0x90, 0xff, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x45, 0x10, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x03, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x02, 0x00, 0x00,
+  0xc0, 0x00, 0x00, 0x00, 0x55, 0x02, 0xac, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x79, 0xa2, 0x90, 0xff, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x32, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xbf, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x04, 0x00, 0x00,
+  0xa0, 0xff, 0xff, 0xff, 0x79, 0xa5, 0x90, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x0f, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x34, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x05, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x7b, 0x5a, 0x90, 0xff, 0x00, 0x00, 0x00, 0x00, 0x15, 0x05, 0xa1, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x05, 0x00, 0xe4, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x04, 0x00, 0x00,
+  0xbf, 0xff, 0xff, 0xff, 0x57, 0x04, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,
+  0x25, 0x04, 0xf3, 0xff, 0x19, 0x00, 0x00, 0x00, 0x47, 0x03, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x05, 0x00, 0xf1, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0xb7, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xb7, 0x01, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x79, 0xa2, 0x90, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0xdb, 0x12, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x9a, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x79, 0xa3, 0x90, 0xff, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x32, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x03, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x2d, 0x73, 0x8f, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x71, 0x23, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x71, 0x22, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x02, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x4f, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x55, 0x02, 0x8a, 0x00, 0x00, 0x01, 0x00, 0x00, 0xbf, 0x92, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x79, 0xa4, 0x90, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x0f, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x23, 0x15, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x71, 0x22, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x67, 0x02, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x4f, 0x32, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x6b, 0x2a, 0xe0, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x02, 0x00, 0x00,
+  0xc0, 0xff, 0xff, 0xff, 0x67, 0x02, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x77, 0x02, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x18, 0x03, 0x00, 0x00,
+  0xb0, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2d, 0x23, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x12, 0x0a, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x71, 0x11, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x67, 0x01, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x4f, 0x21, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xb7, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x7b, 0x2a, 0x88, 0xff, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x02, 0x00, 0x00,
+  0xff, 0xff, 0x00, 0x00, 0x7b, 0x2a, 0x80, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x7b, 0x1a, 0x78, 0xff, 0x00, 0x00, 0x00, 0x00, 0x15, 0x01, 0x4e, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x79, 0xa2, 0x90, 0xff, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x21, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x02, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x2d, 0x72, 0x6b, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x71, 0x11, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x55, 0x01, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x91, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x79, 0xa2, 0x90, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x0f, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x12, 0x1a, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x71, 0x13, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x67, 0x03, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x4f, 0x23, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x55, 0x03, 0x61, 0x00, 0x00, 0x29, 0x00, 0x00,
+  0x71, 0x11, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x01, 0x5f, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x79, 0xa2, 0x90, 0xff, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x21, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x71, 0x12, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x55, 0x02, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x11, 0x20, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x67, 0x01, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00,
+  0xc7, 0x01, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0xb7, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x6d, 0x12, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xa2, 0x90, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x71, 0x12, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x13, 0x23, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x67, 0x03, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x4f, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x03, 0x4d, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x71, 0x13, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x67, 0x03, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x71, 0x12, 0x1b, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x4f, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x71, 0x12, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x02, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x71, 0x14, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x4f, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x32, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x71, 0x13, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x67, 0x03, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x71, 0x14, 0x1d, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x4f, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0f, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x13, 0x20, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x67, 0x03, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x71, 0x14, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0x43, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x71, 0x13, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x11, 0x22, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x67, 0x01, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x4f, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x12, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x77, 0x01, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x57, 0x02, 0x00, 0x00,
+  0xff, 0xff, 0x00, 0x00, 0x0f, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x01, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x0f, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x79, 0xa2, 0x90, 0xff, 0x00, 0x00, 0x00, 0x00, 0x57, 0x02, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xbf, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xdc, 0x03, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x15, 0x02, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xb7, 0x01, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x7b, 0x1a, 0x88, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0xa7, 0x03, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0x57, 0x03, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x7b, 0x3a, 0x80, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x69, 0x91, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xdc, 0x01, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x79, 0xa2, 0x88, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x1f, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x01, 0x00, 0x00, 0xe7, 0xff, 0xff, 0xff, 0x79, 0xa2, 0x90, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x5d, 0x21, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x69, 0x92, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x01, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x7b, 0x2a, 0x70, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x15, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x79, 0xa2, 0x58, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x5f, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x02, 0x14, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x63, 0x1a, 0x9c, 0xff, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xa2, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x02, 0x00, 0x00, 0x9c, 0xff, 0xff, 0xff,
+  0x18, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x7b, 0x0a, 0x48, 0xff, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xa2, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x02, 0x00, 0x00, 0xa0, 0xff, 0xff, 0xff,
+  0x18, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x7b, 0x0a, 0x60, 0xff, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x99, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x79, 0xa1, 0x48, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x15, 0x01, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x01, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x79, 0xa2, 0x48, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0xdb, 0x12, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x62, 0x10, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x18, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x03, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00,
-  0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x05, 0x00, 0xfd, 0xff, 0x00, 0x00, 0x00, 0x00,
-  0xb7, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0xfb, 0xff,
+  0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x72, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x04, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x2d, 0x14, 0x00, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x71, 0x24, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x71, 0x22, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x02, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x4f, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x55, 0x02, 0xfb, 0xfe, 0x00, 0x01, 0x00, 0x00, 0x18, 0x02, 0x00, 0x00,
+  0xc0, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x24, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x67, 0x04, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x77, 0x04, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x18, 0x02, 0x00, 0x00,
+  0xb0, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2d, 0x42, 0xf2, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x79, 0xa2, 0x50, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1f, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x02, 0x00, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0x67, 0x02, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x77, 0x02, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x0f, 0x72, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x85, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x55, 0x00, 0xe8, 0xfe,
+  0x00, 0x00, 0x00, 0x00, 0x61, 0x63, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x61, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x21, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x2d, 0x31, 0xe3, 0xfe, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x70, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0x71, 0x21, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x01, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x71, 0x24, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x4f, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6b, 0x1a, 0xfc, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x71, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x67, 0x01, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x71, 0x24, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x4f, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x71, 0x24, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x04, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x71, 0x25, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x4f, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x04, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x4f, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x63, 0x4a, 0xf8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x71, 0x21, 0x08, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x73, 0x12, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x71, 0x21, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x12, 0x03, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x71, 0x21, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x73, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x21, 0x07, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x73, 0x12, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x71, 0x21, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x12, 0x04, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x71, 0x21, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x73, 0x12, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0xa1, 0xf8, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x77, 0x04, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x73, 0x42, 0x08, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x77, 0x04, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x73, 0x42, 0x09, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x73, 0x12, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x77, 0x01, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x73, 0x12, 0x07, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x69, 0xa1, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x73, 0x12, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x01, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x73, 0x12, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xa1, 0x68, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x79, 0xa1, 0x58, 0xff, 0x00, 0x00, 0x00, 0x00, 0x55, 0x01, 0xcc, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x01, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x2d, 0x31, 0xaf, 0xfe,
+  0x00, 0x00, 0x00, 0x00, 0x61, 0x45, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x7b, 0x5a, 0x88, 0xff, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x51, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x57, 0x01, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,
+  0x77, 0x05, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0f, 0x15, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x71, 0x41, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x67, 0x01, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x71, 0x48, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x4f, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x61, 0x48, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x8a, 0x80, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x57, 0x09, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x0f, 0x95, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x77, 0x09, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0f, 0x95, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x09, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0xdc, 0x09, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x0f, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0f, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x41, 0x05, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x67, 0x01, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x71, 0x48, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0x81, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xb7, 0x08, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x73, 0x84, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x15, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x71, 0x41, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x67, 0x01, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x71, 0x48, 0x06, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x4f, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x79, 0xa8, 0x88, 0xff, 0x00, 0x00, 0x00, 0x00, 0x63, 0x84, 0x10, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x79, 0xa8, 0x80, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x63, 0x84, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x15, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x6b, 0x94, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x71, 0x41, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x01, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x0f, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x05, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x18, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x18, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x57, 0x05, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,
+  0x77, 0x08, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0f, 0x85, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x77, 0x01, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0f, 0x51, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xa7, 0x01, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0x6b, 0x14, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0xb2, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x79, 0xa2, 0x60, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x71, 0x21, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x22, 0x0b, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x67, 0x02, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x4f, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x01, 0x00, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x7b, 0x2a, 0x40, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x2d, 0x21, 0x64, 0xff, 0x00, 0x00, 0x00, 0x00, 0x79, 0xa1, 0x40, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x25, 0x01, 0x62, 0xff, 0xf0, 0x01, 0x00, 0x00,
+  0x79, 0xa2, 0x50, 0xff, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x82, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1f, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x79, 0xa7, 0x88, 0xff, 0x00, 0x00, 0x00, 0x00, 0x79, 0xa1, 0x40, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x02, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x67, 0x02, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x77, 0x02, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x0f, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xa1, 0x90, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x69, 0x91, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x1a, 0x38, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x71, 0x91, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x7b, 0x1a, 0x28, 0xff, 0x00, 0x00, 0x00, 0x00, 0x71, 0x91, 0x0b, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x7b, 0x1a, 0x30, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x00, 0x00, 0x55, 0x00, 0x4d, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x61, 0x62, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x03, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x2d, 0x23, 0x54, 0xfe,
+  0x00, 0x00, 0x00, 0x00, 0x79, 0xa3, 0x90, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x0f, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x00, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x71, 0x13, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x67, 0x03, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x71, 0x14, 0x04, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x4f, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x6b, 0x3a, 0xfc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x71, 0x13, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x67, 0x03, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x71, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0x43, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x71, 0x14, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x67, 0x04, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x71, 0x15, 0x02, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x4f, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x67, 0x04, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x4f, 0x34, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x63, 0x4a, 0xf8, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x71, 0x13, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x31, 0x02, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x71, 0x13, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x73, 0x31, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x13, 0x06, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x73, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x71, 0x13, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x31, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x71, 0x13, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x73, 0x31, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x13, 0x0b, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x73, 0x31, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x61, 0xa3, 0xf8, 0xff, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x34, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x77, 0x04, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x73, 0x41, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x34, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x77, 0x04, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x73, 0x41, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x31, 0x06, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x77, 0x03, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x73, 0x31, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0xa3, 0xfc, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x73, 0x31, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x77, 0x03, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x73, 0x31, 0x0b, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x79, 0xa4, 0x68, 0xff, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x43, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x79, 0xa4, 0x58, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x55, 0x04, 0x0a, 0x01, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x34, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x04, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x2d, 0x24, 0x1f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x61, 0x34, 0x0c, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x7b, 0x4a, 0x68, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0x00, 0x00, 0x77, 0x04, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x0f, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x39, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x67, 0x09, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x71, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0x09, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x61, 0x30, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x08, 0x00, 0x00,
+  0xff, 0xff, 0x00, 0x00, 0x0f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x08, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x0f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x08, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0xdc, 0x08, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x0f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x94, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x71, 0x39, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x67, 0x09, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x71, 0x35, 0x04, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x4f, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xb7, 0x05, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x73, 0x53, 0x08, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x71, 0x35, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x05, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x71, 0x39, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x4f, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xa9, 0x68, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x63, 0x93, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x63, 0x03, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x54, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x6b, 0x83, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x71, 0x35, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x05, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x0f, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x04, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x18, 0x05, 0x00, 0x00,
+  0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x57, 0x04, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,
+  0x77, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0f, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x77, 0x05, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0f, 0x45, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xa7, 0x05, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0x6b, 0x53, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0xf2, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x01, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x2d, 0x31, 0xe3, 0xfd,
+  0x00, 0x00, 0x00, 0x00, 0x61, 0x41, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x67, 0x01, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x61, 0x45, 0x10, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x4f, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x7b, 0x1a, 0xf0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x61, 0x41, 0x0c, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x67, 0x01, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x61, 0x45, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0x51, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x7b, 0x1a, 0xe8, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x61, 0x41, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x14, 0x08, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x61, 0x41, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x63, 0x14, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x41, 0x20, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x63, 0x14, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x61, 0x41, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x14, 0x14, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xb7, 0x01, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x79, 0xa5, 0xf0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x79, 0xa8, 0xe8, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x73, 0x14, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0x01, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x6b, 0x14, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x63, 0x84, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x08, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x63, 0x84, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x63, 0x54, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x05, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x63, 0x54, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x79, 0xa1, 0x50, 0xff, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x12, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x01, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x2d, 0x31, 0xbf, 0xfd,
+  0x00, 0x00, 0x00, 0x00, 0x69, 0x21, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x69, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6b, 0x32, 0x02, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x6b, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xdc, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x6b, 0x02, 0x04, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x61, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xa1, 0x50, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x61, 0x63, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2d, 0x31, 0xb1, 0xfd, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x73, 0x12, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x73, 0x12, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x12, 0x11, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x73, 0x12, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x73, 0x12, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x12, 0x0e, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x73, 0x12, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x6b, 0x12, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x21, 0x0a, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x57, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x47, 0x01, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00, 0x73, 0x12, 0x0a, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x79, 0xa1, 0x58, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x15, 0x01, 0x2f, 0x01, 0x00, 0x00, 0x00, 0x00, 0x79, 0xa1, 0x68, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x2d, 0x31, 0x9d, 0xfd, 0x00, 0x00, 0x00, 0x00,
+  0x71, 0x41, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x01, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x71, 0x45, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x4f, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x45, 0x09, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x67, 0x05, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x71, 0x46, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0x65, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0f, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x41, 0x0d, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x67, 0x01, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x71, 0x45, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0x51, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x71, 0x41, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x01, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x71, 0x45, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x4f, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x71, 0x41, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x67, 0x01, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x71, 0x45, 0x10, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x4f, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0f, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x41, 0x13, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x67, 0x01, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x71, 0x45, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0x51, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x71, 0x45, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x05, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x71, 0x41, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x4f, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x5a, 0x88, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x71, 0x45, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x67, 0x05, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x71, 0x41, 0x24, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x4f, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x7b, 0x5a, 0x80, 0xff, 0x00, 0x00, 0x00, 0x00, 0x71, 0x45, 0x23, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x67, 0x05, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x71, 0x41, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0x15, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x7b, 0x5a, 0x78, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x71, 0x45, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x05, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x71, 0x41, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x4f, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x5a, 0x70, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x71, 0x45, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x67, 0x05, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x71, 0x41, 0x1e, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x4f, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x7b, 0x5a, 0x68, 0xff, 0x00, 0x00, 0x00, 0x00, 0x71, 0x46, 0x1d, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x67, 0x06, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x71, 0x41, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0x16, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x71, 0x41, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x67, 0x01, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x71, 0x45, 0x1a, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x4f, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x71, 0x45, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x05, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x71, 0x48, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x4f, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x48, 0x17, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x67, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x71, 0x49, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0x98, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x71, 0x49, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x71, 0x44, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x04, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x4f, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0f, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0f, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x60, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x79, 0xa1, 0x68, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x0f, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xa1, 0x70, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x79, 0xa1, 0x78, 0xff, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x79, 0xa1, 0x80, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x0f, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xa1, 0x88, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xb7, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0x07, 0x00, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00,
+  0x05, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x46, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x06, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0x0f, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x05, 0x00, 0x00,
+  0xff, 0x00, 0x00, 0x00, 0x67, 0x05, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x0f, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x06, 0x04, 0x00,
+  0x55, 0x00, 0x00, 0x00, 0xbf, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0x04, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x2d, 0x17, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x18, 0x01, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x5f, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x03, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,
+  0x0f, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x77, 0x01, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x0f, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x14, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x57, 0x04, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,
+  0xb7, 0x03, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x15, 0x04, 0xb2, 0x00,
+  0xff, 0xff, 0x00, 0x00, 0xa7, 0x01, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0xbf, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0xaf, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0f, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x31, 0xec, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0xb7, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x71, 0x11, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x3d, 0x74, 0xde, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0f, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x56, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x06, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x2d, 0x36, 0x18, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x71, 0x55, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0xd7, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x04, 0x00, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x2d, 0x24, 0x15, 0xfd, 0x00, 0x00, 0x00, 0x00,
+  0x61, 0x34, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x04, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x61, 0x35, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x4f, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x4a, 0xf0, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x61, 0x34, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x67, 0x04, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x61, 0x35, 0x08, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x4f, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x7b, 0x4a, 0xe8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x61, 0x34, 0x18, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x63, 0x43, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x61, 0x34, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x43, 0x0c, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x61, 0x34, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x63, 0x43, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x34, 0x24, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x63, 0x43, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xb7, 0x04, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x79, 0xa5, 0xf0, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x79, 0xa0, 0xe8, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x73, 0x43, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x74, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xdc, 0x04, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x6b, 0x43, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x03, 0x18, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x63, 0x03, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x53, 0x20, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x77, 0x05, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x63, 0x53, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xa3, 0x50, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x03, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x2d, 0x23, 0xf1, 0xfc, 0x00, 0x00, 0x00, 0x00,
+  0xdc, 0x07, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x6b, 0x71, 0x04, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x69, 0x12, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x69, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6b, 0x31, 0x02, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x6b, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x61, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x21, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x79, 0xa3, 0x50, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x0f, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x14, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x79, 0xa3, 0x90, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x0f, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x04, 0x00, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0x61, 0x63, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2d, 0x34, 0xe1, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x79, 0xa4, 0x40, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x04, 0x00, 0x00, 0xf5, 0xff, 0xff, 0xff,
+  0x71, 0x15, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x05, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x47, 0x05, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00,
+  0x73, 0x51, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xa6, 0x60, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x71, 0x65, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x73, 0x51, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x65, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x71, 0x60, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x73, 0x01, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x51, 0x0e, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x71, 0x65, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x71, 0x60, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x01, 0x11, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x73, 0x51, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x71, 0x60, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x65, 0x05, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x67, 0x05, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x4f, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xa0, 0x78, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xdc, 0x05, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x07, 0x05, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xdc, 0x05, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x73, 0x51, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x05, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x73, 0x51, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x15, 0x04, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x25, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x79, 0xa0, 0x50, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x0f, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xa0, 0x90, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xa6, 0x60, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x06, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0xbf, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x07, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x77, 0x07, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x69, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x71, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x98, 0x19, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x25, 0x00, 0x09, 0x00, 0xee, 0x01, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2d, 0x07, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x08, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x09, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x2d, 0x39, 0xaa, 0xfc,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0xf2, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x79, 0xa5, 0x78, 0xff, 0x00, 0x00, 0x00, 0x00, 0x15, 0x05, 0x1a, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xb7, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x79, 0xa0, 0x40, 0xff, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0xf5, 0xff, 0xff, 0xff, 0x79, 0xa6, 0x60, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x06, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x05, 0x00, 0x25, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x67, 0x09, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x77, 0x09, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0xbf, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0f, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xa9, 0x50, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x79, 0xa9, 0x90, 0xff, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x98, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x09, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x2d, 0x39, 0x95, 0xfc,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0f, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x97, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x73, 0x78, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0x05, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x79, 0xa7, 0x88, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x2d, 0x57, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xa2, 0x70, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x02, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x79, 0xa6, 0x30, 0xff, 0x00, 0x00, 0x00, 0x00, 0x67, 0x06, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x79, 0xa3, 0x90, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x03, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x79, 0xa2, 0x28, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x4f, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x79, 0xa2, 0x60, 0xff, 0x00, 0x00, 0x00, 0x00, 0x71, 0x24, 0x06, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x71, 0x22, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x67, 0x02, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x4f, 0x42, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x57, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x15, 0x03, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0x02, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x57, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x67, 0x07, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x77, 0x07, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x25, 0x07, 0x77, 0xfc,
+  0xef, 0x01, 0x00, 0x00, 0x05, 0x00, 0xd5, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x6b, 0x32, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xa1, 0x90, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x01, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xb7, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x79, 0xa2, 0x90, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0xdb, 0x12, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xb7, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x05, 0x00, 0x67, 0xfd,
+  0x00, 0x00, 0x00, 0x00, 0x71, 0x13, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x67, 0x03, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x71, 0x14, 0x0a, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x4f, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x79, 0xa0, 0x70, 0xff, 0x00, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0x00, 0x00, 0x79, 0xa5, 0x78, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0x04, 0x00, 0x00,
+  0xff, 0xff, 0x00, 0x00, 0x0f, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xa7, 0x06, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x57, 0x06, 0x00, 0x00,
+  0xff, 0xff, 0x00, 0x00, 0x0f, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0f, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x13, 0x13, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x67, 0x03, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x71, 0x14, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0x43, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x79, 0xa4, 0x38, 0xff, 0x00, 0x00, 0x00, 0x00, 0xa7, 0x04, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0x57, 0x04, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,
+  0x69, 0x13, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x43, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x67, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x0f, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x13, 0x0f, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x67, 0x03, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x71, 0x14, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0x43, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x71, 0x13, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x14, 0x11, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x67, 0x04, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x4f, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x40, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x57, 0x02, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,
+  0x0f, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x05, 0x10, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x79, 0xa2, 0x90, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x79, 0xa4, 0x40, 0xff, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x24, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x04, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x79, 0xa2, 0x60, 0xff, 0x00, 0x00, 0x00, 0x00, 0x71, 0x23, 0x08, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x71, 0x22, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x67, 0x02, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x4f, 0x32, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x57, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x15, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0x02, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x79, 0xa3, 0x80, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x0f, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x02, 0x00, 0x00,
+  0xff, 0xff, 0x00, 0x00, 0x0f, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x18, 0x02, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x23, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x77, 0x03, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x57, 0x04, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x0f, 0x34, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x77, 0x02, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0f, 0x42, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x57, 0x04, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xb7, 0x03, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0x15, 0x04, 0x02, 0x00, 0xff, 0xff, 0x00, 0x00,
+  0xa7, 0x02, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x23, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x6b, 0x31, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x79, 0xa1, 0x48, 0xff, 0x00, 0x00, 0x00, 0x00, 0x15, 0x01, 0xb3, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0xb7, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x79, 0xa2, 0x48, 0xff, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x12, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0xaf, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x50, 0x4c, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x47, 0x50, 0x4c, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x9f, 0xeb, 0x01, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x7c, 0x02, 0x00, 0x00, 0x7c, 0x02, 0x00, 0x00, 0xce, 0x0a, 0x00, 0x00,
+  0xe0, 0x04, 0x00, 0x00, 0xe0, 0x04, 0x00, 0x00, 0xfc, 0x1e, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00,
   0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x00,
   0x20, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
@@ -235,647 +1026,2428 @@ unsigned char bpf_kernel_o[] = {
   0x33, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00,
   0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x0f, 0x00, 0x00, 0x00,
   0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-  0x12, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x04,
-  0x18, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
-  0x60, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
-  0x80, 0x00, 0x00, 0x00, 0x8e, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
-  0xa0, 0x00, 0x00, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
-  0x14, 0x00, 0x00, 0x00, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+  0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+  0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0xfd, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04,
+  0x20, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00,
+  0xc0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e,
+  0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x04, 0x28, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x1d, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00,
+  0x1f, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00,
+  0x21, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0e, 0x23, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x26, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x20, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1e, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x2a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0x33, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00,
+  0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x27, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+  0x2a, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x04,
+  0x18, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x91, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x9b, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00,
+  0x60, 0x00, 0x00, 0x00, 0xab, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0xba, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00,
+  0xa0, 0x00, 0x00, 0x00, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+  0x2c, 0x00, 0x00, 0x00, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
   0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x0d, 0x02, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x00,
-  0x11, 0x00, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0c,
-  0x15, 0x00, 0x00, 0x00, 0xb2, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x01, 0x00, 0x00, 0x0d, 0x02, 0x00, 0x00, 0x00, 0xdc, 0x00, 0x00, 0x00,
+  0x29, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0c,
+  0x2d, 0x00, 0x00, 0x00, 0xd8, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
   0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xb7, 0x0a, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x0e, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0xc0, 0x0a, 0x00, 0x00, 0x02, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xdd, 0x1e, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0e, 0x30, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xe6, 0x1e, 0x00, 0x00, 0x05, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00,
   0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
   0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0xc6, 0x0a, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00,
-  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0xec, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00,
+  0xf4, 0x1e, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00,
+  0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
   0x00, 0x69, 0x6e, 0x74, 0x00, 0x5f, 0x5f, 0x41, 0x52, 0x52, 0x41, 0x59,
   0x5f, 0x53, 0x49, 0x5a, 0x45, 0x5f, 0x54, 0x59, 0x50, 0x45, 0x5f, 0x5f,
   0x00, 0x74, 0x79, 0x70, 0x65, 0x00, 0x6d, 0x61, 0x78, 0x5f, 0x65, 0x6e,
   0x74, 0x72, 0x69, 0x65, 0x73, 0x00, 0x6b, 0x65, 0x79, 0x5f, 0x73, 0x69,
   0x7a, 0x65, 0x00, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x5f, 0x73, 0x69, 0x7a,
   0x65, 0x00, 0x6f, 0x70, 0x74, 0x73, 0x5f, 0x6d, 0x61, 0x70, 0x00, 0x78,
-  0x73, 0x6b, 0x73, 0x5f, 0x6d, 0x61, 0x70, 0x00, 0x78, 0x64, 0x70, 0x5f,
-  0x6d, 0x64, 0x00, 0x64, 0x61, 0x74, 0x61, 0x00, 0x64, 0x61, 0x74, 0x61,
-  0x5f, 0x65, 0x6e, 0x64, 0x00, 0x64, 0x61, 0x74, 0x61, 0x5f, 0x6d, 0x65,
-  0x74, 0x61, 0x00, 0x69, 0x6e, 0x67, 0x72, 0x65, 0x73, 0x73, 0x5f, 0x69,
-  0x66, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x00, 0x72, 0x78, 0x5f, 0x71, 0x75,
-  0x65, 0x75, 0x65, 0x5f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x00, 0x65, 0x67,
-  0x72, 0x65, 0x73, 0x73, 0x5f, 0x69, 0x66, 0x69, 0x6e, 0x64, 0x65, 0x78,
-  0x00, 0x5f, 0x5f, 0x75, 0x33, 0x32, 0x00, 0x75, 0x6e, 0x73, 0x69, 0x67,
-  0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x00, 0x63, 0x74, 0x78, 0x00,
-  0x78, 0x64, 0x70, 0x5f, 0x72, 0x65, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74,
-  0x5f, 0x64, 0x6e, 0x73, 0x5f, 0x66, 0x75, 0x6e, 0x63, 0x00, 0x78, 0x64,
-  0x70, 0x00, 0x2f, 0x68, 0x6f, 0x6d, 0x65, 0x2f, 0x64, 0x73, 0x61, 0x6c,
-  0x7a, 0x6d, 0x61, 0x6e, 0x2f, 0x77, 0x6f, 0x72, 0x6b, 0x32, 0x2f, 0x73,
-  0x72, 0x63, 0x2f, 0x6c, 0x69, 0x62, 0x6b, 0x6e, 0x6f, 0x74, 0x2f, 0x78,
-  0x64, 0x70, 0x2f, 0x62, 0x70, 0x66, 0x2d, 0x6b, 0x65, 0x72, 0x6e, 0x65,
-  0x6c, 0x2e, 0x63, 0x00, 0x69, 0x6e, 0x74, 0x20, 0x78, 0x64, 0x70, 0x5f,
+  0x73, 0x6b, 0x73, 0x5f, 0x6d, 0x61, 0x70, 0x00, 0x61, 0x6e, 0x73, 0x77,
+  0x65, 0x72, 0x5f, 0x6d, 0x61, 0x70, 0x00, 0x6d, 0x61, 0x70, 0x5f, 0x66,
+  0x6c, 0x61, 0x67, 0x73, 0x00, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x6d,
+  0x61, 0x70, 0x00, 0x6b, 0x65, 0x72, 0x6e, 0x65, 0x6c, 0x5f, 0x73, 0x74,
+  0x61, 0x74, 0x73, 0x00, 0x78, 0x64, 0x70, 0x5f, 0x6d, 0x64, 0x00, 0x64,
+  0x61, 0x74, 0x61, 0x00, 0x64, 0x61, 0x74, 0x61, 0x5f, 0x65, 0x6e, 0x64,
+  0x00, 0x64, 0x61, 0x74, 0x61, 0x5f, 0x6d, 0x65, 0x74, 0x61, 0x00, 0x69,
+  0x6e, 0x67, 0x72, 0x65, 0x73, 0x73, 0x5f, 0x69, 0x66, 0x69, 0x6e, 0x64,
+  0x65, 0x78, 0x00, 0x72, 0x78, 0x5f, 0x71, 0x75, 0x65, 0x75, 0x65, 0x5f,
+  0x69, 0x6e, 0x64, 0x65, 0x78, 0x00, 0x65, 0x67, 0x72, 0x65, 0x73, 0x73,
+  0x5f, 0x69, 0x66, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x00, 0x5f, 0x5f, 0x75,
+  0x33, 0x32, 0x00, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20,
+  0x69, 0x6e, 0x74, 0x00, 0x63, 0x74, 0x78, 0x00, 0x78, 0x64, 0x70, 0x5f,
   0x72, 0x65, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x5f, 0x64, 0x6e, 0x73,
-  0x5f, 0x66, 0x75, 0x6e, 0x63, 0x28, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74,
-  0x20, 0x78, 0x64, 0x70, 0x5f, 0x6d, 0x64, 0x20, 0x2a, 0x63, 0x74, 0x78,
-  0x29, 0x00, 0x09, 0x5f, 0x5f, 0x75, 0x33, 0x32, 0x20, 0x69, 0x6e, 0x64,
-  0x65, 0x78, 0x20, 0x3d, 0x20, 0x63, 0x74, 0x78, 0x2d, 0x3e, 0x72, 0x78,
-  0x5f, 0x71, 0x75, 0x65, 0x75, 0x65, 0x5f, 0x69, 0x6e, 0x64, 0x65, 0x78,
-  0x3b, 0x00, 0x09, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x6b, 0x6e,
-  0x6f, 0x74, 0x5f, 0x78, 0x64, 0x70, 0x5f, 0x6f, 0x70, 0x74, 0x73, 0x20,
-  0x2a, 0x6f, 0x70, 0x74, 0x73, 0x5f, 0x70, 0x74, 0x72, 0x20, 0x3d, 0x20,
-  0x62, 0x70, 0x66, 0x5f, 0x6d, 0x61, 0x70, 0x5f, 0x6c, 0x6f, 0x6f, 0x6b,
-  0x75, 0x70, 0x5f, 0x65, 0x6c, 0x65, 0x6d, 0x28, 0x26, 0x6f, 0x70, 0x74,
-  0x73, 0x5f, 0x6d, 0x61, 0x70, 0x2c, 0x20, 0x26, 0x69, 0x6e, 0x64, 0x65,
-  0x78, 0x29, 0x3b, 0x00, 0x09, 0x69, 0x66, 0x20, 0x28, 0x21, 0x6f, 0x70,
-  0x74, 0x73, 0x5f, 0x70, 0x74, 0x72, 0x29, 0x20, 0x7b, 0x00, 0x09, 0x69,
-  0x66, 0x20, 0x28, 0x21, 0x28, 0x6f, 0x70, 0x74, 0x73, 0x2e, 0x66, 0x6c,
-  0x61, 0x67, 0x73, 0x20, 0x26, 0x20, 0x4b, 0x4e, 0x4f, 0x54, 0x5f, 0x58,
-  0x44, 0x50, 0x5f, 0x46, 0x49, 0x4c, 0x54, 0x45, 0x52, 0x5f, 0x4f, 0x4e,
-  0x29, 0x29, 0x20, 0x7b, 0x00, 0x09, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29,
-  0x62, 0x70, 0x66, 0x5f, 0x78, 0x64, 0x70, 0x5f, 0x61, 0x64, 0x6a, 0x75,
-  0x73, 0x74, 0x5f, 0x6d, 0x65, 0x74, 0x61, 0x28, 0x63, 0x74, 0x78, 0x2c,
-  0x20, 0x2d, 0x20, 0x28, 0x69, 0x6e, 0x74, 0x29, 0x73, 0x69, 0x7a, 0x65,
-  0x6f, 0x66, 0x28, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x6b, 0x6e,
-  0x6f, 0x74, 0x5f, 0x78, 0x64, 0x70, 0x5f, 0x69, 0x6e, 0x66, 0x6f, 0x29,
-  0x00, 0x09, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x2a, 0x64, 0x61, 0x74, 0x61,
-  0x20, 0x3d, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x2a, 0x29, 0x28,
-  0x6c, 0x6f, 0x6e, 0x67, 0x29, 0x63, 0x74, 0x78, 0x2d, 0x3e, 0x64, 0x61,
-  0x74, 0x61, 0x3b, 0x00, 0x09, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20,
-  0x6b, 0x6e, 0x6f, 0x74, 0x5f, 0x78, 0x64, 0x70, 0x5f, 0x69, 0x6e, 0x66,
-  0x6f, 0x20, 0x2a, 0x6d, 0x65, 0x74, 0x61, 0x20, 0x3d, 0x20, 0x28, 0x76,
-  0x6f, 0x69, 0x64, 0x20, 0x2a, 0x29, 0x28, 0x6c, 0x6f, 0x6e, 0x67, 0x29,
-  0x63, 0x74, 0x78, 0x2d, 0x3e, 0x64, 0x61, 0x74, 0x61, 0x5f, 0x6d, 0x65,
-  0x74, 0x61, 0x3b, 0x00, 0x09, 0x69, 0x66, 0x20, 0x28, 0x28, 0x76, 0x6f,
-  0x69, 0x64, 0x20, 0x2a, 0x29, 0x6d, 0x65, 0x74, 0x61, 0x20, 0x2b, 0x20,
-  0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x2a, 0x6d, 0x65, 0x74, 0x61,
-  0x29, 0x20, 0x3e, 0x20, 0x64, 0x61, 0x74, 0x61, 0x29, 0x20, 0x7b, 0x00,
-  0x09, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x76, 0x6f, 0x69, 0x64, 0x20,
-  0x2a, 0x64, 0x61, 0x74, 0x61, 0x5f, 0x65, 0x6e, 0x64, 0x20, 0x3d, 0x20,
-  0x28, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x2a, 0x29, 0x28, 0x6c, 0x6f, 0x6e,
-  0x67, 0x29, 0x63, 0x74, 0x78, 0x2d, 0x3e, 0x64, 0x61, 0x74, 0x61, 0x5f,
-  0x65, 0x6e, 0x64, 0x3b, 0x00, 0x09, 0x69, 0x66, 0x20, 0x28, 0x28, 0x76,
-  0x6f, 0x69, 0x64, 0x20, 0x2a, 0x29, 0x65, 0x74, 0x68, 0x5f, 0x68, 0x64,
-  0x72, 0x20, 0x2b, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x2a,
-  0x65, 0x74, 0x68, 0x5f, 0x68, 0x64, 0x72, 0x29, 0x20, 0x3e, 0x20, 0x64,
-  0x61, 0x74, 0x61, 0x5f, 0x65, 0x6e, 0x64, 0x29, 0x20, 0x7b, 0x00, 0x09,
-  0x69, 0x66, 0x20, 0x28, 0x65, 0x74, 0x68, 0x5f, 0x68, 0x64, 0x72, 0x2d,
-  0x3e, 0x68, 0x5f, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x20, 0x3d, 0x3d, 0x20,
-  0x5f, 0x5f, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x5f, 0x68,
-  0x74, 0x6f, 0x6e, 0x73, 0x28, 0x45, 0x54, 0x48, 0x5f, 0x50, 0x5f, 0x38,
-  0x30, 0x32, 0x31, 0x51, 0x29, 0x29, 0x20, 0x7b, 0x00, 0x09, 0x09, 0x69,
-  0x66, 0x20, 0x28, 0x64, 0x61, 0x74, 0x61, 0x20, 0x2b, 0x20, 0x73, 0x69,
-  0x7a, 0x65, 0x6f, 0x66, 0x28, 0x5f, 0x5f, 0x75, 0x31, 0x36, 0x29, 0x20,
-  0x2b, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x65, 0x74, 0x68,
-  0x5f, 0x74, 0x79, 0x70, 0x65, 0x29, 0x20, 0x3e, 0x20, 0x64, 0x61, 0x74,
-  0x61, 0x5f, 0x65, 0x6e, 0x64, 0x29, 0x20, 0x7b, 0x00, 0x09, 0x09, 0x7d,
-  0x20, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6d, 0x65,
-  0x74, 0x61, 0x20, 0x3d, 0x3d, 0x20, 0x30, 0x29, 0x20, 0x7b, 0x00, 0x09,
-  0x09, 0x5f, 0x5f, 0x62, 0x75, 0x69, 0x6c, 0x74, 0x69, 0x6e, 0x5f, 0x6d,
-  0x65, 0x6d, 0x63, 0x70, 0x79, 0x28, 0x26, 0x65, 0x74, 0x68, 0x5f, 0x74,
-  0x79, 0x70, 0x65, 0x2c, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x2b, 0x20,
-  0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x5f, 0x5f, 0x75, 0x31, 0x36,
-  0x29, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x65, 0x74,
-  0x68, 0x5f, 0x74, 0x79, 0x70, 0x65, 0x29, 0x29, 0x3b, 0x00, 0x09, 0x73,
-  0x77, 0x69, 0x74, 0x63, 0x68, 0x20, 0x28, 0x65, 0x74, 0x68, 0x5f, 0x74,
-  0x79, 0x70, 0x65, 0x29, 0x20, 0x7b, 0x00, 0x09, 0x09, 0x69, 0x66, 0x20,
-  0x28, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x2a, 0x29, 0x69, 0x70, 0x34,
-  0x20, 0x2b, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x2a, 0x69,
-  0x70, 0x34, 0x29, 0x20, 0x3e, 0x20, 0x64, 0x61, 0x74, 0x61, 0x5f, 0x65,
-  0x6e, 0x64, 0x29, 0x20, 0x7b, 0x00, 0x09, 0x09, 0x69, 0x66, 0x20, 0x28,
-  0x69, 0x70, 0x34, 0x2d, 0x3e, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e,
-  0x20, 0x21, 0x3d, 0x20, 0x34, 0x29, 0x20, 0x7b, 0x00, 0x09, 0x09, 0x69,
-  0x66, 0x20, 0x28, 0x64, 0x61, 0x74, 0x61, 0x5f, 0x65, 0x6e, 0x64, 0x20,
-  0x2d, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x3c, 0x20, 0x5f, 0x5f, 0x62,
-  0x70, 0x66, 0x5f, 0x6e, 0x74, 0x6f, 0x68, 0x73, 0x28, 0x69, 0x70, 0x34,
-  0x2d, 0x3e, 0x74, 0x6f, 0x74, 0x5f, 0x6c, 0x65, 0x6e, 0x29, 0x29, 0x20,
-  0x7b, 0x00, 0x09, 0x09, 0x69, 0x66, 0x20, 0x28, 0x69, 0x70, 0x34, 0x2d,
-  0x3e, 0x66, 0x72, 0x61, 0x67, 0x5f, 0x6f, 0x66, 0x66, 0x20, 0x21, 0x3d,
-  0x20, 0x30, 0x20, 0x26, 0x26, 0x00, 0x09, 0x09, 0x6c, 0x34, 0x5f, 0x68,
-  0x64, 0x72, 0x20, 0x3d, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x2b, 0x20,
-  0x69, 0x70, 0x34, 0x2d, 0x3e, 0x69, 0x68, 0x6c, 0x20, 0x2a, 0x20, 0x34,
-  0x3b, 0x00, 0x09, 0x09, 0x69, 0x70, 0x5f, 0x70, 0x72, 0x6f, 0x74, 0x6f,
-  0x20, 0x3d, 0x20, 0x69, 0x70, 0x34, 0x2d, 0x3e, 0x70, 0x72, 0x6f, 0x74,
-  0x6f, 0x63, 0x6f, 0x6c, 0x3b, 0x00, 0x09, 0x09, 0x69, 0x66, 0x20, 0x28,
-  0x28, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x2a, 0x29, 0x69, 0x70, 0x36, 0x20,
-  0x2b, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x2a, 0x69, 0x70,
-  0x36, 0x29, 0x20, 0x3e, 0x20, 0x64, 0x61, 0x74, 0x61, 0x5f, 0x65, 0x6e,
-  0x64, 0x29, 0x20, 0x7b, 0x00, 0x09, 0x09, 0x69, 0x66, 0x20, 0x28, 0x69,
-  0x70, 0x36, 0x2d, 0x3e, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20,
-  0x21, 0x3d, 0x20, 0x36, 0x29, 0x20, 0x7b, 0x00, 0x09, 0x09, 0x69, 0x66,
-  0x20, 0x28, 0x64, 0x61, 0x74, 0x61, 0x5f, 0x65, 0x6e, 0x64, 0x20, 0x2d,
-  0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x3c, 0x20, 0x5f, 0x5f, 0x62, 0x70,
-  0x66, 0x5f, 0x6e, 0x74, 0x6f, 0x68, 0x73, 0x28, 0x69, 0x70, 0x36, 0x2d,
-  0x3e, 0x70, 0x61, 0x79, 0x6c, 0x6f, 0x61, 0x64, 0x5f, 0x6c, 0x65, 0x6e,
-  0x29, 0x20, 0x2b, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x2a,
-  0x69, 0x70, 0x36, 0x29, 0x29, 0x20, 0x7b, 0x00, 0x09, 0x09, 0x69, 0x70,
-  0x5f, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x20, 0x3d, 0x20, 0x69, 0x70, 0x36,
-  0x2d, 0x3e, 0x6e, 0x65, 0x78, 0x74, 0x68, 0x64, 0x72, 0x3b, 0x00, 0x09,
-  0x09, 0x69, 0x66, 0x20, 0x28, 0x69, 0x70, 0x5f, 0x70, 0x72, 0x6f, 0x74,
-  0x6f, 0x20, 0x3d, 0x3d, 0x20, 0x49, 0x50, 0x50, 0x52, 0x4f, 0x54, 0x4f,
-  0x5f, 0x46, 0x52, 0x41, 0x47, 0x4d, 0x45, 0x4e, 0x54, 0x29, 0x20, 0x7b,
-  0x00, 0x09, 0x09, 0x09, 0x69, 0x66, 0x20, 0x28, 0x28, 0x76, 0x6f, 0x69,
-  0x64, 0x20, 0x2a, 0x29, 0x66, 0x72, 0x61, 0x67, 0x20, 0x2b, 0x20, 0x73,
-  0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x2a, 0x66, 0x72, 0x61, 0x67, 0x29,
-  0x20, 0x3e, 0x20, 0x64, 0x61, 0x74, 0x61, 0x5f, 0x65, 0x6e, 0x64, 0x29,
-  0x20, 0x7b, 0x00, 0x09, 0x09, 0x09, 0x69, 0x70, 0x5f, 0x70, 0x72, 0x6f,
-  0x74, 0x6f, 0x20, 0x3d, 0x20, 0x66, 0x72, 0x61, 0x67, 0x2d, 0x3e, 0x6e,
-  0x65, 0x78, 0x74, 0x68, 0x64, 0x72, 0x3b, 0x00, 0x09, 0x73, 0x77, 0x69,
-  0x74, 0x63, 0x68, 0x20, 0x28, 0x69, 0x70, 0x5f, 0x70, 0x72, 0x6f, 0x74,
-  0x6f, 0x29, 0x20, 0x7b, 0x00, 0x09, 0x09, 0x69, 0x66, 0x20, 0x28, 0x6c,
-  0x34, 0x5f, 0x68, 0x64, 0x72, 0x20, 0x2b, 0x20, 0x73, 0x69, 0x7a, 0x65,
-  0x6f, 0x66, 0x28, 0x2a, 0x74, 0x63, 0x70, 0x29, 0x20, 0x3e, 0x20, 0x64,
-  0x61, 0x74, 0x61, 0x5f, 0x65, 0x6e, 0x64, 0x29, 0x20, 0x7b, 0x00, 0x09,
-  0x09, 0x69, 0x66, 0x20, 0x28, 0x28, 0x6f, 0x70, 0x74, 0x73, 0x2e, 0x66,
-  0x6c, 0x61, 0x67, 0x73, 0x20, 0x26, 0x20, 0x4b, 0x4e, 0x4f, 0x54, 0x5f,
-  0x58, 0x44, 0x50, 0x5f, 0x46, 0x49, 0x4c, 0x54, 0x45, 0x52, 0x5f, 0x54,
-  0x43, 0x50, 0x29, 0x20, 0x26, 0x26, 0x00, 0x09, 0x09, 0x70, 0x6f, 0x72,
-  0x74, 0x5f, 0x64, 0x65, 0x73, 0x74, 0x20, 0x3d, 0x20, 0x5f, 0x5f, 0x62,
-  0x70, 0x66, 0x5f, 0x6e, 0x74, 0x6f, 0x68, 0x73, 0x28, 0x74, 0x63, 0x70,
-  0x2d, 0x3e, 0x64, 0x65, 0x73, 0x74, 0x29, 0x3b, 0x00, 0x09, 0x09, 0x20,
-  0x20, 0x20, 0x20, 0x28, 0x70, 0x6f, 0x72, 0x74, 0x5f, 0x64, 0x65, 0x73,
-  0x74, 0x20, 0x3d, 0x3d, 0x20, 0x6f, 0x70, 0x74, 0x73, 0x2e, 0x75, 0x64,
-  0x70, 0x5f, 0x70, 0x6f, 0x72, 0x74, 0x20, 0x7c, 0x7c, 0x00, 0x09, 0x09,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x28, 0x6f, 0x70, 0x74, 0x73, 0x2e,
-  0x66, 0x6c, 0x61, 0x67, 0x73, 0x20, 0x26, 0x20, 0x28, 0x4b, 0x4e, 0x4f,
-  0x54, 0x5f, 0x58, 0x44, 0x50, 0x5f, 0x46, 0x49, 0x4c, 0x54, 0x45, 0x52,
-  0x5f, 0x50, 0x41, 0x53, 0x53, 0x20, 0x7c, 0x20, 0x4b, 0x4e, 0x4f, 0x54,
-  0x5f, 0x58, 0x44, 0x50, 0x5f, 0x46, 0x49, 0x4c, 0x54, 0x45, 0x52, 0x5f,
-  0x44, 0x52, 0x4f, 0x50, 0x29, 0x29, 0x20, 0x26, 0x26, 0x00, 0x09, 0x09,
-  0x69, 0x66, 0x20, 0x28, 0x6c, 0x34, 0x5f, 0x68, 0x64, 0x72, 0x20, 0x2b,
-  0x20, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x2a, 0x75, 0x64, 0x70,
+  0x5f, 0x66, 0x75, 0x6e, 0x63, 0x00, 0x78, 0x64, 0x70, 0x00, 0x2f, 0x68,
+  0x6f, 0x6d, 0x65, 0x2f, 0x64, 0x73, 0x61, 0x6c, 0x7a, 0x6d, 0x61, 0x6e,
+  0x2f, 0x77, 0x6f, 0x72, 0x6b, 0x32, 0x2f, 0x73, 0x72, 0x63, 0x2f, 0x6c,
+  0x69, 0x62, 0x6b, 0x6e, 0x6f, 0x74, 0x2f, 0x78, 0x64, 0x70, 0x2f, 0x62,
+  0x70, 0x66, 0x2d, 0x6b, 0x65, 0x72, 0x6e, 0x65, 0x6c, 0x2e, 0x63, 0x00,
+  0x69, 0x6e, 0x74, 0x20, 0x78, 0x64, 0x70, 0x5f, 0x72, 0x65, 0x64, 0x69,
+  0x72, 0x65, 0x63, 0x74, 0x5f, 0x64, 0x6e, 0x73, 0x5f, 0x66, 0x75, 0x6e,
+  0x63, 0x28, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x78, 0x64, 0x70,
+  0x5f, 0x6d, 0x64, 0x20, 0x2a, 0x63, 0x74, 0x78, 0x29, 0x00, 0x09, 0x5f,
+  0x5f, 0x75, 0x33, 0x32, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x20, 0x3d,
+  0x20, 0x63, 0x74, 0x78, 0x2d, 0x3e, 0x72, 0x78, 0x5f, 0x71, 0x75, 0x65,
+  0x75, 0x65, 0x5f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x3b, 0x00, 0x09, 0x73,
+  0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x6b, 0x6e, 0x6f, 0x74, 0x5f, 0x78,
+  0x64, 0x70, 0x5f, 0x6f, 0x70, 0x74, 0x73, 0x20, 0x2a, 0x6f, 0x70, 0x74,
+  0x73, 0x5f, 0x70, 0x74, 0x72, 0x20, 0x3d, 0x20, 0x62, 0x70, 0x66, 0x5f,
+  0x6d, 0x61, 0x70, 0x5f, 0x6c, 0x6f, 0x6f, 0x6b, 0x75, 0x70, 0x5f, 0x65,
+  0x6c, 0x65, 0x6d, 0x28, 0x26, 0x6f, 0x70, 0x74, 0x73, 0x5f, 0x6d, 0x61,
+  0x70, 0x2c, 0x20, 0x26, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x29, 0x3b, 0x00,
+  0x09, 0x69, 0x66, 0x20, 0x28, 0x21, 0x6f, 0x70, 0x74, 0x73, 0x5f, 0x70,
+  0x74, 0x72, 0x29, 0x20, 0x7b, 0x00, 0x09, 0x69, 0x66, 0x20, 0x28, 0x21,
+  0x28, 0x6f, 0x70, 0x74, 0x73, 0x2e, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x20,
+  0x26, 0x20, 0x4b, 0x4e, 0x4f, 0x54, 0x5f, 0x58, 0x44, 0x50, 0x5f, 0x46,
+  0x49, 0x4c, 0x54, 0x45, 0x52, 0x5f, 0x4f, 0x4e, 0x29, 0x29, 0x20, 0x7b,
+  0x00, 0x09, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x62, 0x70, 0x66, 0x5f,
+  0x78, 0x64, 0x70, 0x5f, 0x61, 0x64, 0x6a, 0x75, 0x73, 0x74, 0x5f, 0x6d,
+  0x65, 0x74, 0x61, 0x28, 0x63, 0x74, 0x78, 0x2c, 0x20, 0x2d, 0x20, 0x28,
+  0x69, 0x6e, 0x74, 0x29, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x73,
+  0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x6b, 0x6e, 0x6f, 0x74, 0x5f, 0x78,
+  0x64, 0x70, 0x5f, 0x69, 0x6e, 0x66, 0x6f, 0x29, 0x00, 0x09, 0x76, 0x6f,
+  0x69, 0x64, 0x20, 0x2a, 0x64, 0x61, 0x74, 0x61, 0x20, 0x3d, 0x20, 0x28,
+  0x76, 0x6f, 0x69, 0x64, 0x20, 0x2a, 0x29, 0x28, 0x6c, 0x6f, 0x6e, 0x67,
+  0x29, 0x63, 0x74, 0x78, 0x2d, 0x3e, 0x64, 0x61, 0x74, 0x61, 0x3b, 0x00,
+  0x09, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x6b, 0x6e, 0x6f, 0x74,
+  0x5f, 0x78, 0x64, 0x70, 0x5f, 0x69, 0x6e, 0x66, 0x6f, 0x20, 0x2a, 0x6d,
+  0x65, 0x74, 0x61, 0x20, 0x3d, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x20,
+  0x2a, 0x29, 0x28, 0x6c, 0x6f, 0x6e, 0x67, 0x29, 0x63, 0x74, 0x78, 0x2d,
+  0x3e, 0x64, 0x61, 0x74, 0x61, 0x5f, 0x6d, 0x65, 0x74, 0x61, 0x3b, 0x00,
+  0x09, 0x69, 0x66, 0x20, 0x28, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x2a,
+  0x29, 0x6d, 0x65, 0x74, 0x61, 0x20, 0x2b, 0x20, 0x73, 0x69, 0x7a, 0x65,
+  0x6f, 0x66, 0x28, 0x2a, 0x6d, 0x65, 0x74, 0x61, 0x29, 0x20, 0x3e, 0x20,
+  0x64, 0x61, 0x74, 0x61, 0x29, 0x20, 0x7b, 0x00, 0x09, 0x63, 0x6f, 0x6e,
+  0x73, 0x74, 0x20, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x2a, 0x64, 0x61, 0x74,
+  0x61, 0x5f, 0x65, 0x6e, 0x64, 0x20, 0x3d, 0x20, 0x28, 0x76, 0x6f, 0x69,
+  0x64, 0x20, 0x2a, 0x29, 0x28, 0x6c, 0x6f, 0x6e, 0x67, 0x29, 0x63, 0x74,
+  0x78, 0x2d, 0x3e, 0x64, 0x61, 0x74, 0x61, 0x5f, 0x65, 0x6e, 0x64, 0x3b,
+  0x00, 0x09, 0x69, 0x66, 0x20, 0x28, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x20,
+  0x2a, 0x29, 0x65, 0x74, 0x68, 0x5f, 0x68, 0x64, 0x72, 0x20, 0x2b, 0x20,
+  0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x2a, 0x65, 0x74, 0x68, 0x5f,
+  0x68, 0x64, 0x72, 0x29, 0x20, 0x3e, 0x20, 0x64, 0x61, 0x74, 0x61, 0x5f,
+  0x65, 0x6e, 0x64, 0x29, 0x20, 0x7b, 0x00, 0x09, 0x69, 0x66, 0x20, 0x28,
+  0x65, 0x74, 0x68, 0x5f, 0x68, 0x64, 0x72, 0x2d, 0x3e, 0x68, 0x5f, 0x70,
+  0x72, 0x6f, 0x74, 0x6f, 0x20, 0x3d, 0x3d, 0x20, 0x5f, 0x5f, 0x63, 0x6f,
+  0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x5f, 0x68, 0x74, 0x6f, 0x6e, 0x73,
+  0x28, 0x45, 0x54, 0x48, 0x5f, 0x50, 0x5f, 0x38, 0x30, 0x32, 0x31, 0x51,
+  0x29, 0x29, 0x20, 0x7b, 0x00, 0x09, 0x09, 0x69, 0x66, 0x20, 0x28, 0x64,
+  0x61, 0x74, 0x61, 0x20, 0x2b, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66,
+  0x28, 0x5f, 0x5f, 0x75, 0x31, 0x36, 0x29, 0x20, 0x2b, 0x20, 0x73, 0x69,
+  0x7a, 0x65, 0x6f, 0x66, 0x28, 0x65, 0x74, 0x68, 0x5f, 0x74, 0x79, 0x70,
+  0x65, 0x29, 0x20, 0x3e, 0x20, 0x64, 0x61, 0x74, 0x61, 0x5f, 0x65, 0x6e,
+  0x64, 0x29, 0x20, 0x7b, 0x00, 0x09, 0x09, 0x7d, 0x20, 0x65, 0x6c, 0x73,
+  0x65, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6d, 0x65, 0x74, 0x61, 0x20, 0x3d,
+  0x3d, 0x20, 0x30, 0x29, 0x20, 0x7b, 0x20, 0x2f, 0x2a, 0x20, 0x56, 0x4c,
+  0x41, 0x4e, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6f,
+  0x72, 0x74, 0x65, 0x64, 0x2e, 0x20, 0x2a, 0x2f, 0x00, 0x09, 0x09, 0x5f,
+  0x5f, 0x62, 0x75, 0x69, 0x6c, 0x74, 0x69, 0x6e, 0x5f, 0x6d, 0x65, 0x6d,
+  0x63, 0x70, 0x79, 0x28, 0x26, 0x65, 0x74, 0x68, 0x5f, 0x74, 0x79, 0x70,
+  0x65, 0x2c, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x2b, 0x20, 0x73, 0x69,
+  0x7a, 0x65, 0x6f, 0x66, 0x28, 0x5f, 0x5f, 0x75, 0x31, 0x36, 0x29, 0x2c,
+  0x20, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x65, 0x74, 0x68, 0x5f,
+  0x74, 0x79, 0x70, 0x65, 0x29, 0x29, 0x3b, 0x00, 0x09, 0x73, 0x77, 0x69,
+  0x74, 0x63, 0x68, 0x20, 0x28, 0x65, 0x74, 0x68, 0x5f, 0x74, 0x79, 0x70,
+  0x65, 0x29, 0x20, 0x7b, 0x00, 0x09, 0x09, 0x69, 0x66, 0x20, 0x28, 0x28,
+  0x76, 0x6f, 0x69, 0x64, 0x20, 0x2a, 0x29, 0x69, 0x70, 0x34, 0x20, 0x2b,
+  0x20, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x2a, 0x69, 0x70, 0x34,
   0x29, 0x20, 0x3e, 0x20, 0x64, 0x61, 0x74, 0x61, 0x5f, 0x65, 0x6e, 0x64,
+  0x29, 0x20, 0x7b, 0x00, 0x09, 0x09, 0x69, 0x66, 0x20, 0x28, 0x69, 0x70,
+  0x34, 0x2d, 0x3e, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x21,
+  0x3d, 0x20, 0x34, 0x29, 0x20, 0x7b, 0x00, 0x09, 0x09, 0x69, 0x66, 0x20,
+  0x28, 0x64, 0x61, 0x74, 0x61, 0x5f, 0x65, 0x6e, 0x64, 0x20, 0x2d, 0x20,
+  0x64, 0x61, 0x74, 0x61, 0x20, 0x3c, 0x20, 0x5f, 0x5f, 0x62, 0x70, 0x66,
+  0x5f, 0x6e, 0x74, 0x6f, 0x68, 0x73, 0x28, 0x69, 0x70, 0x34, 0x2d, 0x3e,
+  0x74, 0x6f, 0x74, 0x5f, 0x6c, 0x65, 0x6e, 0x29, 0x29, 0x20, 0x7b, 0x00,
+  0x09, 0x09, 0x69, 0x66, 0x20, 0x28, 0x69, 0x70, 0x34, 0x2d, 0x3e, 0x66,
+  0x72, 0x61, 0x67, 0x5f, 0x6f, 0x66, 0x66, 0x20, 0x21, 0x3d, 0x20, 0x30,
+  0x20, 0x26, 0x26, 0x00, 0x09, 0x09, 0x6c, 0x34, 0x5f, 0x68, 0x64, 0x72,
+  0x20, 0x3d, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x2b, 0x20, 0x69, 0x70,
+  0x34, 0x2d, 0x3e, 0x69, 0x68, 0x6c, 0x20, 0x2a, 0x20, 0x34, 0x3b, 0x00,
+  0x09, 0x09, 0x6c, 0x34, 0x5f, 0x6f, 0x66, 0x66, 0x20, 0x3d, 0x20, 0x6c,
+  0x33, 0x5f, 0x6f, 0x66, 0x66, 0x20, 0x2b, 0x20, 0x69, 0x70, 0x34, 0x2d,
+  0x3e, 0x69, 0x68, 0x6c, 0x20, 0x2a, 0x20, 0x34, 0x3b, 0x00, 0x09, 0x09,
+  0x69, 0x70, 0x5f, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x20, 0x3d, 0x20, 0x69,
+  0x70, 0x34, 0x2d, 0x3e, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x63, 0x6f, 0x6c,
+  0x3b, 0x00, 0x09, 0x09, 0x69, 0x66, 0x20, 0x28, 0x28, 0x76, 0x6f, 0x69,
+  0x64, 0x20, 0x2a, 0x29, 0x69, 0x70, 0x36, 0x20, 0x2b, 0x20, 0x73, 0x69,
+  0x7a, 0x65, 0x6f, 0x66, 0x28, 0x2a, 0x69, 0x70, 0x36, 0x29, 0x20, 0x3e,
+  0x20, 0x64, 0x61, 0x74, 0x61, 0x5f, 0x65, 0x6e, 0x64, 0x29, 0x20, 0x7b,
+  0x00, 0x09, 0x09, 0x69, 0x66, 0x20, 0x28, 0x69, 0x70, 0x36, 0x2d, 0x3e,
+  0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x21, 0x3d, 0x20, 0x36,
   0x29, 0x20, 0x7b, 0x00, 0x09, 0x09, 0x69, 0x66, 0x20, 0x28, 0x64, 0x61,
-  0x74, 0x61, 0x5f, 0x65, 0x6e, 0x64, 0x20, 0x2d, 0x20, 0x28, 0x76, 0x6f,
-  0x69, 0x64, 0x20, 0x2a, 0x29, 0x75, 0x64, 0x70, 0x20, 0x3c, 0x20, 0x5f,
-  0x5f, 0x62, 0x70, 0x66, 0x5f, 0x6e, 0x74, 0x6f, 0x68, 0x73, 0x28, 0x75,
-  0x64, 0x70, 0x2d, 0x3e, 0x6c, 0x65, 0x6e, 0x29, 0x29, 0x20, 0x7b, 0x00,
-  0x09, 0x09, 0x70, 0x6f, 0x72, 0x74, 0x5f, 0x64, 0x65, 0x73, 0x74, 0x20,
-  0x3d, 0x20, 0x5f, 0x5f, 0x62, 0x70, 0x66, 0x5f, 0x6e, 0x74, 0x6f, 0x68,
-  0x73, 0x28, 0x75, 0x64, 0x70, 0x2d, 0x3e, 0x64, 0x65, 0x73, 0x74, 0x29,
-  0x3b, 0x00, 0x09, 0x09, 0x69, 0x66, 0x20, 0x28, 0x28, 0x6f, 0x70, 0x74,
-  0x73, 0x2e, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x20, 0x26, 0x20, 0x4b, 0x4e,
-  0x4f, 0x54, 0x5f, 0x58, 0x44, 0x50, 0x5f, 0x46, 0x49, 0x4c, 0x54, 0x45,
-  0x52, 0x5f, 0x55, 0x44, 0x50, 0x29, 0x20, 0x26, 0x26, 0x00, 0x09, 0x09,
-  0x7d, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x69, 0x66, 0x20, 0x28, 0x28,
-  0x6f, 0x70, 0x74, 0x73, 0x2e, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x20, 0x26,
-  0x20, 0x4b, 0x4e, 0x4f, 0x54, 0x5f, 0x58, 0x44, 0x50, 0x5f, 0x46, 0x49,
-  0x4c, 0x54, 0x45, 0x52, 0x5f, 0x51, 0x55, 0x49, 0x43, 0x29, 0x20, 0x26,
-  0x26, 0x00, 0x09, 0x09, 0x20, 0x20, 0x20, 0x20, 0x28, 0x70, 0x6f, 0x72,
-  0x74, 0x5f, 0x64, 0x65, 0x73, 0x74, 0x20, 0x3d, 0x3d, 0x20, 0x6f, 0x70,
-  0x74, 0x73, 0x2e, 0x71, 0x75, 0x69, 0x63, 0x5f, 0x70, 0x6f, 0x72, 0x74,
-  0x20, 0x7c, 0x7c, 0x00, 0x09, 0x7d, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x20,
-  0x69, 0x66, 0x20, 0x28, 0x6f, 0x70, 0x74, 0x73, 0x2e, 0x66, 0x6c, 0x61,
-  0x67, 0x73, 0x20, 0x26, 0x20, 0x4b, 0x4e, 0x4f, 0x54, 0x5f, 0x58, 0x44,
-  0x50, 0x5f, 0x46, 0x49, 0x4c, 0x54, 0x45, 0x52, 0x5f, 0x44, 0x52, 0x4f,
-  0x50, 0x29, 0x20, 0x7b, 0x00, 0x09, 0x69, 0x66, 0x20, 0x28, 0x6f, 0x70,
+  0x74, 0x61, 0x5f, 0x65, 0x6e, 0x64, 0x20, 0x2d, 0x20, 0x64, 0x61, 0x74,
+  0x61, 0x20, 0x3c, 0x20, 0x5f, 0x5f, 0x62, 0x70, 0x66, 0x5f, 0x6e, 0x74,
+  0x6f, 0x68, 0x73, 0x28, 0x69, 0x70, 0x36, 0x2d, 0x3e, 0x70, 0x61, 0x79,
+  0x6c, 0x6f, 0x61, 0x64, 0x5f, 0x6c, 0x65, 0x6e, 0x29, 0x20, 0x2b, 0x20,
+  0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x2a, 0x69, 0x70, 0x36, 0x29,
+  0x29, 0x20, 0x7b, 0x00, 0x09, 0x09, 0x69, 0x70, 0x5f, 0x70, 0x72, 0x6f,
+  0x74, 0x6f, 0x20, 0x3d, 0x20, 0x69, 0x70, 0x36, 0x2d, 0x3e, 0x6e, 0x65,
+  0x78, 0x74, 0x68, 0x64, 0x72, 0x3b, 0x00, 0x09, 0x09, 0x69, 0x66, 0x20,
+  0x28, 0x69, 0x70, 0x5f, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x20, 0x3d, 0x3d,
+  0x20, 0x49, 0x50, 0x50, 0x52, 0x4f, 0x54, 0x4f, 0x5f, 0x46, 0x52, 0x41,
+  0x47, 0x4d, 0x45, 0x4e, 0x54, 0x29, 0x20, 0x7b, 0x00, 0x09, 0x09, 0x09,
+  0x69, 0x66, 0x20, 0x28, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x2a, 0x29,
+  0x66, 0x72, 0x61, 0x67, 0x20, 0x2b, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x6f,
+  0x66, 0x28, 0x2a, 0x66, 0x72, 0x61, 0x67, 0x29, 0x20, 0x3e, 0x20, 0x64,
+  0x61, 0x74, 0x61, 0x5f, 0x65, 0x6e, 0x64, 0x29, 0x20, 0x7b, 0x00, 0x09,
+  0x09, 0x09, 0x69, 0x70, 0x5f, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x20, 0x3d,
+  0x20, 0x66, 0x72, 0x61, 0x67, 0x2d, 0x3e, 0x6e, 0x65, 0x78, 0x74, 0x68,
+  0x64, 0x72, 0x3b, 0x00, 0x09, 0x09, 0x6c, 0x34, 0x5f, 0x6f, 0x66, 0x66,
+  0x20, 0x3d, 0x20, 0x6c, 0x33, 0x5f, 0x6f, 0x66, 0x66, 0x20, 0x2b, 0x20,
+  0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x2a, 0x69, 0x70, 0x36, 0x29,
+  0x20, 0x2b, 0x20, 0x28, 0x66, 0x72, 0x61, 0x67, 0x6d, 0x65, 0x6e, 0x74,
+  0x65, 0x64, 0x20, 0x3f, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28,
+  0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x69, 0x70, 0x76, 0x36, 0x5f,
+  0x66, 0x72, 0x61, 0x67, 0x5f, 0x68, 0x64, 0x72, 0x29, 0x20, 0x3a, 0x20,
+  0x30, 0x29, 0x3b, 0x00, 0x09, 0x73, 0x77, 0x69, 0x74, 0x63, 0x68, 0x20,
+  0x28, 0x69, 0x70, 0x5f, 0x70, 0x72, 0x6f, 0x74, 0x6f, 0x29, 0x20, 0x7b,
+  0x00, 0x09, 0x09, 0x69, 0x66, 0x20, 0x28, 0x6c, 0x34, 0x5f, 0x68, 0x64,
+  0x72, 0x20, 0x2b, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x2a,
+  0x74, 0x63, 0x70, 0x29, 0x20, 0x3e, 0x20, 0x64, 0x61, 0x74, 0x61, 0x5f,
+  0x65, 0x6e, 0x64, 0x29, 0x20, 0x7b, 0x00, 0x09, 0x09, 0x69, 0x66, 0x20,
+  0x28, 0x28, 0x6f, 0x70, 0x74, 0x73, 0x2e, 0x66, 0x6c, 0x61, 0x67, 0x73,
+  0x20, 0x26, 0x20, 0x4b, 0x4e, 0x4f, 0x54, 0x5f, 0x58, 0x44, 0x50, 0x5f,
+  0x46, 0x49, 0x4c, 0x54, 0x45, 0x52, 0x5f, 0x54, 0x43, 0x50, 0x29, 0x20,
+  0x26, 0x26, 0x00, 0x09, 0x09, 0x20, 0x20, 0x20, 0x20, 0x28, 0x70, 0x6f,
+  0x72, 0x74, 0x5f, 0x64, 0x65, 0x73, 0x74, 0x20, 0x3d, 0x3d, 0x20, 0x6f,
+  0x70, 0x74, 0x73, 0x2e, 0x75, 0x64, 0x70, 0x5f, 0x70, 0x6f, 0x72, 0x74,
+  0x20, 0x7c, 0x7c, 0x00, 0x09, 0x09, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28,
+  0x28, 0x6f, 0x70, 0x74, 0x73, 0x2e, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x20,
+  0x26, 0x20, 0x28, 0x4b, 0x4e, 0x4f, 0x54, 0x5f, 0x58, 0x44, 0x50, 0x5f,
+  0x46, 0x49, 0x4c, 0x54, 0x45, 0x52, 0x5f, 0x50, 0x41, 0x53, 0x53, 0x20,
+  0x7c, 0x20, 0x4b, 0x4e, 0x4f, 0x54, 0x5f, 0x58, 0x44, 0x50, 0x5f, 0x46,
+  0x49, 0x4c, 0x54, 0x45, 0x52, 0x5f, 0x44, 0x52, 0x4f, 0x50, 0x29, 0x29,
+  0x20, 0x26, 0x26, 0x00, 0x09, 0x09, 0x69, 0x66, 0x20, 0x28, 0x6c, 0x34,
+  0x5f, 0x68, 0x64, 0x72, 0x20, 0x2b, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x6f,
+  0x66, 0x28, 0x2a, 0x75, 0x64, 0x70, 0x29, 0x20, 0x3e, 0x20, 0x64, 0x61,
+  0x74, 0x61, 0x5f, 0x65, 0x6e, 0x64, 0x29, 0x20, 0x7b, 0x00, 0x09, 0x09,
+  0x69, 0x66, 0x20, 0x28, 0x64, 0x61, 0x74, 0x61, 0x5f, 0x65, 0x6e, 0x64,
+  0x20, 0x2d, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x2a, 0x29, 0x75,
+  0x64, 0x70, 0x20, 0x3c, 0x20, 0x5f, 0x5f, 0x62, 0x70, 0x66, 0x5f, 0x6e,
+  0x74, 0x6f, 0x68, 0x73, 0x28, 0x75, 0x64, 0x70, 0x2d, 0x3e, 0x6c, 0x65,
+  0x6e, 0x29, 0x29, 0x20, 0x7b, 0x00, 0x09, 0x09, 0x70, 0x6f, 0x72, 0x74,
+  0x5f, 0x64, 0x65, 0x73, 0x74, 0x20, 0x3d, 0x20, 0x5f, 0x5f, 0x62, 0x70,
+  0x66, 0x5f, 0x6e, 0x74, 0x6f, 0x68, 0x73, 0x28, 0x75, 0x64, 0x70, 0x2d,
+  0x3e, 0x64, 0x65, 0x73, 0x74, 0x29, 0x3b, 0x00, 0x09, 0x09, 0x69, 0x66,
+  0x20, 0x28, 0x28, 0x6f, 0x70, 0x74, 0x73, 0x2e, 0x66, 0x6c, 0x61, 0x67,
+  0x73, 0x20, 0x26, 0x20, 0x4b, 0x4e, 0x4f, 0x54, 0x5f, 0x58, 0x44, 0x50,
+  0x5f, 0x46, 0x49, 0x4c, 0x54, 0x45, 0x52, 0x5f, 0x55, 0x44, 0x50, 0x29,
+  0x20, 0x26, 0x26, 0x00, 0x09, 0x09, 0x7d, 0x20, 0x65, 0x6c, 0x73, 0x65,
+  0x20, 0x69, 0x66, 0x20, 0x28, 0x28, 0x6f, 0x70, 0x74, 0x73, 0x2e, 0x66,
+  0x6c, 0x61, 0x67, 0x73, 0x20, 0x26, 0x20, 0x4b, 0x4e, 0x4f, 0x54, 0x5f,
+  0x58, 0x44, 0x50, 0x5f, 0x46, 0x49, 0x4c, 0x54, 0x45, 0x52, 0x5f, 0x51,
+  0x55, 0x49, 0x43, 0x29, 0x20, 0x26, 0x26, 0x00, 0x09, 0x09, 0x20, 0x20,
+  0x20, 0x20, 0x28, 0x70, 0x6f, 0x72, 0x74, 0x5f, 0x64, 0x65, 0x73, 0x74,
+  0x20, 0x3d, 0x3d, 0x20, 0x6f, 0x70, 0x74, 0x73, 0x2e, 0x71, 0x75, 0x69,
+  0x63, 0x5f, 0x70, 0x6f, 0x72, 0x74, 0x20, 0x7c, 0x7c, 0x00, 0x09, 0x7d,
+  0x20, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6f, 0x70,
   0x74, 0x73, 0x2e, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x20, 0x26, 0x20, 0x4b,
   0x4e, 0x4f, 0x54, 0x5f, 0x58, 0x44, 0x50, 0x5f, 0x46, 0x49, 0x4c, 0x54,
-  0x45, 0x52, 0x5f, 0x52, 0x4f, 0x55, 0x54, 0x45, 0x29, 0x20, 0x7b, 0x00,
-  0x09, 0x09, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x62, 0x70, 0x66,
-  0x5f, 0x66, 0x69, 0x62, 0x5f, 0x6c, 0x6f, 0x6f, 0x6b, 0x75, 0x70, 0x20,
-  0x66, 0x69, 0x62, 0x20, 0x3d, 0x20, 0x7b, 0x00, 0x09, 0x09, 0x69, 0x66,
-  0x20, 0x28, 0x69, 0x70, 0x76, 0x34, 0x29, 0x20, 0x7b, 0x00, 0x09, 0x09,
-  0x09, 0x66, 0x69, 0x62, 0x2e, 0x66, 0x61, 0x6d, 0x69, 0x6c, 0x79, 0x20,
-  0x20, 0x20, 0x3d, 0x20, 0x41, 0x46, 0x5f, 0x49, 0x4e, 0x45, 0x54, 0x3b,
+  0x45, 0x52, 0x5f, 0x44, 0x52, 0x4f, 0x50, 0x29, 0x20, 0x7b, 0x00, 0x09,
+  0x69, 0x66, 0x20, 0x28, 0x6f, 0x70, 0x74, 0x73, 0x2e, 0x66, 0x6c, 0x61,
+  0x67, 0x73, 0x20, 0x26, 0x20, 0x4b, 0x4e, 0x4f, 0x54, 0x5f, 0x58, 0x44,
+  0x50, 0x5f, 0x46, 0x49, 0x4c, 0x54, 0x45, 0x52, 0x5f, 0x52, 0x4f, 0x55,
+  0x54, 0x45, 0x29, 0x20, 0x7b, 0x00, 0x09, 0x09, 0x73, 0x74, 0x72, 0x75,
+  0x63, 0x74, 0x20, 0x62, 0x70, 0x66, 0x5f, 0x66, 0x69, 0x62, 0x5f, 0x6c,
+  0x6f, 0x6f, 0x6b, 0x75, 0x70, 0x20, 0x66, 0x69, 0x62, 0x20, 0x3d, 0x20,
+  0x7b, 0x00, 0x09, 0x09, 0x69, 0x66, 0x20, 0x28, 0x69, 0x70, 0x76, 0x34,
+  0x29, 0x20, 0x7b, 0x00, 0x09, 0x09, 0x09, 0x66, 0x69, 0x62, 0x2e, 0x66,
+  0x61, 0x6d, 0x69, 0x6c, 0x79, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x41, 0x46,
+  0x5f, 0x49, 0x4e, 0x45, 0x54, 0x3b, 0x00, 0x09, 0x09, 0x09, 0x66, 0x69,
+  0x62, 0x2e, 0x69, 0x70, 0x76, 0x34, 0x5f, 0x73, 0x72, 0x63, 0x20, 0x3d,
+  0x20, 0x69, 0x70, 0x34, 0x2d, 0x3e, 0x64, 0x61, 0x64, 0x64, 0x72, 0x3b,
   0x00, 0x09, 0x09, 0x09, 0x66, 0x69, 0x62, 0x2e, 0x69, 0x70, 0x76, 0x34,
-  0x5f, 0x73, 0x72, 0x63, 0x20, 0x3d, 0x20, 0x69, 0x70, 0x34, 0x2d, 0x3e,
-  0x64, 0x61, 0x64, 0x64, 0x72, 0x3b, 0x00, 0x09, 0x09, 0x09, 0x66, 0x69,
-  0x62, 0x2e, 0x69, 0x70, 0x76, 0x34, 0x5f, 0x64, 0x73, 0x74, 0x20, 0x3d,
-  0x20, 0x69, 0x70, 0x34, 0x2d, 0x3e, 0x73, 0x61, 0x64, 0x64, 0x72, 0x3b,
-  0x00, 0x09, 0x09, 0x09, 0x66, 0x69, 0x62, 0x2e, 0x66, 0x61, 0x6d, 0x69,
-  0x6c, 0x79, 0x20, 0x3d, 0x20, 0x41, 0x46, 0x5f, 0x49, 0x4e, 0x45, 0x54,
-  0x36, 0x3b, 0x00, 0x09, 0x09, 0x09, 0x2a, 0x69, 0x70, 0x76, 0x36, 0x5f,
-  0x73, 0x72, 0x63, 0x20, 0x20, 0x3d, 0x20, 0x69, 0x70, 0x36, 0x2d, 0x3e,
-  0x64, 0x61, 0x64, 0x64, 0x72, 0x3b, 0x00, 0x09, 0x09, 0x09, 0x2a, 0x69,
-  0x70, 0x76, 0x36, 0x5f, 0x64, 0x73, 0x74, 0x20, 0x20, 0x3d, 0x20, 0x69,
-  0x70, 0x36, 0x2d, 0x3e, 0x73, 0x61, 0x64, 0x64, 0x72, 0x3b, 0x00, 0x09,
-  0x09, 0x69, 0x6e, 0x74, 0x20, 0x72, 0x65, 0x74, 0x20, 0x3d, 0x20, 0x62,
-  0x70, 0x66, 0x5f, 0x66, 0x69, 0x62, 0x5f, 0x6c, 0x6f, 0x6f, 0x6b, 0x75,
-  0x70, 0x28, 0x63, 0x74, 0x78, 0x2c, 0x20, 0x26, 0x66, 0x69, 0x62, 0x2c,
-  0x20, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x66, 0x69, 0x62, 0x29,
-  0x2c, 0x20, 0x42, 0x50, 0x46, 0x5f, 0x46, 0x49, 0x42, 0x5f, 0x4c, 0x4f,
-  0x4f, 0x4b, 0x55, 0x50, 0x5f, 0x44, 0x49, 0x52, 0x45, 0x43, 0x54, 0x29,
-  0x3b, 0x00, 0x09, 0x09, 0x73, 0x77, 0x69, 0x74, 0x63, 0x68, 0x20, 0x28,
-  0x72, 0x65, 0x74, 0x29, 0x20, 0x7b, 0x00, 0x09, 0x09, 0x09, 0x69, 0x66,
-  0x20, 0x28, 0x6d, 0x61, 0x63, 0x5f, 0x69, 0x6e, 0x5b, 0x30, 0x5d, 0x20,
-  0x21, 0x3d, 0x20, 0x6d, 0x61, 0x63, 0x5f, 0x6f, 0x75, 0x74, 0x5b, 0x30,
-  0x5d, 0x20, 0x7c, 0x7c, 0x00, 0x09, 0x09, 0x09, 0x20, 0x20, 0x20, 0x20,
-  0x6d, 0x61, 0x63, 0x5f, 0x69, 0x6e, 0x5b, 0x31, 0x5d, 0x20, 0x21, 0x3d,
-  0x20, 0x6d, 0x61, 0x63, 0x5f, 0x6f, 0x75, 0x74, 0x5b, 0x31, 0x5d, 0x20,
-  0x7c, 0x7c, 0x00, 0x09, 0x09, 0x09, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x61,
-  0x63, 0x5f, 0x69, 0x6e, 0x5b, 0x32, 0x5d, 0x20, 0x21, 0x3d, 0x20, 0x6d,
-  0x61, 0x63, 0x5f, 0x6f, 0x75, 0x74, 0x5b, 0x32, 0x5d, 0x29, 0x20, 0x7b,
-  0x00, 0x09, 0x09, 0x09, 0x69, 0x66, 0x20, 0x28, 0x6d, 0x65, 0x74, 0x61,
-  0x20, 0x21, 0x3d, 0x20, 0x30, 0x29, 0x20, 0x7b, 0x00, 0x09, 0x09, 0x09,
-  0x09, 0x6d, 0x65, 0x74, 0x61, 0x2d, 0x3e, 0x6f, 0x75, 0x74, 0x5f, 0x69,
-  0x66, 0x5f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x20, 0x3d, 0x20, 0x66, 0x69,
-  0x62, 0x2e, 0x69, 0x66, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x3b, 0x00, 0x09,
-  0x09, 0x09, 0x5f, 0x5f, 0x62, 0x75, 0x69, 0x6c, 0x74, 0x69, 0x6e, 0x5f,
-  0x6d, 0x65, 0x6d, 0x63, 0x70, 0x79, 0x28, 0x65, 0x74, 0x68, 0x5f, 0x68,
-  0x64, 0x72, 0x2d, 0x3e, 0x68, 0x5f, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65,
-  0x2c, 0x20, 0x66, 0x69, 0x62, 0x2e, 0x64, 0x6d, 0x61, 0x63, 0x2c, 0x20,
-  0x45, 0x54, 0x48, 0x5f, 0x41, 0x4c, 0x45, 0x4e, 0x29, 0x3b, 0x00, 0x09,
-  0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x62, 0x70, 0x66, 0x5f, 0x72,
-  0x65, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x5f, 0x6d, 0x61, 0x70, 0x28,
-  0x26, 0x78, 0x73, 0x6b, 0x73, 0x5f, 0x6d, 0x61, 0x70, 0x2c, 0x20, 0x63,
-  0x74, 0x78, 0x2d, 0x3e, 0x72, 0x78, 0x5f, 0x71, 0x75, 0x65, 0x75, 0x65,
-  0x5f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x00,
-  0x7d, 0x00, 0x63, 0x68, 0x61, 0x72, 0x00, 0x5f, 0x6c, 0x69, 0x63, 0x65,
-  0x6e, 0x73, 0x65, 0x00, 0x2e, 0x6d, 0x61, 0x70, 0x73, 0x00, 0x6c, 0x69,
-  0x63, 0x65, 0x6e, 0x73, 0x65, 0x00, 0x00, 0x00, 0x9f, 0xeb, 0x01, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x2c, 0x07, 0x00, 0x00, 0x40, 0x07, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0xca, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0xca, 0x00, 0x00, 0x00, 0x72, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-  0x00, 0xf0, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00,
-  0x2e, 0x01, 0x00, 0x00, 0x15, 0xfc, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0xce, 0x00, 0x00, 0x00, 0x2e, 0x01, 0x00, 0x00, 0x08, 0xfc, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00,
-  0x52, 0x01, 0x00, 0x00, 0x23, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00,
-  0xce, 0x00, 0x00, 0x00, 0x9c, 0x01, 0x00, 0x00, 0x06, 0x04, 0x01, 0x00,
-  0x58, 0x00, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00, 0xae, 0x01, 0x00, 0x00,
-  0x08, 0x1c, 0x01, 0x00, 0x78, 0x00, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00,
-  0xae, 0x01, 0x00, 0x00, 0x13, 0x1c, 0x01, 0x00, 0x90, 0x00, 0x00, 0x00,
-  0xce, 0x00, 0x00, 0x00, 0xae, 0x01, 0x00, 0x00, 0x06, 0x1c, 0x01, 0x00,
-  0x98, 0x00, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00,
-  0xd9, 0x01, 0x00, 0x00, 0x08, 0x30, 0x01, 0x00, 0xf0, 0x00, 0x00, 0x00,
-  0xce, 0x00, 0x00, 0x00, 0x1d, 0x02, 0x00, 0x00, 0x22, 0x3c, 0x01, 0x00,
-  0xf8, 0x00, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00, 0x44, 0x02, 0x00, 0x00,
-  0x32, 0x44, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00,
-  0x80, 0x02, 0x00, 0x00, 0x13, 0x50, 0x01, 0x00, 0x18, 0x01, 0x00, 0x00,
-  0xce, 0x00, 0x00, 0x00, 0x80, 0x02, 0x00, 0x00, 0x06, 0x50, 0x01, 0x00,
-  0x30, 0x01, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00, 0xac, 0x02, 0x00, 0x00,
-  0x2c, 0x40, 0x01, 0x00, 0x38, 0x01, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00,
-  0xe1, 0x02, 0x00, 0x00, 0x16, 0x8c, 0x01, 0x00, 0x50, 0x01, 0x00, 0x00,
-  0xce, 0x00, 0x00, 0x00, 0xe1, 0x02, 0x00, 0x00, 0x06, 0x8c, 0x01, 0x00,
-  0x58, 0x01, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00, 0x17, 0x03, 0x00, 0x00,
-  0x0f, 0xa4, 0x01, 0x00, 0x78, 0x01, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00,
-  0x17, 0x03, 0x00, 0x00, 0x06, 0xa4, 0x01, 0x00, 0x80, 0x01, 0x00, 0x00,
-  0xce, 0x00, 0x00, 0x00, 0x51, 0x03, 0x00, 0x00, 0x1c, 0xa8, 0x01, 0x00,
-  0x98, 0x01, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00, 0x51, 0x03, 0x00, 0x00,
-  0x07, 0xa8, 0x01, 0x00, 0xa8, 0x01, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00,
-  0x8d, 0x03, 0x00, 0x00, 0x0e, 0xb0, 0x01, 0x00, 0xb8, 0x01, 0x00, 0x00,
-  0xce, 0x00, 0x00, 0x00, 0xa7, 0x03, 0x00, 0x00, 0x03, 0xbc, 0x01, 0x00,
-  0xd8, 0x01, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00, 0xee, 0x03, 0x00, 0x00,
-  0x02, 0xe0, 0x01, 0x00, 0xf8, 0x01, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00,
-  0x03, 0x04, 0x00, 0x00, 0x13, 0xec, 0x01, 0x00, 0x10, 0x02, 0x00, 0x00,
-  0xce, 0x00, 0x00, 0x00, 0x03, 0x04, 0x00, 0x00, 0x07, 0xec, 0x01, 0x00,
-  0x18, 0x02, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00, 0x32, 0x04, 0x00, 0x00,
-  0x0c, 0xf8, 0x01, 0x00, 0x20, 0x02, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00,
-  0x32, 0x04, 0x00, 0x00, 0x14, 0xf8, 0x01, 0x00, 0x38, 0x02, 0x00, 0x00,
-  0xce, 0x00, 0x00, 0x00, 0x32, 0x04, 0x00, 0x00, 0x07, 0xf8, 0x01, 0x00,
-  0x40, 0x02, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00, 0x4d, 0x04, 0x00, 0x00,
-  0x10, 0x10, 0x02, 0x00, 0x50, 0x02, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00,
-  0x4d, 0x04, 0x00, 0x00, 0x19, 0x10, 0x02, 0x00, 0x68, 0x02, 0x00, 0x00,
-  0xce, 0x00, 0x00, 0x00, 0x4d, 0x04, 0x00, 0x00, 0x07, 0x10, 0x02, 0x00,
-  0x70, 0x02, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00, 0x82, 0x04, 0x00, 0x00,
-  0x0c, 0x20, 0x02, 0x00, 0x78, 0x02, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00,
-  0x82, 0x04, 0x00, 0x00, 0x1a, 0x20, 0x02, 0x00, 0xa8, 0x02, 0x00, 0x00,
-  0xce, 0x00, 0x00, 0x00, 0x9e, 0x04, 0x00, 0x00, 0x1c, 0x34, 0x02, 0x00,
-  0xb8, 0x02, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00, 0x9e, 0x04, 0x00, 0x00,
-  0x11, 0x34, 0x02, 0x00, 0xc8, 0x02, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00,
-  0xbe, 0x04, 0x00, 0x00, 0x13, 0x30, 0x02, 0x00, 0xd8, 0x02, 0x00, 0x00,
-  0xce, 0x00, 0x00, 0x00, 0xda, 0x04, 0x00, 0x00, 0x13, 0x48, 0x02, 0x00,
-  0xf0, 0x02, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00, 0xda, 0x04, 0x00, 0x00,
-  0x07, 0x48, 0x02, 0x00, 0xf8, 0x02, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00,
-  0x09, 0x05, 0x00, 0x00, 0x0c, 0x54, 0x02, 0x00, 0x00, 0x03, 0x00, 0x00,
-  0xce, 0x00, 0x00, 0x00, 0x09, 0x05, 0x00, 0x00, 0x14, 0x54, 0x02, 0x00,
-  0x10, 0x03, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00, 0x09, 0x05, 0x00, 0x00,
-  0x07, 0x54, 0x02, 0x00, 0x18, 0x03, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00,
-  0x24, 0x05, 0x00, 0x00, 0x10, 0x6c, 0x02, 0x00, 0x28, 0x03, 0x00, 0x00,
-  0xce, 0x00, 0x00, 0x00, 0x24, 0x05, 0x00, 0x00, 0x19, 0x6c, 0x02, 0x00,
-  0x38, 0x03, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00, 0x24, 0x05, 0x00, 0x00,
-  0x37, 0x6c, 0x02, 0x00, 0x48, 0x03, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00,
-  0x24, 0x05, 0x00, 0x00, 0x07, 0x6c, 0x02, 0x00, 0x68, 0x03, 0x00, 0x00,
-  0xce, 0x00, 0x00, 0x00, 0x6c, 0x05, 0x00, 0x00, 0x13, 0x7c, 0x02, 0x00,
-  0x70, 0x03, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00, 0x87, 0x05, 0x00, 0x00,
-  0x07, 0x84, 0x02, 0x00, 0x80, 0x03, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00,
-  0xad, 0x05, 0x00, 0x00, 0x15, 0x90, 0x02, 0x00, 0x90, 0x03, 0x00, 0x00,
-  0xce, 0x00, 0x00, 0x00, 0xad, 0x05, 0x00, 0x00, 0x08, 0x90, 0x02, 0x00,
-  0xa0, 0x03, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00, 0xdf, 0x05, 0x00, 0x00,
-  0x15, 0x9c, 0x02, 0x00, 0xb8, 0x03, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x03, 0x00, 0x00,
-  0xce, 0x00, 0x00, 0x00, 0xfc, 0x05, 0x00, 0x00, 0x02, 0xe0, 0x02, 0x00,
-  0xf0, 0x03, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00, 0x11, 0x06, 0x00, 0x00,
-  0x0e, 0xf0, 0x02, 0x00, 0x08, 0x04, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00,
-  0x11, 0x06, 0x00, 0x00, 0x07, 0xf0, 0x02, 0x00, 0x10, 0x04, 0x00, 0x00,
-  0xce, 0x00, 0x00, 0x00, 0x3b, 0x06, 0x00, 0x00, 0x13, 0x08, 0x03, 0x00,
-  0x28, 0x04, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00, 0x3b, 0x06, 0x00, 0x00,
-  0x2a, 0x08, 0x03, 0x00, 0x30, 0x04, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00,
-  0x67, 0x06, 0x00, 0x00, 0x0f, 0x00, 0x03, 0x00, 0x40, 0x04, 0x00, 0x00,
-  0xce, 0x00, 0x00, 0x00, 0x8d, 0x06, 0x00, 0x00, 0x12, 0x0c, 0x03, 0x00,
-  0x50, 0x04, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00, 0x8d, 0x06, 0x00, 0x00,
-  0x23, 0x0c, 0x03, 0x00, 0x58, 0x04, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00,
-  0xb2, 0x06, 0x00, 0x00, 0x15, 0x10, 0x03, 0x00, 0x70, 0x04, 0x00, 0x00,
-  0xce, 0x00, 0x00, 0x00, 0xb2, 0x06, 0x00, 0x00, 0x46, 0x10, 0x03, 0x00,
-  0x98, 0x04, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00, 0xfa, 0x06, 0x00, 0x00,
-  0x0e, 0x30, 0x03, 0x00, 0xb0, 0x04, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00,
-  0xfa, 0x06, 0x00, 0x00, 0x07, 0x30, 0x03, 0x00, 0xb8, 0x04, 0x00, 0x00,
-  0xce, 0x00, 0x00, 0x00, 0x24, 0x07, 0x00, 0x00, 0x10, 0x44, 0x03, 0x00,
-  0xc0, 0x04, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00, 0x24, 0x07, 0x00, 0x00,
-  0x20, 0x44, 0x03, 0x00, 0xd8, 0x04, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00,
-  0x24, 0x07, 0x00, 0x00, 0x07, 0x44, 0x03, 0x00, 0xe0, 0x04, 0x00, 0x00,
-  0xce, 0x00, 0x00, 0x00, 0x5c, 0x07, 0x00, 0x00, 0x0f, 0x54, 0x03, 0x00,
-  0xf0, 0x04, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00, 0x82, 0x07, 0x00, 0x00,
-  0x13, 0x5c, 0x03, 0x00, 0x00, 0x05, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00,
-  0x82, 0x07, 0x00, 0x00, 0x2a, 0x5c, 0x03, 0x00, 0x08, 0x05, 0x00, 0x00,
-  0xce, 0x00, 0x00, 0x00, 0x8d, 0x06, 0x00, 0x00, 0x12, 0x60, 0x03, 0x00,
-  0x18, 0x05, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00, 0x8d, 0x06, 0x00, 0x00,
-  0x23, 0x60, 0x03, 0x00, 0x20, 0x05, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00,
-  0xb2, 0x06, 0x00, 0x00, 0x15, 0x64, 0x03, 0x00, 0x30, 0x05, 0x00, 0x00,
-  0xce, 0x00, 0x00, 0x00, 0xb2, 0x06, 0x00, 0x00, 0x46, 0x64, 0x03, 0x00,
-  0x48, 0x05, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00, 0xae, 0x07, 0x00, 0x00,
-  0x1a, 0x70, 0x03, 0x00, 0x60, 0x05, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00,
-  0xae, 0x07, 0x00, 0x00, 0x32, 0x70, 0x03, 0x00, 0x70, 0x05, 0x00, 0x00,
-  0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x90, 0x05, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00, 0xe2, 0x07, 0x00, 0x00,
-  0x12, 0x74, 0x03, 0x00, 0x98, 0x05, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00,
-  0xe2, 0x07, 0x00, 0x00, 0x24, 0x74, 0x03, 0x00, 0xa0, 0x05, 0x00, 0x00,
-  0xce, 0x00, 0x00, 0x00, 0xb2, 0x06, 0x00, 0x00, 0x15, 0x78, 0x03, 0x00,
-  0xb8, 0x05, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00, 0xb2, 0x06, 0x00, 0x00,
-  0x46, 0x78, 0x03, 0x00, 0xd8, 0x05, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00,
-  0x08, 0x08, 0x00, 0x00, 0x18, 0xac, 0x03, 0x00, 0xf0, 0x05, 0x00, 0x00,
-  0xce, 0x00, 0x00, 0x00, 0x08, 0x08, 0x00, 0x00, 0x0d, 0xac, 0x03, 0x00,
-  0x10, 0x06, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00, 0x39, 0x08, 0x00, 0x00,
-  0x11, 0xd0, 0x03, 0x00, 0x18, 0x06, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00,
-  0x39, 0x08, 0x00, 0x00, 0x06, 0xd0, 0x03, 0x00, 0x28, 0x06, 0x00, 0x00,
-  0xce, 0x00, 0x00, 0x00, 0x64, 0x08, 0x00, 0x00, 0x19, 0xd4, 0x03, 0x00,
-  0x78, 0x06, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00, 0x84, 0x08, 0x00, 0x00,
-  0x07, 0xe0, 0x03, 0x00, 0x90, 0x06, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00,
-  0x92, 0x08, 0x00, 0x00, 0x11, 0xe4, 0x03, 0x00, 0x98, 0x06, 0x00, 0x00,
-  0xce, 0x00, 0x00, 0x00, 0xad, 0x08, 0x00, 0x00, 0x18, 0xe8, 0x03, 0x00,
-  0xa0, 0x06, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00, 0xad, 0x08, 0x00, 0x00,
-  0x11, 0xe8, 0x03, 0x00, 0xa8, 0x06, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00,
-  0xcb, 0x08, 0x00, 0x00, 0x18, 0xec, 0x03, 0x00, 0xb0, 0x06, 0x00, 0x00,
-  0xce, 0x00, 0x00, 0x00, 0xcb, 0x08, 0x00, 0x00, 0x11, 0xec, 0x03, 0x00,
-  0xc8, 0x06, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00, 0xe9, 0x08, 0x00, 0x00,
-  0x0f, 0xfc, 0x03, 0x00, 0xd0, 0x06, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00,
-  0x03, 0x09, 0x00, 0x00, 0x16, 0x00, 0x04, 0x00, 0x20, 0x07, 0x00, 0x00,
-  0xce, 0x00, 0x00, 0x00, 0x1f, 0x09, 0x00, 0x00, 0x16, 0x04, 0x04, 0x00,
-  0x78, 0x07, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00,
-  0x3b, 0x09, 0x00, 0x00, 0x0d, 0x18, 0x04, 0x00, 0xb8, 0x07, 0x00, 0x00,
-  0xce, 0x00, 0x00, 0x00, 0x86, 0x09, 0x00, 0x00, 0x03, 0x1c, 0x04, 0x00,
-  0xe0, 0x07, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00, 0x97, 0x09, 0x00, 0x00,
-  0x08, 0x28, 0x04, 0x00, 0xe8, 0x07, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00,
-  0x97, 0x09, 0x00, 0x00, 0x15, 0x28, 0x04, 0x00, 0xf0, 0x07, 0x00, 0x00,
-  0xce, 0x00, 0x00, 0x00, 0x97, 0x09, 0x00, 0x00, 0x20, 0x28, 0x04, 0x00,
-  0xf8, 0x07, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00, 0xb9, 0x09, 0x00, 0x00,
-  0x08, 0x2c, 0x04, 0x00, 0x00, 0x08, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00,
-  0xb9, 0x09, 0x00, 0x00, 0x15, 0x2c, 0x04, 0x00, 0x08, 0x08, 0x00, 0x00,
-  0xce, 0x00, 0x00, 0x00, 0xb9, 0x09, 0x00, 0x00, 0x20, 0x2c, 0x04, 0x00,
-  0x10, 0x08, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00, 0xdb, 0x09, 0x00, 0x00,
-  0x08, 0x30, 0x04, 0x00, 0x18, 0x08, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00,
-  0xdb, 0x09, 0x00, 0x00, 0x15, 0x30, 0x04, 0x00, 0x20, 0x08, 0x00, 0x00,
-  0xce, 0x00, 0x00, 0x00, 0x97, 0x09, 0x00, 0x00, 0x08, 0x28, 0x04, 0x00,
-  0x28, 0x08, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00, 0xfd, 0x09, 0x00, 0x00,
-  0x08, 0x44, 0x04, 0x00, 0x38, 0x08, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00,
-  0x11, 0x0a, 0x00, 0x00, 0x1e, 0x48, 0x04, 0x00, 0x40, 0x08, 0x00, 0x00,
-  0xce, 0x00, 0x00, 0x00, 0x11, 0x0a, 0x00, 0x00, 0x18, 0x48, 0x04, 0x00,
-  0x50, 0x08, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00, 0x37, 0x0a, 0x00, 0x00,
-  0x04, 0x58, 0x04, 0x00, 0xb0, 0x08, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00,
-  0x73, 0x0a, 0x00, 0x00, 0x09, 0x88, 0x04, 0x00, 0xd8, 0x08, 0x00, 0x00,
-  0xce, 0x00, 0x00, 0x00, 0xb0, 0x0a, 0x00, 0x00, 0x01, 0x8c, 0x04, 0x00,
+  0x5f, 0x64, 0x73, 0x74, 0x20, 0x3d, 0x20, 0x69, 0x70, 0x34, 0x2d, 0x3e,
+  0x73, 0x61, 0x64, 0x64, 0x72, 0x3b, 0x00, 0x09, 0x09, 0x09, 0x66, 0x69,
+  0x62, 0x2e, 0x66, 0x61, 0x6d, 0x69, 0x6c, 0x79, 0x20, 0x3d, 0x20, 0x41,
+  0x46, 0x5f, 0x49, 0x4e, 0x45, 0x54, 0x36, 0x3b, 0x00, 0x09, 0x09, 0x09,
+  0x2a, 0x69, 0x70, 0x76, 0x36, 0x5f, 0x73, 0x72, 0x63, 0x20, 0x20, 0x3d,
+  0x20, 0x69, 0x70, 0x36, 0x2d, 0x3e, 0x64, 0x61, 0x64, 0x64, 0x72, 0x3b,
+  0x00, 0x09, 0x09, 0x09, 0x2a, 0x69, 0x70, 0x76, 0x36, 0x5f, 0x64, 0x73,
+  0x74, 0x20, 0x20, 0x3d, 0x20, 0x69, 0x70, 0x36, 0x2d, 0x3e, 0x73, 0x61,
+  0x64, 0x64, 0x72, 0x3b, 0x00, 0x09, 0x09, 0x69, 0x6e, 0x74, 0x20, 0x72,
+  0x65, 0x74, 0x20, 0x3d, 0x20, 0x62, 0x70, 0x66, 0x5f, 0x66, 0x69, 0x62,
+  0x5f, 0x6c, 0x6f, 0x6f, 0x6b, 0x75, 0x70, 0x28, 0x63, 0x74, 0x78, 0x2c,
+  0x20, 0x26, 0x66, 0x69, 0x62, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x6f,
+  0x66, 0x28, 0x66, 0x69, 0x62, 0x29, 0x2c, 0x20, 0x42, 0x50, 0x46, 0x5f,
+  0x46, 0x49, 0x42, 0x5f, 0x4c, 0x4f, 0x4f, 0x4b, 0x55, 0x50, 0x5f, 0x44,
+  0x49, 0x52, 0x45, 0x43, 0x54, 0x29, 0x3b, 0x00, 0x09, 0x09, 0x73, 0x77,
+  0x69, 0x74, 0x63, 0x68, 0x20, 0x28, 0x72, 0x65, 0x74, 0x29, 0x20, 0x7b,
+  0x00, 0x09, 0x09, 0x09, 0x69, 0x66, 0x20, 0x28, 0x6d, 0x61, 0x63, 0x5f,
+  0x69, 0x6e, 0x5b, 0x30, 0x5d, 0x20, 0x21, 0x3d, 0x20, 0x6d, 0x61, 0x63,
+  0x5f, 0x6f, 0x75, 0x74, 0x5b, 0x30, 0x5d, 0x20, 0x7c, 0x7c, 0x00, 0x09,
+  0x09, 0x09, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x61, 0x63, 0x5f, 0x69, 0x6e,
+  0x5b, 0x31, 0x5d, 0x20, 0x21, 0x3d, 0x20, 0x6d, 0x61, 0x63, 0x5f, 0x6f,
+  0x75, 0x74, 0x5b, 0x31, 0x5d, 0x20, 0x7c, 0x7c, 0x00, 0x09, 0x09, 0x09,
+  0x20, 0x20, 0x20, 0x20, 0x6d, 0x61, 0x63, 0x5f, 0x69, 0x6e, 0x5b, 0x32,
+  0x5d, 0x20, 0x21, 0x3d, 0x20, 0x6d, 0x61, 0x63, 0x5f, 0x6f, 0x75, 0x74,
+  0x5b, 0x32, 0x5d, 0x29, 0x20, 0x7b, 0x00, 0x09, 0x09, 0x09, 0x69, 0x66,
+  0x20, 0x28, 0x6d, 0x65, 0x74, 0x61, 0x20, 0x21, 0x3d, 0x20, 0x30, 0x29,
+  0x20, 0x7b, 0x00, 0x09, 0x09, 0x09, 0x09, 0x6d, 0x65, 0x74, 0x61, 0x2d,
+  0x3e, 0x6f, 0x75, 0x74, 0x5f, 0x69, 0x66, 0x5f, 0x69, 0x6e, 0x64, 0x65,
+  0x78, 0x20, 0x3d, 0x20, 0x66, 0x69, 0x62, 0x2e, 0x69, 0x66, 0x69, 0x6e,
+  0x64, 0x65, 0x78, 0x3b, 0x00, 0x09, 0x09, 0x09, 0x5f, 0x5f, 0x62, 0x75,
+  0x69, 0x6c, 0x74, 0x69, 0x6e, 0x5f, 0x6d, 0x65, 0x6d, 0x63, 0x70, 0x79,
+  0x28, 0x65, 0x74, 0x68, 0x5f, 0x68, 0x64, 0x72, 0x2d, 0x3e, 0x68, 0x5f,
+  0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x2c, 0x20, 0x66, 0x69, 0x62, 0x2e,
+  0x64, 0x6d, 0x61, 0x63, 0x2c, 0x20, 0x45, 0x54, 0x48, 0x5f, 0x41, 0x4c,
+  0x45, 0x4e, 0x29, 0x3b, 0x00, 0x09, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20,
+  0x5f, 0x5f, 0x75, 0x38, 0x20, 0x66, 0x61, 0x73, 0x74, 0x5f, 0x70, 0x61,
+  0x74, 0x68, 0x20, 0x3d, 0x20, 0x69, 0x70, 0x5f, 0x70, 0x72, 0x6f, 0x74,
+  0x6f, 0x20, 0x3d, 0x3d, 0x20, 0x49, 0x50, 0x50, 0x52, 0x4f, 0x54, 0x4f,
+  0x5f, 0x55, 0x44, 0x50, 0x20, 0x26, 0x26, 0x20, 0x70, 0x6f, 0x72, 0x74,
+  0x5f, 0x64, 0x65, 0x73, 0x74, 0x20, 0x3d, 0x3d, 0x20, 0x6f, 0x70, 0x74,
+  0x73, 0x2e, 0x75, 0x64, 0x70, 0x5f, 0x70, 0x6f, 0x72, 0x74, 0x20, 0x26,
+  0x26, 0x00, 0x09, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x28, 0x69, 0x70, 0x76, 0x34, 0x20, 0x3f, 0x20, 0x28, 0x69,
+  0x70, 0x34, 0x2d, 0x3e, 0x69, 0x68, 0x6c, 0x20, 0x3d, 0x3d, 0x20, 0x35,
+  0x20, 0x26, 0x26, 0x00, 0x09, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x28, 0x69, 0x70, 0x34, 0x2d, 0x3e, 0x66, 0x72, 0x61, 0x67, 0x5f,
+  0x6f, 0x66, 0x66, 0x20, 0x26, 0x20, 0x5f, 0x5f, 0x63, 0x6f, 0x6e, 0x73,
+  0x74, 0x61, 0x6e, 0x74, 0x5f, 0x68, 0x74, 0x6f, 0x6e, 0x73, 0x28, 0x49,
+  0x50, 0x5f, 0x4d, 0x46, 0x20, 0x7c, 0x20, 0x49, 0x50, 0x5f, 0x4f, 0x46,
+  0x46, 0x53, 0x45, 0x54, 0x29, 0x29, 0x20, 0x3d, 0x3d, 0x20, 0x30, 0x29,
+  0x00, 0x09, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3a, 0x20, 0x69, 0x70, 0x36,
+  0x2d, 0x3e, 0x6e, 0x65, 0x78, 0x74, 0x68, 0x64, 0x72, 0x20, 0x3d, 0x3d,
+  0x20, 0x49, 0x50, 0x50, 0x52, 0x4f, 0x54, 0x4f, 0x5f, 0x55, 0x44, 0x50,
+  0x29, 0x3b, 0x00, 0x09, 0x69, 0x66, 0x20, 0x28, 0x28, 0x6f, 0x70, 0x74,
+  0x73, 0x2e, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x20, 0x26, 0x20, 0x4b, 0x4e,
+  0x4f, 0x54, 0x5f, 0x58, 0x44, 0x50, 0x5f, 0x46, 0x49, 0x4c, 0x54, 0x45,
+  0x52, 0x5f, 0x42, 0x4c, 0x4f, 0x43, 0x4b, 0x29, 0x20, 0x26, 0x26, 0x20,
+  0x66, 0x61, 0x73, 0x74, 0x5f, 0x70, 0x61, 0x74, 0x68, 0x29, 0x20, 0x7b,
+  0x00, 0x09, 0x6b, 0x6e, 0x6f, 0x74, 0x5f, 0x78, 0x64, 0x70, 0x5f, 0x62,
+  0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x6b, 0x65, 0x79, 0x5f, 0x74, 0x20, 0x6b,
+  0x65, 0x79, 0x20, 0x3d, 0x20, 0x7b, 0x20, 0x2e, 0x70, 0x72, 0x65, 0x66,
+  0x69, 0x78, 0x6c, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x38, 0x20, 0x2a, 0x20,
+  0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x6b, 0x65, 0x79, 0x2e, 0x61,
+  0x64, 0x64, 0x72, 0x29, 0x20, 0x7d, 0x3b, 0x00, 0x09, 0x69, 0x66, 0x20,
+  0x28, 0x69, 0x70, 0x76, 0x34, 0x29, 0x20, 0x7b, 0x00, 0x09, 0x09, 0x6b,
+  0x65, 0x79, 0x2e, 0x61, 0x64, 0x64, 0x72, 0x5b, 0x31, 0x30, 0x5d, 0x20,
+  0x3d, 0x20, 0x6b, 0x65, 0x79, 0x2e, 0x61, 0x64, 0x64, 0x72, 0x5b, 0x31,
+  0x31, 0x5d, 0x20, 0x3d, 0x20, 0x30, 0x78, 0x66, 0x66, 0x3b, 0x20, 0x2f,
+  0x2a, 0x20, 0x49, 0x50, 0x76, 0x34, 0x2d, 0x6d, 0x61, 0x70, 0x70, 0x65,
+  0x64, 0x20, 0x49, 0x50, 0x76, 0x36, 0x20, 0x61, 0x64, 0x64, 0x72, 0x65,
+  0x73, 0x73, 0x2e, 0x20, 0x2a, 0x2f, 0x00, 0x09, 0x09, 0x5f, 0x5f, 0x62,
+  0x75, 0x69, 0x6c, 0x74, 0x69, 0x6e, 0x5f, 0x6d, 0x65, 0x6d, 0x63, 0x70,
+  0x79, 0x28, 0x6b, 0x65, 0x79, 0x2e, 0x61, 0x64, 0x64, 0x72, 0x20, 0x2b,
+  0x20, 0x31, 0x32, 0x2c, 0x20, 0x26, 0x69, 0x70, 0x34, 0x2d, 0x3e, 0x73,
+  0x61, 0x64, 0x64, 0x72, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66,
+  0x28, 0x69, 0x70, 0x34, 0x2d, 0x3e, 0x73, 0x61, 0x64, 0x64, 0x72, 0x29,
+  0x29, 0x3b, 0x00, 0x09, 0x09, 0x5f, 0x5f, 0x62, 0x75, 0x69, 0x6c, 0x74,
+  0x69, 0x6e, 0x5f, 0x6d, 0x65, 0x6d, 0x63, 0x70, 0x79, 0x28, 0x6b, 0x65,
+  0x79, 0x2e, 0x61, 0x64, 0x64, 0x72, 0x2c, 0x20, 0x26, 0x69, 0x70, 0x36,
+  0x2d, 0x3e, 0x73, 0x61, 0x64, 0x64, 0x72, 0x2c, 0x20, 0x73, 0x69, 0x7a,
+  0x65, 0x6f, 0x66, 0x28, 0x69, 0x70, 0x36, 0x2d, 0x3e, 0x73, 0x61, 0x64,
+  0x64, 0x72, 0x29, 0x29, 0x3b, 0x00, 0x09, 0x6b, 0x6e, 0x6f, 0x74, 0x5f,
+  0x78, 0x64, 0x70, 0x5f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x74, 0x20,
+  0x2a, 0x62, 0x6c, 0x6b, 0x20, 0x3d, 0x20, 0x62, 0x70, 0x66, 0x5f, 0x6d,
+  0x61, 0x70, 0x5f, 0x6c, 0x6f, 0x6f, 0x6b, 0x75, 0x70, 0x5f, 0x65, 0x6c,
+  0x65, 0x6d, 0x28, 0x26, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x6d, 0x61,
+  0x70, 0x2c, 0x20, 0x26, 0x6b, 0x65, 0x79, 0x29, 0x3b, 0x00, 0x09, 0x69,
+  0x66, 0x20, 0x28, 0x21, 0x62, 0x6c, 0x6b, 0x20, 0x7c, 0x7c, 0x20, 0x62,
+  0x6c, 0x6b, 0x2d, 0x3e, 0x65, 0x78, 0x70, 0x69, 0x72, 0x65, 0x20, 0x3c,
+  0x3d, 0x20, 0x62, 0x70, 0x66, 0x5f, 0x6b, 0x74, 0x69, 0x6d, 0x65, 0x5f,
+  0x67, 0x65, 0x74, 0x5f, 0x6e, 0x73, 0x28, 0x29, 0x29, 0x20, 0x7b, 0x00,
+  0x09, 0x5f, 0x5f, 0x75, 0x31, 0x36, 0x20, 0x73, 0x6c, 0x69, 0x70, 0x20,
+  0x3d, 0x20, 0x62, 0x6c, 0x6b, 0x2d, 0x3e, 0x73, 0x6c, 0x69, 0x70, 0x3b,
+  0x00, 0x09, 0x6b, 0x6e, 0x6f, 0x74, 0x5f, 0x78, 0x64, 0x70, 0x5f, 0x6b,
+  0x65, 0x72, 0x6e, 0x65, 0x6c, 0x5f, 0x73, 0x74, 0x61, 0x74, 0x73, 0x5f,
+  0x74, 0x20, 0x2a, 0x73, 0x74, 0x61, 0x74, 0x73, 0x20, 0x3d, 0x20, 0x62,
+  0x70, 0x66, 0x5f, 0x6d, 0x61, 0x70, 0x5f, 0x6c, 0x6f, 0x6f, 0x6b, 0x75,
+  0x70, 0x5f, 0x65, 0x6c, 0x65, 0x6d, 0x28, 0x26, 0x6b, 0x65, 0x72, 0x6e,
+  0x65, 0x6c, 0x5f, 0x73, 0x74, 0x61, 0x74, 0x73, 0x2c, 0x20, 0x26, 0x69,
+  0x6e, 0x64, 0x65, 0x78, 0x29, 0x3b, 0x00, 0x09, 0x69, 0x66, 0x20, 0x28,
+  0x73, 0x6c, 0x69, 0x70, 0x20, 0x3e, 0x20, 0x30, 0x20, 0x26, 0x26, 0x20,
+  0x62, 0x70, 0x66, 0x5f, 0x67, 0x65, 0x74, 0x5f, 0x70, 0x72, 0x61, 0x6e,
+  0x64, 0x6f, 0x6d, 0x5f, 0x75, 0x33, 0x32, 0x28, 0x29, 0x20, 0x25, 0x20,
+  0x73, 0x6c, 0x69, 0x70, 0x20, 0x3d, 0x3d, 0x20, 0x30, 0x20, 0x26, 0x26,
+  0x00, 0x09, 0x69, 0x66, 0x20, 0x28, 0x6c, 0x34, 0x5f, 0x6f, 0x66, 0x66,
+  0x20, 0x3e, 0x20, 0x36, 0x34, 0x29, 0x20, 0x7b, 0x00, 0x09, 0x73, 0x74,
+  0x72, 0x75, 0x63, 0x74, 0x20, 0x75, 0x64, 0x70, 0x68, 0x64, 0x72, 0x20,
+  0x2a, 0x75, 0x64, 0x70, 0x20, 0x3d, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20,
+  0x2b, 0x20, 0x6c, 0x34, 0x5f, 0x6f, 0x66, 0x66, 0x3b, 0x00, 0x09, 0x5f,
+  0x5f, 0x75, 0x38, 0x20, 0x2a, 0x64, 0x6e, 0x73, 0x20, 0x3d, 0x20, 0x28,
+  0x76, 0x6f, 0x69, 0x64, 0x20, 0x2a, 0x29, 0x28, 0x75, 0x64, 0x70, 0x20,
+  0x2b, 0x20, 0x31, 0x29, 0x3b, 0x00, 0x09, 0x69, 0x66, 0x20, 0x28, 0x28,
+  0x76, 0x6f, 0x69, 0x64, 0x20, 0x2a, 0x29, 0x64, 0x6e, 0x73, 0x20, 0x3e,
+  0x20, 0x64, 0x61, 0x74, 0x61, 0x5f, 0x65, 0x6e, 0x64, 0x29, 0x20, 0x7b,
+  0x00, 0x09, 0x69, 0x66, 0x20, 0x28, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x20,
+  0x2a, 0x29, 0x64, 0x6e, 0x73, 0x20, 0x2b, 0x20, 0x44, 0x4e, 0x53, 0x5f,
+  0x48, 0x44, 0x52, 0x5f, 0x4c, 0x45, 0x4e, 0x20, 0x3e, 0x20, 0x64, 0x61,
+  0x74, 0x61, 0x5f, 0x65, 0x6e, 0x64, 0x29, 0x20, 0x7b, 0x00, 0x09, 0x69,
+  0x66, 0x20, 0x28, 0x28, 0x64, 0x6e, 0x73, 0x5b, 0x32, 0x5d, 0x20, 0x26,
+  0x20, 0x30, 0x78, 0x66, 0x38, 0x29, 0x20, 0x21, 0x3d, 0x20, 0x30, 0x20,
+  0x7c, 0x7c, 0x20, 0x2f, 0x2a, 0x20, 0x51, 0x52, 0x20, 0x61, 0x6e, 0x64,
+  0x20, 0x4f, 0x50, 0x43, 0x4f, 0x44, 0x45, 0x20, 0x2a, 0x2f, 0x00, 0x09,
+  0x5f, 0x5f, 0x62, 0x75, 0x69, 0x6c, 0x74, 0x69, 0x6e, 0x5f, 0x6d, 0x65,
+  0x6d, 0x63, 0x70, 0x79, 0x28, 0x26, 0x76, 0x61, 0x6c, 0x2c, 0x20, 0x70,
+  0x74, 0x72, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x76,
+  0x61, 0x6c, 0x29, 0x29, 0x3b, 0x00, 0x09, 0x20, 0x20, 0x20, 0x20, 0x6c,
+  0x6f, 0x61, 0x64, 0x31, 0x36, 0x28, 0x64, 0x6e, 0x73, 0x20, 0x2b, 0x20,
+  0x34, 0x29, 0x20, 0x21, 0x3d, 0x20, 0x5f, 0x5f, 0x63, 0x6f, 0x6e, 0x73,
+  0x74, 0x61, 0x6e, 0x74, 0x5f, 0x68, 0x74, 0x6f, 0x6e, 0x73, 0x28, 0x31,
+  0x29, 0x20, 0x7c, 0x7c, 0x00, 0x09, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f,
+  0x61, 0x64, 0x31, 0x36, 0x28, 0x64, 0x6e, 0x73, 0x20, 0x2b, 0x20, 0x36,
+  0x29, 0x20, 0x21, 0x3d, 0x20, 0x30, 0x20, 0x7c, 0x7c, 0x20, 0x6c, 0x6f,
+  0x61, 0x64, 0x31, 0x36, 0x28, 0x64, 0x6e, 0x73, 0x20, 0x2b, 0x20, 0x38,
+  0x29, 0x20, 0x21, 0x3d, 0x20, 0x30, 0x20, 0x7c, 0x7c, 0x00, 0x09, 0x09,
+  0x69, 0x66, 0x20, 0x28, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x2a, 0x29,
+  0x70, 0x6f, 0x73, 0x20, 0x2b, 0x20, 0x31, 0x20, 0x3e, 0x20, 0x64, 0x61,
+  0x74, 0x61, 0x5f, 0x65, 0x6e, 0x64, 0x29, 0x20, 0x7b, 0x00, 0x09, 0x09,
+  0x69, 0x66, 0x20, 0x28, 0x69, 0x20, 0x3d, 0x3d, 0x20, 0x6c, 0x61, 0x62,
+  0x65, 0x6c, 0x29, 0x20, 0x7b, 0x00, 0x09, 0x09, 0x09, 0x69, 0x66, 0x20,
+  0x28, 0x63, 0x20, 0x3d, 0x3d, 0x20, 0x30, 0x29, 0x20, 0x7b, 0x00, 0x09,
+  0x09, 0x09, 0x7d, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x69, 0x66, 0x20,
+  0x28, 0x63, 0x20, 0x26, 0x20, 0x30, 0x78, 0x63, 0x30, 0x29, 0x20, 0x7b,
+  0x00, 0x09, 0x09, 0x7d, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x69, 0x66,
+  0x20, 0x28, 0x63, 0x20, 0x3e, 0x3d, 0x20, 0x27, 0x41, 0x27, 0x20, 0x26,
+  0x26, 0x20, 0x63, 0x20, 0x3c, 0x3d, 0x20, 0x27, 0x5a, 0x27, 0x29, 0x20,
+  0x7b, 0x00, 0x09, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x5f, 0x5f, 0x75, 0x33,
+  0x32, 0x20, 0x69, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x20, 0x69, 0x20, 0x3c,
+  0x20, 0x4b, 0x4e, 0x4f, 0x54, 0x5f, 0x58, 0x44, 0x50, 0x5f, 0x41, 0x4e,
+  0x53, 0x57, 0x45, 0x52, 0x5f, 0x51, 0x4e, 0x41, 0x4d, 0x45, 0x5f, 0x4d,
+  0x41, 0x58, 0x3b, 0x20, 0x69, 0x2b, 0x2b, 0x29, 0x20, 0x7b, 0x00, 0x09,
+  0x69, 0x66, 0x20, 0x28, 0x73, 0x74, 0x61, 0x74, 0x73, 0x29, 0x20, 0x7b,
+  0x00, 0x09, 0x69, 0x66, 0x20, 0x28, 0x28, 0x6f, 0x70, 0x74, 0x73, 0x2e,
+  0x66, 0x6c, 0x61, 0x67, 0x73, 0x20, 0x26, 0x20, 0x4b, 0x4e, 0x4f, 0x54,
+  0x5f, 0x58, 0x44, 0x50, 0x5f, 0x46, 0x49, 0x4c, 0x54, 0x45, 0x52, 0x5f,
+  0x41, 0x4e, 0x53, 0x57, 0x45, 0x52, 0x29, 0x20, 0x26, 0x26, 0x20, 0x66,
+  0x61, 0x73, 0x74, 0x5f, 0x70, 0x61, 0x74, 0x68, 0x29, 0x20, 0x7b, 0x00,
+  0x09, 0x5f, 0x5f, 0x62, 0x75, 0x69, 0x6c, 0x74, 0x69, 0x6e, 0x5f, 0x6d,
+  0x65, 0x6d, 0x73, 0x65, 0x74, 0x28, 0x6b, 0x65, 0x79, 0x2c, 0x20, 0x30,
+  0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x2a, 0x6b, 0x65,
+  0x79, 0x29, 0x29, 0x3b, 0x00, 0x09, 0x09, 0x5f, 0x5f, 0x75, 0x38, 0x20,
+  0x63, 0x20, 0x3d, 0x20, 0x2a, 0x70, 0x6f, 0x73, 0x3b, 0x00, 0x09, 0x09,
+  0x6b, 0x65, 0x79, 0x2d, 0x3e, 0x71, 0x6e, 0x61, 0x6d, 0x65, 0x5b, 0x69,
+  0x5d, 0x20, 0x3d, 0x20, 0x63, 0x3b, 0x00, 0x09, 0x09, 0x09, 0x63, 0x20,
+  0x7c, 0x3d, 0x20, 0x30, 0x78, 0x32, 0x30, 0x3b, 0x00, 0x09, 0x69, 0x66,
+  0x20, 0x28, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x2a, 0x29, 0x71, 0x74,
+  0x79, 0x70, 0x65, 0x20, 0x2b, 0x20, 0x32, 0x20, 0x2a, 0x20, 0x73, 0x69,
+  0x7a, 0x65, 0x6f, 0x66, 0x28, 0x5f, 0x5f, 0x75, 0x31, 0x36, 0x29, 0x20,
+  0x3e, 0x20, 0x64, 0x61, 0x74, 0x61, 0x5f, 0x65, 0x6e, 0x64, 0x20, 0x7c,
+  0x7c, 0x00, 0x09, 0x6b, 0x65, 0x79, 0x2d, 0x3e, 0x71, 0x74, 0x79, 0x70,
+  0x65, 0x20, 0x3d, 0x20, 0x6c, 0x6f, 0x61, 0x64, 0x31, 0x36, 0x28, 0x71,
+  0x74, 0x79, 0x70, 0x65, 0x29, 0x3b, 0x00, 0x09, 0x69, 0x66, 0x20, 0x28,
+  0x71, 0x5f, 0x65, 0x6e, 0x64, 0x20, 0x3d, 0x3d, 0x20, 0x30, 0x20, 0x7c,
+  0x7c, 0x20, 0x71, 0x5f, 0x65, 0x6e, 0x64, 0x20, 0x3e, 0x20, 0x44, 0x4e,
+  0x53, 0x5f, 0x48, 0x44, 0x52, 0x5f, 0x4c, 0x45, 0x4e, 0x20, 0x2b, 0x20,
+  0x4b, 0x4e, 0x4f, 0x54, 0x5f, 0x58, 0x44, 0x50, 0x5f, 0x41, 0x4e, 0x53,
+  0x57, 0x45, 0x52, 0x5f, 0x51, 0x4e, 0x41, 0x4d, 0x45, 0x5f, 0x4d, 0x41,
+  0x58, 0x20, 0x2b, 0x20, 0x32, 0x20, 0x2a, 0x20, 0x73, 0x69, 0x7a, 0x65,
+  0x6f, 0x66, 0x28, 0x5f, 0x5f, 0x75, 0x31, 0x36, 0x29, 0x29, 0x20, 0x7b,
+  0x00, 0x09, 0x69, 0x66, 0x20, 0x28, 0x61, 0x72, 0x63, 0x6f, 0x75, 0x6e,
+  0x74, 0x20, 0x21, 0x3d, 0x20, 0x30, 0x29, 0x20, 0x7b, 0x00, 0x09, 0x09,
+  0x69, 0x66, 0x20, 0x28, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x2a, 0x29,
+  0x6f, 0x70, 0x74, 0x20, 0x2b, 0x20, 0x4b, 0x4e, 0x4f, 0x54, 0x5f, 0x58,
+  0x44, 0x50, 0x5f, 0x41, 0x4e, 0x53, 0x57, 0x45, 0x52, 0x5f, 0x4f, 0x50,
+  0x54, 0x5f, 0x4c, 0x45, 0x4e, 0x20, 0x3e, 0x20, 0x64, 0x61, 0x74, 0x61,
+  0x5f, 0x65, 0x6e, 0x64, 0x29, 0x20, 0x7b, 0x00, 0x09, 0x09, 0x69, 0x66,
+  0x20, 0x28, 0x6f, 0x70, 0x74, 0x5b, 0x30, 0x5d, 0x20, 0x21, 0x3d, 0x20,
+  0x30, 0x20, 0x7c, 0x7c, 0x20, 0x6c, 0x6f, 0x61, 0x64, 0x31, 0x36, 0x28,
+  0x6f, 0x70, 0x74, 0x20, 0x2b, 0x20, 0x31, 0x29, 0x20, 0x21, 0x3d, 0x20,
+  0x5f, 0x5f, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x5f, 0x68,
+  0x74, 0x6f, 0x6e, 0x73, 0x28, 0x44, 0x4e, 0x53, 0x5f, 0x54, 0x59, 0x50,
+  0x45, 0x5f, 0x4f, 0x50, 0x54, 0x29, 0x20, 0x7c, 0x7c, 0x00, 0x09, 0x09,
+  0x20, 0x20, 0x20, 0x20, 0x6f, 0x70, 0x74, 0x5b, 0x35, 0x5d, 0x20, 0x21,
+  0x3d, 0x20, 0x30, 0x20, 0x7c, 0x7c, 0x20, 0x6f, 0x70, 0x74, 0x5b, 0x36,
+  0x5d, 0x20, 0x21, 0x3d, 0x20, 0x30, 0x20, 0x7c, 0x7c, 0x20, 0x28, 0x6f,
+  0x70, 0x74, 0x5b, 0x37, 0x5d, 0x20, 0x26, 0x20, 0x30, 0x78, 0x38, 0x30,
+  0x29, 0x20, 0x7c, 0x7c, 0x00, 0x09, 0x09, 0x5f, 0x5f, 0x75, 0x33, 0x32,
+  0x20, 0x73, 0x75, 0x6d, 0x20, 0x3d, 0x20, 0x6c, 0x6f, 0x61, 0x64, 0x31,
+  0x36, 0x28, 0x6f, 0x70, 0x74, 0x29, 0x20, 0x2b, 0x20, 0x6c, 0x6f, 0x61,
+  0x64, 0x31, 0x36, 0x28, 0x6f, 0x70, 0x74, 0x20, 0x2b, 0x20, 0x32, 0x29,
+  0x20, 0x2b, 0x20, 0x6c, 0x6f, 0x61, 0x64, 0x31, 0x36, 0x28, 0x6f, 0x70,
+  0x74, 0x20, 0x2b, 0x20, 0x34, 0x29, 0x20, 0x2b, 0x00, 0x09, 0x09, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c,
+  0x6f, 0x61, 0x64, 0x31, 0x36, 0x28, 0x6f, 0x70, 0x74, 0x20, 0x2b, 0x20,
+  0x36, 0x29, 0x20, 0x2b, 0x20, 0x6c, 0x6f, 0x61, 0x64, 0x31, 0x36, 0x28,
+  0x6f, 0x70, 0x74, 0x20, 0x2b, 0x20, 0x38, 0x29, 0x20, 0x2b, 0x20, 0x6c,
+  0x6f, 0x61, 0x64, 0x31, 0x36, 0x28, 0x6c, 0x61, 0x73, 0x74, 0x29, 0x3b,
+  0x00, 0x09, 0x73, 0x75, 0x6d, 0x20, 0x3d, 0x20, 0x28, 0x73, 0x75, 0x6d,
+  0x20, 0x26, 0x20, 0x30, 0x78, 0x66, 0x66, 0x66, 0x66, 0x29, 0x20, 0x2b,
+  0x20, 0x28, 0x73, 0x75, 0x6d, 0x20, 0x3e, 0x3e, 0x20, 0x31, 0x36, 0x29,
+  0x3b, 0x00, 0x09, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x28, 0x73,
+  0x75, 0x6d, 0x20, 0x26, 0x20, 0x30, 0x78, 0x66, 0x66, 0x66, 0x66, 0x29,
+  0x20, 0x2b, 0x20, 0x28, 0x73, 0x75, 0x6d, 0x20, 0x3e, 0x3e, 0x20, 0x31,
+  0x36, 0x29, 0x3b, 0x00, 0x09, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20,
+  0x28, 0x6f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x20, 0x26, 0x20, 0x31, 0x29,
+  0x20, 0x3f, 0x20, 0x28, 0x5f, 0x5f, 0x75, 0x31, 0x36, 0x29, 0x28, 0x28,
+  0x73, 0x75, 0x6d, 0x20, 0x3c, 0x3c, 0x20, 0x38, 0x29, 0x20, 0x7c, 0x20,
+  0x28, 0x73, 0x75, 0x6d, 0x20, 0x3e, 0x3e, 0x20, 0x38, 0x29, 0x29, 0x20,
+  0x3a, 0x20, 0x73, 0x75, 0x6d, 0x3b, 0x00, 0x09, 0x69, 0x66, 0x20, 0x28,
+  0x5f, 0x5f, 0x62, 0x70, 0x66, 0x5f, 0x6e, 0x74, 0x6f, 0x68, 0x73, 0x28,
+  0x75, 0x64, 0x70, 0x2d, 0x3e, 0x6c, 0x65, 0x6e, 0x29, 0x20, 0x21, 0x3d,
+  0x20, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x2a, 0x75, 0x64, 0x70,
+  0x29, 0x20, 0x2b, 0x20, 0x71, 0x5f, 0x65, 0x6e, 0x64, 0x20, 0x2b, 0x20,
+  0x6f, 0x70, 0x74, 0x5f, 0x6c, 0x65, 0x6e, 0x29, 0x20, 0x7b, 0x00, 0x09,
+  0x5f, 0x5f, 0x75, 0x31, 0x36, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x20,
+  0x3d, 0x20, 0x75, 0x64, 0x70, 0x2d, 0x3e, 0x63, 0x68, 0x65, 0x63, 0x6b,
+  0x3b, 0x00, 0x09, 0x69, 0x66, 0x20, 0x28, 0x21, 0x69, 0x70, 0x76, 0x34,
+  0x20, 0x26, 0x26, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x20, 0x3d, 0x3d,
+  0x20, 0x30, 0x29, 0x20, 0x7b, 0x00, 0x09, 0x6b, 0x6e, 0x6f, 0x74, 0x5f,
+  0x78, 0x64, 0x70, 0x5f, 0x61, 0x6e, 0x73, 0x77, 0x65, 0x72, 0x5f, 0x74,
+  0x20, 0x2a, 0x61, 0x6e, 0x73, 0x20, 0x3d, 0x20, 0x62, 0x70, 0x66, 0x5f,
+  0x6d, 0x61, 0x70, 0x5f, 0x6c, 0x6f, 0x6f, 0x6b, 0x75, 0x70, 0x5f, 0x65,
+  0x6c, 0x65, 0x6d, 0x28, 0x26, 0x61, 0x6e, 0x73, 0x77, 0x65, 0x72, 0x5f,
+  0x6d, 0x61, 0x70, 0x2c, 0x20, 0x26, 0x6b, 0x65, 0x79, 0x29, 0x3b, 0x00,
+  0x09, 0x69, 0x66, 0x20, 0x28, 0x21, 0x61, 0x6e, 0x73, 0x29, 0x20, 0x7b,
+  0x00, 0x09, 0x09, 0x69, 0x66, 0x20, 0x28, 0x73, 0x74, 0x61, 0x74, 0x73,
+  0x29, 0x20, 0x7b, 0x00, 0x09, 0x09, 0x09, 0x5f, 0x5f, 0x73, 0x79, 0x6e,
+  0x63, 0x5f, 0x66, 0x65, 0x74, 0x63, 0x68, 0x5f, 0x61, 0x6e, 0x64, 0x5f,
+  0x61, 0x64, 0x64, 0x28, 0x26, 0x73, 0x74, 0x61, 0x74, 0x73, 0x2d, 0x3e,
+  0x6d, 0x69, 0x73, 0x73, 0x65, 0x64, 0x2c, 0x20, 0x31, 0x29, 0x3b, 0x00,
+  0x09, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x62, 0x70, 0x66, 0x5f,
+  0x72, 0x65, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x5f, 0x6d, 0x61, 0x70,
+  0x28, 0x26, 0x78, 0x73, 0x6b, 0x73, 0x5f, 0x6d, 0x61, 0x70, 0x2c, 0x20,
+  0x63, 0x74, 0x78, 0x2d, 0x3e, 0x72, 0x78, 0x5f, 0x71, 0x75, 0x65, 0x75,
+  0x65, 0x5f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2c, 0x20, 0x30, 0x29, 0x3b,
+  0x00, 0x7d, 0x00, 0x09, 0x69, 0x66, 0x20, 0x28, 0x62, 0x70, 0x66, 0x5f,
+  0x78, 0x64, 0x70, 0x5f, 0x61, 0x64, 0x6a, 0x75, 0x73, 0x74, 0x5f, 0x74,
+  0x61, 0x69, 0x6c, 0x28, 0x63, 0x74, 0x78, 0x2c, 0x20, 0x64, 0x65, 0x6c,
+  0x74, 0x61, 0x29, 0x20, 0x21, 0x3d, 0x20, 0x30, 0x29, 0x20, 0x7b, 0x00,
+  0x09, 0x5f, 0x5f, 0x62, 0x75, 0x69, 0x6c, 0x74, 0x69, 0x6e, 0x5f, 0x6d,
+  0x65, 0x6d, 0x63, 0x70, 0x79, 0x28, 0x6d, 0x61, 0x63, 0x2c, 0x20, 0x65,
+  0x74, 0x68, 0x5f, 0x68, 0x64, 0x72, 0x2d, 0x3e, 0x68, 0x5f, 0x64, 0x65,
+  0x73, 0x74, 0x2c, 0x20, 0x45, 0x54, 0x48, 0x5f, 0x41, 0x4c, 0x45, 0x4e,
+  0x29, 0x3b, 0x00, 0x09, 0x5f, 0x5f, 0x62, 0x75, 0x69, 0x6c, 0x74, 0x69,
+  0x6e, 0x5f, 0x6d, 0x65, 0x6d, 0x63, 0x70, 0x79, 0x28, 0x65, 0x74, 0x68,
+  0x5f, 0x68, 0x64, 0x72, 0x2d, 0x3e, 0x68, 0x5f, 0x64, 0x65, 0x73, 0x74,
+  0x2c, 0x20, 0x65, 0x74, 0x68, 0x5f, 0x68, 0x64, 0x72, 0x2d, 0x3e, 0x68,
+  0x5f, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x2c, 0x20, 0x45, 0x54, 0x48,
+  0x5f, 0x41, 0x4c, 0x45, 0x4e, 0x29, 0x3b, 0x00, 0x09, 0x5f, 0x5f, 0x62,
+  0x75, 0x69, 0x6c, 0x74, 0x69, 0x6e, 0x5f, 0x6d, 0x65, 0x6d, 0x63, 0x70,
+  0x79, 0x28, 0x65, 0x74, 0x68, 0x5f, 0x68, 0x64, 0x72, 0x2d, 0x3e, 0x68,
+  0x5f, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x2c, 0x20, 0x6d, 0x61, 0x63,
+  0x2c, 0x20, 0x45, 0x54, 0x48, 0x5f, 0x41, 0x4c, 0x45, 0x4e, 0x29, 0x3b,
+  0x00, 0x09, 0x09, 0x5f, 0x5f, 0x62, 0x65, 0x33, 0x32, 0x20, 0x61, 0x64,
+  0x64, 0x72, 0x20, 0x3d, 0x20, 0x69, 0x70, 0x34, 0x2d, 0x3e, 0x73, 0x61,
+  0x64, 0x64, 0x72, 0x3b, 0x00, 0x09, 0x09, 0x09, 0x73, 0x75, 0x6d, 0x20,
+  0x2b, 0x3d, 0x20, 0x6c, 0x6f, 0x61, 0x64, 0x31, 0x36, 0x28, 0x77, 0x6f,
+  0x72, 0x64, 0x20, 0x2b, 0x20, 0x69, 0x29, 0x3b, 0x00, 0x09, 0x09, 0x69,
+  0x70, 0x34, 0x2d, 0x3e, 0x74, 0x6f, 0x74, 0x5f, 0x6c, 0x65, 0x6e, 0x20,
+  0x3d, 0x20, 0x5f, 0x5f, 0x62, 0x70, 0x66, 0x5f, 0x68, 0x74, 0x6f, 0x6e,
+  0x73, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x2a, 0x69, 0x70,
+  0x34, 0x29, 0x20, 0x2b, 0x20, 0x75, 0x64, 0x70, 0x5f, 0x6c, 0x65, 0x6e,
+  0x29, 0x3b, 0x00, 0x09, 0x09, 0x69, 0x70, 0x34, 0x2d, 0x3e, 0x73, 0x61,
+  0x64, 0x64, 0x72, 0x20, 0x3d, 0x20, 0x69, 0x70, 0x34, 0x2d, 0x3e, 0x64,
+  0x61, 0x64, 0x64, 0x72, 0x3b, 0x00, 0x09, 0x09, 0x69, 0x70, 0x34, 0x2d,
+  0x3e, 0x74, 0x74, 0x6c, 0x20, 0x3d, 0x20, 0x44, 0x4e, 0x53, 0x5f, 0x44,
+  0x45, 0x46, 0x5f, 0x54, 0x54, 0x4c, 0x3b, 0x00, 0x09, 0x09, 0x69, 0x70,
+  0x34, 0x2d, 0x3e, 0x64, 0x61, 0x64, 0x64, 0x72, 0x20, 0x3d, 0x20, 0x61,
+  0x64, 0x64, 0x72, 0x3b, 0x00, 0x09, 0x09, 0x69, 0x70, 0x34, 0x2d, 0x3e,
+  0x63, 0x68, 0x65, 0x63, 0x6b, 0x20, 0x3d, 0x20, 0x7e, 0x63, 0x73, 0x75,
+  0x6d, 0x5f, 0x66, 0x6f, 0x6c, 0x64, 0x28, 0x73, 0x75, 0x6d, 0x29, 0x3b,
+  0x00, 0x09, 0x69, 0x66, 0x20, 0x28, 0x6c, 0x65, 0x6e, 0x20, 0x3c, 0x20,
+  0x4b, 0x4e, 0x4f, 0x54, 0x5f, 0x58, 0x44, 0x50, 0x5f, 0x41, 0x4e, 0x53,
+  0x57, 0x45, 0x52, 0x5f, 0x4f, 0x50, 0x54, 0x5f, 0x4c, 0x45, 0x4e, 0x20,
+  0x7c, 0x7c, 0x20, 0x6c, 0x65, 0x6e, 0x20, 0x3e, 0x20, 0x4b, 0x4e, 0x4f,
+  0x54, 0x5f, 0x58, 0x44, 0x50, 0x5f, 0x41, 0x4e, 0x53, 0x57, 0x45, 0x52,
+  0x5f, 0x44, 0x41, 0x54, 0x41, 0x5f, 0x4d, 0x41, 0x58, 0x29, 0x20, 0x7b,
+  0x00, 0x09, 0x5f, 0x5f, 0x75, 0x31, 0x36, 0x20, 0x6f, 0x6c, 0x64, 0x5f,
+  0x75, 0x64, 0x70, 0x5f, 0x6c, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x75, 0x64,
+  0x70, 0x2d, 0x3e, 0x6c, 0x65, 0x6e, 0x3b, 0x00, 0x09, 0x09, 0x73, 0x74,
+  0x72, 0x75, 0x63, 0x74, 0x20, 0x69, 0x6e, 0x36, 0x5f, 0x61, 0x64, 0x64,
+  0x72, 0x20, 0x61, 0x64, 0x64, 0x72, 0x20, 0x3d, 0x20, 0x69, 0x70, 0x36,
+  0x2d, 0x3e, 0x73, 0x61, 0x64, 0x64, 0x72, 0x3b, 0x00, 0x09, 0x09, 0x69,
+  0x70, 0x36, 0x2d, 0x3e, 0x73, 0x61, 0x64, 0x64, 0x72, 0x20, 0x3d, 0x20,
+  0x69, 0x70, 0x36, 0x2d, 0x3e, 0x64, 0x61, 0x64, 0x64, 0x72, 0x3b, 0x00,
+  0x09, 0x09, 0x69, 0x70, 0x36, 0x2d, 0x3e, 0x64, 0x61, 0x64, 0x64, 0x72,
+  0x20, 0x3d, 0x20, 0x61, 0x64, 0x64, 0x72, 0x3b, 0x00, 0x09, 0x09, 0x69,
+  0x70, 0x36, 0x2d, 0x3e, 0x68, 0x6f, 0x70, 0x5f, 0x6c, 0x69, 0x6d, 0x69,
+  0x74, 0x20, 0x3d, 0x20, 0x44, 0x4e, 0x53, 0x5f, 0x44, 0x45, 0x46, 0x5f,
+  0x54, 0x54, 0x4c, 0x3b, 0x00, 0x09, 0x09, 0x69, 0x70, 0x36, 0x2d, 0x3e,
+  0x70, 0x61, 0x79, 0x6c, 0x6f, 0x61, 0x64, 0x5f, 0x6c, 0x65, 0x6e, 0x20,
+  0x3d, 0x20, 0x5f, 0x5f, 0x62, 0x70, 0x66, 0x5f, 0x68, 0x74, 0x6f, 0x6e,
+  0x73, 0x28, 0x75, 0x64, 0x70, 0x5f, 0x6c, 0x65, 0x6e, 0x29, 0x3b, 0x00,
+  0x09, 0x69, 0x66, 0x20, 0x28, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x2a,
+  0x29, 0x75, 0x64, 0x70, 0x20, 0x2b, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x6f,
+  0x66, 0x28, 0x2a, 0x75, 0x64, 0x70, 0x29, 0x20, 0x3e, 0x20, 0x64, 0x61,
+  0x74, 0x61, 0x5f, 0x65, 0x6e, 0x64, 0x29, 0x20, 0x7b, 0x00, 0x09, 0x75,
+  0x64, 0x70, 0x2d, 0x3e, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x20, 0x3d,
+  0x20, 0x75, 0x64, 0x70, 0x2d, 0x3e, 0x64, 0x65, 0x73, 0x74, 0x3b, 0x00,
+  0x09, 0x5f, 0x5f, 0x62, 0x65, 0x31, 0x36, 0x20, 0x70, 0x6f, 0x72, 0x74,
+  0x20, 0x3d, 0x20, 0x75, 0x64, 0x70, 0x2d, 0x3e, 0x73, 0x6f, 0x75, 0x72,
+  0x63, 0x65, 0x3b, 0x00, 0x09, 0x75, 0x64, 0x70, 0x2d, 0x3e, 0x64, 0x65,
+  0x73, 0x74, 0x20, 0x3d, 0x20, 0x70, 0x6f, 0x72, 0x74, 0x3b, 0x00, 0x09,
+  0x75, 0x64, 0x70, 0x2d, 0x3e, 0x6c, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x5f,
+  0x5f, 0x62, 0x70, 0x66, 0x5f, 0x68, 0x74, 0x6f, 0x6e, 0x73, 0x28, 0x75,
+  0x64, 0x70, 0x5f, 0x6c, 0x65, 0x6e, 0x29, 0x3b, 0x00, 0x09, 0x64, 0x61,
+  0x74, 0x61, 0x20, 0x3d, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x2a,
+  0x29, 0x28, 0x6c, 0x6f, 0x6e, 0x67, 0x29, 0x63, 0x74, 0x78, 0x2d, 0x3e,
+  0x64, 0x61, 0x74, 0x61, 0x3b, 0x00, 0x09, 0x75, 0x64, 0x70, 0x20, 0x3d,
+  0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x2b, 0x20, 0x6c, 0x34, 0x5f, 0x6f,
+  0x66, 0x66, 0x3b, 0x00, 0x09, 0x64, 0x61, 0x74, 0x61, 0x5f, 0x65, 0x6e,
+  0x64, 0x20, 0x3d, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x2a, 0x29,
+  0x28, 0x6c, 0x6f, 0x6e, 0x67, 0x29, 0x63, 0x74, 0x78, 0x2d, 0x3e, 0x64,
+  0x61, 0x74, 0x61, 0x5f, 0x65, 0x6e, 0x64, 0x3b, 0x00, 0x09, 0x5f, 0x5f,
+  0x62, 0x75, 0x69, 0x6c, 0x74, 0x69, 0x6e, 0x5f, 0x6d, 0x65, 0x6d, 0x63,
+  0x70, 0x79, 0x28, 0x70, 0x74, 0x72, 0x2c, 0x20, 0x26, 0x76, 0x61, 0x6c,
+  0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x76, 0x61, 0x6c,
+  0x29, 0x29, 0x3b, 0x00, 0x09, 0x64, 0x6e, 0x73, 0x5b, 0x33, 0x5d, 0x20,
+  0x3d, 0x20, 0x30, 0x3b, 0x00, 0x09, 0x75, 0x64, 0x70, 0x2d, 0x3e, 0x63,
+  0x68, 0x65, 0x63, 0x6b, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x00, 0x09, 0x64,
+  0x6e, 0x73, 0x5b, 0x32, 0x5d, 0x20, 0x3d, 0x20, 0x30, 0x78, 0x38, 0x32,
+  0x20, 0x7c, 0x20, 0x28, 0x64, 0x6e, 0x73, 0x5b, 0x32, 0x5d, 0x20, 0x26,
+  0x20, 0x30, 0x78, 0x30, 0x31, 0x29, 0x3b, 0x00, 0x09, 0x69, 0x66, 0x20,
+  0x28, 0x21, 0x69, 0x70, 0x76, 0x34, 0x29, 0x20, 0x7b, 0x00, 0x09, 0x09,
+  0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x69, 0x70, 0x76, 0x36, 0x68,
+  0x64, 0x72, 0x20, 0x2a, 0x69, 0x70, 0x36, 0x20, 0x3d, 0x20, 0x64, 0x61,
+  0x74, 0x61, 0x20, 0x2b, 0x20, 0x6c, 0x33, 0x5f, 0x6f, 0x66, 0x66, 0x3b,
+  0x00, 0x09, 0x09, 0x5f, 0x5f, 0x75, 0x33, 0x32, 0x20, 0x73, 0x75, 0x6d,
+  0x20, 0x3d, 0x20, 0x5f, 0x5f, 0x62, 0x70, 0x66, 0x5f, 0x68, 0x74, 0x6f,
+  0x6e, 0x73, 0x28, 0x75, 0x64, 0x70, 0x5f, 0x6c, 0x65, 0x6e, 0x29, 0x20,
+  0x2b, 0x20, 0x5f, 0x5f, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74,
+  0x5f, 0x68, 0x74, 0x6f, 0x6e, 0x73, 0x28, 0x49, 0x50, 0x50, 0x52, 0x4f,
+  0x54, 0x4f, 0x5f, 0x55, 0x44, 0x50, 0x29, 0x3b, 0x00, 0x09, 0x09, 0x09,
+  0x73, 0x75, 0x6d, 0x20, 0x2b, 0x3d, 0x20, 0x6c, 0x6f, 0x61, 0x64, 0x31,
+  0x36, 0x28, 0x61, 0x64, 0x64, 0x72, 0x20, 0x2b, 0x20, 0x69, 0x29, 0x3b,
+  0x00, 0x09, 0x09, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x5f, 0x5f, 0x75, 0x33,
+  0x32, 0x20, 0x69, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x20, 0x69, 0x20, 0x3c,
+  0x20, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x2a, 0x75, 0x64, 0x70,
+  0x29, 0x20, 0x2b, 0x20, 0x44, 0x4e, 0x53, 0x5f, 0x48, 0x44, 0x52, 0x5f,
+  0x4c, 0x45, 0x4e, 0x20, 0x2b, 0x20, 0x4b, 0x4e, 0x4f, 0x54, 0x5f, 0x58,
+  0x44, 0x50, 0x5f, 0x41, 0x4e, 0x53, 0x57, 0x45, 0x52, 0x5f, 0x51, 0x4e,
+  0x41, 0x4d, 0x45, 0x5f, 0x4d, 0x41, 0x58, 0x20, 0x2b, 0x00, 0x09, 0x09,
+  0x09, 0x73, 0x75, 0x6d, 0x20, 0x2b, 0x3d, 0x20, 0x6c, 0x6f, 0x61, 0x64,
+  0x31, 0x36, 0x28, 0x77, 0x6f, 0x72, 0x64, 0x29, 0x3b, 0x00, 0x09, 0x09,
+  0x75, 0x64, 0x70, 0x2d, 0x3e, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x20, 0x3d,
+  0x20, 0x28, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x20, 0x3d, 0x3d, 0x20, 0x30,
+  0x29, 0x20, 0x3f, 0x20, 0x30, 0x78, 0x66, 0x66, 0x66, 0x66, 0x20, 0x3a,
+  0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x3b, 0x00, 0x09, 0x09, 0x09, 0x69,
+  0x66, 0x20, 0x28, 0x69, 0x20, 0x3e, 0x3d, 0x20, 0x75, 0x64, 0x70, 0x5f,
+  0x6c, 0x65, 0x6e, 0x20, 0x7c, 0x7c, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64,
+  0x20, 0x2a, 0x29, 0x70, 0x6f, 0x73, 0x20, 0x2b, 0x20, 0x69, 0x20, 0x2b,
+  0x20, 0x31, 0x20, 0x3e, 0x20, 0x64, 0x61, 0x74, 0x61, 0x5f, 0x65, 0x6e,
+  0x64, 0x29, 0x20, 0x7b, 0x00, 0x09, 0x09, 0x09, 0x5f, 0x5f, 0x75, 0x38,
+  0x20, 0x77, 0x6f, 0x72, 0x64, 0x5b, 0x32, 0x5d, 0x20, 0x3d, 0x20, 0x7b,
+  0x20, 0x70, 0x6f, 0x73, 0x5b, 0x69, 0x5d, 0x2c, 0x20, 0x30, 0x20, 0x7d,
+  0x3b, 0x00, 0x09, 0x09, 0x09, 0x69, 0x66, 0x20, 0x28, 0x69, 0x20, 0x2b,
+  0x20, 0x31, 0x20, 0x3c, 0x20, 0x75, 0x64, 0x70, 0x5f, 0x6c, 0x65, 0x6e,
+  0x29, 0x20, 0x7b, 0x00, 0x09, 0x09, 0x09, 0x09, 0x69, 0x66, 0x20, 0x28,
+  0x28, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x2a, 0x29, 0x70, 0x6f, 0x73, 0x20,
+  0x2b, 0x20, 0x69, 0x20, 0x2b, 0x20, 0x32, 0x20, 0x3e, 0x20, 0x64, 0x61,
+  0x74, 0x61, 0x5f, 0x65, 0x6e, 0x64, 0x29, 0x20, 0x7b, 0x00, 0x09, 0x09,
+  0x09, 0x09, 0x77, 0x6f, 0x72, 0x64, 0x5b, 0x31, 0x5d, 0x20, 0x3d, 0x20,
+  0x70, 0x6f, 0x73, 0x5b, 0x69, 0x20, 0x2b, 0x20, 0x31, 0x5d, 0x3b, 0x00,
+  0x09, 0x69, 0x66, 0x20, 0x28, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x2a,
+  0x29, 0x64, 0x6e, 0x73, 0x20, 0x2b, 0x20, 0x71, 0x5f, 0x65, 0x6e, 0x64,
+  0x20, 0x3e, 0x20, 0x64, 0x61, 0x74, 0x61, 0x5f, 0x65, 0x6e, 0x64, 0x29,
+  0x20, 0x7b, 0x00, 0x09, 0x64, 0x6e, 0x73, 0x5b, 0x32, 0x5d, 0x20, 0x3d,
+  0x20, 0x30, 0x78, 0x38, 0x34, 0x20, 0x7c, 0x20, 0x28, 0x64, 0x6e, 0x73,
+  0x5b, 0x32, 0x5d, 0x20, 0x26, 0x20, 0x30, 0x78, 0x30, 0x31, 0x29, 0x3b,
+  0x00, 0x09, 0x64, 0x6e, 0x73, 0x5b, 0x33, 0x5d, 0x20, 0x3d, 0x20, 0x61,
+  0x6e, 0x73, 0x2d, 0x3e, 0x72, 0x63, 0x6f, 0x64, 0x65, 0x3b, 0x00, 0x09,
+  0x73, 0x74, 0x6f, 0x72, 0x65, 0x31, 0x36, 0x28, 0x64, 0x6e, 0x73, 0x20,
+  0x2b, 0x20, 0x36, 0x2c, 0x20, 0x61, 0x6e, 0x73, 0x2d, 0x3e, 0x61, 0x6e,
+  0x63, 0x6f, 0x75, 0x6e, 0x74, 0x29, 0x3b, 0x00, 0x09, 0x73, 0x74, 0x6f,
+  0x72, 0x65, 0x31, 0x36, 0x28, 0x64, 0x6e, 0x73, 0x20, 0x2b, 0x20, 0x38,
+  0x2c, 0x20, 0x61, 0x6e, 0x73, 0x2d, 0x3e, 0x6e, 0x73, 0x63, 0x6f, 0x75,
+  0x6e, 0x74, 0x29, 0x3b, 0x00, 0x09, 0x73, 0x74, 0x6f, 0x72, 0x65, 0x31,
+  0x36, 0x28, 0x64, 0x6e, 0x73, 0x20, 0x2b, 0x20, 0x31, 0x30, 0x2c, 0x20,
+  0x6f, 0x70, 0x74, 0x5f, 0x6c, 0x65, 0x6e, 0x20, 0x3e, 0x20, 0x30, 0x20,
+  0x3f, 0x20, 0x5f, 0x5f, 0x62, 0x70, 0x66, 0x5f, 0x68, 0x74, 0x6f, 0x6e,
+  0x73, 0x28, 0x5f, 0x5f, 0x62, 0x70, 0x66, 0x5f, 0x6e, 0x74, 0x6f, 0x68,
+  0x73, 0x28, 0x61, 0x6e, 0x73, 0x2d, 0x3e, 0x61, 0x72, 0x63, 0x6f, 0x75,
+  0x6e, 0x74, 0x29, 0x20, 0x2b, 0x20, 0x31, 0x29, 0x20, 0x3a, 0x00, 0x09,
+  0x66, 0x6f, 0x72, 0x20, 0x28, 0x5f, 0x5f, 0x75, 0x33, 0x32, 0x20, 0x69,
+  0x20, 0x3d, 0x20, 0x30, 0x3b, 0x20, 0x69, 0x20, 0x3c, 0x20, 0x4b, 0x4e,
+  0x4f, 0x54, 0x5f, 0x58, 0x44, 0x50, 0x5f, 0x41, 0x4e, 0x53, 0x57, 0x45,
+  0x52, 0x5f, 0x44, 0x41, 0x54, 0x41, 0x5f, 0x4d, 0x41, 0x58, 0x3b, 0x20,
+  0x69, 0x2b, 0x2b, 0x29, 0x20, 0x7b, 0x00, 0x09, 0x09, 0x64, 0x73, 0x74,
+  0x5b, 0x69, 0x5d, 0x20, 0x3d, 0x20, 0x61, 0x6e, 0x73, 0x2d, 0x3e, 0x64,
+  0x61, 0x74, 0x61, 0x5b, 0x69, 0x5d, 0x3b, 0x00, 0x09, 0x09, 0x69, 0x66,
+  0x20, 0x28, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x2a, 0x29, 0x64, 0x73,
+  0x74, 0x20, 0x2b, 0x20, 0x69, 0x20, 0x2b, 0x20, 0x31, 0x20, 0x3e, 0x20,
+  0x64, 0x61, 0x74, 0x61, 0x5f, 0x65, 0x6e, 0x64, 0x29, 0x20, 0x7b, 0x00,
+  0x09, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x5f, 0x5f, 0x75, 0x33, 0x32, 0x20,
+  0x69, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x20, 0x69, 0x20, 0x3c, 0x20, 0x6f,
+  0x70, 0x74, 0x5f, 0x6c, 0x65, 0x6e, 0x3b, 0x20, 0x69, 0x2b, 0x2b, 0x29,
+  0x20, 0x7b, 0x00, 0x09, 0x09, 0x69, 0x66, 0x20, 0x28, 0x70, 0x6f, 0x73,
+  0x20, 0x3e, 0x3d, 0x20, 0x4b, 0x4e, 0x4f, 0x54, 0x5f, 0x58, 0x44, 0x50,
+  0x5f, 0x41, 0x4e, 0x53, 0x57, 0x45, 0x52, 0x5f, 0x44, 0x41, 0x54, 0x41,
+  0x5f, 0x4d, 0x41, 0x58, 0x20, 0x7c, 0x7c, 0x20, 0x28, 0x76, 0x6f, 0x69,
+  0x64, 0x20, 0x2a, 0x29, 0x64, 0x73, 0x74, 0x20, 0x2b, 0x20, 0x70, 0x6f,
+  0x73, 0x20, 0x2b, 0x20, 0x31, 0x20, 0x3e, 0x20, 0x64, 0x61, 0x74, 0x61,
+  0x5f, 0x65, 0x6e, 0x64, 0x29, 0x20, 0x7b, 0x00, 0x09, 0x09, 0x64, 0x73,
+  0x74, 0x5b, 0x70, 0x6f, 0x73, 0x5d, 0x20, 0x3d, 0x20, 0x61, 0x6e, 0x73,
+  0x2d, 0x3e, 0x64, 0x61, 0x74, 0x61, 0x5b, 0x70, 0x6f, 0x73, 0x5d, 0x3b,
+  0x00, 0x09, 0x69, 0x66, 0x20, 0x28, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x20,
+  0x21, 0x3d, 0x20, 0x30, 0x29, 0x20, 0x7b, 0x00, 0x09, 0x09, 0x73, 0x75,
+  0x6d, 0x20, 0x2b, 0x3d, 0x20, 0x63, 0x73, 0x75, 0x6d, 0x5f, 0x61, 0x74,
+  0x28, 0x61, 0x6e, 0x73, 0x2d, 0x3e, 0x63, 0x73, 0x75, 0x6d, 0x2c, 0x20,
+  0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x2a, 0x75, 0x64, 0x70, 0x29,
+  0x20, 0x2b, 0x20, 0x71, 0x5f, 0x65, 0x6e, 0x64, 0x29, 0x3b, 0x00, 0x09,
+  0x09, 0x5f, 0x5f, 0x75, 0x33, 0x32, 0x20, 0x73, 0x75, 0x6d, 0x20, 0x3d,
+  0x20, 0x28, 0x5f, 0x5f, 0x75, 0x31, 0x36, 0x29, 0x7e, 0x63, 0x68, 0x65,
+  0x63, 0x6b, 0x3b, 0x00, 0x09, 0x09, 0x73, 0x75, 0x6d, 0x20, 0x2b, 0x3d,
+  0x20, 0x28, 0x5f, 0x5f, 0x75, 0x31, 0x36, 0x29, 0x7e, 0x61, 0x72, 0x63,
+  0x6f, 0x75, 0x6e, 0x74, 0x20, 0x2b, 0x20, 0x6c, 0x6f, 0x61, 0x64, 0x31,
+  0x36, 0x28, 0x64, 0x6e, 0x73, 0x20, 0x2b, 0x20, 0x31, 0x30, 0x29, 0x3b,
+  0x00, 0x09, 0x09, 0x73, 0x75, 0x6d, 0x20, 0x2b, 0x3d, 0x20, 0x6c, 0x6f,
+  0x61, 0x64, 0x31, 0x36, 0x28, 0x64, 0x6e, 0x73, 0x20, 0x2b, 0x20, 0x36,
+  0x29, 0x20, 0x2b, 0x20, 0x6c, 0x6f, 0x61, 0x64, 0x31, 0x36, 0x28, 0x64,
+  0x6e, 0x73, 0x20, 0x2b, 0x20, 0x38, 0x29, 0x3b, 0x00, 0x09, 0x09, 0x73,
+  0x75, 0x6d, 0x20, 0x2b, 0x3d, 0x20, 0x28, 0x5f, 0x5f, 0x75, 0x31, 0x36,
+  0x29, 0x7e, 0x6f, 0x6c, 0x64, 0x5f, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x20,
+  0x2b, 0x20, 0x6c, 0x6f, 0x61, 0x64, 0x31, 0x36, 0x28, 0x64, 0x6e, 0x73,
+  0x20, 0x2b, 0x20, 0x32, 0x29, 0x3b, 0x00, 0x09, 0x09, 0x73, 0x75, 0x6d,
+  0x20, 0x2b, 0x3d, 0x20, 0x32, 0x20, 0x2a, 0x20, 0x28, 0x5f, 0x5f, 0x75,
+  0x33, 0x32, 0x29, 0x28, 0x5f, 0x5f, 0x75, 0x31, 0x36, 0x29, 0x7e, 0x6f,
+  0x6c, 0x64, 0x5f, 0x75, 0x64, 0x70, 0x5f, 0x6c, 0x65, 0x6e, 0x20, 0x2b,
+  0x20, 0x32, 0x20, 0x2a, 0x20, 0x28, 0x5f, 0x5f, 0x75, 0x33, 0x32, 0x29,
+  0x75, 0x64, 0x70, 0x2d, 0x3e, 0x6c, 0x65, 0x6e, 0x3b, 0x00, 0x09, 0x09,
+  0x69, 0x66, 0x20, 0x28, 0x6f, 0x70, 0x74, 0x5f, 0x6c, 0x65, 0x6e, 0x20,
+  0x3e, 0x20, 0x30, 0x29, 0x20, 0x7b, 0x00, 0x09, 0x09, 0x09, 0x73, 0x75,
+  0x6d, 0x20, 0x2b, 0x3d, 0x20, 0x63, 0x73, 0x75, 0x6d, 0x5f, 0x61, 0x74,
+  0x28, 0x61, 0x6e, 0x73, 0x2d, 0x3e, 0x6f, 0x70, 0x74, 0x5f, 0x63, 0x73,
+  0x75, 0x6d, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x2a,
+  0x75, 0x64, 0x70, 0x29, 0x20, 0x2b, 0x20, 0x71, 0x5f, 0x65, 0x6e, 0x64,
+  0x20, 0x2b, 0x20, 0x72, 0x72, 0x5f, 0x6c, 0x65, 0x6e, 0x29, 0x3b, 0x00,
+  0x09, 0x09, 0x09, 0x73, 0x75, 0x6d, 0x20, 0x2b, 0x3d, 0x20, 0x28, 0x5f,
+  0x5f, 0x75, 0x31, 0x36, 0x29, 0x7e, 0x6f, 0x70, 0x74, 0x5f, 0x73, 0x75,
+  0x6d, 0x3b, 0x00, 0x09, 0x09, 0x5f, 0x5f, 0x73, 0x79, 0x6e, 0x63, 0x5f,
+  0x66, 0x65, 0x74, 0x63, 0x68, 0x5f, 0x61, 0x6e, 0x64, 0x5f, 0x61, 0x64,
+  0x64, 0x28, 0x26, 0x73, 0x74, 0x61, 0x74, 0x73, 0x2d, 0x3e, 0x61, 0x6e,
+  0x73, 0x77, 0x65, 0x72, 0x65, 0x64, 0x2c, 0x20, 0x31, 0x29, 0x3b, 0x00,
+  0x63, 0x68, 0x61, 0x72, 0x00, 0x5f, 0x6c, 0x69, 0x63, 0x65, 0x6e, 0x73,
+  0x65, 0x00, 0x2e, 0x6d, 0x61, 0x70, 0x73, 0x00, 0x2e, 0x72, 0x6f, 0x64,
+  0x61, 0x74, 0x61, 0x00, 0x6c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x00,
+  0x9f, 0xeb, 0x01, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x6c, 0x22, 0x00, 0x00,
+  0x80, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0xf6, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2e, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xf6, 0x00, 0x00, 0x00,
+  0x26, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x2c, 0x01, 0x00, 0x00, 0x00, 0x68, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x5a, 0x01, 0x00, 0x00, 0x15, 0x74, 0x08, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x5a, 0x01, 0x00, 0x00,
+  0x08, 0x74, 0x08, 0x00, 0x20, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x7e, 0x01, 0x00, 0x00, 0x23, 0x78, 0x08, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0xc8, 0x01, 0x00, 0x00,
+  0x06, 0x7c, 0x08, 0x00, 0x58, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0xda, 0x01, 0x00, 0x00, 0x08, 0x94, 0x08, 0x00, 0x78, 0x00, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0xda, 0x01, 0x00, 0x00, 0x13, 0x94, 0x08, 0x00,
+  0x90, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0xda, 0x01, 0x00, 0x00,
+  0x06, 0x94, 0x08, 0x00, 0x98, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x00, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x00, 0x08, 0xa8, 0x08, 0x00,
+  0xf8, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x49, 0x02, 0x00, 0x00,
+  0x22, 0xb4, 0x08, 0x00, 0x00, 0x01, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x70, 0x02, 0x00, 0x00, 0x32, 0xbc, 0x08, 0x00, 0x08, 0x01, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0xac, 0x02, 0x00, 0x00, 0x13, 0xc8, 0x08, 0x00,
+  0x20, 0x01, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0xac, 0x02, 0x00, 0x00,
+  0x06, 0xc8, 0x08, 0x00, 0x38, 0x01, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0xd8, 0x02, 0x00, 0x00, 0x2c, 0xb8, 0x08, 0x00, 0x40, 0x01, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x0d, 0x03, 0x00, 0x00, 0x16, 0x0c, 0x09, 0x00,
+  0x58, 0x01, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x0d, 0x03, 0x00, 0x00,
+  0x06, 0x0c, 0x09, 0x00, 0x60, 0x01, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x43, 0x03, 0x00, 0x00, 0x0f, 0x24, 0x09, 0x00, 0x88, 0x01, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x43, 0x03, 0x00, 0x00, 0x06, 0x24, 0x09, 0x00,
+  0x90, 0x01, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x7d, 0x03, 0x00, 0x00,
+  0x1c, 0x28, 0x09, 0x00, 0xa8, 0x01, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x7d, 0x03, 0x00, 0x00, 0x07, 0x28, 0x09, 0x00, 0xb8, 0x01, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0xb9, 0x03, 0x00, 0x00, 0x0e, 0x30, 0x09, 0x00,
+  0xc8, 0x01, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0xed, 0x03, 0x00, 0x00,
+  0x03, 0x3c, 0x09, 0x00, 0xf8, 0x01, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x34, 0x04, 0x00, 0x00, 0x02, 0x64, 0x09, 0x00, 0x18, 0x02, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x49, 0x04, 0x00, 0x00, 0x13, 0x70, 0x09, 0x00,
+  0x30, 0x02, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x49, 0x04, 0x00, 0x00,
+  0x07, 0x70, 0x09, 0x00, 0x38, 0x02, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x78, 0x04, 0x00, 0x00, 0x0c, 0x7c, 0x09, 0x00, 0x40, 0x02, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x78, 0x04, 0x00, 0x00, 0x14, 0x7c, 0x09, 0x00,
+  0x58, 0x02, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x78, 0x04, 0x00, 0x00,
+  0x07, 0x7c, 0x09, 0x00, 0x60, 0x02, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x93, 0x04, 0x00, 0x00, 0x10, 0x94, 0x09, 0x00, 0x70, 0x02, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x93, 0x04, 0x00, 0x00, 0x19, 0x94, 0x09, 0x00,
+  0x88, 0x02, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x93, 0x04, 0x00, 0x00,
+  0x07, 0x94, 0x09, 0x00, 0x90, 0x02, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0xc8, 0x04, 0x00, 0x00, 0x0c, 0xa4, 0x09, 0x00, 0x98, 0x02, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0xc8, 0x04, 0x00, 0x00, 0x1a, 0xa4, 0x09, 0x00,
+  0xd0, 0x02, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0xe4, 0x04, 0x00, 0x00,
+  0x1c, 0xb8, 0x09, 0x00, 0xe0, 0x02, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x04, 0x05, 0x00, 0x00, 0x13, 0xbc, 0x09, 0x00, 0xf0, 0x02, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0xe4, 0x04, 0x00, 0x00, 0x11, 0xb8, 0x09, 0x00,
+  0x00, 0x03, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x26, 0x05, 0x00, 0x00,
+  0x13, 0xb4, 0x09, 0x00, 0x10, 0x03, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x42, 0x05, 0x00, 0x00, 0x13, 0xd0, 0x09, 0x00, 0x28, 0x03, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x42, 0x05, 0x00, 0x00, 0x07, 0xd0, 0x09, 0x00,
+  0x30, 0x03, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x71, 0x05, 0x00, 0x00,
+  0x0c, 0xdc, 0x09, 0x00, 0x38, 0x03, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x71, 0x05, 0x00, 0x00, 0x14, 0xdc, 0x09, 0x00, 0x48, 0x03, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x71, 0x05, 0x00, 0x00, 0x07, 0xdc, 0x09, 0x00,
+  0x50, 0x03, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x8c, 0x05, 0x00, 0x00,
+  0x10, 0xf4, 0x09, 0x00, 0x60, 0x03, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x8c, 0x05, 0x00, 0x00, 0x19, 0xf4, 0x09, 0x00, 0x70, 0x03, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x8c, 0x05, 0x00, 0x00, 0x37, 0xf4, 0x09, 0x00,
+  0x80, 0x03, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x8c, 0x05, 0x00, 0x00,
+  0x07, 0xf4, 0x09, 0x00, 0x90, 0x03, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0xd4, 0x05, 0x00, 0x00, 0x13, 0x04, 0x0a, 0x00, 0xa0, 0x03, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0xef, 0x05, 0x00, 0x00, 0x07, 0x0c, 0x0a, 0x00,
+  0xb0, 0x03, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x15, 0x06, 0x00, 0x00,
+  0x15, 0x18, 0x0a, 0x00, 0xc8, 0x03, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x15, 0x06, 0x00, 0x00, 0x08, 0x18, 0x0a, 0x00, 0xe8, 0x03, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x47, 0x06, 0x00, 0x00, 0x15, 0x24, 0x0a, 0x00,
+  0xf8, 0x03, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x64, 0x06, 0x00, 0x00,
+  0x13, 0x34, 0x0a, 0x00, 0x10, 0x04, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x64, 0x06, 0x00, 0x00, 0x22, 0x34, 0x0a, 0x00, 0x28, 0x04, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x50, 0x04, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0xb8, 0x06, 0x00, 0x00,
+  0x02, 0x6c, 0x0a, 0x00, 0x78, 0x04, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0xcd, 0x06, 0x00, 0x00, 0x0e, 0x7c, 0x0a, 0x00, 0x90, 0x04, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0xcd, 0x06, 0x00, 0x00, 0x07, 0x7c, 0x0a, 0x00,
+  0x98, 0x04, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0xf7, 0x06, 0x00, 0x00,
+  0x13, 0x94, 0x0a, 0x00, 0xb0, 0x04, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0xf7, 0x06, 0x00, 0x00, 0x2a, 0x94, 0x0a, 0x00, 0xb8, 0x04, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xd0, 0x04, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x23, 0x07, 0x00, 0x00,
+  0x12, 0x98, 0x0a, 0x00, 0xe0, 0x04, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x23, 0x07, 0x00, 0x00, 0x23, 0x98, 0x0a, 0x00, 0xe8, 0x04, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x48, 0x07, 0x00, 0x00, 0x15, 0x9c, 0x0a, 0x00,
+  0x00, 0x05, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x48, 0x07, 0x00, 0x00,
+  0x46, 0x9c, 0x0a, 0x00, 0x38, 0x05, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x90, 0x07, 0x00, 0x00, 0x0e, 0xbc, 0x0a, 0x00, 0x50, 0x05, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x90, 0x07, 0x00, 0x00, 0x07, 0xbc, 0x0a, 0x00,
+  0x58, 0x05, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0xba, 0x07, 0x00, 0x00,
+  0x10, 0xd0, 0x0a, 0x00, 0x60, 0x05, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0xba, 0x07, 0x00, 0x00, 0x20, 0xd0, 0x0a, 0x00, 0x78, 0x05, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0xba, 0x07, 0x00, 0x00, 0x07, 0xd0, 0x0a, 0x00,
+  0x80, 0x05, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0xf2, 0x07, 0x00, 0x00,
+  0x0f, 0xe0, 0x0a, 0x00, 0x90, 0x05, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x18, 0x08, 0x00, 0x00, 0x13, 0xe8, 0x0a, 0x00, 0xa0, 0x05, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x18, 0x08, 0x00, 0x00, 0x2a, 0xe8, 0x0a, 0x00,
+  0xb0, 0x05, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x23, 0x07, 0x00, 0x00,
+  0x12, 0xec, 0x0a, 0x00, 0xc0, 0x05, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x23, 0x07, 0x00, 0x00, 0x23, 0xec, 0x0a, 0x00, 0xc8, 0x05, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x48, 0x07, 0x00, 0x00, 0x15, 0xf0, 0x0a, 0x00,
+  0xd8, 0x05, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x48, 0x07, 0x00, 0x00,
+  0x46, 0xf0, 0x0a, 0x00, 0x00, 0x06, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x44, 0x08, 0x00, 0x00, 0x1a, 0xfc, 0x0a, 0x00, 0x18, 0x06, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x44, 0x08, 0x00, 0x00, 0x32, 0xfc, 0x0a, 0x00,
+  0x28, 0x06, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x40, 0x06, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x78, 0x08, 0x00, 0x00, 0x12, 0x00, 0x0b, 0x00, 0x58, 0x06, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x78, 0x08, 0x00, 0x00, 0x24, 0x00, 0x0b, 0x00,
+  0x60, 0x06, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x48, 0x07, 0x00, 0x00,
+  0x15, 0x04, 0x0b, 0x00, 0x78, 0x06, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x48, 0x07, 0x00, 0x00, 0x46, 0x04, 0x0b, 0x00, 0xa8, 0x06, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x9e, 0x08, 0x00, 0x00, 0x18, 0x38, 0x0b, 0x00,
+  0xc0, 0x06, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x9e, 0x08, 0x00, 0x00,
+  0x0d, 0x38, 0x0b, 0x00, 0xe8, 0x06, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0xcf, 0x08, 0x00, 0x00, 0x11, 0x5c, 0x0b, 0x00, 0xf8, 0x06, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0xcf, 0x08, 0x00, 0x00, 0x06, 0x5c, 0x0b, 0x00,
+  0x10, 0x07, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0xfa, 0x08, 0x00, 0x00,
+  0x19, 0x60, 0x0b, 0x00, 0x60, 0x07, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x1a, 0x09, 0x00, 0x00, 0x07, 0x6c, 0x0b, 0x00, 0x80, 0x07, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x28, 0x09, 0x00, 0x00, 0x11, 0x70, 0x0b, 0x00,
+  0x88, 0x07, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x43, 0x09, 0x00, 0x00,
+  0x18, 0x74, 0x0b, 0x00, 0x90, 0x07, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x43, 0x09, 0x00, 0x00, 0x11, 0x74, 0x0b, 0x00, 0x98, 0x07, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x61, 0x09, 0x00, 0x00, 0x18, 0x78, 0x0b, 0x00,
+  0xa0, 0x07, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x61, 0x09, 0x00, 0x00,
+  0x11, 0x78, 0x0b, 0x00, 0xb8, 0x07, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x7f, 0x09, 0x00, 0x00, 0x0f, 0x88, 0x0b, 0x00, 0xc0, 0x07, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x99, 0x09, 0x00, 0x00, 0x16, 0x8c, 0x0b, 0x00,
+  0x10, 0x08, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0xb5, 0x09, 0x00, 0x00,
+  0x16, 0x90, 0x0b, 0x00, 0x68, 0x08, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x08, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0xd1, 0x09, 0x00, 0x00, 0x0d, 0xa4, 0x0b, 0x00,
+  0xa8, 0x08, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x1c, 0x0a, 0x00, 0x00,
+  0x03, 0xa8, 0x0b, 0x00, 0xd0, 0x08, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x2d, 0x0a, 0x00, 0x00, 0x08, 0xb4, 0x0b, 0x00, 0xd8, 0x08, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x2d, 0x0a, 0x00, 0x00, 0x15, 0xb4, 0x0b, 0x00,
+  0xe0, 0x08, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x2d, 0x0a, 0x00, 0x00,
+  0x20, 0xb4, 0x0b, 0x00, 0xe8, 0x08, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x4f, 0x0a, 0x00, 0x00, 0x08, 0xb8, 0x0b, 0x00, 0xf0, 0x08, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x4f, 0x0a, 0x00, 0x00, 0x15, 0xb8, 0x0b, 0x00,
+  0xf8, 0x08, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x4f, 0x0a, 0x00, 0x00,
+  0x20, 0xb8, 0x0b, 0x00, 0x00, 0x09, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x71, 0x0a, 0x00, 0x00, 0x08, 0xbc, 0x0b, 0x00, 0x08, 0x09, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x71, 0x0a, 0x00, 0x00, 0x15, 0xbc, 0x0b, 0x00,
+  0x10, 0x09, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x2d, 0x0a, 0x00, 0x00,
+  0x08, 0xb4, 0x0b, 0x00, 0x18, 0x09, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x93, 0x0a, 0x00, 0x00, 0x08, 0xd0, 0x0b, 0x00, 0x28, 0x09, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0xa7, 0x0a, 0x00, 0x00, 0x1e, 0xd4, 0x0b, 0x00,
+  0x30, 0x09, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0xa7, 0x0a, 0x00, 0x00,
+  0x18, 0xd4, 0x0b, 0x00, 0x40, 0x09, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0xcd, 0x0a, 0x00, 0x00, 0x04, 0xe4, 0x0b, 0x00, 0xb8, 0x09, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x09, 0x0b, 0x00, 0x00, 0x22, 0x18, 0x0c, 0x00,
+  0xc0, 0x09, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x09, 0x0b, 0x00, 0x00,
+  0x31, 0x18, 0x0c, 0x00, 0xe8, 0x09, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x5a, 0x0b, 0x00, 0x00, 0x1a, 0x20, 0x0c, 0x00, 0xf8, 0x09, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x5a, 0x0b, 0x00, 0x00, 0x27, 0x20, 0x0c, 0x00,
+  0x08, 0x0a, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x5a, 0x0b, 0x00, 0x00,
+  0x30, 0x20, 0x0c, 0x00, 0x18, 0x0a, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x8c, 0x0b, 0x00, 0x00, 0x28, 0x24, 0x0c, 0x00, 0x20, 0x0a, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x8c, 0x0b, 0x00, 0x00, 0x31, 0x24, 0x0c, 0x00,
+  0x30, 0x0a, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x8c, 0x0b, 0x00, 0x00,
+  0x58, 0x24, 0x0c, 0x00, 0x48, 0x0a, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0xe9, 0x0b, 0x00, 0x00, 0x26, 0x28, 0x0c, 0x00, 0x58, 0x0a, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0xe9, 0x0b, 0x00, 0x00, 0x2e, 0x28, 0x0c, 0x00,
+  0x68, 0x0a, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x27, 0x0c, 0x00, 0x00,
+  0x12, 0x34, 0x0c, 0x00, 0x78, 0x0a, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x27, 0x0c, 0x00, 0x00, 0x2b, 0x34, 0x0c, 0x00, 0x98, 0x0a, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0xd8, 0x02, 0x00, 0x00, 0x2c, 0xb0, 0x07, 0x00,
+  0xa0, 0x0a, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x49, 0x02, 0x00, 0x00,
+  0x22, 0xac, 0x07, 0x00, 0xb0, 0x0a, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x61, 0x0c, 0x00, 0x00, 0x17, 0xc8, 0x07, 0x00, 0xe8, 0x0a, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xf8, 0x0a, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x61, 0x0c, 0x00, 0x00,
+  0x17, 0xc8, 0x07, 0x00, 0x00, 0x0b, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0xa4, 0x0c, 0x00, 0x00, 0x06, 0xcc, 0x07, 0x00, 0x10, 0x0b, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x49, 0x04, 0x00, 0x00, 0x13, 0xd4, 0x07, 0x00,
+  0x20, 0x0b, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x49, 0x04, 0x00, 0x00,
+  0x07, 0xd4, 0x07, 0x00, 0x30, 0x0b, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0xb1, 0x0c, 0x00, 0x00, 0x10, 0xe0, 0x07, 0x00, 0x38, 0x0b, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0xf7, 0x0c, 0x00, 0x00, 0x03, 0xe4, 0x07, 0x00,
+  0x60, 0x0b, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x42, 0x05, 0x00, 0x00,
+  0x13, 0xf0, 0x07, 0x00, 0x70, 0x0b, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x42, 0x05, 0x00, 0x00, 0x07, 0xf0, 0x07, 0x00, 0x78, 0x0b, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x3b, 0x0d, 0x00, 0x00, 0x03, 0xfc, 0x07, 0x00,
+  0xc0, 0x0b, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x7a, 0x0d, 0x00, 0x00,
+  0x1a, 0x08, 0x08, 0x00, 0xe8, 0x0b, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0xba, 0x0d, 0x00, 0x00, 0x0b, 0x0c, 0x08, 0x00, 0xf0, 0x0b, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0xba, 0x0d, 0x00, 0x00, 0x13, 0x0c, 0x08, 0x00,
+  0xf8, 0x0b, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0xba, 0x0d, 0x00, 0x00,
+  0x1d, 0x0c, 0x08, 0x00, 0x08, 0x0c, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0xba, 0x0d, 0x00, 0x00, 0x06, 0x0c, 0x08, 0x00, 0x18, 0x0c, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0xec, 0x0d, 0x00, 0x00, 0x14, 0x18, 0x08, 0x00,
+  0x20, 0x0c, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x5a, 0x01, 0x00, 0x00,
+  0x15, 0x20, 0x08, 0x00, 0x28, 0x0c, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x5a, 0x01, 0x00, 0x00, 0x08, 0x20, 0x08, 0x00, 0x38, 0x0c, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0xec, 0x0d, 0x00, 0x00, 0x14, 0x18, 0x08, 0x00,
+  0x40, 0x0c, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x05, 0x0e, 0x00, 0x00,
+  0x23, 0x24, 0x08, 0x00, 0x60, 0x0c, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x53, 0x0e, 0x00, 0x00, 0x0f, 0x2c, 0x08, 0x00, 0x68, 0x0c, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x53, 0x0e, 0x00, 0x00, 0x12, 0x2c, 0x08, 0x00,
+  0x80, 0x0c, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x53, 0x0e, 0x00, 0x00,
+  0x28, 0x2c, 0x08, 0x00, 0xa0, 0x0c, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x53, 0x0e, 0x00, 0x00, 0x34, 0x2c, 0x08, 0x00, 0xa8, 0x0c, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x89, 0x0e, 0x00, 0x00, 0x06, 0x5c, 0x06, 0x00,
+  0xb8, 0x0c, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xc8, 0x0c, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x9d, 0x0e, 0x00, 0x00, 0x1c, 0x6c, 0x06, 0x00, 0xe0, 0x0c, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0xc2, 0x0e, 0x00, 0x00, 0x1b, 0x70, 0x06, 0x00,
+  0xf0, 0x0c, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0xe2, 0x0e, 0x00, 0x00,
+  0x06, 0x74, 0x06, 0x00, 0xf8, 0x0c, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x01, 0x0f, 0x00, 0x00, 0x12, 0x24, 0x02, 0x00, 0x08, 0x0d, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x01, 0x0f, 0x00, 0x00, 0x06, 0x24, 0x02, 0x00,
+  0x10, 0x0d, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x2e, 0x0f, 0x00, 0x00,
+  0x07, 0x38, 0x02, 0x00, 0x18, 0x0d, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x2e, 0x0f, 0x00, 0x00, 0x1b, 0x38, 0x02, 0x00, 0x20, 0x0d, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x5f, 0x0f, 0x00, 0x00, 0x02, 0xb0, 0x01, 0x00,
+  0x40, 0x0d, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x8a, 0x0f, 0x00, 0x00,
+  0x2d, 0x3c, 0x02, 0x00, 0x48, 0x0d, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x5f, 0x0f, 0x00, 0x00, 0x02, 0xb0, 0x01, 0x00, 0x68, 0x0d, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0xb9, 0x0f, 0x00, 0x00, 0x1b, 0x40, 0x02, 0x00,
+  0x70, 0x0d, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x90, 0x0d, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x5f, 0x0f, 0x00, 0x00, 0x02, 0xb0, 0x01, 0x00, 0xb8, 0x0d, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0xb9, 0x0f, 0x00, 0x00, 0x2e, 0x40, 0x02, 0x00,
+  0xc8, 0x0d, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0xb9, 0x0f, 0x00, 0x00,
+  0x33, 0x40, 0x02, 0x00, 0xe0, 0x0d, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0xee, 0x0f, 0x00, 0x00, 0x13, 0x6c, 0x02, 0x00, 0xf0, 0x0d, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0xee, 0x0f, 0x00, 0x00, 0x17, 0x6c, 0x02, 0x00,
+  0x00, 0x0e, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0xee, 0x0f, 0x00, 0x00,
+  0x07, 0x6c, 0x02, 0x00, 0x08, 0x0e, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x12, 0x10, 0x00, 0x00, 0x09, 0x7c, 0x02, 0x00, 0x20, 0x0e, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x12, 0x10, 0x00, 0x00, 0x07, 0x7c, 0x02, 0x00,
+  0x28, 0x0e, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x30, 0x0e, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x26, 0x10, 0x00, 0x00, 0x08, 0x80, 0x02, 0x00, 0x38, 0x0e, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x37, 0x10, 0x00, 0x00, 0x11, 0x8c, 0x02, 0x00,
+  0x48, 0x0e, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x37, 0x10, 0x00, 0x00,
+  0x0f, 0x8c, 0x02, 0x00, 0x50, 0x0e, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x51, 0x10, 0x00, 0x00, 0x03, 0x9c, 0x02, 0x00, 0x68, 0x0e, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x76, 0x10, 0x00, 0x00, 0x34, 0x64, 0x02, 0x00,
+  0x70, 0x0e, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x76, 0x10, 0x00, 0x00,
+  0x02, 0x64, 0x02, 0x00, 0x80, 0x0e, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0xaf, 0x10, 0x00, 0x00, 0x06, 0x4c, 0x08, 0x00, 0xa0, 0x0e, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0xbd, 0x10, 0x00, 0x00, 0x12, 0x64, 0x0c, 0x00,
+  0xb0, 0x0e, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0xbd, 0x10, 0x00, 0x00,
+  0x2c, 0x64, 0x0c, 0x00, 0xc8, 0x0e, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x89, 0x0e, 0x00, 0x00, 0x06, 0x0c, 0x04, 0x00, 0xd0, 0x0e, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xe0, 0x0e, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x9d, 0x0e, 0x00, 0x00,
+  0x1c, 0x1c, 0x04, 0x00, 0xf0, 0x0e, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0xc2, 0x0e, 0x00, 0x00, 0x1b, 0x20, 0x04, 0x00, 0x00, 0x0f, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0xe2, 0x0e, 0x00, 0x00, 0x06, 0x24, 0x04, 0x00,
+  0x10, 0x0f, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x01, 0x0f, 0x00, 0x00,
+  0x12, 0x24, 0x02, 0x00, 0x20, 0x0f, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x01, 0x0f, 0x00, 0x00, 0x06, 0x24, 0x02, 0x00, 0x28, 0x0f, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x2e, 0x0f, 0x00, 0x00, 0x07, 0x38, 0x02, 0x00,
+  0x30, 0x0f, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x2e, 0x0f, 0x00, 0x00,
+  0x1b, 0x38, 0x02, 0x00, 0x38, 0x0f, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x5f, 0x0f, 0x00, 0x00, 0x02, 0xb0, 0x01, 0x00, 0x58, 0x0f, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x8a, 0x0f, 0x00, 0x00, 0x2d, 0x3c, 0x02, 0x00,
+  0x60, 0x0f, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x5f, 0x0f, 0x00, 0x00,
+  0x02, 0xb0, 0x01, 0x00, 0x80, 0x0f, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0xb9, 0x0f, 0x00, 0x00, 0x1b, 0x40, 0x02, 0x00, 0x88, 0x0f, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xa8, 0x0f, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x5f, 0x0f, 0x00, 0x00,
+  0x02, 0xb0, 0x01, 0x00, 0xd0, 0x0f, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0xb9, 0x0f, 0x00, 0x00, 0x2e, 0x40, 0x02, 0x00, 0xe0, 0x0f, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0xb9, 0x0f, 0x00, 0x00, 0x33, 0x40, 0x02, 0x00,
+  0xf0, 0x0f, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0xf8, 0x10, 0x00, 0x00,
+  0x02, 0x54, 0x02, 0x00, 0x50, 0x10, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0xee, 0x0f, 0x00, 0x00, 0x13, 0x6c, 0x02, 0x00, 0x68, 0x10, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0xee, 0x0f, 0x00, 0x00, 0x17, 0x6c, 0x02, 0x00,
+  0x78, 0x10, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0xee, 0x0f, 0x00, 0x00,
+  0x07, 0x6c, 0x02, 0x00, 0x80, 0x10, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x21, 0x11, 0x00, 0x00, 0x0c, 0x78, 0x02, 0x00, 0x88, 0x10, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x12, 0x10, 0x00, 0x00, 0x09, 0x7c, 0x02, 0x00,
+  0xa0, 0x10, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x12, 0x10, 0x00, 0x00,
+  0x07, 0x7c, 0x02, 0x00, 0xb0, 0x10, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x26, 0x10, 0x00, 0x00, 0x08, 0x80, 0x02, 0x00, 0xb8, 0x10, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x37, 0x10, 0x00, 0x00, 0x11, 0x8c, 0x02, 0x00,
+  0xc8, 0x10, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x37, 0x10, 0x00, 0x00,
+  0x0f, 0x8c, 0x02, 0x00, 0xd0, 0x10, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x51, 0x10, 0x00, 0x00, 0x03, 0x9c, 0x02, 0x00, 0xf0, 0x10, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x11, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x32, 0x11, 0x00, 0x00,
+  0x11, 0xa8, 0x02, 0x00, 0x10, 0x11, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x76, 0x10, 0x00, 0x00, 0x34, 0x64, 0x02, 0x00, 0x20, 0x11, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x76, 0x10, 0x00, 0x00, 0x02, 0x64, 0x02, 0x00,
+  0x30, 0x11, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x51, 0x10, 0x00, 0x00,
+  0x17, 0x9c, 0x02, 0x00, 0x50, 0x11, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x47, 0x11, 0x00, 0x00, 0x06, 0xa0, 0x02, 0x00, 0x68, 0x11, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x88, 0x11, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x55, 0x11, 0x00, 0x00,
+  0x28, 0xc4, 0x02, 0x00, 0xb0, 0x11, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x55, 0x11, 0x00, 0x00, 0x33, 0xc4, 0x02, 0x00, 0xb8, 0x11, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x5f, 0x0f, 0x00, 0x00, 0x02, 0xb0, 0x01, 0x00,
+  0xd8, 0x11, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x55, 0x11, 0x00, 0x00,
+  0x06, 0xc4, 0x02, 0x00, 0xe0, 0x11, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x5f, 0x0f, 0x00, 0x00, 0x02, 0xb0, 0x01, 0x00, 0x18, 0x12, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x8a, 0x11, 0x00, 0x00, 0x0d, 0xd4, 0x02, 0x00,
+  0x50, 0x12, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0xa7, 0x11, 0x00, 0x00,
+  0x11, 0x3c, 0x04, 0x00, 0x58, 0x12, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x5f, 0x0f, 0x00, 0x00, 0x02, 0xb0, 0x01, 0x00, 0xa0, 0x12, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x01, 0x12, 0x00, 0x00, 0x06, 0x5c, 0x04, 0x00,
+  0xa8, 0x12, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x16, 0x12, 0x00, 0x00,
+  0x13, 0x64, 0x04, 0x00, 0xc0, 0x12, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x16, 0x12, 0x00, 0x00, 0x2d, 0x64, 0x04, 0x00, 0xd0, 0x12, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x16, 0x12, 0x00, 0x00, 0x07, 0x64, 0x04, 0x00,
+  0xd8, 0x12, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x50, 0x12, 0x00, 0x00,
+  0x07, 0x70, 0x04, 0x00, 0xe0, 0x12, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x50, 0x12, 0x00, 0x00, 0x13, 0x70, 0x04, 0x00, 0xe8, 0x12, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x5f, 0x0f, 0x00, 0x00, 0x02, 0xb0, 0x01, 0x00,
+  0x20, 0x13, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x50, 0x12, 0x00, 0x00,
+  0x48, 0x70, 0x04, 0x00, 0x28, 0x13, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x9a, 0x12, 0x00, 0x00, 0x07, 0x74, 0x04, 0x00, 0x30, 0x13, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x9a, 0x12, 0x00, 0x00, 0x13, 0x74, 0x04, 0x00,
+  0x38, 0x13, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x9a, 0x12, 0x00, 0x00,
+  0x16, 0x74, 0x04, 0x00, 0x58, 0x13, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x9a, 0x12, 0x00, 0x00, 0x22, 0x74, 0x04, 0x00, 0x60, 0x13, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x9a, 0x12, 0x00, 0x00, 0x26, 0x74, 0x04, 0x00,
+  0x80, 0x13, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x9a, 0x12, 0x00, 0x00,
+  0x35, 0x74, 0x04, 0x00, 0x88, 0x13, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x5f, 0x0f, 0x00, 0x00, 0x02, 0xb0, 0x01, 0x00, 0xc0, 0x13, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x50, 0x12, 0x00, 0x00, 0x07, 0x70, 0x04, 0x00,
+  0xc8, 0x13, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x5f, 0x0f, 0x00, 0x00,
+  0x02, 0xb0, 0x01, 0x00, 0xe8, 0x13, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x5f, 0x0f, 0x00, 0x00, 0x02, 0xb0, 0x01, 0x00, 0x08, 0x14, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0xd1, 0x12, 0x00, 0x00, 0x2d, 0x88, 0x04, 0x00,
+  0x10, 0x14, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x5f, 0x0f, 0x00, 0x00,
+  0x02, 0xb0, 0x01, 0x00, 0x30, 0x14, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0xd1, 0x12, 0x00, 0x00, 0x3f, 0x88, 0x04, 0x00, 0x38, 0x14, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x5f, 0x0f, 0x00, 0x00, 0x02, 0xb0, 0x01, 0x00,
+  0x58, 0x14, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x11, 0x13, 0x00, 0x00,
+  0x1f, 0x8c, 0x04, 0x00, 0x60, 0x14, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x5f, 0x0f, 0x00, 0x00, 0x02, 0xb0, 0x01, 0x00, 0x80, 0x14, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x11, 0x13, 0x00, 0x00, 0x31, 0x8c, 0x04, 0x00,
+  0x88, 0x14, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x51, 0x13, 0x00, 0x00,
+  0x1e, 0xdc, 0x01, 0x00, 0x98, 0x14, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x51, 0x13, 0x00, 0x00, 0x0d, 0xdc, 0x01, 0x00, 0xa0, 0x14, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x51, 0x13, 0x00, 0x00, 0x17, 0xdc, 0x01, 0x00,
+  0xa8, 0x14, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x76, 0x13, 0x00, 0x00,
+  0x1f, 0xe0, 0x01, 0x00, 0xb8, 0x14, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x76, 0x13, 0x00, 0x00, 0x18, 0xe0, 0x01, 0x00, 0xc0, 0x14, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x9c, 0x13, 0x00, 0x00, 0x11, 0xf8, 0x01, 0x00,
+  0xd0, 0x14, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x9c, 0x13, 0x00, 0x00,
+  0x09, 0xf8, 0x01, 0x00, 0x18, 0x15, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0xdb, 0x13, 0x00, 0x00, 0x06, 0xa4, 0x04, 0x00, 0x28, 0x15, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0xdb, 0x13, 0x00, 0x00, 0x1c, 0xa4, 0x04, 0x00,
+  0x40, 0x15, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0xdb, 0x13, 0x00, 0x00,
+  0x06, 0xa4, 0x04, 0x00, 0x50, 0x15, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x1b, 0x14, 0x00, 0x00, 0x15, 0xb8, 0x04, 0x00, 0x78, 0x15, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x36, 0x14, 0x00, 0x00, 0x0c, 0xbc, 0x04, 0x00,
+  0x90, 0x15, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x5a, 0x01, 0x00, 0x00,
+  0x15, 0xcc, 0x04, 0x00, 0x98, 0x15, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x5a, 0x01, 0x00, 0x00, 0x08, 0xcc, 0x04, 0x00, 0xa8, 0x15, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x5a, 0x01, 0x00, 0x00, 0x15, 0xcc, 0x04, 0x00,
+  0xb0, 0x15, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x05, 0x0e, 0x00, 0x00,
+  0x23, 0xd0, 0x04, 0x00, 0xd8, 0x15, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x5a, 0x01, 0x00, 0x00, 0x15, 0xcc, 0x04, 0x00, 0xe0, 0x15, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x52, 0x14, 0x00, 0x00, 0x1b, 0xd8, 0x04, 0x00,
+  0x00, 0x16, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x94, 0x14, 0x00, 0x00,
+  0x06, 0xdc, 0x04, 0x00, 0x08, 0x16, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0xa1, 0x14, 0x00, 0x00, 0x07, 0xe0, 0x04, 0x00, 0x20, 0x16, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0xb0, 0x14, 0x00, 0x00, 0x04, 0xe4, 0x04, 0x00,
+  0x30, 0x16, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0xdc, 0x14, 0x00, 0x00,
+  0x2a, 0x94, 0x0c, 0x00, 0x38, 0x16, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0xdc, 0x14, 0x00, 0x00, 0x09, 0x94, 0x0c, 0x00, 0x58, 0x16, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x19, 0x15, 0x00, 0x00, 0x01, 0x98, 0x0c, 0x00,
+  0x60, 0x16, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x55, 0x11, 0x00, 0x00,
+  0x28, 0xc4, 0x02, 0x00, 0x78, 0x16, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x55, 0x11, 0x00, 0x00, 0x33, 0xc4, 0x02, 0x00, 0x80, 0x16, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x5f, 0x0f, 0x00, 0x00, 0x02, 0xb0, 0x01, 0x00,
+  0xa0, 0x16, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x55, 0x11, 0x00, 0x00,
+  0x06, 0xc4, 0x02, 0x00, 0xf0, 0x16, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x1b, 0x15, 0x00, 0x00, 0x06, 0xa4, 0x06, 0x00, 0x38, 0x17, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x1b, 0x15, 0x00, 0x00, 0x06, 0xa4, 0x06, 0x00,
+  0x40, 0x17, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0xd8, 0x02, 0x00, 0x00,
+  0x2c, 0x08, 0x03, 0x00, 0x48, 0x17, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x49, 0x02, 0x00, 0x00, 0x22, 0x04, 0x03, 0x00, 0x50, 0x17, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x0d, 0x03, 0x00, 0x00, 0x16, 0x14, 0x03, 0x00,
+  0x60, 0x17, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x0d, 0x03, 0x00, 0x00,
+  0x06, 0x14, 0x03, 0x00, 0x68, 0x17, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x17, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x48, 0x15, 0x00, 0x00, 0x02, 0x24, 0x03, 0x00,
+  0xf8, 0x17, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x7b, 0x15, 0x00, 0x00,
+  0x02, 0x28, 0x03, 0x00, 0x58, 0x18, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0xbc, 0x15, 0x00, 0x00, 0x02, 0x2c, 0x03, 0x00, 0xc8, 0x18, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xe0, 0x18, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0xa4, 0x0c, 0x00, 0x00,
+  0x06, 0x34, 0x03, 0x00, 0xf0, 0x18, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x49, 0x04, 0x00, 0x00, 0x13, 0x3c, 0x03, 0x00, 0x00, 0x19, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x49, 0x04, 0x00, 0x00, 0x07, 0x3c, 0x03, 0x00,
+  0x08, 0x19, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0xf1, 0x15, 0x00, 0x00,
+  0x16, 0x48, 0x03, 0x00, 0x10, 0x19, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x0d, 0x16, 0x00, 0x00, 0x0b, 0x70, 0x03, 0x00, 0x28, 0x19, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x29, 0x16, 0x00, 0x00, 0x12, 0x54, 0x03, 0x00,
+  0x30, 0x19, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x0d, 0x16, 0x00, 0x00,
+  0x08, 0x70, 0x03, 0x00, 0x38, 0x19, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x5f, 0x0f, 0x00, 0x00, 0x02, 0xb0, 0x01, 0x00, 0x58, 0x19, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x5f, 0x16, 0x00, 0x00, 0x15, 0x4c, 0x03, 0x00,
+  0x60, 0x19, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x0d, 0x16, 0x00, 0x00,
+  0x0b, 0x70, 0x03, 0x00, 0x78, 0x19, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x0d, 0x16, 0x00, 0x00, 0x08, 0x70, 0x03, 0x00, 0x80, 0x19, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x29, 0x16, 0x00, 0x00, 0x12, 0x54, 0x03, 0x00,
+  0x90, 0x19, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x0d, 0x16, 0x00, 0x00,
+  0x08, 0x70, 0x03, 0x00, 0x98, 0x19, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x29, 0x16, 0x00, 0x00, 0x12, 0x54, 0x03, 0x00, 0xb0, 0x19, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x0d, 0x16, 0x00, 0x00, 0x08, 0x70, 0x03, 0x00,
+  0xc0, 0x19, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x5f, 0x0f, 0x00, 0x00,
+  0x02, 0xb0, 0x01, 0x00, 0xe8, 0x19, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x7a, 0x16, 0x00, 0x00, 0x0c, 0x58, 0x03, 0x00, 0xf0, 0x19, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x0d, 0x16, 0x00, 0x00, 0x08, 0x70, 0x03, 0x00,
+  0xf8, 0x19, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x5f, 0x0f, 0x00, 0x00,
+  0x02, 0xb0, 0x01, 0x00, 0x18, 0x1a, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x94, 0x16, 0x00, 0x00, 0x0e, 0x50, 0x03, 0x00, 0x28, 0x1a, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x5f, 0x16, 0x00, 0x00, 0x0e, 0x4c, 0x03, 0x00,
+  0x38, 0x1a, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x0d, 0x16, 0x00, 0x00,
+  0x08, 0x70, 0x03, 0x00, 0x40, 0x1a, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x29, 0x16, 0x00, 0x00, 0x10, 0x54, 0x03, 0x00, 0x48, 0x1a, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x5f, 0x0f, 0x00, 0x00, 0x02, 0xb0, 0x01, 0x00,
+  0x58, 0x1a, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x0d, 0x16, 0x00, 0x00,
+  0x08, 0x70, 0x03, 0x00, 0x88, 0x1a, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x51, 0x13, 0x00, 0x00, 0x0d, 0xdc, 0x01, 0x00, 0x90, 0x1a, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x51, 0x13, 0x00, 0x00, 0x1e, 0xdc, 0x01, 0x00,
+  0x98, 0x1a, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x51, 0x13, 0x00, 0x00,
+  0x17, 0xdc, 0x01, 0x00, 0xa0, 0x1a, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x76, 0x13, 0x00, 0x00, 0x1f, 0xe0, 0x01, 0x00, 0xb0, 0x1a, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x76, 0x13, 0x00, 0x00, 0x18, 0xe0, 0x01, 0x00,
+  0xb8, 0x1a, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0xa9, 0x16, 0x00, 0x00,
+  0x10, 0x78, 0x03, 0x00, 0xc0, 0x1a, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0xa9, 0x16, 0x00, 0x00, 0x0e, 0x78, 0x03, 0x00, 0xd8, 0x1a, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0xc9, 0x16, 0x00, 0x00, 0x24, 0xfc, 0x04, 0x00,
+  0x20, 0x1b, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x1b, 0x15, 0x00, 0x00,
+  0x06, 0x28, 0x05, 0x00, 0x38, 0x1b, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x11, 0x17, 0x00, 0x00, 0x1b, 0x14, 0x05, 0x00, 0x50, 0x1b, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x1b, 0x15, 0x00, 0x00, 0x06, 0x28, 0x05, 0x00,
+  0x80, 0x1b, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x11, 0x17, 0x00, 0x00,
+  0x1b, 0x14, 0x05, 0x00, 0x88, 0x1b, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x5f, 0x0f, 0x00, 0x00, 0x02, 0xb0, 0x01, 0x00, 0xa8, 0x1b, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x1b, 0x15, 0x00, 0x00, 0x06, 0x28, 0x05, 0x00,
+  0xc0, 0x1b, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x1b, 0x15, 0x00, 0x00,
+  0x06, 0x28, 0x05, 0x00, 0xc8, 0x1b, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0xd8, 0x02, 0x00, 0x00, 0x2c, 0x08, 0x03, 0x00, 0xd0, 0x1b, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x49, 0x02, 0x00, 0x00, 0x22, 0x04, 0x03, 0x00,
+  0xd8, 0x1b, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x0d, 0x03, 0x00, 0x00,
+  0x16, 0x14, 0x03, 0x00, 0xe8, 0x1b, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x0d, 0x03, 0x00, 0x00, 0x06, 0x14, 0x03, 0x00, 0xf0, 0x1b, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x1c, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x48, 0x15, 0x00, 0x00,
+  0x02, 0x24, 0x03, 0x00, 0x88, 0x1c, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x7b, 0x15, 0x00, 0x00, 0x02, 0x28, 0x03, 0x00, 0xe8, 0x1c, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0xbc, 0x15, 0x00, 0x00, 0x02, 0x2c, 0x03, 0x00,
+  0x58, 0x1d, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x70, 0x1d, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0xa4, 0x0c, 0x00, 0x00, 0x06, 0x34, 0x03, 0x00, 0x80, 0x1d, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x49, 0x04, 0x00, 0x00, 0x13, 0x3c, 0x03, 0x00,
+  0x90, 0x1d, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x49, 0x04, 0x00, 0x00,
+  0x07, 0x3c, 0x03, 0x00, 0x98, 0x1d, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0xf1, 0x15, 0x00, 0x00, 0x16, 0x48, 0x03, 0x00, 0xa0, 0x1d, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x0d, 0x16, 0x00, 0x00, 0x0b, 0x70, 0x03, 0x00,
+  0xb8, 0x1d, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x29, 0x16, 0x00, 0x00,
+  0x12, 0x54, 0x03, 0x00, 0xc0, 0x1d, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x0d, 0x16, 0x00, 0x00, 0x08, 0x70, 0x03, 0x00, 0xc8, 0x1d, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x5f, 0x0f, 0x00, 0x00, 0x02, 0xb0, 0x01, 0x00,
+  0xe8, 0x1d, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x5f, 0x16, 0x00, 0x00,
+  0x15, 0x4c, 0x03, 0x00, 0xf0, 0x1d, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x0d, 0x16, 0x00, 0x00, 0x0b, 0x70, 0x03, 0x00, 0x00, 0x1e, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x0d, 0x16, 0x00, 0x00, 0x08, 0x70, 0x03, 0x00,
+  0x08, 0x1e, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x29, 0x16, 0x00, 0x00,
+  0x12, 0x54, 0x03, 0x00, 0x18, 0x1e, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x0d, 0x16, 0x00, 0x00, 0x08, 0x70, 0x03, 0x00, 0x20, 0x1e, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x29, 0x16, 0x00, 0x00, 0x12, 0x54, 0x03, 0x00,
+  0x38, 0x1e, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x0d, 0x16, 0x00, 0x00,
+  0x08, 0x70, 0x03, 0x00, 0x48, 0x1e, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x5f, 0x0f, 0x00, 0x00, 0x02, 0xb0, 0x01, 0x00, 0x70, 0x1e, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x7a, 0x16, 0x00, 0x00, 0x0c, 0x58, 0x03, 0x00,
+  0x78, 0x1e, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x0d, 0x16, 0x00, 0x00,
+  0x08, 0x70, 0x03, 0x00, 0x80, 0x1e, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x5f, 0x0f, 0x00, 0x00, 0x02, 0xb0, 0x01, 0x00, 0xa0, 0x1e, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x94, 0x16, 0x00, 0x00, 0x0e, 0x50, 0x03, 0x00,
+  0xb0, 0x1e, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x5f, 0x16, 0x00, 0x00,
+  0x0e, 0x4c, 0x03, 0x00, 0xb8, 0x1e, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x0d, 0x16, 0x00, 0x00, 0x08, 0x70, 0x03, 0x00, 0xc0, 0x1e, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x29, 0x16, 0x00, 0x00, 0x10, 0x54, 0x03, 0x00,
+  0xc8, 0x1e, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x5f, 0x0f, 0x00, 0x00,
+  0x02, 0xb0, 0x01, 0x00, 0xd8, 0x1e, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x0d, 0x16, 0x00, 0x00, 0x08, 0x70, 0x03, 0x00, 0x08, 0x1f, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x51, 0x13, 0x00, 0x00, 0x0d, 0xdc, 0x01, 0x00,
+  0x10, 0x1f, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x51, 0x13, 0x00, 0x00,
+  0x1e, 0xdc, 0x01, 0x00, 0x18, 0x1f, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x51, 0x13, 0x00, 0x00, 0x17, 0xdc, 0x01, 0x00, 0x20, 0x1f, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x76, 0x13, 0x00, 0x00, 0x1f, 0xe0, 0x01, 0x00,
+  0x30, 0x1f, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x76, 0x13, 0x00, 0x00,
+  0x18, 0xe0, 0x01, 0x00, 0x38, 0x1f, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0xa9, 0x16, 0x00, 0x00, 0x10, 0x78, 0x03, 0x00, 0x40, 0x1f, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0xa9, 0x16, 0x00, 0x00, 0x0e, 0x78, 0x03, 0x00,
+  0x50, 0x1f, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x42, 0x05, 0x00, 0x00,
+  0x13, 0x84, 0x03, 0x00, 0x60, 0x1f, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x42, 0x05, 0x00, 0x00, 0x07, 0x84, 0x03, 0x00, 0x68, 0x1f, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x30, 0x17, 0x00, 0x00, 0x1f, 0x90, 0x03, 0x00,
+  0xb8, 0x1f, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x55, 0x17, 0x00, 0x00,
+  0x15, 0x94, 0x03, 0x00, 0x00, 0x20, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x70, 0x17, 0x00, 0x00, 0x10, 0x98, 0x03, 0x00, 0x10, 0x20, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x85, 0x17, 0x00, 0x00, 0x12, 0xa0, 0x03, 0x00,
+  0x18, 0x20, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0xa5, 0x17, 0x00, 0x00,
+  0x16, 0x9c, 0x03, 0x00, 0x28, 0x20, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0xa5, 0x17, 0x00, 0x00, 0x14, 0x9c, 0x03, 0x00, 0x30, 0x20, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x70, 0x17, 0x00, 0x00, 0x10, 0x98, 0x03, 0x00,
+  0x60, 0x20, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x9d, 0x0e, 0x00, 0x00,
+  0x1c, 0xac, 0x03, 0x00, 0x70, 0x20, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0xd0, 0x17, 0x00, 0x00, 0x12, 0xb0, 0x03, 0x00, 0x80, 0x20, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0xd0, 0x17, 0x00, 0x00, 0x06, 0xb0, 0x03, 0x00,
+  0x88, 0x20, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0xfe, 0x17, 0x00, 0x00,
+  0x15, 0xc0, 0x03, 0x00, 0x90, 0x20, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x18, 0x18, 0x00, 0x00, 0x15, 0xbc, 0x03, 0x00, 0x98, 0x20, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x34, 0x18, 0x00, 0x00, 0x0c, 0xc4, 0x03, 0x00,
+  0xa0, 0x20, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0xfe, 0x17, 0x00, 0x00,
+  0x0e, 0xc0, 0x03, 0x00, 0xa8, 0x20, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x47, 0x18, 0x00, 0x00, 0x0d, 0xc8, 0x03, 0x00, 0xb0, 0x20, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x47, 0x18, 0x00, 0x00, 0x0b, 0xc8, 0x03, 0x00,
+  0xb8, 0x20, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x69, 0x18, 0x00, 0x00,
+  0x1c, 0xc4, 0x06, 0x00, 0xc0, 0x20, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x8a, 0x18, 0x00, 0x00, 0x0d, 0xd0, 0x06, 0x00, 0xd8, 0x20, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x01, 0x0f, 0x00, 0x00, 0x12, 0xd8, 0x06, 0x00,
+  0xe8, 0x20, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0xa0, 0x18, 0x00, 0x00,
+  0x20, 0xc8, 0x06, 0x00, 0xf0, 0x20, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x01, 0x0f, 0x00, 0x00, 0x06, 0xd8, 0x06, 0x00, 0x00, 0x21, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0xc9, 0x18, 0x00, 0x00, 0x02, 0xc8, 0x01, 0x00,
+  0x10, 0x21, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0xc9, 0x18, 0x00, 0x00,
+  0x02, 0xc8, 0x01, 0x00, 0x20, 0x21, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0xc9, 0x18, 0x00, 0x00, 0x02, 0xc8, 0x01, 0x00, 0x30, 0x21, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0xf4, 0x18, 0x00, 0x00, 0x09, 0xf0, 0x06, 0x00,
+  0x38, 0x21, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x01, 0x19, 0x00, 0x00,
+  0x0d, 0x08, 0x07, 0x00, 0x40, 0x21, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x12, 0x19, 0x00, 0x00, 0x13, 0xec, 0x06, 0x00, 0x48, 0x21, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x12, 0x19, 0x00, 0x00, 0x1a, 0xec, 0x06, 0x00,
+  0x50, 0x21, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x12, 0x19, 0x00, 0x00,
+  0x10, 0xec, 0x06, 0x00, 0x58, 0x21, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x12, 0x19, 0x00, 0x00, 0x09, 0xec, 0x06, 0x00, 0x60, 0x21, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x34, 0x19, 0x00, 0x00, 0x06, 0x0c, 0x07, 0x00,
+  0x70, 0x21, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x42, 0x19, 0x00, 0x00,
+  0x1e, 0x10, 0x07, 0x00, 0x80, 0x21, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x42, 0x05, 0x00, 0x00, 0x13, 0x14, 0x07, 0x00, 0x90, 0x21, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x42, 0x05, 0x00, 0x00, 0x07, 0x14, 0x07, 0x00,
+  0x98, 0x21, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x5f, 0x0f, 0x00, 0x00,
+  0x02, 0xb0, 0x01, 0x00, 0xd8, 0x21, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x69, 0x19, 0x00, 0x00, 0x24, 0x28, 0x07, 0x00, 0xe0, 0x21, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0xad, 0x19, 0x00, 0x00, 0x08, 0x34, 0x07, 0x00,
+  0xe8, 0x21, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x5f, 0x0f, 0x00, 0x00,
+  0x02, 0xb0, 0x01, 0x00, 0x08, 0x22, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0xad, 0x19, 0x00, 0x00, 0x08, 0x34, 0x07, 0x00, 0x10, 0x22, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x5f, 0x0f, 0x00, 0x00, 0x02, 0xb0, 0x01, 0x00,
+  0x30, 0x22, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0xad, 0x19, 0x00, 0x00,
+  0x08, 0x34, 0x07, 0x00, 0x38, 0x22, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x5f, 0x0f, 0x00, 0x00, 0x02, 0xb0, 0x01, 0x00, 0x58, 0x22, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0xad, 0x19, 0x00, 0x00, 0x08, 0x34, 0x07, 0x00,
+  0x60, 0x22, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x5f, 0x0f, 0x00, 0x00,
+  0x02, 0xb0, 0x01, 0x00, 0x80, 0x22, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0xad, 0x19, 0x00, 0x00, 0x08, 0x34, 0x07, 0x00, 0x88, 0x22, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x5f, 0x0f, 0x00, 0x00, 0x02, 0xb0, 0x01, 0x00,
+  0xf0, 0x23, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0xad, 0x19, 0x00, 0x00,
+  0x08, 0x34, 0x07, 0x00, 0x70, 0x24, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0xc9, 0x19, 0x00, 0x00, 0x03, 0x44, 0x07, 0x00, 0x78, 0x24, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0xad, 0x19, 0x00, 0x00, 0x08, 0x34, 0x07, 0x00,
+  0x98, 0x24, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xb0, 0x24, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x1a, 0x1a, 0x00, 0x00, 0x08, 0x74, 0x07, 0x00, 0xb8, 0x24, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0xc9, 0x19, 0x00, 0x00, 0x03, 0x44, 0x07, 0x00,
+  0xc0, 0x24, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xd0, 0x24, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0xc9, 0x19, 0x00, 0x00, 0x03, 0x44, 0x07, 0x00, 0xf0, 0x24, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x51, 0x13, 0x00, 0x00, 0x0d, 0xdc, 0x01, 0x00,
+  0x00, 0x25, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x51, 0x13, 0x00, 0x00,
+  0x1e, 0xdc, 0x01, 0x00, 0x08, 0x25, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x51, 0x13, 0x00, 0x00, 0x0d, 0xdc, 0x01, 0x00, 0x10, 0x25, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x51, 0x13, 0x00, 0x00, 0x17, 0xdc, 0x01, 0x00,
+  0x18, 0x25, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x76, 0x13, 0x00, 0x00,
+  0x1f, 0xe0, 0x01, 0x00, 0x28, 0x25, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x76, 0x13, 0x00, 0x00, 0x18, 0xe0, 0x01, 0x00, 0x30, 0x25, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x76, 0x13, 0x00, 0x00, 0x09, 0xe0, 0x01, 0x00,
+  0x48, 0x25, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x32, 0x1a, 0x00, 0x00,
+  0x10, 0x84, 0x07, 0x00, 0x68, 0x25, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x60, 0x1a, 0x00, 0x00, 0x28, 0x4c, 0x07, 0x00, 0x78, 0x25, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x60, 0x1a, 0x00, 0x00, 0x08, 0x4c, 0x07, 0x00,
+  0x88, 0x25, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x99, 0x1a, 0x00, 0x00,
+  0x15, 0x58, 0x07, 0x00, 0x90, 0x25, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0xba, 0x1a, 0x00, 0x00, 0x08, 0x5c, 0x07, 0x00, 0x98, 0x25, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0xd4, 0x1a, 0x00, 0x00, 0x1d, 0x60, 0x07, 0x00,
+  0xb8, 0x25, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0xd4, 0x1a, 0x00, 0x00,
+  0x09, 0x60, 0x07, 0x00, 0xc0, 0x25, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0xfe, 0x1a, 0x00, 0x00, 0x0f, 0x6c, 0x07, 0x00, 0xd0, 0x25, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x42, 0x05, 0x00, 0x00, 0x13, 0x84, 0x03, 0x00,
+  0xe0, 0x25, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x42, 0x05, 0x00, 0x00,
+  0x07, 0x84, 0x03, 0x00, 0xe8, 0x25, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x30, 0x17, 0x00, 0x00, 0x1f, 0x90, 0x03, 0x00, 0x38, 0x26, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x55, 0x17, 0x00, 0x00, 0x15, 0x94, 0x03, 0x00,
+  0x80, 0x26, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x70, 0x17, 0x00, 0x00,
+  0x10, 0x98, 0x03, 0x00, 0x90, 0x26, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x85, 0x17, 0x00, 0x00, 0x12, 0xa0, 0x03, 0x00, 0x98, 0x26, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0xa5, 0x17, 0x00, 0x00, 0x16, 0x9c, 0x03, 0x00,
+  0xa8, 0x26, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0xa5, 0x17, 0x00, 0x00,
+  0x14, 0x9c, 0x03, 0x00, 0xb0, 0x26, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x70, 0x17, 0x00, 0x00, 0x10, 0x98, 0x03, 0x00, 0xe0, 0x26, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x9d, 0x0e, 0x00, 0x00, 0x1c, 0xac, 0x03, 0x00,
+  0xf0, 0x26, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0xd0, 0x17, 0x00, 0x00,
+  0x12, 0xb0, 0x03, 0x00, 0x00, 0x27, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0xd0, 0x17, 0x00, 0x00, 0x06, 0xb0, 0x03, 0x00, 0x08, 0x27, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x47, 0x18, 0x00, 0x00, 0x0d, 0xc8, 0x03, 0x00,
+  0x10, 0x27, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x47, 0x18, 0x00, 0x00,
+  0x0b, 0xc8, 0x03, 0x00, 0x18, 0x27, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0xfe, 0x17, 0x00, 0x00, 0x15, 0xc0, 0x03, 0x00, 0x20, 0x27, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x15, 0xbc, 0x03, 0x00,
+  0x28, 0x27, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x34, 0x18, 0x00, 0x00,
+  0x0c, 0xc4, 0x03, 0x00, 0x30, 0x27, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0xfe, 0x17, 0x00, 0x00, 0x0e, 0xc0, 0x03, 0x00, 0x38, 0x27, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x69, 0x18, 0x00, 0x00, 0x1c, 0x48, 0x05, 0x00,
+  0x40, 0x27, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x8a, 0x18, 0x00, 0x00,
+  0x0d, 0x54, 0x05, 0x00, 0x58, 0x27, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x18, 0x1b, 0x00, 0x00, 0x1a, 0x5c, 0x05, 0x00, 0x78, 0x27, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0xa0, 0x18, 0x00, 0x00, 0x20, 0x4c, 0x05, 0x00,
+  0x80, 0x27, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x18, 0x1b, 0x00, 0x00,
+  0x06, 0x5c, 0x05, 0x00, 0x88, 0x27, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x27, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x3f, 0x1b, 0x00, 0x00, 0x13, 0x70, 0x05, 0x00,
+  0xa0, 0x27, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x3f, 0x1b, 0x00, 0x00,
+  0x1a, 0x70, 0x05, 0x00, 0xa8, 0x27, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x3f, 0x1b, 0x00, 0x00, 0x10, 0x70, 0x05, 0x00, 0xb0, 0x27, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x3f, 0x1b, 0x00, 0x00, 0x09, 0x70, 0x05, 0x00,
+  0xc0, 0x27, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x61, 0x1b, 0x00, 0x00,
+  0x10, 0x74, 0x05, 0x00, 0xc8, 0x27, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x61, 0x1b, 0x00, 0x00, 0x09, 0x74, 0x05, 0x00, 0xd0, 0x27, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x77, 0x1b, 0x00, 0x00, 0x18, 0x78, 0x05, 0x00,
+  0xe0, 0x27, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0xc9, 0x18, 0x00, 0x00,
+  0x02, 0xc8, 0x01, 0x00, 0xf0, 0x27, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x98, 0x1b, 0x00, 0x00, 0x18, 0x7c, 0x05, 0x00, 0x00, 0x28, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0xc9, 0x18, 0x00, 0x00, 0x02, 0xc8, 0x01, 0x00,
+  0x10, 0x28, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x30, 0x28, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0xb9, 0x1b, 0x00, 0x00, 0x14, 0x80, 0x05, 0x00, 0x58, 0x28, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0xc9, 0x18, 0x00, 0x00, 0x02, 0xc8, 0x01, 0x00,
+  0x70, 0x28, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x07, 0x1c, 0x00, 0x00,
+  0x02, 0x90, 0x05, 0x00, 0xd8, 0x28, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x3f, 0x1c, 0x00, 0x00, 0x0c, 0xac, 0x05, 0x00, 0xf0, 0x28, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x3f, 0x1c, 0x00, 0x00, 0x0a, 0xac, 0x05, 0x00,
+  0xf8, 0x28, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x07, 0x1c, 0x00, 0x00,
+  0x02, 0x90, 0x05, 0x00, 0x00, 0x29, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x29, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x07, 0x1c, 0x00, 0x00, 0x02, 0x90, 0x05, 0x00,
+  0x18, 0x29, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x58, 0x1c, 0x00, 0x00,
+  0x1b, 0xa0, 0x05, 0x00, 0x38, 0x29, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x58, 0x1c, 0x00, 0x00, 0x07, 0xa0, 0x05, 0x00, 0x48, 0x29, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x80, 0x1c, 0x00, 0x00, 0x02, 0xb4, 0x05, 0x00,
+  0x88, 0x29, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xb0, 0x29, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0xa7, 0x1c, 0x00, 0x00, 0x3c, 0xbc, 0x05, 0x00, 0xd0, 0x29, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0xa7, 0x1c, 0x00, 0x00, 0x40, 0xbc, 0x05, 0x00,
+  0xe0, 0x29, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0xa7, 0x1c, 0x00, 0x00,
+  0x07, 0xbc, 0x05, 0x00, 0xe8, 0x29, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0xf4, 0x1c, 0x00, 0x00, 0x0e, 0xc8, 0x05, 0x00, 0x00, 0x2a, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0xf4, 0x1c, 0x00, 0x00, 0x0c, 0xc8, 0x05, 0x00,
+  0x08, 0x2a, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x80, 0x1c, 0x00, 0x00,
+  0x02, 0xb4, 0x05, 0x00, 0x10, 0x2a, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x80, 0x1c, 0x00, 0x00, 0x22, 0xb4, 0x05, 0x00, 0x18, 0x2a, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x80, 0x1c, 0x00, 0x00, 0x02, 0xb4, 0x05, 0x00,
+  0x28, 0x2a, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x11, 0x1d, 0x00, 0x00,
+  0x06, 0xd8, 0x05, 0x00, 0x58, 0x2a, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x2a, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x24, 0x1d, 0x00, 0x00, 0x17, 0xf4, 0x05, 0x00,
+  0x90, 0x2a, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x9c, 0x13, 0x00, 0x00,
+  0x11, 0xf8, 0x01, 0x00, 0x98, 0x2a, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x9c, 0x13, 0x00, 0x00, 0x09, 0xf8, 0x01, 0x00, 0xb0, 0x2a, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0xa7, 0x1c, 0x00, 0x00, 0x0b, 0xbc, 0x05, 0x00,
+  0xd0, 0x2a, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0xa7, 0x1c, 0x00, 0x00,
+  0x27, 0xbc, 0x05, 0x00, 0xe0, 0x2a, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x32, 0x1a, 0x00, 0x00, 0x0e, 0x84, 0x07, 0x00, 0xe8, 0x2a, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0xa1, 0x14, 0x00, 0x00, 0x07, 0x34, 0x08, 0x00,
+  0x00, 0x2b, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x20, 0x2b, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x5f, 0x0f, 0x00, 0x00, 0x02, 0xb0, 0x01, 0x00, 0x48, 0x2b, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x57, 0x1d, 0x00, 0x00, 0x0f, 0xdc, 0x05, 0x00,
+  0x58, 0x2b, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x74, 0x1d, 0x00, 0x00,
+  0x0a, 0xec, 0x05, 0x00, 0x68, 0x2b, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0xa1, 0x1d, 0x00, 0x00, 0x1a, 0xf0, 0x05, 0x00, 0x70, 0x2b, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0xcd, 0x1d, 0x00, 0x00, 0x11, 0xe8, 0x05, 0x00,
+  0x78, 0x2b, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0xcd, 0x1d, 0x00, 0x00,
+  0x0a, 0xe8, 0x05, 0x00, 0x80, 0x2b, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0xfb, 0x1d, 0x00, 0x00, 0x07, 0xe4, 0x05, 0x00, 0x88, 0x2b, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0xcd, 0x1d, 0x00, 0x00, 0x1c, 0xe8, 0x05, 0x00,
+  0x90, 0x2b, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x5f, 0x0f, 0x00, 0x00,
+  0x02, 0xb0, 0x01, 0x00, 0xb0, 0x2b, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0xcd, 0x1d, 0x00, 0x00, 0x07, 0xe8, 0x05, 0x00, 0xc0, 0x2b, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0xfb, 0x1d, 0x00, 0x00, 0x1c, 0xe4, 0x05, 0x00,
+  0xc8, 0x2b, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0xfb, 0x1d, 0x00, 0x00,
+  0x0e, 0xe4, 0x05, 0x00, 0xd0, 0x2b, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0xfb, 0x1d, 0x00, 0x00, 0x3b, 0xe4, 0x05, 0x00, 0xd8, 0x2b, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0xfb, 0x1d, 0x00, 0x00, 0x29, 0xe4, 0x05, 0x00,
+  0xe8, 0x2b, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x74, 0x1d, 0x00, 0x00,
+  0x1a, 0xec, 0x05, 0x00, 0xf0, 0x2b, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x5f, 0x0f, 0x00, 0x00, 0x02, 0xb0, 0x01, 0x00, 0x10, 0x2c, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x74, 0x1d, 0x00, 0x00, 0x07, 0xec, 0x05, 0x00,
+  0x18, 0x2c, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x5f, 0x0f, 0x00, 0x00,
+  0x02, 0xb0, 0x01, 0x00, 0x38, 0x2c, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0xa1, 0x1d, 0x00, 0x00, 0x07, 0xf0, 0x05, 0x00, 0x40, 0x2c, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x24, 0x1d, 0x00, 0x00, 0x0a, 0xf4, 0x05, 0x00,
+  0x48, 0x2c, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x24, 0x1d, 0x00, 0x00,
+  0x07, 0xf4, 0x05, 0x00, 0x50, 0x2c, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x3a, 0x1e, 0x00, 0x00, 0x07, 0xf8, 0x05, 0x00, 0x70, 0x2c, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x80, 0x2c, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x4f, 0x1e, 0x00, 0x00,
+  0x18, 0x00, 0x06, 0x00, 0xa0, 0x2c, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x9c, 0x13, 0x00, 0x00, 0x11, 0xf8, 0x01, 0x00, 0xa8, 0x2c, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x9c, 0x13, 0x00, 0x00, 0x09, 0xf8, 0x01, 0x00,
+  0xb8, 0x2c, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x90, 0x1e, 0x00, 0x00,
+  0x08, 0xfc, 0x05, 0x00, 0xc8, 0x2c, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x4f, 0x1e, 0x00, 0x00, 0x0b, 0x00, 0x06, 0x00, 0xd0, 0x2c, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x4f, 0x1e, 0x00, 0x00, 0x08, 0x00, 0x06, 0x00,
+  0xf0, 0x2c, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x51, 0x13, 0x00, 0x00,
+  0x0d, 0xdc, 0x01, 0x00, 0x00, 0x2d, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x51, 0x13, 0x00, 0x00, 0x1e, 0xdc, 0x01, 0x00, 0x08, 0x2d, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x51, 0x13, 0x00, 0x00, 0x0d, 0xdc, 0x01, 0x00,
+  0x10, 0x2d, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x51, 0x13, 0x00, 0x00,
+  0x17, 0xdc, 0x01, 0x00, 0x18, 0x2d, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x76, 0x13, 0x00, 0x00, 0x1f, 0xe0, 0x01, 0x00, 0x28, 0x2d, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x76, 0x13, 0x00, 0x00, 0x18, 0xe0, 0x01, 0x00,
+  0x30, 0x2d, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x76, 0x13, 0x00, 0x00,
+  0x09, 0xe0, 0x01, 0x00, 0x48, 0x2d, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0x32, 0x1a, 0x00, 0x00, 0x10, 0x0c, 0x06, 0x00, 0x60, 0x2d, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x32, 0x1a, 0x00, 0x00, 0x0e, 0x0c, 0x06, 0x00,
+  0x68, 0x2d, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0xaf, 0x10, 0x00, 0x00,
+  0x06, 0x18, 0x06, 0x00, 0x80, 0x2d, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+  0xab, 0x1e, 0x00, 0x00, 0x03, 0x1c, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xd8, 0x08, 0x00, 0x00,
+  0xb5, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x58, 0x16, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xae, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x30, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xf0, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x3f, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x10, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x72, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xc8, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xe0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x20, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1d, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xf8, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x59, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x38, 0x05, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x51, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xa8, 0x06, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x37, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x06, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x59, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xb0, 0x09, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x61, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xb0, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2f, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x60, 0x08, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1e, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x50, 0x0b, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x47, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x90, 0x0e, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x94, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x40, 0x09, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x26, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x30, 0x16, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xc9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x28, 0x01, 0x00, 0x00,
+  0x03, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x40, 0x0a, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xd8, 0x01, 0x00, 0x00,
+  0x83, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x68, 0x0a, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xd8, 0x02, 0x00, 0x00,
+  0xd8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x60, 0x0a, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xb1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xa8, 0x02, 0x00, 0x00,
+  0xc5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xa0, 0x0e, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xb8, 0x03, 0x00, 0x00,
+  0x7b, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x60, 0x0b, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xe8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x98, 0x04, 0x00, 0x00,
+  0x2e, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xb8, 0x0b, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xd8, 0x05, 0x00, 0x00,
+  0x7a, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x80, 0x0e, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xa9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x48, 0x05, 0x00, 0x00,
+  0xbe, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xe0, 0x0d, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xb9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xb0, 0x08, 0x00, 0x00,
+  0xab, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x68, 0x0e, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xc1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xc0, 0x06, 0x00, 0x00,
+  0x6a, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x60, 0x16, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x70, 0x07, 0x00, 0x00,
+  0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x60, 0x11, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xe0, 0x08, 0x00, 0x00,
+  0xf1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x50, 0x10, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xf0, 0x08, 0x00, 0x00,
+  0x14, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x30, 0x11, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x50, 0x08, 0x00, 0x00,
+  0x69, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x88, 0x11, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x4b, 0x00, 0x00, 0x00, 0x12, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x22, 0x00, 0x00, 0x00, 0x11, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x9c, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xe8, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x83, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x18, 0x15, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xbc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xf0, 0x14, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0b, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x78, 0x15, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xe8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xd0, 0x1a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x50, 0x1f, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x8c, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x60, 0x20, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x8b, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xd0, 0x25, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x15, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xe0, 0x26, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xe8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xe8, 0x2a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xa5, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x68, 0x25, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x88, 0x24, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x61, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xe0, 0x24, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x25, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xe0, 0x2a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x48, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x58, 0x28, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xcf, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x48, 0x29, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xfa, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x18, 0x29, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0c, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xd8, 0x28, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x3f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x28, 0x2a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x50, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xb0, 0x2a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xb3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x88, 0x29, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x36, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x68, 0x2d, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xc6, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x20, 0x2b, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xf1, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x10, 0x2b, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xd8, 0x2c, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xb8, 0x2c, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x72, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x60, 0x2d, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x6d, 0x00, 0x00, 0x00, 0x12, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x98, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2f, 0x00, 0x00, 0x00, 0x11, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x4c, 0x00, 0x00, 0x00, 0x11, 0x00, 0x05, 0x00, 0x60, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x11, 0x00, 0x05, 0x00, 0x88, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x2b, 0x00, 0x00, 0x00, 0x11, 0x00, 0x05, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x00, 0x00, 0x11, 0x00, 0x05, 0x00, 0x40, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x42, 0x00, 0x00, 0x00, 0x11, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x38, 0x00, 0x00, 0x00, 0x11, 0x00, 0x05, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x64, 0x00, 0x00, 0x00, 0x11, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x12, 0x00, 0x00, 0x00, 0xb8, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x68, 0x02, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00,
-  0x74, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x13, 0x00, 0x00, 0x00, 0x8c, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x00, 0x00, 0xc8, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x40, 0x0c, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00,
+  0xb0, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x3f, 0x00, 0x00, 0x00, 0xe0, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x38, 0x16, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00,
+  0x9c, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x00, 0x00, 0xa8, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0xb4, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0xc0, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x00, 0x00, 0xcc, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0xf0, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00,
+  0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
+  0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00,
+  0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00,
+  0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00,
+  0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x01, 0x00, 0x00,
+  0x20, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x30, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x30, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x50, 0x01, 0x00, 0x00,
+  0x50, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x60, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x70, 0x01, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x60, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x70, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00,
+  0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x90, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xa0, 0x01, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x90, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0xa0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xb0, 0x01, 0x00, 0x00,
+  0xb0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xc0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xd0, 0x01, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0xc0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0xd0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
+  0xe0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xf0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0xf0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x02, 0x00, 0x00,
+  0x10, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x20, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x30, 0x02, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x20, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x30, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00,
+  0x40, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x50, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x60, 0x02, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x50, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x60, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x70, 0x02, 0x00, 0x00,
+  0x70, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x80, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x90, 0x02, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x80, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x90, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xa0, 0x02, 0x00, 0x00,
+  0xa0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xb0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xc0, 0x02, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0xb0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0xc0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xd0, 0x02, 0x00, 0x00,
+  0xd0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xe0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf0, 0x02, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0xe0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0xf0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+  0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x03, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x10, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x20, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x30, 0x03, 0x00, 0x00,
+  0x30, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x40, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x50, 0x03, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x40, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x50, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x60, 0x03, 0x00, 0x00,
+  0x60, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x70, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x70, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x90, 0x03, 0x00, 0x00,
+  0x90, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xa0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xb0, 0x03, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0xa0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0xb0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xc0, 0x03, 0x00, 0x00,
+  0xc0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xd0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xe0, 0x03, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0xd0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0xe0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf0, 0x03, 0x00, 0x00,
+  0xf0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x04, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x04, 0x00, 0x00,
+  0x20, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x30, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x30, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x50, 0x04, 0x00, 0x00,
+  0x50, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x60, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x70, 0x04, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x60, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x70, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00,
+  0x80, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x90, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xa0, 0x04, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x90, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0xa0, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xb0, 0x04, 0x00, 0x00,
+  0xb0, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xc0, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xd0, 0x04, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0xc0, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0xd0, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xe0, 0x04, 0x00, 0x00,
+  0xe0, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xf0, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x20, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x30, 0x05, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x50, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x60, 0x05, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x70, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x80, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x90, 0x05, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xa0, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xb0, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xc0, 0x05, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xd0, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xe0, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf0, 0x05, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x06, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0xf0, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x05, 0x00, 0x00,
+  0x30, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x40, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x50, 0x06, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x20, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x30, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x05, 0x00, 0x00,
+  0x60, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x70, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x06, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x50, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x60, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x70, 0x05, 0x00, 0x00,
+  0x90, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xa0, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xb0, 0x06, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x80, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x90, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xa0, 0x05, 0x00, 0x00,
+  0xc0, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xd0, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xe0, 0x06, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0xb0, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0xc0, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xd0, 0x05, 0x00, 0x00,
+  0xf0, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x07, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0xe0, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0xf0, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00,
+  0x20, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x30, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x07, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x10, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x20, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x30, 0x06, 0x00, 0x00,
+  0x50, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x60, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x70, 0x07, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x40, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x50, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x60, 0x06, 0x00, 0x00,
+  0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x90, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xa0, 0x07, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x70, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x80, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x90, 0x06, 0x00, 0x00,
+  0xb0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xc0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xd0, 0x07, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0xa0, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0xb0, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xc0, 0x06, 0x00, 0x00,
+  0xe0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xf0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0xd0, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0xe0, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf0, 0x06, 0x00, 0x00,
+  0x10, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x30, 0x08, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x07, 0x00, 0x00,
+  0x40, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x50, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x60, 0x08, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x30, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x40, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x50, 0x07, 0x00, 0x00,
+  0x70, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x80, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x90, 0x08, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x1a, 0x1b, 0x1c, 0x1d, 0x00, 0x2e, 0x74, 0x65, 0x78, 0x74, 0x00, 0x2e,
-  0x72, 0x65, 0x6c, 0x2e, 0x42, 0x54, 0x46, 0x2e, 0x65, 0x78, 0x74, 0x00,
+  0xa0, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xb0, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xc0, 0x08, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xd0, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xe0, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf0, 0x08, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x09, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x30, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x40, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x50, 0x09, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x60, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x70, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x09, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x90, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xa0, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xb0, 0x09, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xc0, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xd0, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xe0, 0x09, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xf0, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x0a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x30, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x0a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x50, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x60, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x70, 0x0a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x90, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xa0, 0x0a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xb0, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xc0, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xd0, 0x0a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xe0, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xf0, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x20, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x30, 0x0b, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x50, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x60, 0x0b, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x70, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x80, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x90, 0x0b, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xa0, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xb0, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xc0, 0x0b, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xd0, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xe0, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf0, 0x0b, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x0c, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x30, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x40, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x50, 0x0c, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x60, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x70, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x0c, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x90, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xa0, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xb0, 0x0c, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xc0, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xd0, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xe0, 0x0c, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xf0, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x0d, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x30, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x0d, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x50, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x60, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x70, 0x0d, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x90, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xa0, 0x0d, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xb0, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xc0, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xd0, 0x0d, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xe0, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xf0, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x20, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x30, 0x0e, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x50, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x60, 0x0e, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x70, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x80, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x90, 0x0e, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xa0, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xb0, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xc0, 0x0e, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xd0, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xe0, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf0, 0x0e, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x0f, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x30, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x40, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x50, 0x0f, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x60, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x70, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x0f, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x90, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xa0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xb0, 0x0f, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xc0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xd0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xe0, 0x0f, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x30, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x50, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x60, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x70, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x90, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xa0, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xb0, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xc0, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xd0, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xe0, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xf0, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x20, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x30, 0x11, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x50, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x60, 0x11, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x70, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x80, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x90, 0x11, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xa0, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xb0, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xc0, 0x11, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xd0, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xe0, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf0, 0x11, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x12, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x30, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x40, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x50, 0x12, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x60, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x70, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x12, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x90, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xa0, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xb0, 0x12, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xc0, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xd0, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xe0, 0x12, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xf0, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x13, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x30, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x13, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x50, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x60, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x70, 0x13, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x90, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xa0, 0x13, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xb0, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xc0, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xd0, 0x13, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xe0, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xf0, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x20, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x30, 0x14, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x50, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x60, 0x14, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x70, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x80, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x90, 0x14, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xa0, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xb0, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xc0, 0x14, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xd0, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xe0, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf0, 0x14, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x15, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x30, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x40, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x50, 0x15, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x60, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x70, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x15, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x90, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xa0, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xb0, 0x15, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xc0, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xd0, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xe0, 0x15, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xf0, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x16, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x30, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x16, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x50, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x60, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x70, 0x16, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x90, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xa0, 0x16, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xb0, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xc0, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xd0, 0x16, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xe0, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xf0, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x20, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x30, 0x17, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x50, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x60, 0x17, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x70, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x80, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x90, 0x17, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xa0, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xb0, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xc0, 0x17, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xd0, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xe0, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf0, 0x17, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x18, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x30, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x40, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x50, 0x18, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x60, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x70, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x18, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x90, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xa0, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xb0, 0x18, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xc0, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xd0, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xe0, 0x18, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xf0, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x19, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x30, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x19, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x50, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x60, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x70, 0x19, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x90, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xa0, 0x19, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xb0, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xc0, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xd0, 0x19, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xe0, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xf0, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x20, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x30, 0x1a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x50, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x60, 0x1a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x70, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x80, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x90, 0x1a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xa0, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xb0, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xc0, 0x1a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xd0, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xe0, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf0, 0x1a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x1b, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x30, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x40, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x50, 0x1b, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x60, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x70, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x1b, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x90, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xa0, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xb0, 0x1b, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xc0, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xd0, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xe0, 0x1b, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xf0, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x1c, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x30, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x1c, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x50, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x60, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x70, 0x1c, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x90, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xa0, 0x1c, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xb0, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xc0, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xd0, 0x1c, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xe0, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xf0, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x20, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x30, 0x1d, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x50, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x60, 0x1d, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x70, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x80, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x90, 0x1d, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xa0, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xb0, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xc0, 0x1d, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xd0, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xe0, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf0, 0x1d, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x1e, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x30, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x40, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x50, 0x1e, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x60, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x70, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x1e, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x90, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xa0, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xb0, 0x1e, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xc0, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xd0, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xe0, 0x1e, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xf0, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x1f, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x30, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x1f, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x50, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x60, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x70, 0x1f, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x90, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xa0, 0x1f, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xb0, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xc0, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xd0, 0x1f, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xe0, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xf0, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x30, 0x20, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x40, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x50, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x60, 0x20, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x70, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x90, 0x20, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xa0, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xb0, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xc0, 0x20, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xd0, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xe0, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf0, 0x20, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x21, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x30, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x40, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x50, 0x21, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x70, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x21, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x90, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xa0, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xb0, 0x21, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xc0, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xd0, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xe0, 0x21, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xf0, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x22, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x30, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x22, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x50, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x60, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x70, 0x22, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x90, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x46, 0x47, 0x4b, 0x4c,
+  0x4a, 0x48, 0x49, 0x00, 0x2e, 0x74, 0x65, 0x78, 0x74, 0x00, 0x2e, 0x72,
+  0x65, 0x6c, 0x2e, 0x42, 0x54, 0x46, 0x2e, 0x65, 0x78, 0x74, 0x00, 0x6b,
+  0x65, 0x72, 0x6e, 0x65, 0x6c, 0x5f, 0x73, 0x74, 0x61, 0x74, 0x73, 0x00,
   0x2e, 0x6d, 0x61, 0x70, 0x73, 0x00, 0x2e, 0x72, 0x65, 0x6c, 0x78, 0x64,
   0x70, 0x00, 0x6f, 0x70, 0x74, 0x73, 0x5f, 0x6d, 0x61, 0x70, 0x00, 0x78,
-  0x73, 0x6b, 0x73, 0x5f, 0x6d, 0x61, 0x70, 0x00, 0x2e, 0x6c, 0x6c, 0x76,
-  0x6d, 0x5f, 0x61, 0x64, 0x64, 0x72, 0x73, 0x69, 0x67, 0x00, 0x5f, 0x6c,
-  0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x00, 0x78, 0x64, 0x70, 0x5f, 0x72,
-  0x65, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x5f, 0x64, 0x6e, 0x73, 0x5f,
-  0x66, 0x75, 0x6e, 0x63, 0x00, 0x2e, 0x73, 0x74, 0x72, 0x74, 0x61, 0x62,
-  0x00, 0x2e, 0x73, 0x79, 0x6d, 0x74, 0x61, 0x62, 0x00, 0x2e, 0x72, 0x65,
-  0x6c, 0x2e, 0x42, 0x54, 0x46, 0x00, 0x4c, 0x42, 0x42, 0x30, 0x5f, 0x39,
-  0x00, 0x4c, 0x42, 0x42, 0x30, 0x5f, 0x35, 0x38, 0x00, 0x4c, 0x42, 0x42,
-  0x30, 0x5f, 0x35, 0x37, 0x00, 0x4c, 0x42, 0x42, 0x30, 0x5f, 0x31, 0x37,
-  0x00, 0x4c, 0x42, 0x42, 0x30, 0x5f, 0x35, 0x36, 0x00, 0x4c, 0x42, 0x42,
-  0x30, 0x5f, 0x34, 0x36, 0x00, 0x4c, 0x42, 0x42, 0x30, 0x5f, 0x33, 0x36,
+  0x73, 0x6b, 0x73, 0x5f, 0x6d, 0x61, 0x70, 0x00, 0x61, 0x6e, 0x73, 0x77,
+  0x65, 0x72, 0x5f, 0x6d, 0x61, 0x70, 0x00, 0x62, 0x6c, 0x6f, 0x63, 0x6b,
+  0x5f, 0x6d, 0x61, 0x70, 0x00, 0x2e, 0x6c, 0x6c, 0x76, 0x6d, 0x5f, 0x61,
+  0x64, 0x64, 0x72, 0x73, 0x69, 0x67, 0x00, 0x5f, 0x6c, 0x69, 0x63, 0x65,
+  0x6e, 0x73, 0x65, 0x00, 0x78, 0x64, 0x70, 0x5f, 0x72, 0x65, 0x64, 0x69,
+  0x72, 0x65, 0x63, 0x74, 0x5f, 0x64, 0x6e, 0x73, 0x5f, 0x66, 0x75, 0x6e,
+  0x63, 0x00, 0x2e, 0x73, 0x74, 0x72, 0x74, 0x61, 0x62, 0x00, 0x2e, 0x73,
+  0x79, 0x6d, 0x74, 0x61, 0x62, 0x00, 0x2e, 0x72, 0x6f, 0x64, 0x61, 0x74,
+  0x61, 0x00, 0x2e, 0x72, 0x65, 0x6c, 0x2e, 0x42, 0x54, 0x46, 0x00, 0x4c,
+  0x42, 0x42, 0x30, 0x5f, 0x39, 0x00, 0x4c, 0x42, 0x42, 0x30, 0x5f, 0x38,
+  0x39, 0x00, 0x4c, 0x42, 0x42, 0x30, 0x5f, 0x31, 0x37, 0x39, 0x00, 0x4c,
+  0x42, 0x42, 0x30, 0x5f, 0x31, 0x34, 0x39, 0x00, 0x4c, 0x42, 0x42, 0x30,
+  0x5f, 0x31, 0x31, 0x39, 0x00, 0x4c, 0x42, 0x42, 0x30, 0x5f, 0x31, 0x30,
+  0x39, 0x00, 0x4c, 0x42, 0x42, 0x30, 0x5f, 0x39, 0x38, 0x00, 0x4c, 0x42,
+  0x42, 0x30, 0x5f, 0x31, 0x38, 0x38, 0x00, 0x4c, 0x42, 0x42, 0x30, 0x5f,
+  0x31, 0x35, 0x38, 0x00, 0x4c, 0x42, 0x42, 0x30, 0x5f, 0x31, 0x32, 0x38,
+  0x00, 0x4c, 0x42, 0x42, 0x30, 0x5f, 0x31, 0x31, 0x38, 0x00, 0x4c, 0x42,
+  0x42, 0x30, 0x5f, 0x31, 0x38, 0x37, 0x00, 0x4c, 0x42, 0x42, 0x30, 0x5f,
+  0x31, 0x37, 0x37, 0x00, 0x4c, 0x42, 0x42, 0x30, 0x5f, 0x31, 0x36, 0x37,
+  0x00, 0x4c, 0x42, 0x42, 0x30, 0x5f, 0x35, 0x37, 0x00, 0x4c, 0x42, 0x42,
+  0x30, 0x5f, 0x31, 0x35, 0x37, 0x00, 0x4c, 0x42, 0x42, 0x30, 0x5f, 0x34,
+  0x37, 0x00, 0x4c, 0x42, 0x42, 0x30, 0x5f, 0x33, 0x37, 0x00, 0x4c, 0x42,
+  0x42, 0x30, 0x5f, 0x31, 0x37, 0x00, 0x4c, 0x42, 0x42, 0x30, 0x5f, 0x31,
+  0x31, 0x37, 0x00, 0x4c, 0x42, 0x42, 0x30, 0x5f, 0x31, 0x37, 0x36, 0x00,
+  0x4c, 0x42, 0x42, 0x30, 0x5f, 0x35, 0x36, 0x00, 0x4c, 0x42, 0x42, 0x30,
+  0x5f, 0x34, 0x36, 0x00, 0x4c, 0x42, 0x42, 0x30, 0x5f, 0x31, 0x33, 0x36,
   0x00, 0x4c, 0x42, 0x42, 0x30, 0x5f, 0x31, 0x36, 0x00, 0x4c, 0x42, 0x42,
-  0x30, 0x5f, 0x35, 0x35, 0x00, 0x4c, 0x42, 0x42, 0x30, 0x5f, 0x34, 0x35,
+  0x30, 0x5f, 0x31, 0x31, 0x36, 0x00, 0x4c, 0x42, 0x42, 0x30, 0x5f, 0x36,
+  0x35, 0x00, 0x4c, 0x42, 0x42, 0x30, 0x5f, 0x31, 0x36, 0x35, 0x00, 0x4c,
+  0x42, 0x42, 0x30, 0x5f, 0x35, 0x35, 0x00, 0x4c, 0x42, 0x42, 0x30, 0x5f,
+  0x31, 0x33, 0x35, 0x00, 0x4c, 0x42, 0x42, 0x30, 0x5f, 0x31, 0x30, 0x35,
   0x00, 0x4c, 0x42, 0x42, 0x30, 0x5f, 0x34, 0x00, 0x4c, 0x42, 0x42, 0x30,
-  0x5f, 0x35, 0x34, 0x00, 0x4c, 0x42, 0x42, 0x30, 0x5f, 0x32, 0x33, 0x00,
-  0x4c, 0x42, 0x42, 0x30, 0x5f, 0x34, 0x30, 0x00, 0x4c, 0x42, 0x42, 0x30,
-  0x5f, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x5f, 0x31, 0x39, 0x34, 0x00, 0x4c, 0x42, 0x42, 0x30, 0x5f, 0x38, 0x34,
+  0x00, 0x4c, 0x42, 0x42, 0x30, 0x5f, 0x31, 0x38, 0x34, 0x00, 0x4c, 0x42,
+  0x42, 0x30, 0x5f, 0x31, 0x37, 0x34, 0x00, 0x4c, 0x42, 0x42, 0x30, 0x5f,
+  0x36, 0x34, 0x00, 0x4c, 0x42, 0x42, 0x30, 0x5f, 0x32, 0x34, 0x00, 0x4c,
+  0x42, 0x42, 0x30, 0x5f, 0x31, 0x31, 0x34, 0x00, 0x4c, 0x42, 0x42, 0x30,
+  0x5f, 0x31, 0x39, 0x33, 0x00, 0x4c, 0x42, 0x42, 0x30, 0x5f, 0x31, 0x37,
+  0x33, 0x00, 0x4c, 0x42, 0x42, 0x30, 0x5f, 0x36, 0x33, 0x00, 0x4c, 0x42,
+  0x42, 0x30, 0x5f, 0x31, 0x35, 0x33, 0x00, 0x4c, 0x42, 0x42, 0x30, 0x5f,
+  0x31, 0x33, 0x33, 0x00, 0x4c, 0x42, 0x42, 0x30, 0x5f, 0x32, 0x33, 0x00,
+  0x4c, 0x42, 0x42, 0x30, 0x5f, 0x31, 0x31, 0x33, 0x00, 0x4c, 0x42, 0x42,
+  0x30, 0x5f, 0x37, 0x32, 0x00, 0x4c, 0x42, 0x42, 0x30, 0x5f, 0x31, 0x39,
+  0x31, 0x00, 0x4c, 0x42, 0x42, 0x30, 0x5f, 0x31, 0x38, 0x31, 0x00, 0x4c,
+  0x42, 0x42, 0x30, 0x5f, 0x31, 0x37, 0x31, 0x00, 0x4c, 0x42, 0x42, 0x30,
+  0x5f, 0x34, 0x31, 0x00, 0x4c, 0x42, 0x42, 0x30, 0x5f, 0x33, 0x31, 0x00,
+  0x4c, 0x42, 0x42, 0x30, 0x5f, 0x31, 0x31, 0x31, 0x00, 0x4c, 0x42, 0x42,
+  0x30, 0x5f, 0x39, 0x30, 0x00, 0x4c, 0x42, 0x42, 0x30, 0x5f, 0x31, 0x39,
+  0x30, 0x00, 0x4c, 0x42, 0x42, 0x30, 0x5f, 0x37, 0x30, 0x00, 0x4c, 0x42,
+  0x42, 0x30, 0x5f, 0x31, 0x35, 0x30, 0x00, 0x4c, 0x42, 0x42, 0x30, 0x5f,
+  0x31, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x61, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x83, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xc4, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00,
+  0xaf, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0x02, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
@@ -883,59 +3455,65 @@ unsigned char bpf_kernel_o[] = {
   0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00,
   0x01, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x98, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x1a, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x27, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x40, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x78, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
   0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
   0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x40, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xd8, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00,
   0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x09, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x2e, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x75, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x93, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x84, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x0d, 0x00, 0x00,
+  0x84, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x60, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
-  0x07, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0x16, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x60, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x9f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x07, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x98, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xf4, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9b, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0x7b, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x8c, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x22, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x90, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x07, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
-  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x03, 0x4c, 0xff, 0x6f,
-  0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xc0, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x1e, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xf8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x38, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x70, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00,
+  0x03, 0x4c, 0xff, 0x6f, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x9e, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x8b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x30, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x06, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00
 };
-unsigned int bpf_kernel_o_len = 11256;
+unsigned int bpf_kernel_o_len = 42184;
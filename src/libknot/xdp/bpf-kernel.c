@@ -28,6 +28,10 @@
 
 /* Don't fragment flag. */
 #define	IP_DF		0x4000
+/* More fragments flag. */
+#define	IP_MF		0x2000
+/* Fragment offset mask. */
+#define	IP_OFFSET	0x1fff
 
 #define AF_INET		2
 #define AF_INET6	10
@@ -35,6 +39,23 @@
 /* Define maximum reasonable number of NIC queues supported. */
 #define QUEUE_MAX	256
 
+/* Define maximum number of pre-built answers. */
+#define ANSWER_MAX	1024
+
+/* Define maximum number of blocked client prefixes. */
+#define BLOCK_MAX	65536
+
+/* DNS constants not available in the kernel headers. */
+#define DNS_HDR_LEN	12
+#define DNS_CLASS_IN	1
+#define DNS_TYPE_OPT	41
+#define DNS_DEF_TTL	64
+
+/* Results of the answer fast-path. */
+#define ANSWER_PASS	-1 /* Not answered, the packet is untouched. */
+#define ANSWER_TX	0  /* Answered, the packet is the response. */
+#define ANSWER_DROP	1  /* Failed after the packet was modified. */
+
 /* A map of configuration options. */
 struct {
 	__uint(type, BPF_MAP_TYPE_ARRAY);
@@ -51,11 +72,468 @@ struct {
 	__uint(value_size, sizeof(int));
 } xsks_map SEC(".maps");
 
+/* A map of pre-built answers. */
+struct {
+	__uint(type, BPF_MAP_TYPE_HASH);
+	__uint(max_entries, ANSWER_MAX);
+	__uint(key_size, sizeof(knot_xdp_answer_key_t));
+	__uint(value_size, sizeof(knot_xdp_answer_t));
+} answer_map SEC(".maps");
+
+/* A map of blocked client prefixes. */
+struct {
+	__uint(type, BPF_MAP_TYPE_LPM_TRIE);
+	__uint(max_entries, BLOCK_MAX);
+	__uint(map_flags, BPF_F_NO_PREALLOC);
+	__uint(key_size, sizeof(knot_xdp_block_key_t));
+	__uint(value_size, sizeof(knot_xdp_block_t));
+} block_map SEC(".maps");
+
+/* A map of fast-path counters. */
+struct {
+	__uint(type, BPF_MAP_TYPE_ARRAY);
+	__uint(max_entries, QUEUE_MAX);
+	__uint(key_size, sizeof(__u32)); /* Must be 4 bytes. */
+	__uint(value_size, sizeof(knot_xdp_kernel_stats_t));
+} kernel_stats SEC(".maps");
+
 struct ipv6_frag_hdr {
 	unsigned char nexthdr;
 	unsigned char whatever[7];
 } __attribute__((packed));
 
+static __always_inline __u16 load16(const void *ptr)
+{
+	__u16 val;
+	__builtin_memcpy(&val, ptr, sizeof(val));
+	return val;
+}
+
+static __always_inline void store16(void *ptr, __u16 val)
+{
+	__builtin_memcpy(ptr, &val, sizeof(val));
+}
+
+static __always_inline __u16 csum_fold(__u32 sum)
+{
+	sum = (sum & 0xffff) + (sum >> 16);
+	return (sum & 0xffff) + (sum >> 16);
+}
+
+/* A partial sum of data placed at an odd offset contributes byte-swapped. */
+static __always_inline __u16 csum_at(__u16 sum, __u32 offset)
+{
+	return (offset & 1) ? (__u16)((sum << 8) | (sum >> 8)) : sum;
+}
+
+/*
+ * Check a standard query with one question and possibly an OPT record and copy
+ * its lower-cased QNAME and QTYPE into the key. Returns the offset of the end
+ * of the question or 0 if not suitable.
+ */
+static __always_inline __u32 parse_query(__u8 *dns, const void *data_end,
+                                         knot_xdp_answer_key_t *key)
+{
+	if ((void *)dns + DNS_HDR_LEN > data_end) {
+		return 0;
+	}
+
+	__u16 arcount = load16(dns + 10);
+	if ((dns[2] & 0xf8) != 0 || /* QR and OPCODE */
+	    load16(dns + 4) != __constant_htons(1) ||
+	    load16(dns + 6) != 0 || load16(dns + 8) != 0 ||
+	    (arcount != 0 && arcount != __constant_htons(1))) {
+		return 0;
+	}
+
+	__builtin_memset(key, 0, sizeof(*key));
+
+	__u32 qlen = 0;
+	__u32 label = 0;
+	for (__u32 i = 0; i < KNOT_XDP_ANSWER_QNAME_MAX; i++) {
+		__u8 *pos = dns + DNS_HDR_LEN + i;
+		if ((void *)pos + 1 > data_end) {
+			return 0;
+		}
+		__u8 c = *pos;
+		if (i == label) {
+			if (c == 0) {
+				qlen = i + 1;
+				break;
+			} else if (c & 0xc0) {
+				return 0;
+			}
+			label = i + 1 + c;
+		} else if (c >= 'A' && c <= 'Z') {
+			c |= 0x20;
+		}
+		key->qname[i] = c;
+	}
+	if (qlen == 0) {
+		return 0;
+	}
+
+	__u8 *qtype = dns + DNS_HDR_LEN + qlen;
+	if ((void *)qtype + 2 * sizeof(__u16) > data_end ||
+	    load16(qtype + 2) != __constant_htons(DNS_CLASS_IN)) {
+		return 0;
+	}
+	key->qtype = load16(qtype);
+
+	return DNS_HDR_LEN + qlen + 2 * sizeof(__u16);
+}
+
+/*
+ * Turn the (already resized) packet headers into reply ones: swap the MAC
+ * addresses, IP addresses, and UDP ports, and set the lengths.
+ */
+static __always_inline int reply_headers(struct xdp_md *ctx, __u32 l3_off, __u32 l4_off,
+                                         __u8 ipv4, __u32 udp_len)
+{
+	void *data = (void *)(long)ctx->data;
+	const void *data_end = (void *)(long)ctx->data_end;
+
+	struct ethhdr *eth_hdr = data;
+	if ((void *)eth_hdr + sizeof(*eth_hdr) > data_end) {
+		return -1;
+	}
+	__u8 mac[ETH_ALEN];
+	__builtin_memcpy(mac, eth_hdr->h_dest, ETH_ALEN);
+	__builtin_memcpy(eth_hdr->h_dest, eth_hdr->h_source, ETH_ALEN);
+	__builtin_memcpy(eth_hdr->h_source, mac, ETH_ALEN);
+
+	if (ipv4) {
+		struct iphdr *ip4 = data + l3_off;
+		if ((void *)ip4 + sizeof(*ip4) > data_end) {
+			return -1;
+		}
+		__be32 addr = ip4->saddr;
+		ip4->saddr = ip4->daddr;
+		ip4->daddr = addr;
+		ip4->tot_len = __bpf_htons(sizeof(*ip4) + udp_len);
+		ip4->ttl = DNS_DEF_TTL;
+		ip4->check = 0;
+
+		__u32 sum = 0;
+		const __u16 *word = (const __u16 *)ip4;
+		for (__u32 i = 0; i < sizeof(*ip4) / sizeof(__u16); i++) {
+			sum += load16(word + i);
+		}
+		ip4->check = ~csum_fold(sum);
+	} else {
+		struct ipv6hdr *ip6 = data + l3_off;
+		if ((void *)ip6 + sizeof(*ip6) > data_end) {
+			return -1;
+		}
+		struct in6_addr addr = ip6->saddr;
+		ip6->saddr = ip6->daddr;
+		ip6->daddr = addr;
+		ip6->payload_len = __bpf_htons(udp_len);
+		ip6->hop_limit = DNS_DEF_TTL;
+	}
+
+	struct udphdr *udp = data + l4_off;
+	if ((void *)udp + sizeof(*udp) > data_end) {
+		return -1;
+	}
+	__be16 port = udp->source;
+	udp->source = udp->dest;
+	udp->dest = port;
+	udp->len = __bpf_htons(udp_len);
+
+	return 0;
+}
+
+/*
+ * Rewrite a standard query without DO bit and EDNS options into the pre-built
+ * response from the answer map. The UDP checksum is updated incrementally as
+ * the addresses and ports are just swapped and the question is kept.
+ */
+static __always_inline int answer(struct xdp_md *ctx, __u32 l3_off, __u32 l4_off,
+                                  __u8 ipv4)
+{
+	void *data = (void *)(long)ctx->data;
+	void *data_end = (void *)(long)ctx->data_end;
+
+	/* Bound the offset for the verifier (Ethernet + VLAN + IPv6 headers). */
+	if (l4_off > 64) {
+		return ANSWER_PASS;
+	}
+
+	struct udphdr *udp = data + l4_off;
+	__u8 *dns = (void *)(udp + 1);
+	if ((void *)dns > data_end) {
+		return ANSWER_PASS;
+	}
+
+	knot_xdp_answer_key_t key;
+	__u32 q_end = parse_query(dns, data_end, &key);
+	if (q_end == 0 || q_end > DNS_HDR_LEN + KNOT_XDP_ANSWER_QNAME_MAX + 2 * sizeof(__u16)) {
+		return ANSWER_PASS;
+	}
+	__u16 arcount = load16(dns + 10);
+
+	/* Check the OPT record (no options, no DO bit) and its checksum part. */
+	__u32 opt_len = 0;
+	__u16 opt_sum = 0;
+	if (arcount != 0) {
+		__u8 *opt = dns + q_end;
+		if ((void *)opt + KNOT_XDP_ANSWER_OPT_LEN > data_end) {
+			return ANSWER_PASS;
+		}
+		if (opt[0] != 0 || load16(opt + 1) != __constant_htons(DNS_TYPE_OPT) ||
+		    opt[5] != 0 || opt[6] != 0 || (opt[7] & 0x80) ||
+		    load16(opt + 9) != 0) {
+			return ANSWER_PASS;
+		}
+		__u8 last[2] = { opt[10], 0 };
+		__u32 sum = load16(opt) + load16(opt + 2) + load16(opt + 4) +
+		            load16(opt + 6) + load16(opt + 8) + load16(last);
+		opt_sum = csum_at(csum_fold(sum), sizeof(*udp) + q_end);
+		opt_len = KNOT_XDP_ANSWER_OPT_LEN;
+	}
+
+	/* No trailing data allowed. */
+	if (__bpf_ntohs(udp->len) != sizeof(*udp) + q_end + opt_len) {
+		return ANSWER_PASS;
+	}
+
+	/* The checksum is mandatory for IPv6. */
+	__u16 check = udp->check;
+	if (!ipv4 && check == 0) {
+		return ANSWER_PASS;
+	}
+
+	__u32 index = ctx->rx_queue_index;
+	knot_xdp_kernel_stats_t *stats = bpf_map_lookup_elem(&kernel_stats, &index);
+
+	knot_xdp_answer_t *ans = bpf_map_lookup_elem(&answer_map, &key);
+	if (!ans) {
+		if (stats) {
+			__sync_fetch_and_add(&stats->missed, 1);
+		}
+		return ANSWER_PASS;
+	}
+
+	__u32 len = ans->len;
+	if (len < KNOT_XDP_ANSWER_OPT_LEN || len > KNOT_XDP_ANSWER_DATA_MAX) {
+		return ANSWER_PASS;
+	}
+	__u32 rr_len = len - KNOT_XDP_ANSWER_OPT_LEN;
+	__u32 udp_len = sizeof(*udp) + q_end + rr_len + opt_len;
+
+	__u16 old_udp_len = udp->len;
+	__u16 old_flags = load16(dns + 2);
+
+	/* Resize the packet, this invalidates all the packet pointers. */
+	int delta = (int)(l4_off + udp_len) - (int)(data_end - data);
+	if (bpf_xdp_adjust_tail(ctx, delta) != 0) {
+		return ANSWER_PASS;
+	}
+
+	if (reply_headers(ctx, l3_off, l4_off, ipv4, udp_len) != 0) {
+		return ANSWER_DROP;
+	}
+
+	data = (void *)(long)ctx->data;
+	data_end = (void *)(long)ctx->data_end;
+
+	udp = data + l4_off;
+	dns = (void *)(udp + 1);
+	if ((void *)dns + q_end > data_end) {
+		return ANSWER_DROP;
+	}
+
+	/* QR, AA, copied RD. */
+	dns[2] = 0x84 | (dns[2] & 0x01);
+	dns[3] = ans->rcode;
+	store16(dns + 6, ans->ancount);
+	store16(dns + 8, ans->nscount);
+	store16(dns + 10, opt_len > 0 ? __bpf_htons(__bpf_ntohs(ans->arcount) + 1) :
+	                                ans->arcount);
+
+	__u8 *dst = dns + q_end;
+	for (__u32 i = 0; i < KNOT_XDP_ANSWER_DATA_MAX; i++) {
+		if (i >= rr_len) {
+			break;
+		}
+		if ((void *)dst + i + 1 > data_end) {
+			return ANSWER_DROP;
+		}
+		dst[i] = ans->data[i];
+	}
+	for (__u32 i = 0; i < opt_len; i++) {
+		__u32 pos = rr_len + i;
+		if (pos >= KNOT_XDP_ANSWER_DATA_MAX || (void *)dst + pos + 1 > data_end) {
+			return ANSWER_DROP;
+		}
+		dst[pos] = ans->data[pos];
+	}
+
+	/* Zero checksum means no checksum over IPv4. */
+	if (check != 0) {
+		__u32 sum = (__u16)~check;
+		/* The UDP length is both in the pseudo-header and the header. */
+		sum += 2 * (__u32)(__u16)~old_udp_len + 2 * (__u32)udp->len;
+		sum += (__u16)~old_flags + load16(dns + 2);
+		sum += (__u16)~arcount + load16(dns + 10);
+		sum += load16(dns + 6) + load16(dns + 8);
+		sum += csum_at(ans->csum, sizeof(*udp) + q_end);
+		if (opt_len > 0) {
+			sum += (__u16)~opt_sum;
+			sum += csum_at(ans->opt_csum, sizeof(*udp) + q_end + rr_len);
+		}
+		check = ~csum_fold(sum);
+		udp->check = (check == 0) ? 0xffff : check;
+	}
+
+	if (stats) {
+		__sync_fetch_and_add(&stats->answered, 1);
+	}
+
+	return ANSWER_TX;
+}
+
+/*
+ * Rewrite a query into an empty response with TC bit set, keeping just the
+ * question. The UDP checksum is computed from scratch as the message is short.
+ */
+static __always_inline int slip_reply(struct xdp_md *ctx, __u32 l3_off, __u32 l4_off,
+                                      __u8 ipv4)
+{
+	void *data = (void *)(long)ctx->data;
+	void *data_end = (void *)(long)ctx->data_end;
+
+	if (l4_off > 64) {
+		return ANSWER_PASS;
+	}
+
+	struct udphdr *udp = data + l4_off;
+	__u8 *dns = (void *)(udp + 1);
+	if ((void *)dns > data_end) {
+		return ANSWER_PASS;
+	}
+
+	knot_xdp_answer_key_t key;
+	__u32 q_end = parse_query(dns, data_end, &key);
+	if (q_end == 0 || q_end > DNS_HDR_LEN + KNOT_XDP_ANSWER_QNAME_MAX + 2 * sizeof(__u16)) {
+		return ANSWER_PASS;
+	}
+	__u32 udp_len = sizeof(*udp) + q_end;
+
+	int delta = (int)(l4_off + udp_len) - (int)(data_end - data);
+	if (bpf_xdp_adjust_tail(ctx, delta) != 0) {
+		return ANSWER_PASS;
+	}
+
+	if (reply_headers(ctx, l3_off, l4_off, ipv4, udp_len) != 0) {
+		return ANSWER_DROP;
+	}
+
+	data = (void *)(long)ctx->data;
+	data_end = (void *)(long)ctx->data_end;
+
+	udp = data + l4_off;
+	dns = (void *)(udp + 1);
+	if ((void *)dns + DNS_HDR_LEN > data_end) {
+		return ANSWER_DROP;
+	}
+
+	/* QR, TC, copied RD. */
+	dns[2] = 0x82 | (dns[2] & 0x01);
+	dns[3] = 0;
+	store16(dns + 6, 0);
+	store16(dns + 8, 0);
+	store16(dns + 10, 0);
+
+	/* Zero checksum means no checksum over IPv4. */
+	udp->check = 0;
+	if (!ipv4) {
+		struct ipv6hdr *ip6 = data + l3_off;
+		if ((void *)ip6 + sizeof(*ip6) > data_end) {
+			return ANSWER_DROP;
+		}
+
+		/* Pseudo-header: addresses, length, next header. */
+		__u32 sum = __bpf_htons(udp_len) + __constant_htons(IPPROTO_UDP);
+		const __u16 *addr = (const __u16 *)&ip6->saddr;
+		for (__u32 i = 0; i < 2 * sizeof(struct in6_addr) / sizeof(__u16); i++) {
+			sum += load16(addr + i);
+		}
+
+		const __u8 *pos = (const __u8 *)udp;
+		for (__u32 i = 0; i < sizeof(*udp) + DNS_HDR_LEN + KNOT_XDP_ANSWER_QNAME_MAX +
+		                      2 * sizeof(__u16); i += 2) {
+			if (i >= udp_len || (void *)pos + i + 1 > data_end) {
+				break;
+			}
+			__u8 word[2] = { pos[i], 0 };
+			if (i + 1 < udp_len) {
+				if ((void *)pos + i + 2 > data_end) {
+					return ANSWER_DROP;
+				}
+				word[1] = pos[i + 1];
+			}
+			sum += load16(word);
+		}
+
+		__u16 check = ~csum_fold(sum);
+		udp->check = (check == 0) ? 0xffff : check;
+	}
+
+	return ANSWER_TX;
+}
+
+/* Drop or slip a query from a blocked client prefix. */
+static __always_inline int block(struct xdp_md *ctx, __u32 l3_off, __u32 l4_off,
+                                 __u8 ipv4)
+{
+	void *data = (void *)(long)ctx->data;
+	const void *data_end = (void *)(long)ctx->data_end;
+
+	if (l3_off > 32) {
+		return ANSWER_PASS;
+	}
+
+	knot_xdp_block_key_t key = { .prefixlen = 8 * sizeof(key.addr) };
+	if (ipv4) {
+		const struct iphdr *ip4 = data + l3_off;
+		if ((void *)ip4 + sizeof(*ip4) > data_end) {
+			return ANSWER_PASS;
+		}
+		key.addr[10] = key.addr[11] = 0xff; /* IPv4-mapped IPv6 address. */
+		__builtin_memcpy(key.addr + 12, &ip4->saddr, sizeof(ip4->saddr));
+	} else {
+		const struct ipv6hdr *ip6 = data + l3_off;
+		if ((void *)ip6 + sizeof(*ip6) > data_end) {
+			return ANSWER_PASS;
+		}
+		__builtin_memcpy(key.addr, &ip6->saddr, sizeof(ip6->saddr));
+	}
+
+	knot_xdp_block_t *blk = bpf_map_lookup_elem(&block_map, &key);
+	if (!blk || blk->expire <= bpf_ktime_get_ns()) {
+		return ANSWER_PASS;
+	}
+	__u16 slip = blk->slip;
+
+	__u32 index = ctx->rx_queue_index;
+	knot_xdp_kernel_stats_t *stats = bpf_map_lookup_elem(&kernel_stats, &index);
+
+	if (slip > 0 && bpf_get_prandom_u32() % slip == 0 &&
+	    slip_reply(ctx, l3_off, l4_off, ipv4) == ANSWER_TX) {
+		if (stats) {
+			__sync_fetch_and_add(&stats->slipped, 1);
+		}
+		return ANSWER_TX;
+	}
+
+	if (stats) {
+		__sync_fetch_and_add(&stats->dropped, 1);
+	}
+	return ANSWER_DROP;
+}
+
 SEC("xdp")
 int xdp_redirect_dns_func(struct xdp_md *ctx)
 {
@@ -94,6 +572,8 @@ int xdp_redirect_dns_func(struct xdp_md *ctx)
 	__u8 ip_proto;
 	__u8 fragmented = 0;
 	__u16 eth_type; /* In big endian. */
+	__u32 l3_off = sizeof(*eth_hdr);
+	__u32 l4_off;
 
 	/* Parse Ethernet header. */
 	if ((void *)eth_hdr + sizeof(*eth_hdr) > data_end) {
@@ -110,6 +590,7 @@ int xdp_redirect_dns_func(struct xdp_md *ctx)
 		}
 		__builtin_memcpy(&eth_type, data + sizeof(__u16), sizeof(eth_type));
 		data += sizeof(__u16) + sizeof(eth_type);
+		l3_off += sizeof(__u16) + sizeof(eth_type);
 	} else {
 		eth_type = eth_hdr->h_proto;
 	}
@@ -139,6 +620,7 @@ int xdp_redirect_dns_func(struct xdp_md *ctx)
 		}
 		ip_proto = ip4->protocol;
 		l4_hdr = data + ip4->ihl * 4;
+		l4_off = l3_off + ip4->ihl * 4;
 		ipv4 = 1;
 		break;
 	case __constant_htons(ETH_P_IPV6):
@@ -168,6 +650,7 @@ int xdp_redirect_dns_func(struct xdp_md *ctx)
 			data += sizeof(*frag);
 		}
 		l4_hdr = data;
+		l4_off = l3_off + sizeof(*ip6) + (fragmented ? sizeof(struct ipv6_frag_hdr) : 0);
 		ipv4 = 0;
 		break;
 	default:
@@ -286,6 +769,38 @@ int xdp_redirect_dns_func(struct xdp_md *ctx)
 		}
 	}
 
+	/* Only unfragmented UDP queries without IPv4 options or IPv6 extension
+	 * headers are handled in the fast-paths, anything else is left to user space. */
+	const __u8 fast_path = ip_proto == IPPROTO_UDP && port_dest == opts.udp_port &&
+	                       !fragmented &&
+	                       (ipv4 ? (ip4->ihl == 5 &&
+	                                (ip4->frag_off & __constant_htons(IP_MF | IP_OFFSET)) == 0)
+	                             : ip6->nexthdr == IPPROTO_UDP);
+
+	/* Drop or slip the query if the client is blocked. */
+	if ((opts.flags & KNOT_XDP_FILTER_BLOCK) && fast_path) {
+		switch (block(ctx, l3_off, l4_off, ipv4)) {
+		case ANSWER_TX:
+			return XDP_TX;
+		case ANSWER_DROP:
+			return XDP_DROP;
+		default:
+			break;
+		}
+	}
+
+	/* Answer the query directly if there is a pre-built response. */
+	if ((opts.flags & KNOT_XDP_FILTER_ANSWER) && fast_path) {
+		switch (answer(ctx, l3_off, l4_off, ipv4)) {
+		case ANSWER_TX:
+			return XDP_TX;
+		case ANSWER_DROP:
+			return XDP_DROP;
+		default:
+			break;
+		}
+	}
+
 	/* Forward the packet to user space. */
 	return bpf_redirect_map(&xsks_map, ctx->rx_queue_index, 0);
 }
@@ -15,6 +15,7 @@
  */
 
 #include <bpf/bpf.h>
+#include <errno.h>
 #include <linux/if_link.h>
 #include <net/if.h>
 #include <stdlib.h>
@@ -28,14 +29,16 @@
 #include "libknot/xdp/eth.h"
 #include "contrib/openbsd/strlcpy.h"
 
-#define NO_BPF_MAPS	2
+#define NO_BPF_MAPS	5
+
+#define BLOCK_SWEEP_BATCH	256
 
 static inline bool IS_ERR_OR_NULL(const void *ptr)
 {
 	return (ptr == NULL) || (unsigned long)ptr >= (unsigned long)-4095;
 }
 
-static int prog_load(struct bpf_object **pobj, int *prog_fd)
+static int prog_load(struct bpf_object **pobj, int *prog_fd, bool frags)
 {
 	struct bpf_program *prog, *first_prog = NULL;
 	struct bpf_object *obj;
@@ -47,6 +50,15 @@ static int prog_load(struct bpf_object **pobj, int *prog_fd)
 
 	bpf_object__for_each_program(prog, obj) {
 		bpf_program__set_type(prog, BPF_PROG_TYPE_XDP);
+		if (frags) {
+#ifdef BPF_F_XDP_HAS_FRAGS
+			// The program only parses headers in the first buffer.
+			bpf_program__set_flags(prog, bpf_program__flags(prog) | BPF_F_XDP_HAS_FRAGS);
+#else
+			bpf_object__close(obj);
+			return KNOT_ENOTSUP;
+#endif
+		}
 		if (first_prog == NULL) {
 			first_prog = prog;
 		}
@@ -69,7 +81,8 @@ static int prog_load(struct bpf_object **pobj, int *prog_fd)
 	return KNOT_EOK;
 }
 
-static int ensure_prog(struct kxsk_iface *iface, bool overwrite, bool generic_xdp)
+static int ensure_prog(struct kxsk_iface *iface, bool overwrite, bool generic_xdp,
+                       bool frags)
 {
 	if (bpf_kernel_o_len < 2) {
 		return KNOT_ENOTSUP;
@@ -78,8 +91,10 @@ static int ensure_prog(struct kxsk_iface *iface, bool overwrite, bool generic_xd
 	/* Use libbpf for extracting BPF byte-code from BPF-ELF object, and
 	 * loading this into the kernel via bpf-syscall. */
 	int prog_fd;
-	int ret = prog_load(&iface->prog_obj, &prog_fd);
-	if (ret != KNOT_EOK) {
+	int ret = prog_load(&iface->prog_obj, &prog_fd, frags);
+	if (ret == KNOT_ENOTSUP) {
+		return ret;
+	} else if (ret != KNOT_EOK) {
 		return KNOT_EPROGRAM;
 	}
 
@@ -125,11 +140,23 @@ static void unget_bpf_maps(struct kxsk_iface *iface)
 	if (iface->xsks_map_fd >= 0) {
 		close(iface->xsks_map_fd);
 	}
+	if (iface->answer_map_fd >= 0) {
+		close(iface->answer_map_fd);
+	}
+	if (iface->block_map_fd >= 0) {
+		close(iface->block_map_fd);
+	}
+	if (iface->stats_map_fd >= 0) {
+		close(iface->stats_map_fd);
+	}
 	iface->opts_map_fd = iface->xsks_map_fd = -1;
+	iface->answer_map_fd = iface->block_map_fd = iface->stats_map_fd = -1;
 }
 
 /*!
- * /brief Get FDs for the two maps and assign them into xsk_info-> fields.
+ * /brief Get FDs for the maps and assign them into xsk_info-> fields.
+ *
+ * The fast-path maps are optional as a previously loaded program may lack them.
  *
  * Inspired by xsk_lookup_bpf_maps() from libbpf before qidconf_map elimination.
  */
@@ -176,6 +203,21 @@ static int get_bpf_maps(int prog_fd, struct kxsk_iface *iface)
 			continue;
 		}
 
+		if (strcmp(map_info.name, "answer_map") == 0) {
+			iface->answer_map_fd = fd;
+			continue;
+		}
+
+		if (strcmp(map_info.name, "block_map") == 0) {
+			iface->block_map_fd = fd;
+			continue;
+		}
+
+		if (strcmp(map_info.name, "kernel_stats") == 0) {
+			iface->stats_map_fd = fd;
+			continue;
+		}
+
 		close(fd);
 	}
 
@@ -228,8 +270,93 @@ void kxsk_socket_stop(const struct kxsk_iface *iface)
 	(void)bpf_map_delete_elem(iface->xsks_map_fd, &iface->if_queue);
 }
 
+int kxsk_answer_update(const struct kxsk_iface *iface, const knot_xdp_answer_key_t *key,
+                       const knot_xdp_answer_t *answer)
+{
+	if (iface == NULL || key == NULL) {
+		return KNOT_EINVAL;
+	} else if (iface->answer_map_fd < 0) {
+		return KNOT_ENOTSUP;
+	}
+
+	int ret;
+	if (answer != NULL) {
+		ret = bpf_map_update_elem(iface->answer_map_fd, key, answer, 0);
+	} else {
+		ret = bpf_map_delete_elem(iface->answer_map_fd, key);
+		if (ret != 0 && errno == ENOENT) {
+			ret = 0;
+		}
+	}
+
+	return (ret == 0) ? KNOT_EOK : knot_map_errno();
+}
+
+int kxsk_kernel_stats(const struct kxsk_iface *iface, knot_xdp_kernel_stats_t *stats)
+{
+	if (iface == NULL || stats == NULL) {
+		return KNOT_EINVAL;
+	} else if (iface->stats_map_fd < 0) {
+		return KNOT_ENOTSUP;
+	}
+
+	int ret = bpf_map_lookup_elem(iface->stats_map_fd, &iface->if_queue, stats);
+	return (ret == 0) ? KNOT_EOK : knot_map_errno();
+}
+
+int kxsk_block_update(const struct kxsk_iface *iface, const knot_xdp_block_key_t *key,
+                      const knot_xdp_block_t *block)
+{
+	if (iface == NULL || key == NULL || block == NULL) {
+		return KNOT_EINVAL;
+	} else if (iface->block_map_fd < 0) {
+		return KNOT_ENOTSUP;
+	}
+
+	int ret = bpf_map_update_elem(iface->block_map_fd, key, block, 0);
+	return (ret == 0) ? KNOT_EOK : knot_map_errno();
+}
+
+int kxsk_block_sweep(const struct kxsk_iface *iface, uint64_t now, unsigned *removed)
+{
+	if (iface == NULL || removed == NULL) {
+		return KNOT_EINVAL;
+	} else if (iface->block_map_fd < 0) {
+		return KNOT_ENOTSUP;
+	}
+
+	*removed = 0;
+
+	// Collect a batch first as deleting the current key restarts the iteration.
+	knot_xdp_block_key_t expired[BLOCK_SWEEP_BATCH];
+	unsigned count;
+	do {
+		count = 0;
+		knot_xdp_block_key_t key, prev;
+		bool first = true;
+		while (count < BLOCK_SWEEP_BATCH &&
+		       bpf_map_get_next_key(iface->block_map_fd, first ? NULL : &prev, &key) == 0) {
+			knot_xdp_block_t block;
+			if (bpf_map_lookup_elem(iface->block_map_fd, &key, &block) == 0 &&
+			    block.expire <= now) {
+				expired[count++] = key;
+			}
+			prev = key;
+			first = false;
+		}
+
+		for (unsigned i = 0; i < count; i++) {
+			if (bpf_map_delete_elem(iface->block_map_fd, &expired[i]) == 0) {
+				(*removed)++;
+			}
+		}
+	} while (count == BLOCK_SWEEP_BATCH);
+
+	return KNOT_EOK;
+}
+
 int kxsk_iface_new(const char *if_name, unsigned if_queue, knot_xdp_load_bpf_t load_bpf,
-                   bool generic_xdp, struct kxsk_iface **out_iface)
+                   bool generic_xdp, bool frags, struct kxsk_iface **out_iface)
 {
 	if (if_name == NULL || out_iface == NULL) {
 		return KNOT_EINVAL;
@@ -248,6 +375,7 @@ int kxsk_iface_new(const char *if_name, unsigned if_queue, knot_xdp_load_bpf_t l
 	}
 	iface->if_queue = if_queue;
 	iface->opts_map_fd = iface->xsks_map_fd = -1;
+	iface->answer_map_fd = iface->block_map_fd = iface->stats_map_fd = -1;
 
 	int ret;
 	switch (load_bpf) {
@@ -276,10 +404,10 @@ int kxsk_iface_new(const char *if_name, unsigned if_queue, knot_xdp_load_bpf_t l
 		sleep(1);
 		// FALLTHROUGH
 	case KNOT_XDP_LOAD_BPF_ALWAYS:
-		ret = ensure_prog(iface, true, generic_xdp);
+		ret = ensure_prog(iface, true, generic_xdp, frags);
 		break;
 	case KNOT_XDP_LOAD_BPF_MAYBE:
-		ret = ensure_prog(iface, false, generic_xdp);
+		ret = ensure_prog(iface, false, generic_xdp, frags);
 		break;
 	default:
 		return KNOT_EINVAL;
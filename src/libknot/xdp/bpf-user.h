@@ -45,6 +45,12 @@ struct kxsk_iface {
 	int opts_map_fd;
 	/*! XSK BPF map file descriptor. */
 	int xsks_map_fd;
+	/*! Answer BPF map file descriptor (-1 if not supported by the program). */
+	int answer_map_fd;
+	/*! Block BPF map file descriptor (-1 if not supported by the program). */
+	int block_map_fd;
+	/*! Kernel statistics BPF map file descriptor (-1 if not supported). */
+	int stats_map_fd;
 
 	/*! BPF program object. */
 	struct bpf_object *prog_obj;
@@ -62,6 +68,8 @@ struct kxsk_umem {
 	struct umem_frame *frames;
 	/*! Size of RX and TX rings. */
 	uint16_t ring_size;
+	/*! Number of consecutive frames forming one TX buffer. */
+	uint16_t tx_frames;
 	/*! The number of free frames (for TX). */
 	uint16_t tx_free_count;
 	/*! Stack of indices of the free frames (for TX). */
@@ -93,6 +101,11 @@ struct knot_xdp_socket {
 
 	/*! Enabled preferred busy polling. */
 	bool busy_poll;
+	uint16_t busy_poll_budget;
+	uint16_t busy_poll_timeout;
+
+	/*! The last received descriptor continues in the next one. */
+	bool rx_contd;
 };
 
 /*!
@@ -102,12 +115,13 @@ struct knot_xdp_socket {
  * \param if_queue     Network card queue id.
  * \param load_bpf     Insert BPF program into packet processing.
  * \param generic_xdp  Use generic XDP implementation instead of a native one.
+ * \param frags        Load the BPF program as capable of multi-buffer packets.
  * \param out_iface    Output: created interface context.
  *
  * \return KNOT_E* or -errno
  */
 int kxsk_iface_new(const char *if_name, unsigned if_queue, knot_xdp_load_bpf_t load_bpf,
-                   bool generic_xdp, struct kxsk_iface **out_iface);
+                   bool generic_xdp, bool frags, struct kxsk_iface **out_iface);
 
 /*!
  * \brief Unload BPF maps for a socket.
@@ -139,4 +153,49 @@ int kxsk_socket_start(const struct kxsk_iface *iface, knot_xdp_filter_flag_t fla
  */
 void kxsk_socket_stop(const struct kxsk_iface *iface);
 
+/*!
+ * \brief Insert, replace, or remove a pre-built answer in the BPF answer map.
+ *
+ * \param iface   Interface context.
+ * \param key     Answer key.
+ * \param answer  Answer to be stored, NULL to remove the key.
+ *
+ * \return KNOT_E* or -errno
+ */
+int kxsk_answer_update(const struct kxsk_iface *iface, const knot_xdp_answer_key_t *key,
+                       const knot_xdp_answer_t *answer);
+
+/*!
+ * \brief Read the BPF program counters of the interface queue.
+ *
+ * \param iface  Interface context.
+ * \param stats  Output counters.
+ *
+ * \return KNOT_E* or -errno
+ */
+int kxsk_kernel_stats(const struct kxsk_iface *iface, knot_xdp_kernel_stats_t *stats);
+
+/*!
+ * \brief Insert or replace a client prefix in the BPF block map.
+ *
+ * \param iface  Interface context.
+ * \param key    Block key.
+ * \param block  Block parameters.
+ *
+ * \return KNOT_E* or -errno
+ */
+int kxsk_block_update(const struct kxsk_iface *iface, const knot_xdp_block_key_t *key,
+                      const knot_xdp_block_t *block);
+
+/*!
+ * \brief Remove expired items from the BPF block map.
+ *
+ * \param iface    Interface context.
+ * \param now      Current CLOCK_MONOTONIC time in nanoseconds.
+ * \param removed  Output: number of removed items.
+ *
+ * \return KNOT_E* or -errno
+ */
+int kxsk_block_sweep(const struct kxsk_iface *iface, uint64_t now, unsigned *removed);
+
 /*! @} */
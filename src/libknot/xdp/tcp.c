@@ -29,6 +29,10 @@
 #include "contrib/openbsd/siphash.h"
 #include "contrib/ucw/lists.h"
 
+#define OOO_MAX_SEGS	16	// Limit of stored out-of-order segments per connection.
+#define OOO_MAX_AHEAD	(1 << 20)	// Don't store segments further ahead of expected seqno.
+#define DUPACK_THRESH	3	// Duplicate ACKs triggering fast retransmit (RFC 5681).
+
 static uint32_t get_timestamp(void)
 {
 	struct timespec t;
@@ -87,18 +91,23 @@ static void next_node_ptr(knot_tcp_conn_t **ptr)
 	}
 }
 
+static size_t conn_inbufs_usage(knot_tcp_conn_t *conn)
+{
+	return buffer_alloc_size(conn->inbuf.iov_len) + conn->ooo_usage;
+}
+
 static void next_ptr_ibuf(knot_tcp_conn_t **ptr)
 {
 	do {
 		next_node_ptr(ptr);
-	} while (*ptr != NULL && (*ptr)->inbuf.iov_len == 0);
+	} while (*ptr != NULL && conn_inbufs_usage(*ptr) == 0);
 }
 
 static void next_ptr_obuf(knot_tcp_conn_t **ptr)
 {
 	do {
 		next_node_ptr(ptr);
-	} while (*ptr != NULL && knot_tcp_outbufs_usage((*ptr)->outbufs) == 0);
+	} while (*ptr != NULL && (*ptr)->outbufs_usage == 0);
 }
 
 _public_
@@ -125,15 +134,21 @@ knot_tcp_table_t *knot_tcp_table_new(size_t size, knot_tcp_table_t *secret_share
 	return table;
 }
 
+static void free_segs(struct knot_tcp_outbuf **segs)
+{
+	while (*segs != NULL) {
+		struct knot_tcp_outbuf *next = (*segs)->next;
+		free(*segs);
+		*segs = next;
+	}
+}
+
 static void del_conn(knot_tcp_conn_t *conn)
 {
 	if (conn != NULL) {
 		free(conn->inbuf.iov_base);
-		while (conn->outbufs != NULL) {
-			struct knot_tcp_outbuf *next = conn->outbufs->next;
-			free(conn->outbufs);
-			conn->outbufs = next;
-		}
+		free_segs(&conn->ooo_segs);
+		free_segs(&conn->outbufs);
 		free(conn);
 	}
 }
@@ -206,8 +221,8 @@ static void tcp_table_remove(knot_tcp_conn_t **todel, knot_tcp_table_t *table)
 {
 	assert(table->usage > 0);
 	rem_align_pointers(*todel, table);
-	table->inbufs_total -= buffer_alloc_size((*todel)->inbuf.iov_len);
-	table->outbufs_total -= knot_tcp_outbufs_usage((*todel)->outbufs);
+	table->inbufs_total -= conn_inbufs_usage(*todel);
+	table->outbufs_total -= (*todel)->outbufs_usage;
 	tcp_table_remove_conn(todel);
 	table->usage--;
 }
@@ -227,9 +242,15 @@ static void conn_init_from_msg(knot_tcp_conn_t *conn, knot_xdp_msg_t *msg)
 	conn->last_active = get_timestamp();
 	conn->state = XDP_TCP_NORMAL;
 	conn->establish_rtt = 0;
+	conn->cwnd = 0;
+	conn->ssthresh = UINT32_MAX;
+	conn->dup_acks = 0;
 
 	memset(&conn->inbuf, 0, sizeof(conn->inbuf));
-	memset(&conn->outbufs, 0, sizeof(conn->outbufs));
+	conn->ooo_segs = NULL;
+	conn->ooo_usage = 0;
+	conn->outbufs = NULL;
+	conn->outbufs_usage = 0;
 }
 
 static void tcp_table_insert(knot_tcp_conn_t *conn, uint64_t hash,
@@ -259,17 +280,141 @@ static int tcp_table_add(knot_xdp_msg_t *msg, uint64_t hash, knot_tcp_table_t *t
 	return KNOT_EOK;
 }
 
+static bool check_ack(const knot_xdp_msg_t *msg, const knot_tcp_conn_t *conn)
+{
+	if (conn->acked <= conn->ackno) { // ackno does not wrap around uint32
+		return (msg->ackno >= conn->acked && msg->ackno <= conn->ackno);
+	} else { // this is more tricky
+		return (msg->ackno >= conn->acked || msg->ackno <= conn->ackno);
+	}
+}
+
 static bool check_seq_ack(const knot_xdp_msg_t *msg, const knot_tcp_conn_t *conn)
 {
 	if (conn == NULL || conn->seqno != msg->seqno) {
 		return false;
 	}
 
-	if (conn->acked <= conn->ackno) { // ackno does not wrap around uint32
-		return (msg->ackno >= conn->acked && msg->ackno <= conn->ackno);
-	} else { // this is more tricky
-		return (msg->ackno >= conn->acked || msg->ackno <= conn->ackno);
+	return check_ack(msg, conn);
+}
+
+static uint32_t conn_flight(const knot_tcp_conn_t *conn)
+{
+	return conn->ackno - conn->acked;
+}
+
+static void cwnd_loss(knot_tcp_conn_t *conn, bool timeout)
+{
+	conn->ssthresh = MAX(conn_flight(conn) / 2, 2 * (uint32_t)conn->mss);
+	conn->cwnd = timeout ? conn->mss : conn->ssthresh;
+	conn->dup_acks = 0;
+}
+
+/*!
+ * \brief Update congestion window upon received ACK (RFC 5681).
+ *
+ * \return True if fast retransmit shall take place.
+ */
+static bool cwnd_ack(knot_tcp_conn_t *conn, uint32_t newly_acked, bool pure_ack)
+{
+	if (conn->cwnd == 0) {
+		return false;
+	}
+
+	if (newly_acked > 0) {
+		conn->dup_acks = 0;
+		if (conn->cwnd >= conn->window_size) {
+			// don't grow beyond what the peer allows anyway
+		} else if (conn->cwnd < conn->ssthresh) { // slow start
+			conn->cwnd += MIN(newly_acked, conn->mss);
+		} else { // congestion avoidance
+			conn->cwnd += MAX(1, (uint32_t)conn->mss * conn->mss / conn->cwnd);
+		}
+	} else if (pure_ack && conn_flight(conn) > 0 && ++conn->dup_acks == DUPACK_THRESH) {
+		cwnd_loss(conn, false);
+		return true;
+	}
+
+	return false;
+}
+
+/*!
+ * \brief Store a segment received ahead of the expected sequence number.
+ */
+static int ooo_store(knot_tcp_conn_t *conn, const knot_xdp_msg_t *msg,
+                     knot_tcp_table_t *table)
+{
+	uint32_t ahead = msg->seqno - conn->seqno;
+	if (ahead == 0 || ahead >= OOO_MAX_AHEAD) {
+		return KNOT_EOK; // old retransmission or garbage, just ACK
+	}
+
+	size_t count = 0;
+	struct knot_tcp_outbuf **pos = &conn->ooo_segs;
+	while (*pos != NULL && (*pos)->seqno - conn->seqno <= ahead) {
+		if ((*pos)->seqno == msg->seqno) {
+			return KNOT_EOK; // duplicate
+		}
+		pos = &(*pos)->next;
+		count++;
+	}
+	for (struct knot_tcp_outbuf *i = *pos; i != NULL; i = i->next) {
+		count++;
+	}
+	if (count >= OOO_MAX_SEGS) {
+		return KNOT_EOK; // the peer will retransmit
+	}
+
+	struct knot_tcp_outbuf *seg = malloc(sizeof(*seg) + msg->payload.iov_len);
+	if (seg == NULL) {
+		return KNOT_ENOMEM;
+	}
+	seg->len = msg->payload.iov_len;
+	seg->seqno = msg->seqno;
+	seg->sent = false;
+	memcpy(seg->bytes, msg->payload.iov_base, seg->len);
+	seg->next = *pos;
+	*pos = seg;
+
+	conn->ooo_usage += seg->len + sizeof(*seg);
+	table->inbufs_total += seg->len + sizeof(*seg);
+	if (table->next_ibuf == NULL) {
+		table->next_ibuf = conn;
+	}
+
+	return KNOT_EOK;
+}
+
+/*!
+ * \brief Pass stored segments which became in-order to the input buffer.
+ */
+static int ooo_drain(knot_tcp_conn_t *conn, knot_tcp_relay_t *relay,
+                     knot_tcp_table_t *table)
+{
+	int ret = KNOT_EOK;
+	while (ret == KNOT_EOK && conn->ooo_segs != NULL) {
+		struct knot_tcp_outbuf *seg = conn->ooo_segs;
+		uint32_t skip = conn->seqno - seg->seqno;
+		if (skip > INT32_MAX) {
+			break; // still a gap in front of it
+		}
+
+		if (skip < seg->len) {
+			struct iovec data = {
+				.iov_base = seg->bytes + skip,
+				.iov_len = seg->len - skip
+			};
+			ret = knot_tcp_inbufs_upd(&conn->inbuf, data, true,
+			                          &relay->inbf, &table->inbufs_total);
+			conn->seqno += data.iov_len;
+		}
+
+		conn->ooo_usage -= seg->len + sizeof(*seg);
+		table->inbufs_total -= seg->len + sizeof(*seg);
+		conn->ooo_segs = seg->next;
+		free(seg);
 	}
+	return ret;
 }
 
 static void conn_update(knot_tcp_conn_t *conn, const knot_xdp_msg_t *msg)
@@ -316,8 +461,26 @@ int knot_tcp_recv(knot_tcp_relay_t *relay, knot_xdp_msg_t *msg,
 		add_tail(tcp_table_timeout(tcp_table), tcp_conn_node(conn));
 
 		if (msg->flags & KNOT_XDP_MSG_ACK) {
+			uint32_t newly_acked = msg->ackno - conn->acked;
 			conn->acked = msg->ackno;
-			knot_tcp_outbufs_ack(&conn->outbufs, msg->ackno, &tcp_table->outbufs_total);
+			size_t usage = conn->outbufs_usage;
+			knot_tcp_outbufs_ack(&conn->outbufs, msg->ackno, &conn->outbufs_usage);
+			tcp_table->outbufs_total -= usage - conn->outbufs_usage;
+			bool pure_ack = msg->payload.iov_len == 0 &&
+			                !(msg->flags & (KNOT_XDP_MSG_SYN | KNOT_XDP_MSG_FIN | KNOT_XDP_MSG_RST));
+			if (cwnd_ack(conn, newly_acked, pure_ack)) {
+				relay->answer = XDP_TCP_RESEND;
+			}
+		}
+
+		// the conn has been moved to the end, keep watching its unACKed data
+		if (conn->outbufs_usage > 0) {
+			if (tcp_table->next_obuf == NULL) {
+				tcp_table->next_obuf = conn;
+			}
+			if (tcp_table->next_resend == NULL) {
+				tcp_table->next_resend = conn;
+			}
 		}
 	}
 
@@ -331,12 +494,24 @@ int knot_tcp_recv(knot_tcp_relay_t *relay, knot_xdp_msg_t *msg,
 		}
 		ret = knot_tcp_inbufs_upd(&conn->inbuf, msg->payload, false,
 		                          &relay->inbf, &tcp_table->inbufs_total);
+		if (ret == KNOT_EOK) {
+			ret = ooo_drain(conn, relay, tcp_table);
+		}
 		if (ret != KNOT_EOK) {
 			return ret;
 		}
 		if (conn->inbuf.iov_len > 0 && tcp_table->next_ibuf == NULL) {
 			tcp_table->next_ibuf = conn;
 		}
+	} else if (!seq_ack_match && conn != NULL && conn->state == XDP_TCP_NORMAL &&
+	           (msg->flags & (KNOT_XDP_MSG_SYN | KNOT_XDP_MSG_ACK | KNOT_XDP_MSG_FIN |
+	                          KNOT_XDP_MSG_RST)) == KNOT_XDP_MSG_ACK &&
+	           msg->payload.iov_len > 0 && check_ack(msg, conn)) {
+		// segment out of order, keep it for later and send duplicate ACK
+		if (!(ignore & XDP_TCP_IGNORE_DATA_ACK)) {
+			relay->auto_answer = KNOT_XDP_MSG_ACK;
+		}
+		return ooo_store(conn, msg, tcp_table);
 	}
 
 	// process TCP connection state
@@ -369,6 +544,7 @@ int knot_tcp_recv(knot_tcp_relay_t *relay, knot_xdp_msg_t *msg,
 				conn->state = synack ? XDP_TCP_NORMAL: XDP_TCP_ESTABLISHING;
 				conn->mss = MAX(msg->mss, 536); // minimal MSS, most importantly not zero!
 				conn->window_scale = msg->win_scale;
+				conn->cwnd = add_table->init_cwnd * conn->mss;
 				conn_update(conn, msg);
 				if (!synack) {
 					conn->acked = dnssec_random_uint32_t();
@@ -455,13 +631,15 @@ int knot_tcp_reply_data(knot_tcp_relay_t *relay, knot_tcp_table_t *tcp_table,
 	if (relay == NULL || tcp_table == NULL || relay->conn == NULL || conn_removed(relay->conn)) {
 		return KNOT_EINVAL;
 	}
+	size_t usage = relay->conn->outbufs_usage;
 	int ret = knot_tcp_outbufs_add(&relay->conn->outbufs, data, len, ignore_lastbyte,
-	                               relay->conn->mss, &tcp_table->outbufs_total);
+	                               relay->conn->mss, &relay->conn->outbufs_usage);
+	tcp_table->outbufs_total += relay->conn->outbufs_usage - usage;
 
-	if (tcp_table->next_obuf == NULL && knot_tcp_outbufs_usage(relay->conn->outbufs) > 0) {
+	if (tcp_table->next_obuf == NULL && relay->conn->outbufs_usage > 0) {
 		tcp_table->next_obuf = relay->conn;
 	}
-	if (tcp_table->next_resend == NULL && knot_tcp_outbufs_usage(relay->conn->outbufs) > 0) {
+	if (tcp_table->next_resend == NULL && relay->conn->outbufs_usage > 0) {
 		tcp_table->next_resend = relay->conn;
 	}
 	return ret;
@@ -591,7 +769,11 @@ int knot_tcp_send(knot_xdp_socket_t *socket, knot_tcp_relay_t relays[],
 		size_t can_data = 0;
 		knot_tcp_outbuf_t *ob;
 		if (rl->conn != NULL) {
-			knot_tcp_outbufs_can_send(rl->conn->outbufs, rl->conn->window_size,
+			uint32_t window = rl->conn->window_size;
+			if (rl->conn->cwnd > 0) {
+				window = MIN(window, rl->conn->cwnd);
+			}
+			knot_tcp_outbufs_can_send(rl->conn->outbufs, window,
 			                          rl->answer == XDP_TCP_RESEND, &ob, &can_data);
 		}
 		while (can_data > 0) {
@@ -627,8 +809,8 @@ static void sweep_reset(knot_tcp_table_t *tcp_table, knot_tcp_relay_t *rl,
 	tcp_table_remove(tcp_table_re_lookup(rl->conn, tcp_table), tcp_table); // also updates tcp_table->next_*
 
 	*free_conns -= 1;
-	*free_inbuf -= buffer_alloc_size(rl->conn->inbuf.iov_len);
-	*free_outbuf -= knot_tcp_outbufs_usage(rl->conn->outbufs);
+	*free_inbuf -= conn_inbufs_usage(rl->conn);
+	*free_outbuf -= rl->conn->outbufs_usage;
 
 	knot_sweep_stats_incr(stats, counter);
 }
@@ -656,7 +838,7 @@ int knot_tcp_sweep(knot_tcp_table_t *tcp_table,
 	// reset connections to free ibufs
 	while (free_inbuf > 0 && rl != rl_max) {
 		assert(tcp_table->next_ibuf != NULL);
-		if (tcp_table->next_ibuf->inbuf.iov_len == 0) { // this conn might have get rid of ibuf in the meantime
+		if (conn_inbufs_usage(tcp_table->next_ibuf) == 0) { // this conn might have get rid of ibuf in the meantime
 			next_ptr_ibuf(&tcp_table->next_ibuf);
 		}
 		assert(tcp_table->next_ibuf != NULL);
@@ -669,7 +851,7 @@ int knot_tcp_sweep(knot_tcp_table_t *tcp_table,
 	// reset connections to free obufs
 	while (free_outbuf > 0 && rl != rl_max) {
 		assert(tcp_table->next_obuf != NULL);
-		if (knot_tcp_outbufs_usage(tcp_table->next_obuf->outbufs) == 0) {
+		if (tcp_table->next_obuf->outbufs_usage == 0) {
 			next_ptr_obuf(&tcp_table->next_obuf);
 		}
 		assert(tcp_table->next_obuf != NULL);
@@ -714,6 +896,9 @@ int knot_tcp_sweep(knot_tcp_table_t *tcp_table,
 	       rl != rl_max) {
 		rl->conn = tcp_table->next_resend;
 		rl->answer = XDP_TCP_RESEND;
+		if (rl->conn->cwnd > 0) {
+			cwnd_loss(rl->conn, true);
+		}
 		rl++;
 		next_ptr_obuf(&tcp_table->next_resend);
 	}
@@ -736,7 +921,11 @@ void knot_tcp_cleanup(knot_tcp_table_t *tcp_table, knot_tcp_relay_t relays[],
 
 			del_conn(relays[i].conn);
 		}
-		free(relays[i].inbf);
+		while (relays[i].inbf != NULL) {
+			struct knot_tcp_inbufs_upd_res *next = relays[i].inbf->next;
+			free(relays[i].inbf);
+			relays[i].inbf = next;
+		}
 	}
 	memset(relays, 0, relay_count * sizeof(relays[0]));
 }
@@ -82,6 +82,12 @@ typedef struct knot_tcp_conn {
 	struct iovec inbuf;
 	struct knot_tcp_outbuf *outbufs;
 	struct knot_tcp_conn *next;
+	uint32_t cwnd; // congestion window in bytes, zero if unlimited
+	uint32_t ssthresh;
+	uint8_t dup_acks;
+	struct knot_tcp_outbuf *ooo_segs; // out-of-order received segments
+	size_t ooo_usage; // allocated size of ooo_segs
+	size_t outbufs_usage; // allocated size of outbufs
 } knot_tcp_conn_t;
 
 typedef struct {
@@ -94,6 +100,7 @@ typedef struct {
 	knot_tcp_conn_t *next_ibuf;
 	knot_tcp_conn_t *next_obuf;
 	knot_tcp_conn_t *next_resend;
+	uint32_t init_cwnd; // initial congestion window in segments, zero if unlimited
 	knot_tcp_conn_t *conns[];
 } knot_tcp_table_t;
 
@@ -26,8 +26,13 @@
 #include <unistd.h>
 
 #include "libknot/attribute.h"
+#include "libknot/consts.h"
+#include "libknot/descriptor.h"
+#include "libknot/dname.h"
 #include "libknot/endian.h"
 #include "libknot/errcode.h"
+#include "libknot/packet/wire.h"
+#include "libknot/xdp/answer.h"
 #include "libknot/xdp/bpf-consts.h"
 #include "libknot/xdp/bpf-user.h"
 #include "libknot/xdp/eth.h"
@@ -67,7 +72,8 @@ static uint32_t ring_size(const knot_xdp_config_t *config)
 	return config != NULL ? config->ring_size : DEFAULT_RING_SIZE;
 }
 
-static int configure_xsk_umem(struct kxsk_umem **out_umem, uint32_t ring_size)
+static int configure_xsk_umem(struct kxsk_umem **out_umem, uint32_t ring_size,
+                              uint16_t tx_frames)
 {
 	/* Allocate memory and call driver to create the UMEM. */
 	struct kxsk_umem *umem = calloc(1,
@@ -77,12 +83,14 @@ static int configure_xsk_umem(struct kxsk_umem **out_umem, uint32_t ring_size)
 		return KNOT_ENOMEM;
 	}
 	umem->ring_size = ring_size;
+	umem->tx_frames = tx_frames;
 
 	/* It's recommended that the FQ ring size >= HW RX ring size + AF_XDP RX ring size.
 	 * However, the performance is better if FQ size == AF_XDP RX size. */
 	const uint32_t FQ_SIZE = umem->ring_size;
 	const uint32_t CQ_SIZE = umem->ring_size;
-	const uint32_t FRAMES = FQ_SIZE + CQ_SIZE;
+	const uint32_t TX_FRAMES = CQ_SIZE * tx_frames;
+	const uint32_t FRAMES = FQ_SIZE + TX_FRAMES;
 
 	int ret = posix_memalign((void **)&umem->frames, getpagesize(),
 	                         FRAME_SIZE * FRAMES);
@@ -93,7 +101,7 @@ static int configure_xsk_umem(struct kxsk_umem **out_umem, uint32_t ring_size)
 
 	const struct xsk_umem_config umem_config = {
 		.fill_size = FQ_SIZE,
-		.comp_size = CQ_SIZE,
+		.comp_size = CQ_SIZE * tx_frames, // Every fragment is completed separately.
 		.frame_size = FRAME_SIZE,
 		.frame_headroom = KNOT_XDP_PKT_ALIGNMENT,
 	};
@@ -121,7 +129,7 @@ static int configure_xsk_umem(struct kxsk_umem **out_umem, uint32_t ring_size)
 		return KNOT_ERROR;
 	}
 	assert(idx == 0);
-	for (uint32_t i = CQ_SIZE; i < CQ_SIZE + FQ_SIZE; ++i) {
+	for (uint32_t i = TX_FRAMES; i < TX_FRAMES + FQ_SIZE; ++i) {
 		*xsk_ring_prod__fill_addr(&umem->fq, idx++) = i * FRAME_SIZE;
 	}
 	xsk_ring_prod__submit(&umem->fq, FQ_SIZE);
@@ -136,21 +144,25 @@ static void deconfigure_xsk_umem(struct kxsk_umem *umem)
 	free(umem);
 }
 
-static int enable_busypoll(int socket, unsigned timeout_us, unsigned budget)
+static int set_busypoll(int socket, unsigned timeout_us, unsigned budget)
 {
 #if defined(SO_PREFER_BUSY_POLL) && defined(SO_BUSY_POLL_BUDGET)
-	int opt_val = 1;
+	int opt_val = (budget > 0);
 	if (setsockopt(socket, SOL_SOCKET, SO_PREFER_BUSY_POLL,
 	               &opt_val, sizeof(opt_val)) != 0) {
 		return knot_map_errno();
 	}
 
-	opt_val = timeout_us;
+	opt_val = (budget > 0) ? timeout_us : 0;
 	if (setsockopt(socket, SOL_SOCKET, SO_BUSY_POLL,
 	               &opt_val, sizeof(opt_val)) != 0) {
 		return knot_map_errno();
 	}
 
+	if (budget == 0) { // Keep the last budget, it's not used anyway.
+		return KNOT_EOK;
+	}
+
 	opt_val = budget;
 	if (setsockopt(socket, SOL_SOCKET, SO_BUSY_POLL_BUDGET,
 	               &opt_val, sizeof(opt_val)) != 0) {
@@ -179,9 +191,17 @@ static int configure_xsk_socket(struct kxsk_umem *umem,
 	if (config != NULL && config->force_copy) {
 		bind_flags |= XDP_COPY;
 	}
+	if (umem->tx_frames > 1) {
+#ifdef XDP_USE_SG
+		bind_flags |= XDP_USE_SG;
+#else
+		free(xsk_info);
+		return KNOT_ENOTSUP;
+#endif
+	}
 
 	const struct xsk_socket_config sock_conf = {
-		.tx_size = umem->ring_size,
+		.tx_size = umem->ring_size * umem->tx_frames,
 		.rx_size = umem->ring_size,
 		.libbpf_flags = XSK_LIBBPF_FLAGS__INHIBIT_PROG_LOAD,
 		.bind_flags = bind_flags,
@@ -196,14 +216,16 @@ static int configure_xsk_socket(struct kxsk_umem *umem,
 	}
 
 	if (config != NULL && config->busy_poll_budget > 0) {
-		ret = enable_busypoll(xsk_socket__fd(xsk_info->xsk),
-		                      config->busy_poll_timeout, config->busy_poll_budget);
+		ret = set_busypoll(xsk_socket__fd(xsk_info->xsk),
+		                   config->busy_poll_timeout, config->busy_poll_budget);
 		if (ret != KNOT_EOK) {
 			xsk_socket__delete(xsk_info->xsk);
 			free(xsk_info);
 			return ret;
 		}
 		xsk_info->busy_poll = true;
+		xsk_info->busy_poll_budget = config->busy_poll_budget;
+		xsk_info->busy_poll_timeout = config->busy_poll_timeout;
 	}
 
 	*out_sock = xsk_info;
@@ -223,14 +245,15 @@ int knot_xdp_init(knot_xdp_socket_t **socket, const char *if_name, int if_queue,
 
 	struct kxsk_iface *iface;
 	const bool generic_xdp = (xdp_config != NULL && xdp_config->force_generic);
-	int ret = kxsk_iface_new(if_name, if_queue, load_bpf, generic_xdp, &iface);
+	const bool tx_multi_buffer = (xdp_config != NULL && xdp_config->tx_multi_buffer);
+	int ret = kxsk_iface_new(if_name, if_queue, load_bpf, generic_xdp, tx_multi_buffer, &iface);
 	if (ret != KNOT_EOK) {
 		return ret;
 	}
 
 	/* Initialize shared packet_buffer for umem usage. */
 	struct kxsk_umem *umem = NULL;
-	ret = configure_xsk_umem(&umem, ring_size(xdp_config));
+	ret = configure_xsk_umem(&umem, ring_size(xdp_config), tx_multi_buffer ? 2 : 1);
 	if (ret != KNOT_EOK) {
 		kxsk_iface_free(iface);
 		return ret;
@@ -243,7 +266,7 @@ int knot_xdp_init(knot_xdp_socket_t **socket, const char *if_name, int if_queue,
 		return ret;
 	}
 
-	(*socket)->frame_limit = FRAME_SIZE;
+	(*socket)->frame_limit = FRAME_SIZE * umem->tx_frames;
 	ret = knot_eth_mtu(if_name);
 	if (ret > 0) {
 		(*socket)->frame_limit = MIN((unsigned)ret, (*socket)->frame_limit);
@@ -308,7 +331,7 @@ int knot_xdp_socket_fd(knot_xdp_socket_t *socket)
 static void tx_free_relative(struct kxsk_umem *umem, uint64_t addr_relative)
 {
 	/* The address may not point to *start* of buffer, but `/` solves that. */
-	uint64_t index = addr_relative / FRAME_SIZE;
+	uint64_t index = addr_relative / (FRAME_SIZE * umem->tx_frames);
 	assert(index < umem->ring_size);
 	umem->tx_free_indices[umem->tx_free_count++] = index;
 }
@@ -328,12 +351,18 @@ void knot_xdp_send_prepare(knot_xdp_socket_t *socket)
 	if (completed == 0) {
 		return;
 	}
-	assert(umem->tx_free_count + completed <= umem->ring_size);
 
 	for (uint32_t i = 0; i < completed; ++i) {
 		uint64_t addr_relative = *xsk_ring_cons__comp_addr(cq, idx++);
+		/* Continuation fragments start at a frame boundary inside the buffer,
+		 * whereas the packet itself starts after the alignment gap. */
+		if (umem->tx_frames > 1 &&
+		    addr_relative % (FRAME_SIZE * umem->tx_frames) >= FRAME_SIZE) {
+			continue;
+		}
 		tx_free_relative(umem, addr_relative);
 	}
+	assert(umem->tx_free_count <= umem->ring_size);
 
 	xsk_ring_cons__release(cq, completed);
 }
@@ -357,14 +386,19 @@ static struct umem_frame *alloc_tx_frame(knot_xdp_socket_t *socket)
 	}
 
 	uint32_t index = umem->tx_free_indices[--umem->tx_free_count];
-	return umem->frames + index;
+	return umem->frames + index * umem->tx_frames;
 }
 
-static void prepare_payload(knot_xdp_msg_t *msg, void *uframe)
+static void prepare_payload(knot_xdp_socket_t *socket, knot_xdp_msg_t *msg, void *uframe)
 {
+	size_t buf_size = FRAME_SIZE;
+	if (likely(socket->send_mock == NULL)) {
+		buf_size *= socket->umem->tx_frames;
+	}
+
 	size_t hdr_len = prot_write_hdrs_len(msg);
 	msg->payload.iov_base = uframe + hdr_len + KNOT_XDP_PKT_ALIGNMENT;
-	msg->payload.iov_len = FRAME_SIZE - hdr_len - KNOT_XDP_PKT_ALIGNMENT;
+	msg->payload.iov_len = buf_size - hdr_len - KNOT_XDP_PKT_ALIGNMENT;
 }
 
 _public_
@@ -381,7 +415,7 @@ int knot_xdp_send_alloc(knot_xdp_socket_t *socket, knot_xdp_msg_flag_t flags,
 	}
 
 	msg_init(out, flags);
-	prepare_payload(out, uframe);
+	prepare_payload(socket, out, uframe);
 
 	return KNOT_EOK;
 }
@@ -400,7 +434,7 @@ int knot_xdp_reply_alloc(knot_xdp_socket_t *socket, const knot_xdp_msg_t *query,
 	}
 
 	msg_init_reply(out, query);
-	prepare_payload(out, uframe);
+	prepare_payload(socket, out, uframe);
 
 	return KNOT_EOK;
 }
@@ -435,8 +469,9 @@ int knot_xdp_send(knot_xdp_socket_t *socket, const knot_xdp_msg_t msgs[],
 	 * and the API doesn't allow "cancelling reservations".
 	 * Therefore we handle `socket->tx.cached_prod` by hand.
 	 */
+	const uint32_t descs = count * socket->umem->tx_frames;
 	const struct timespec delay = { .tv_nsec = RETRY_DELAY };
-	while (unlikely(xsk_prod_nb_free(&socket->tx, count) < count)) {
+	while (unlikely(xsk_prod_nb_free(&socket->tx, descs) < descs)) {
 		if (socket->busy_poll || xsk_ring_prod__needs_wakeup(&socket->tx)) {
 			(void)sendto(xsk_socket__fd(socket->xsk), NULL, 0,
 			             MSG_DONTWAIT, NULL, 0);
@@ -445,6 +480,7 @@ int knot_xdp_send(knot_xdp_socket_t *socket, const knot_xdp_msg_t msgs[],
 	}
 	uint32_t idx = socket->tx.cached_prod;
 
+	*sent = 0;
 	for (uint32_t i = 0; i < count; ++i) {
 		const knot_xdp_msg_t *msg = &msgs[i];
 
@@ -457,17 +493,36 @@ int knot_xdp_send(knot_xdp_socket_t *socket, const knot_xdp_msg_t msgs[],
 			uint16_t mss = MIN(socket->frame_limit - hdr_len, KNOT_TCP_MSS);
 			prot_write_eth(msg_beg, msg, msg_beg + tot_len, mss);
 
-			*xsk_ring_prod__tx_desc(&socket->tx, idx++) = (struct xdp_desc) {
-				.addr = msg_beg - socket->umem->frames->bytes,
-				.len = tot_len,
-			};
+			uint64_t addr = msg_beg - socket->umem->frames->bytes;
+			uint32_t head_len = FRAME_SIZE - addr % FRAME_SIZE;
+			if (tot_len <= head_len) {
+				*xsk_ring_prod__tx_desc(&socket->tx, idx++) = (struct xdp_desc) {
+					.addr = addr,
+					.len = tot_len,
+				};
+			} else { // Spans the next frame of the buffer, see XDP_USE_SG.
+#ifdef XDP_PKT_CONTD
+				*xsk_ring_prod__tx_desc(&socket->tx, idx++) = (struct xdp_desc) {
+					.addr = addr,
+					.len = head_len,
+					.options = XDP_PKT_CONTD,
+				};
+				*xsk_ring_prod__tx_desc(&socket->tx, idx++) = (struct xdp_desc) {
+					.addr = addr + head_len,
+					.len = tot_len - head_len,
+				};
+#else
+				assert(0); // Not allowed by configure_xsk_socket().
+#endif
+			}
+			(*sent)++;
 		}
 	}
 
-	*sent = idx - socket->tx.cached_prod;
 	assert(*sent <= count);
+	uint32_t submit = idx - socket->tx.cached_prod;
 	socket->tx.cached_prod = idx;
-	xsk_ring_prod__submit(&socket->tx, *sent);
+	xsk_ring_prod__submit(&socket->tx, submit);
 
 	return KNOT_EOK;
 }
@@ -524,13 +579,29 @@ int knot_xdp_recv(knot_xdp_socket_t *socket, knot_xdp_msg_t msgs[],
 		const struct xdp_desc *desc = xsk_ring_cons__rx_desc(&socket->rx, idx++);
 		uint8_t *uframe_p = (uint8_t *)socket->umem->frames + desc->addr;
 
+#ifdef XDP_PKT_CONTD
+		/* Multi-buffer is used for TX only. A packet spanning more frames
+		 * can't be passed as one payload, all its fragments are returned
+		 * as empty messages. Normally the BPF program drops them already,
+		 * as it checks the IP length against the first buffer. The
+		 * advertised TCP MSS (KNOT_TCP_MSS) fits one frame. */
+		bool fragment = socket->rx_contd || (desc->options & XDP_PKT_CONTD);
+		socket->rx_contd = (desc->options & XDP_PKT_CONTD);
+		if (unlikely(fragment)) {
+			memset(msg, 0, sizeof(*msg));
+			msg->payload.iov_base = uframe_p;
+			continue;
+		}
+#endif
+
 		void *payl_end;
 		void *payl_start = prot_read_eth(uframe_p, msg, &payl_end,
 		                                 socket->vlan_map, socket->vlan_map_max);
 
 		msg->payload.iov_base = payl_start;
 		msg->payload.iov_len = payl_end - payl_start;
-		msg->mss = MIN(msg->mss, FRAME_SIZE - (payl_start - (void *)uframe_p));
+		msg->mss = MIN(msg->mss, FRAME_SIZE * socket->umem->tx_frames -
+		                         (payl_start - (void *)uframe_p));
 
 		if (wire_size != NULL) {
 			(*wire_size) += desc->len;
@@ -609,6 +680,44 @@ void knot_xdp_socket_info(const knot_xdp_socket_t *socket, FILE *file)
 	fprintf(file, "TX free frames: %4d\n", tx_freef);
 }
 
+_public_
+int knot_xdp_busy_poll_set(knot_xdp_socket_t *socket, unsigned timeout, unsigned budget)
+{
+	if (socket == NULL || timeout > UINT16_MAX || budget > UINT16_MAX ||
+	    (budget > 0 && timeout == 0)) {
+		return KNOT_EINVAL;
+	}
+
+	bool enable = (budget > 0);
+	if (enable == socket->busy_poll && (!enable ||
+	    (budget == socket->busy_poll_budget && timeout == socket->busy_poll_timeout))) {
+		return KNOT_EOK; // No change.
+	}
+
+	int ret = set_busypoll(knot_xdp_socket_fd(socket), timeout, budget);
+	if (ret != KNOT_EOK) {
+		return ret;
+	}
+
+	socket->busy_poll = enable;
+	if (enable) {
+		socket->busy_poll_budget = budget;
+		socket->busy_poll_timeout = timeout;
+	}
+
+	return KNOT_EOK;
+}
+
+_public_
+uint32_t knot_xdp_rx_pending(const knot_xdp_socket_t *socket)
+{
+	if (socket == NULL) {
+		return 0;
+	}
+
+	return RING_BUSY(&socket->rx);
+}
+
 _public_
 int knot_xdp_socket_stats(knot_xdp_socket_t *socket, knot_xdp_stats_t *stats)
 {
@@ -642,5 +751,106 @@ int knot_xdp_socket_stats(knot_xdp_socket_t *socket, knot_xdp_stats_t *stats)
 	stats->rings.tx_fill = RING_BUSY(&socket->tx);
 	stats->rings.cq_fill = RING_BUSY(&socket->umem->cq);
 
+	stats->busy_poll.polling = socket->busy_poll;
+	stats->busy_poll.budget = socket->busy_poll ? socket->busy_poll_budget : 0;
+	stats->busy_poll.timeout = socket->busy_poll ? socket->busy_poll_timeout : 0;
+
+	knot_xdp_kernel_stats_t kernel_stats;
+	if (kxsk_kernel_stats(socket->iface, &kernel_stats) == KNOT_EOK) {
+		stats->kernel.answered = kernel_stats.answered;
+		stats->kernel.missed = kernel_stats.missed;
+		stats->kernel.dropped = kernel_stats.dropped;
+		stats->kernel.slipped = kernel_stats.slipped;
+	}
+
 	return KNOT_EOK;
 }
+
+_public_
+int knot_xdp_answer_set(knot_xdp_socket_t *socket, const uint8_t *wire, size_t len,
+                        uint16_t edns_payload)
+{
+	if (socket == NULL || wire == NULL) {
+		return KNOT_EINVAL;
+	}
+
+	knot_xdp_answer_key_t key;
+	knot_xdp_answer_t answer;
+	int ret = answer_build(&key, &answer, wire, len, edns_payload);
+	if (ret != KNOT_EOK) {
+		return ret;
+	}
+
+	return kxsk_answer_update(socket->iface, &key, &answer);
+}
+
+_public_
+int knot_xdp_answer_del(knot_xdp_socket_t *socket, const uint8_t *qname, uint16_t qtype)
+{
+	if (socket == NULL || qname == NULL) {
+		return KNOT_EINVAL;
+	}
+
+	knot_xdp_answer_key_t key;
+	int ret = answer_key(&key, qname, qname + KNOT_DNAME_MAXLEN);
+	if (ret == KNOT_ESPACE) {
+		return KNOT_EOK; // Never stored.
+	} else if (ret < 0) {
+		return ret;
+	}
+	key.qtype = htobe16(qtype);
+
+	return kxsk_answer_update(socket->iface, &key, NULL);
+}
+
+static uint64_t monotonic_ns(void)
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (uint64_t)now.tv_sec * 1000000000 + now.tv_nsec;
+}
+
+_public_
+int knot_xdp_block_set(knot_xdp_socket_t *socket, const struct sockaddr_storage *addr,
+                       unsigned prefix, uint32_t duration, uint16_t slip)
+{
+	if (socket == NULL || addr == NULL) {
+		return KNOT_EINVAL;
+	}
+
+	knot_xdp_block_key_t key = { 0 };
+	if (addr->ss_family == AF_INET6 && prefix <= 128) {
+		const struct sockaddr_in6 *ip6 = (const struct sockaddr_in6 *)addr;
+		memcpy(key.addr, &ip6->sin6_addr, sizeof(ip6->sin6_addr));
+		key.prefixlen = prefix;
+	} else if (addr->ss_family == AF_INET && prefix <= 32) {
+		const struct sockaddr_in *ip4 = (const struct sockaddr_in *)addr;
+		key.addr[10] = key.addr[11] = 0xff; // IPv4-mapped IPv6 address.
+		memcpy(key.addr + 12, &ip4->sin_addr, sizeof(ip4->sin_addr));
+		key.prefixlen = 96 + prefix;
+	} else {
+		return KNOT_EINVAL;
+	}
+
+	// Clear the host bits so that a prefix is stored just once.
+	for (unsigned i = key.prefixlen; i < 8 * sizeof(key.addr); i++) {
+		key.addr[i / 8] &= ~(0x80 >> (i % 8));
+	}
+
+	knot_xdp_block_t block = {
+		.expire = monotonic_ns() + (uint64_t)duration * 1000000,
+		.slip = slip,
+	};
+
+	return kxsk_block_update(socket->iface, &key, &block);
+}
+
+_public_
+int knot_xdp_block_sweep(knot_xdp_socket_t *socket, unsigned *removed)
+{
+	if (socket == NULL || removed == NULL) {
+		return KNOT_EINVAL;
+	}
+
+	return kxsk_block_sweep(socket->iface, monotonic_ns(), removed);
+}
@@ -58,6 +58,7 @@ struct knot_xdp_config {
 	bool force_copy;     /*!< Force copying packet data between kernel and user-space (avoid zero-copy). */
 	unsigned busy_poll_timeout; /*!< Preferred busy poll budget (0 means disabled). */
 	unsigned busy_poll_budget;  /*!< Preferred busy poll timeout (in microseconds) . */
+	bool tx_multi_buffer; /*!< Use two frames per outgoing packet, incoming packets must fit one frame (kernel >= 6.6). */
 };
 
 /*! \brief Configuration of XDP socket. */
@@ -99,6 +100,26 @@ typedef struct {
 		/*! Pending buffers in CQ ring. */
 		uint16_t cq_fill;
 	} rings;
+	/*! Counters of the BPF program fast-paths for the queue. */
+	struct {
+		/*! Queries answered directly by the BPF program. */
+		uint64_t answered;
+		/*! Eligible queries passed to user space as not found in the answer map. */
+		uint64_t missed;
+		/*! Queries dropped due to a block map item. */
+		uint64_t dropped;
+		/*! Queries answered with TC bit due to a block map item. */
+		uint64_t slipped;
+	} kernel;
+	/*! Current busy polling setting. */
+	struct {
+		/*! Preferred busy polling is enabled (otherwise interrupt driven). */
+		uint16_t polling;
+		/*! Busy poll budget (0 if not polling). */
+		uint16_t budget;
+		/*! Busy poll timeout in microseconds (0 if not polling). */
+		uint16_t timeout;
+	} busy_poll;
 } knot_xdp_stats_t;
 
 /*!
@@ -236,6 +257,26 @@ void knot_xdp_recv_finish(knot_xdp_socket_t *socket, const knot_xdp_msg_t msgs[]
  */
 void knot_xdp_socket_info(const knot_xdp_socket_t *socket, FILE *file);
 
+/*!
+ * \brief Change the preferred busy polling setting of the XDP socket.
+ *
+ * \note Increasing the values over the system defaults requires CAP_NET_ADMIN.
+ *
+ * \param socket   XDP socket.
+ * \param timeout  Busy poll timeout in microseconds.
+ * \param budget   Busy poll budget (0 means switch to interrupt driven mode).
+ *
+ * \return KNOT_E*
+ */
+int knot_xdp_busy_poll_set(knot_xdp_socket_t *socket, unsigned timeout, unsigned budget);
+
+/*!
+ * \brief Return the number of received packets waiting in the RX ring.
+ *
+ * \param socket  XDP socket.
+ */
+uint32_t knot_xdp_rx_pending(const knot_xdp_socket_t *socket);
+
 /*!
  * \brief Gets various statistics of the XDP socket.
  *
@@ -246,4 +287,67 @@ void knot_xdp_socket_info(const knot_xdp_socket_t *socket, FILE *file);
  */
 int knot_xdp_socket_stats(knot_xdp_socket_t *socket, knot_xdp_stats_t *stats);
 
+/*!
+ * \brief Store a pre-built answer to be sent directly by the BPF program.
+ *
+ * The answer is used for UDP queries without EDNS or with a bare EDNS record
+ * (no options, no DO bit) matching the QNAME (case-insensitively) and QTYPE.
+ * The query ID, QNAME case, and RD bit are taken from the query. The answer map
+ * is shared by all the sockets on the interface and requires the filter flag
+ * KNOT_XDP_FILTER_ANSWER.
+ *
+ * \param socket        XDP socket.
+ * \param wire          Response with one question and no OPT record.
+ * \param len           Response length.
+ * \param edns_payload  Maximum UDP payload advertised in the appended OPT record.
+ *
+ * \retval KNOT_ESPACE if the response (including OPT) exceeds 512 bytes.
+ * \retval KNOT_ENOTSUP if the loaded BPF program doesn't support answering.
+ *
+ * \return KNOT_E*
+ */
+int knot_xdp_answer_set(knot_xdp_socket_t *socket, const uint8_t *wire, size_t len,
+                        uint16_t edns_payload);
+
+/*!
+ * \brief Remove a pre-built answer (if any) from the BPF answer map.
+ *
+ * \param socket  XDP socket.
+ * \param qname   QNAME in wire format.
+ * \param qtype   QTYPE.
+ *
+ * \return KNOT_E*
+ */
+int knot_xdp_answer_del(knot_xdp_socket_t *socket, const uint8_t *qname, uint16_t qtype);
+
+/*!
+ * \brief Block UDP queries from a client prefix in the BPF program.
+ *
+ * The queries to the UDP port are dropped, every \a slip -th of them is answered
+ * with an empty truncated response instead. The block map is shared by all the
+ * sockets on the interface and requires the filter flag KNOT_XDP_FILTER_BLOCK.
+ *
+ * \param socket    XDP socket.
+ * \param addr      Client address.
+ * \param prefix    Prefix length of the address to be blocked.
+ * \param duration  Block duration in milliseconds.
+ * \param slip      Slip every Nth query (0 means drop all).
+ *
+ * \retval KNOT_ENOTSUP if the loaded BPF program doesn't support blocking.
+ *
+ * \return KNOT_E*
+ */
+int knot_xdp_block_set(knot_xdp_socket_t *socket, const struct sockaddr_storage *addr,
+                       unsigned prefix, uint32_t duration, uint16_t slip);
+
+/*!
+ * \brief Remove expired client blocks from the BPF program.
+ *
+ * \param socket   XDP socket.
+ * \param removed  Output: number of removed blocks.
+ *
+ * \return KNOT_E*
+ */
+int knot_xdp_block_sweep(knot_xdp_socket_t *socket, unsigned *removed);
+
 /*! @} */
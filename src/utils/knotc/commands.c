@@ -27,6 +27,7 @@
 #include "knot/conf/tools.h"
 #include "knot/zone/zonefile.h"
 #include "knot/zone/zone-load.h"
+#include "contrib/base64.h"
 #include "contrib/color.h"
 #include "contrib/macros.h"
 #include "contrib/string.h"
@@ -203,6 +204,64 @@ static int get_conf_key(const char *key, knot_ctl_data_t *data)
 	return KNOT_EOK;
 }
 
+static void format_wire(const char *zone, const char *sign, const char *value,
+                        bool *empty)
+{
+	static char rdata[2 * 65536];
+
+	uint8_t *wire = NULL;
+	int32_t wire_len = knot_base64_decode_alloc((const uint8_t *)value,
+	                                            strlen(value), &wire);
+	if (wire_len < 0) {
+		printf("%serror: (%s)", (!(*empty) ? "\n" : ""), knot_strerror(wire_len));
+		*empty = false;
+		return;
+	}
+
+	knot_dump_style_t style = {
+		.show_ttl = true,
+		.original_ttl = true,
+		.human_timestamp = true
+	};
+
+	size_t pos = 0;
+	while (pos < (size_t)wire_len) {
+		knot_rrset_t rrset;
+		int ret = knot_rrset_rr_from_wire(wire, &pos, wire_len, &rrset, NULL, false);
+		if (ret != KNOT_EOK) {
+			printf("%serror: (%s)", (!(*empty) ? "\n" : ""), knot_strerror(ret));
+			*empty = false;
+			break;
+		}
+
+		knot_dname_txt_storage_t owner;
+		char type[32];
+		uint32_t ttl = (rrset.type == KNOT_RRTYPE_RRSIG) ?
+		               knot_rrsig_original_ttl(rrset.rrs.rdata) : rrset.ttl;
+		if (knot_dname_to_str(owner, rrset.owner, sizeof(owner)) == NULL ||
+		    knot_rrtype_to_string(rrset.type, type, sizeof(type)) < 0 ||
+		    knot_rrset_txt_dump_data(&rrset, 0, rdata, sizeof(rdata), &style) < 0) {
+			printf("%serror: (%s)", (!(*empty) ? "\n" : ""), knot_strerror(KNOT_EMALF));
+			*empty = false;
+			knot_rrset_clear(&rrset, NULL);
+			break;
+		}
+
+		printf("%s%s%s%s%s%s %u %s %s",
+		       (!(*empty)    ? "\n"  : ""),
+		       (zone != NULL ? "["   : ""),
+		       (zone != NULL ? zone  : ""),
+		       (zone != NULL ? "] "  : ""),
+		       (sign != NULL ? sign  : ""),
+		       owner, ttl, type, rdata);
+		*empty = false;
+
+		knot_rrset_clear(&rrset, NULL);
+	}
+
+	free(wire);
+}
+
 static void format_data(cmd_args_t *args, knot_ctl_type_t data_type,
                         knot_ctl_data_t *data, bool *empty)
 {
@@ -345,6 +404,10 @@ static void format_data(cmd_args_t *args, knot_ctl_type_t data_type,
 	case CTL_ZONE_GET:
 	case CTL_ZONE_SET:
 	case CTL_ZONE_UNSET:
+		if (ctl_has_flag(flags, CTL_FLAG_WIRE) && error == NULL && value != NULL) {
+			format_wire(zone, sign, value, empty);
+			break;
+		}
 		printf("%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s",
 		       (!(*empty)     ? "\n"       : ""),
 		       (error != NULL ? "error: (" : ""),
@@ -936,9 +999,22 @@ static int set_node_items(cmd_args_t *args, knot_ctl_data_t *data, char *rdata,
 
 static int cmd_zone_node_ctl(cmd_args_t *args)
 {
+	// Request records in the wire format, the formatting is done locally.
+	char flags[16] = "";
+	strlcat(flags, args->flags, sizeof(flags));
+	switch (args->desc->cmd) {
+	case CTL_ZONE_READ:
+	case CTL_ZONE_DIFF:
+	case CTL_ZONE_GET:
+		strlcat(flags, CTL_FLAG_WIRE, sizeof(flags));
+		break;
+	default:
+		break;
+	}
+
 	knot_ctl_data_t data = {
 		[KNOT_CTL_IDX_CMD] = ctl_cmd_to_str(args->desc->cmd),
-		[KNOT_CTL_IDX_FLAGS] = args->flags,
+		[KNOT_CTL_IDX_FLAGS] = flags,
 	};
 
 	char rdata[65536]; // Maximum item size in libknot control interface.
@@ -34,6 +34,7 @@
 #include "libknot/libknot.h"
 #include "contrib/strtonum.h"
 #include "contrib/time.h"
+#include "knot/ctl/commands.h"
 #include "knot/ctl/process.h"
 #include "knot/conf/conf.h"
 #include "knot/conf/migration.h"
@@ -481,10 +482,21 @@ static void event_loop(server_t *server, const char *socket, bool daemonize,
 	}
 	free(listen);
 
+	/* Prepare control workers. */
+	size_t n_ctxs = conf_get_int(conf(), C_CTL, C_WORKERS);
+	concurrent_ctl_ctx_t *concurrent_ctxs = calloc(n_ctxs, sizeof(*concurrent_ctxs));
+	ret = (n_ctxs > 0 && concurrent_ctxs == NULL) ? KNOT_ENOMEM : ctl_init(n_ctxs + 1);
+	if (ret != KNOT_EOK) {
+		free(concurrent_ctxs);
+		knot_ctl_unbind(ctl);
+		knot_ctl_free(ctl);
+		log_fatal("control, failed to initialize (%s)", knot_strerror(ret));
+		return;
+	}
+
 	enable_signals();
 
-	concurrent_ctl_ctx_t concurrent_ctxs[CTL_MAX_CONCURRENT] = { 0 };
-	init_ctxs(concurrent_ctxs, CTL_MAX_CONCURRENT, server);
+	init_ctxs(concurrent_ctxs, n_ctxs, server);
 	bool main_thread_exclusive = false;
 
 	/* Notify systemd about successful start. */
@@ -512,7 +524,7 @@ static void event_loop(server_t *server, const char *socket, bool daemonize,
 			server_update_zones(conf(), server, mode);
 			pthread_rwlock_unlock(&server->ctl_lock);
 		}
-		if (sig_req_stop || cleanup_ctxs(concurrent_ctxs, CTL_MAX_CONCURRENT) == KNOT_CTL_ESTOP) {
+		if (sig_req_stop || cleanup_ctxs(concurrent_ctxs, n_ctxs) == KNOT_CTL_ESTOP) {
 			break;
 		}
 
@@ -531,7 +543,7 @@ static void event_loop(server_t *server, const char *socket, bool daemonize,
 		}
 
 		if (main_thread_exclusive ||
-		    find_free_ctx(concurrent_ctxs, CTL_MAX_CONCURRENT, ctl) == NULL) {
+		    find_free_ctx(concurrent_ctxs, n_ctxs, ctl) == NULL) {
 			ret = ctl_process(ctl, server, 0, &main_thread_exclusive);
 			knot_ctl_close(ctl);
 			if (ret == KNOT_CTL_ESTOP) {
@@ -540,7 +552,9 @@ static void event_loop(server_t *server, const char *socket, bool daemonize,
 		}
 	}
 
-	finalize_ctxs(concurrent_ctxs, CTL_MAX_CONCURRENT);
+	finalize_ctxs(concurrent_ctxs, n_ctxs);
+	free(concurrent_ctxs);
+	ctl_deinit();
 
 	if (conf()->cache.srv_dbus_event & DBUS_EVENT_RUNNING) {
 		dbus_emit_running(false);
@@ -601,16 +601,18 @@ void *xdp_gun_thread(void *_ctx)
 						default:
 							break;
 						}
-						for (size_t j = 0; rl->inbf != NULL && j < rl->inbf->n_inbufs; j++) {
-							if (check_dns_payload(&rl->inbf->inbufs[j], ctx, &periodic_stats)) {
-								if (!(ctx->ignore1 & KXDPGUN_IGNORE_CLOSE)) {
-									rl->answer = XDP_TCP_CLOSE;
-								} else if ((ctx->ignore1 & KXDPGUN_REUSE_CONN)) {
-									knot_tcp_relay_t *rl_copy = malloc(sizeof(*rl));
-									memcpy(rl_copy, rl, sizeof(*rl));
-									ptrlist_add(&reuse_conns, rl_copy, NULL);
-									rl_copy->answer = XDP_TCP_NOOP;
-									rl_copy->auto_answer = 0;
+						for (knot_tcp_inbufs_upd_res_t *inbf = rl->inbf; inbf != NULL; inbf = inbf->next) {
+							for (size_t j = 0; j < inbf->n_inbufs; j++) {
+								if (check_dns_payload(&inbf->inbufs[j], ctx, &periodic_stats)) {
+									if (!(ctx->ignore1 & KXDPGUN_IGNORE_CLOSE)) {
+										rl->answer = XDP_TCP_CLOSE;
+									} else if ((ctx->ignore1 & KXDPGUN_REUSE_CONN)) {
+										knot_tcp_relay_t *rl_copy = malloc(sizeof(*rl));
+										memcpy(rl_copy, rl, sizeof(*rl));
+										ptrlist_add(&reuse_conns, rl_copy, NULL);
+										rl_copy->answer = XDP_TCP_NOOP;
+										rl_copy->auto_answer = 0;
+									}
 								}
 							}
 						}
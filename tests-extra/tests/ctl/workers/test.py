@@ -0,0 +1,72 @@
+#!/usr/bin/env python3
+
+'''Test that long zone-status commands don't block other control clients.'''
+
+import time
+from dnstest.libknot import libknot
+from dnstest.test import Test
+from dnstest.utils import *
+
+WORKERS = 4
+ZONES = 1000 # Enough for the zone-status output not to fit into the socket buffers.
+TIMEOUT = 2
+
+def stalled_status(server):
+    '''Start zone-status for all zones and don't read the output.'''
+    ctl = libknot.control.KnotCtl()
+    ctl.connect(os.path.join(server.dir, "knot.sock"))
+    ctl.send_block(cmd="zone-status")
+    return ctl
+
+def status_time(server):
+    '''Return the status command duration or None if timed out.'''
+    ctl = libknot.control.KnotCtl()
+    ctl.set_timeout(TIMEOUT)
+    start = time.time()
+    try:
+        ctl.connect(os.path.join(server.dir, "knot.sock"))
+        ctl.send_block(cmd="status")
+        ctl.receive_block()
+        ctl.send(libknot.control.KnotCtlType.END)
+    except libknot.control.KnotCtlError:
+        return None
+    finally:
+        ctl.close()
+    return time.time() - start
+
+t = Test()
+
+knot = t.server("knot")
+zones = t.zone_rnd(ZONES, records=1, dnssec=False)
+t.link(zones, knot)
+
+knot.ctl_workers = WORKERS
+
+t.start()
+knot.zones_wait(zones)
+
+# Each stalled client occupies one worker until the control timeout.
+stalled = [ stalled_status(knot) for i in range(WORKERS) ]
+t.sleep(1)
+
+# The main thread still processes other clients.
+if status_time(knot) is None:
+    set_err("status blocked by %i long zone-status" % WORKERS)
+
+# One more stalled client occupies the main thread too.
+stalled.append(stalled_status(knot))
+t.sleep(1)
+
+if status_time(knot) is not None:
+    set_err("status not blocked by %i long zone-status" % (WORKERS + 1))
+
+for ctl in stalled:
+    ctl.close()
+t.sleep(1)
+
+# The workers are released with the clients.
+if status_time(knot) is None:
+    set_err("status blocked after closed zone-status")
+knot.ctl("zone-status")
+
+t.end()
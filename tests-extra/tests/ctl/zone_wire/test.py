@@ -0,0 +1,138 @@
+#!/usr/bin/env python3
+
+'''Test zone contents transfer in wire format chunks over the control socket.'''
+
+import base64
+import struct
+import subprocess
+import dns.name
+import dns.rdata
+import dns.rdataclass
+import dns.rdatatype
+from dnstest.libknot import libknot
+from dnstest.test import Test
+from dnstest.utils import *
+
+CtlType = libknot.control.KnotCtlType
+CtlIdx = libknot.control.KnotCtlDataIdx
+
+WIRE_CHUNK_SIZE = (65535 // 4) * 3
+
+def txt_record(sign, owner, ttl, rtype, data):
+    rdata = dns.rdata.from_text(dns.rdataclass.IN, dns.rdatatype.from_text(rtype), data)
+    return (sign, dns.name.from_text(owner).to_text().lower(), int(ttl),
+            dns.rdatatype.to_text(rdata.rdtype), rdata.to_text())
+
+def wire_records(sign, value):
+    '''Decode one chunk of uncompressed records in the wire format.'''
+    wire = base64.b64decode(value)
+    if len(wire) > WIRE_CHUNK_SIZE:
+        set_err("wire chunk too long (%i)" % len(wire))
+    records = []
+    pos = 0
+    while pos < len(wire):
+        owner, used = dns.name.from_wire(wire, pos)
+        pos += used
+        rtype, rclass, ttl, rdlen = struct.unpack_from("!HHIH", wire, pos)
+        pos += 10
+        rdata = dns.rdata.from_wire(rclass, rtype, wire, pos, rdlen)
+        pos += rdlen
+        records.append((sign, owner.to_text().lower(), ttl,
+                        dns.rdatatype.to_text(rtype), rdata.to_text()))
+    return records
+
+def read(server, cmd, zone, wire):
+    '''Return the records as a set, the number of wire chunks, and text records.'''
+    ctl = libknot.control.KnotCtl()
+    ctl.connect(os.path.join(server.dir, "knot.sock"))
+    ctl.send_block(cmd=cmd, zone=zone, flags="w" if wire else None)
+
+    records = set()
+    chunks = 0
+    texts = 0
+    while True:
+        reply = libknot.control.KnotCtlData()
+        if ctl.receive(reply) not in [CtlType.DATA, CtlType.EXTRA]:
+            break
+        if reply[CtlIdx.ERROR]:
+            set_err("%s failed (%s)" % (cmd, reply[CtlIdx.ERROR]))
+            continue
+        compare(reply[CtlIdx.ZONE], zone, "reply zone")
+
+        flags = reply[CtlIdx.FLAGS]
+        sign = flags.replace("w", "")
+        if "w" in flags:
+            chunks += 1
+            records.update(wire_records(sign, reply[CtlIdx.DATA]))
+        else:
+            texts += 1
+            records.add(txt_record(sign, reply[CtlIdx.OWNER], reply[CtlIdx.TTL],
+                                   reply[CtlIdx.TYPE], reply[CtlIdx.DATA]))
+
+    ctl.send(CtlType.END)
+    ctl.close()
+
+    return records, chunks, texts
+
+t = Test()
+
+knot = t.server("knot")
+zone = t.zone_rnd(1, records=2000, dnssec=False)
+t.link(zone, knot)
+
+t.start()
+knot.zones_wait(zone)
+ZONE = zone[0].name
+
+# The wire format chunks carry the same records as the text format.
+txt, chunks, texts = read(knot, "zone-read", ZONE, False)
+isset(chunks == 0, "no wire chunks without the flag")
+wire, chunks, texts = read(knot, "zone-read", ZONE, True)
+isset(chunks > 1, "more wire chunks")
+compare(texts, 0, "text records in the wire mode")
+compare(wire, txt, "wire and text zone contents")
+
+# An RRSet which doesn't fit a chunk falls back to the text format.
+BIG = "big." + ZONE
+big_data = " ".join([ "\"%s\"" % ("x" * 250) ] * 250)
+knot.ctl("zone-begin " + ZONE)
+ctl = libknot.control.KnotCtl()
+ctl.connect(os.path.join(knot.dir, "knot.sock"))
+ctl.send_block(cmd="zone-set", zone=ZONE, owner=BIG, ttl="3600", rtype="TXT", data=big_data)
+ctl.receive_block()
+ctl.send(CtlType.END)
+ctl.close()
+knot.ctl("zone-commit " + ZONE)
+
+wire, chunks, texts = read(knot, "zone-read", ZONE, True)
+compare(texts, 1, "text records for an oversized RRSet")
+big_rec = txt_record("", BIG, 3600, "TXT", big_data)
+isset(big_rec in wire, "oversized RRSet in the text format")
+txt, chunks, texts = read(knot, "zone-read", ZONE, False)
+compare(wire, txt, "wire and text zone contents with an oversized RRSet")
+
+# The zone diff keeps the signs of the changes.
+ADDED = "added." + ZONE
+removed = sorted([ r for r in txt if r[3] in ["A", "AAAA"] ])[0]
+knot.ctl("zone-begin " + ZONE)
+knot.ctl("zone-set %s %s 3600 A 192.0.2.1" % (ZONE, ADDED))
+knot.ctl("zone-unset %s %s %s %s" % (ZONE, removed[1], removed[3], removed[4]))
+
+diff, chunks, texts = read(knot, "zone-diff", ZONE, True)
+isset(chunks > 0, "wire chunks in the zone diff")
+added_rec = txt_record("+", ADDED, 3600, "A", "192.0.2.1")
+removed_rec = ("-",) + removed[1:]
+isset(added_rec in diff, "added record with the plus sign")
+isset(removed_rec in diff, "removed record with the minus sign")
+txt_diff, chunks, texts = read(knot, "zone-diff", ZONE, False)
+compare(diff, txt_diff, "wire and text zone diff")
+
+# knotc prints the wire chunks as the text records.
+out = subprocess.check_output([knot.control_bin] + knot.ctl_params +
+                              ["zone-diff", ZONE]).decode()
+isset(("[%s] +%s 3600 A 192.0.2.1" % (ZONE, ADDED)) in out, "knotc added record")
+isset(("[%s] -%s" % (ZONE, removed[1])) in out, "knotc removed record")
+
+knot.ctl("zone-abort " + ZONE)
+
+t.end()
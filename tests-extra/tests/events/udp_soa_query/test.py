@@ -0,0 +1,147 @@
+#!/usr/bin/env python3
+
+'''Test the refresh SOA query over UDP with the fallbacks to TCP.'''
+
+import select
+import socket
+import threading
+import dns.name
+import dns.rdatatype
+from dnstest.libknot import libknot
+from dnstest.module import ModNoudp, ModStats
+from dnstest.test import Test
+from dnstest.utils import *
+
+def protocols(server, zone):
+    '''Return the number of UDP and TCP requests for the zone.'''
+    ctl = libknot.control.KnotCtl()
+    ctl.connect(os.path.join(server.dir, "knot.sock"))
+    try:
+        ctl.send_block(cmd="zone-stats", section="mod-stats", item="request-protocol",
+                       zone=zone.name)
+        stats = ctl.receive_stats()
+    finally:
+        ctl.send(libknot.control.KnotCtlType.END)
+        ctl.close()
+
+    proto = stats.get("zone", {}).get(zone.name.lower(), {}). \
+                  get("mod-stats", {}).get("request-protocol", {})
+    udp = sum([ v for k, v in proto.items() if k.startswith("udp") ])
+    tcp = sum([ v for k, v in proto.items() if k.startswith("tcp") ])
+    return udp, tcp
+
+def refresh(slave, zone, master):
+    '''Refresh the zone on the slave and return the new master requests.'''
+    udp, tcp = protocols(master, zone)
+    slave.ctl("zone-refresh %s" % zone.name, wait=True)
+    t.sleep(2)
+    new_udp, new_tcp = protocols(master, zone)
+    return new_udp - udp, new_tcp - tcp
+
+def update(master, zone, serials):
+    master.ctl("zone-begin %s" % zone.name)
+    master.ctl("zone-set %s added%i.%s 3600 A 192.0.2.1" %
+               (zone.name, serials[zone.name], zone.name))
+    master.ctl("zone-commit %s" % zone.name)
+    serials[zone.name] = master.zone_wait(zone, serials[zone.name], use_ctl=True)
+
+def soa_queries(sock, zone):
+    '''Return the number of received SOA queries for the zone.'''
+    sock.setblocking(False)
+    queries = 0
+    while True:
+        try:
+            wire = sock.recv(65535)
+        except BlockingIOError:
+            return queries
+        qname, used = dns.name.from_wire(wire, 12)
+        qtype = int.from_bytes(wire[12 + used:14 + used], "big")
+        if qname == dns.name.from_text(zone.name) and qtype == dns.rdatatype.SOA:
+            queries += 1
+
+def relay(listener, target):
+    '''Relay the TCP connections to the target, UDP isn't answered.'''
+    while True:
+        try:
+            conn, _ = listener.accept()
+        except OSError:
+            return
+        upstream = socket.create_connection(target)
+        socks = [ conn, upstream ]
+        while True:
+            readable, _, _ = select.select(socks, [], [], 10)
+            if not readable:
+                break
+            data = readable[0].recv(65535)
+            if not data:
+                break
+            (upstream if readable[0] is conn else conn).sendall(data)
+        conn.close()
+        upstream.close()
+
+ModStats.check()
+ModNoudp.check()
+
+t = Test(address=4)
+
+master = t.server("knot")
+slave = t.server("knot")
+zones = t.zone_rnd(2, records=10, dnssec=False)
+t.link(zones, master, slave)
+
+master.disable_notify = True
+master.udp_soa_query = True
+slave.tcp_remote_io_timeout = 3000
+
+for z in zones:
+    master.add_module(z, ModStats())
+# Every UDP answer for the second zone is truncated.
+master.add_module(zones[1], ModNoudp())
+
+t.start()
+serials = master.zones_wait(zones, use_ctl=True)
+slave.zones_wait(zones, serials, equal=True, greater=False)
+
+# An up-to-date zone is checked over UDP only.
+udp, tcp = refresh(slave, zones[0], master)
+compare((udp, tcp), (1, 0), "UDP and TCP requests, no change")
+
+# A changed zone is transferred over TCP.
+update(master, zones[0], serials)
+udp, tcp = refresh(slave, zones[0], master)
+compare((udp, tcp), (1, 1), "UDP and TCP requests, transfer")
+slave.zone_wait(zones[0], serials[zones[0].name], equal=True, greater=False)
+
+# A truncated answer is followed by the query over TCP.
+update(master, zones[1], serials)
+udp, tcp = refresh(slave, zones[1], master)
+isset(udp == 1 and tcp >= 1, "TCP requests after truncation")
+slave.zone_wait(zones[1], serials[zones[1].name], equal=True, greater=False)
+
+# An unanswered query is retransmitted and then sent over TCP.
+port = t._gen_port()
+blackhole = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+blackhole.bind((master.addr, port))
+listener = socket.socket(socket.AF_INET, socket.SOCK_STREAM)
+listener.bind((master.addr, port))
+listener.listen(8)
+threading.Thread(target=relay, args=[listener, (master.addr, master.port)],
+                 daemon=True).start()
+
+slave.ctl("conf-begin")
+slave.ctl("conf-unset remote[%s].address" % master.name)
+slave.ctl("conf-set remote[%s].address %s@%i" % (master.name, master.addr, port))
+slave.ctl("conf-commit")
+t.sleep(5)
+soa_queries(blackhole, zones[0])
+
+update(master, zones[0], serials)
+udp, tcp = refresh(slave, zones[0], master)
+compare((udp, tcp), (0, 1), "UDP and TCP requests, unanswered UDP")
+slave.zone_wait(zones[0], serials[zones[0].name], equal=True, greater=False)
+compare(soa_queries(blackhole, zones[0]), 3, "SOA queries over UDP")
+
+listener.close()
+blackhole.close()
+
+t.end()
@@ -0,0 +1,90 @@
+#!/usr/bin/env python3
+
+'''Test NOTIFY over UDP, its statistics, and coalescing of duplicate remotes.'''
+
+from dnstest.libknot import libknot
+from dnstest.test import Test
+from dnstest.utils import *
+
+COUNTERS = [ "sent", "acked", "failed", "retransmits", "retried", "coalesced" ]
+
+def notify_stats(server):
+    ctl = libknot.control.KnotCtl()
+    ctl.connect(os.path.join(server.dir, "knot.sock"))
+    try:
+        ctl.send_block(cmd="stats", section="notify")
+        stats = ctl.receive_stats()
+    finally:
+        ctl.send(libknot.control.KnotCtlType.END)
+        ctl.close()
+    return { c: int(stats.get("notify", {}).get(c, 0)) for c in COUNTERS }
+
+def check_stats(server, before, expected, name):
+    '''Wait for the expected counter increments.'''
+    for _ in range(20):
+        after = notify_stats(server)
+        diff = { c: after[c] - before[c] for c in COUNTERS }
+        if diff == expected:
+            break
+        t.sleep(0.5)
+    compare(diff, expected, name)
+    return after
+
+def increments(**kwargs):
+    return { c: kwargs.get(c, 0) for c in COUNTERS }
+
+def update(master, zone, serial):
+    master.ctl("zone-begin %s" % zone.name)
+    master.ctl("zone-set %s added%i.%s 3600 A 192.0.2.1" % (zone.name, serial, zone.name))
+    master.ctl("zone-commit %s" % zone.name)
+    return master.zone_wait(zone, serial)
+
+t = Test()
+
+master = t.server("knot")
+slave = t.server("knot")
+zone = t.zone_rnd(1, records=10, dnssec=False)
+t.link(zone, master, slave)
+
+slave.udp_notify = True
+master.tcp_remote_io_timeout = 1500
+
+t.start()
+serial = master.zone_wait(zone)
+slave.zone_wait(zone, serial, equal=True, greater=False)
+ZONE = zone[0].name
+
+# A NOTIFY over UDP is answered.
+stats = notify_stats(master)
+serial = update(master, zone, serial)
+slave.zone_wait(zone, serial, equal=True, greater=False)
+stats = check_stats(master, stats, increments(sent=1, acked=1), "UDP NOTIFY")
+
+# The slave listed directly and in a remote group is notified once.
+master.ctl("conf-begin")
+master.ctl("conf-set remotes[group].remote %s" % slave.name)
+master.ctl("conf-set zone[%s].notify group" % ZONE)
+master.ctl("conf-commit")
+t.sleep(2)
+
+stats = notify_stats(master)
+serial = update(master, zone, serial)
+slave.zone_wait(zone, serial, equal=True, greater=False)
+stats = check_stats(master, stats, increments(sent=1, acked=1, coalesced=1),
+                    "coalesced NOTIFY")
+
+# An unanswered NOTIFY is retransmitted and the notification fails.
+slave.stop()
+serial = update(master, zone, serial)
+stats = check_stats(master, stats, increments(sent=3, retransmits=2, failed=1, coalesced=1),
+                    "unanswered NOTIFY")
+
+# The failed remote is retried, and only once.
+slave.start()
+slave.zone_wait(zone)
+master.ctl("zone-notify %s" % ZONE)
+stats = check_stats(master, stats, increments(sent=1, acked=1, retried=1, coalesced=1),
+                    "retried NOTIFY")
+slave.zone_wait(zone, serial, equal=True, greater=False)
+
+t.end()
@@ -0,0 +1,87 @@
+#!/usr/bin/env python3
+
+'''Test that stalled DoT handshakes don't block the TCP worker.'''
+
+import socket
+import ssl
+import time
+
+import dns.message
+import dns.query
+
+from dnstest.test import Test
+from dnstest.utils import *
+
+CLIENTS = 100
+ROUNDS = 5
+
+t = Test(tls=True, stress=False)
+
+knot = t.server("knot")
+zone = t.zone("example.com.")
+t.link(zone, knot)
+
+# A single worker must multiplex all pending handshakes.
+knot.tcp_workers = 1
+knot.tcp_io_timeout = 500 # Handshake timeout 4 seconds.
+
+t.start()
+knot.zone_wait(zone)
+
+ctx = ssl.create_default_context()
+ctx.check_hostname = False
+ctx.verify_mode = ssl.CERT_NONE
+
+def client_hello():
+    bio_in, bio_out = ssl.MemoryBIO(), ssl.MemoryBIO()
+    obj = ctx.wrap_bio(bio_in, bio_out)
+    try:
+        obj.do_handshake()
+    except ssl.SSLWantReadError:
+        pass
+    return bio_out.read()
+
+def dot_query():
+    query = dns.message.make_query(zone[0].name, "SOA")
+    start = time.monotonic()
+    resp = dns.query.tls(query, knot.addr, port=knot.tls_port, ssl_context=ctx,
+                         timeout=2)
+    compare(resp.rcode(), dns.rcode.NOERROR, "DoT response RCODE")
+    return time.monotonic() - start
+
+# Slow-loris clients send the ClientHello in small pieces.
+hello = client_hello()
+chunk = max(len(hello) // (ROUNDS + 1), 1)
+slow = []
+for i in range(CLIENTS):
+    sock = socket.create_connection((knot.addr, knot.tls_port))
+    slow.append(sock)
+
+for r in range(ROUNDS):
+    for sock in slow:
+        sock.send(hello[r * chunk:(r + 1) * chunk])
+    elapsed = dot_query()
+    if elapsed > 1:
+        set_err("SLOW DOT QUERY")
+        detail_log("DoT query took %.2f s with %u stalled handshakes" % (elapsed, CLIENTS))
+    t.sleep(0.2)
+
+# The unfinished handshakes must be terminated after the handshake timeout.
+t.sleep(8)
+closed = 0
+for sock in slow:
+    sock.settimeout(0.5)
+    try:
+        if sock.recv(4096) == b"":
+            closed += 1
+    except ConnectionResetError:
+        closed += 1
+    except socket.timeout:
+        pass
+    sock.close()
+compare(closed, CLIENTS, "terminated stalled handshakes")
+
+# The server is still responsive.
+dot_query()
+
+t.end()
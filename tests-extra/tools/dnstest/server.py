@@ -170,6 +170,7 @@ class Server(object):
         self.udp_workers = None
         self.tcp_workers = None
         self.bg_workers = None
+        self.ctl_workers = None
         self.fixed_port = False
         self.ctlport = None
         self.external = False
@@ -178,6 +179,8 @@ class Server(object):
         self.tsig = None
         self.tsig_test = None
         self.no_xfr_edns = None
+        self.udp_soa_query = None
+        self.udp_notify = None
         self.via = None
 
         self.zones = dict()
@@ -1419,6 +1422,7 @@ class Knot(Server):
         s.begin("control")
         s.item_str("listen", "knot.sock")
         s.item_str("timeout", "15")
+        self._str(s, "workers", self.ctl_workers)
         s.end()
 
         if self.tsig:
@@ -1463,6 +1467,8 @@ class Knot(Server):
                         s.item_str("via", self.via)
                     if master.no_xfr_edns:
                         s.item_str("no-edns", "on")
+                    if master.udp_soa_query:
+                        s.item_str("udp-soa-query", "on")
                     servers.add(master.name)
             for slave in z.slaves:
                 if slave.name not in servers:
@@ -1484,6 +1490,8 @@ class Knot(Server):
                         s.item_str("via", self.via)
                     if self.tsig:
                         s.item_str("key", self.tsig.name)
+                    if slave.udp_notify:
+                        s.item_str("udp-notify", "on")
                     servers.add(slave.name)
             for parent in z.dnssec.ksk_sbm_check + [ z.dnssec.ds_push ] if z.dnssec.ds_push else z.dnssec.ksk_sbm_check:
                 if isinstance(parent, Server) and parent.name not in servers:
@@ -0,0 +1,135 @@
+/*  Copyright (C) 2024 CZ.NIC, z.s.p.o. <knot-dns@labs.nic.cz>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Compares the ACL decision rate of the configuration walk (acl_allowed)
+ * with the ACL compiled upon the zone database reload (acl_compiled_allowed).
+ *
+ * Usage: bench_acl [<decisions>]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "test_conf.h"
+#include "knot/updates/acl.h"
+#include "libknot/libknot.h"
+#include "contrib/sockaddr.h"
+
+#define ZONE	"example.zone"
+
+static const char *bench_conf =
+	"key:\n"
+	"  - id: key1\n"
+	"    algorithm: hmac-sha256\n"
+	"    secret: Zm9v\n"
+	"  - id: key2\n"
+	"    algorithm: hmac-sha256\n"
+	"    secret: YmFy\n"
+	"\n"
+	"remote:\n"
+	"  - id: primary\n"
+	"    address: [ 192.0.2.1, 2001:db8::1 ]\n"
+	"    key: key1\n"
+	"\n"
+	"acl:\n"
+	"  - id: acl_deny\n"
+	"    address: [ 198.51.100.0/24 ]\n"
+	"    deny: on\n"
+	"  - id: acl_notify\n"
+	"    remote: primary\n"
+	"    action: notify\n"
+	"  - id: acl_update\n"
+	"    key: [ key1, key2 ]\n"
+	"    update-type: [ A, AAAA ]\n"
+	"    action: update\n"
+	"  - id: acl_transfer\n"
+	"    address: [ 203.0.113.0/24, 2001:db8:1::/48 ]\n"
+	"    key: key2\n"
+	"    action: transfer\n"
+	"\n"
+	"zone:\n"
+	"  - domain: "ZONE"\n"
+	"    acl: [ acl_deny, acl_notify, acl_update, acl_transfer ]\n";
+
+static double decisions_per_sec(conf_t *conf, const acl_compiled_t *compiled,
+                                const struct sockaddr_storage *addr,
+                                const knot_tsig_key_t *key,
+                                const knot_dname_t *zone_name, size_t count)
+{
+	struct timespec begin, end;
+	clock_gettime(CLOCK_MONOTONIC, &begin);
+
+	size_t allowed = 0;
+	for (size_t i = 0; i < count; i++) {
+		knot_tsig_key_t tsig = *key;
+		if (compiled != NULL) {
+			allowed += acl_compiled_allowed(compiled, ACL_ACTION_TRANSFER, addr,
+			                                &tsig, zone_name, NULL, NULL);
+		} else {
+			conf_val_t acl = conf_zone_get(conf, C_ACL, zone_name);
+			allowed += acl_allowed(conf, &acl, ACL_ACTION_TRANSFER, addr,
+			                       &tsig, zone_name, NULL, NULL);
+		}
+	}
+
+	clock_gettime(CLOCK_MONOTONIC, &end);
+	double elapsed = (end.tv_sec - begin.tv_sec) + (end.tv_nsec - begin.tv_nsec) / 1e9;
+
+	if (allowed != count) {
+		fprintf(stderr, "unexpected ACL decision\n");
+		return 0;
+	}
+
+	return (elapsed > 0) ? count / elapsed : 0;
+}
+
+int main(int argc, char *argv[])
+{
+	size_t count = (argc > 1) ? strtoul(argv[1], NULL, 10) : 1000000;
+
+	int ret = test_conf(bench_conf, NULL);
+	if (ret != KNOT_EOK) {
+		fprintf(stderr, "failed to prepare configuration (%s)\n", knot_strerror(ret));
+		return EXIT_FAILURE;
+	}
+
+	knot_dname_t *zone_name = knot_dname_from_str_alloc(ZONE);
+	knot_dname_t *key_name = knot_dname_from_str_alloc("key2");
+	acl_compiled_t *compiled = acl_compile(conf(), zone_name, NULL);
+	if (zone_name == NULL || key_name == NULL || compiled == NULL) {
+		fprintf(stderr, "failed to compile ACL\n");
+		return EXIT_FAILURE;
+	}
+
+	// The last ACL rule matches.
+	struct sockaddr_storage addr;
+	sockaddr_set(&addr, AF_INET6, "2001:db8:1::53", 0);
+	knot_tsig_key_t key = { DNSSEC_TSIG_HMAC_SHA256, key_name };
+
+	double legacy = decisions_per_sec(conf(), NULL, &addr, &key, zone_name, count);
+	double fast = decisions_per_sec(conf(), compiled, &addr, &key, zone_name, count);
+	printf("configuration walk: %.0f decisions/s\n", legacy);
+	printf("compiled ACL:       %.0f decisions/s\n", fast);
+
+	acl_compiled_free(compiled);
+	knot_dname_free(key_name, NULL);
+	knot_dname_free(zone_name, NULL);
+	conf_free(conf());
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,400 @@
+/*  Copyright (C) 2024 CZ.NIC, z.s.p.o. <knot-dns@labs.nic.cz>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Compares zone-read over a control socket with the records sent as text
+ * items and as Base64 wire format chunks (the 'w' flag). The server side
+ * formats the records as knot/ctl/commands.c does, the client side prints
+ * them to /dev/null as knotc does.
+ *
+ * Usage: bench_ctl_wire [<records>]
+ */
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "contrib/base64.h"
+#include "libknot/libknot.h"
+
+#define ZONE		"example."
+#define WIRE_CHUNK_SIZE	((UINT16_MAX / 4) * 3) // As in knot/ctl/commands.c.
+
+typedef struct {
+	knot_rrset_t *rrsets;
+	size_t count;
+	knot_ctl_t *ctl;
+	bool wire;
+	size_t bytes;   // Sent item payload including the item headers.
+	size_t units;   // Sent data units.
+	double cpu;     // Sender thread CPU time.
+	int ret;
+} bench_t;
+
+static const knot_dump_style_t style = {
+	.show_ttl = true,
+	.original_ttl = true,
+	.human_timestamp = true
+};
+
+static char rdata[2 * 65536];
+static char out_rdata[2 * 65536];
+
+static double now(clockid_t clock)
+{
+	struct timespec ts;
+	clock_gettime(clock, &ts);
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/* Records of a typical zone, an A, AAAA, and TXT RRSet per name. */
+static knot_rrset_t *gen_rrsets(size_t count)
+{
+	knot_rrset_t *rrsets = calloc(count, sizeof(*rrsets));
+	if (rrsets == NULL) {
+		return NULL;
+	}
+
+	for (size_t i = 0; i < count; i++) {
+		char owner[64];
+		(void)snprintf(owner, sizeof(owner), "host%zu." ZONE, i / 3);
+		knot_dname_t *dname = knot_dname_from_str_alloc(owner);
+
+		uint8_t data[64];
+		uint16_t type, len;
+		switch (i % 3) {
+		case 0:
+			type = KNOT_RRTYPE_A;
+			len = 4;
+			knot_wire_write_u32(data, 0xC0000200 + i);
+			break;
+		case 1:
+			type = KNOT_RRTYPE_AAAA;
+			len = 16;
+			memset(data, 0, len);
+			knot_wire_write_u32(data, 0x20010db8);
+			knot_wire_write_u32(data + 12, i);
+			break;
+		default:
+			type = KNOT_RRTYPE_TXT;
+			len = 1 + snprintf((char *)data + 1, sizeof(data) - 1,
+			                   "v=spf1 ip4:192.0.2.%zu -all", i % 256);
+			data[0] = len - 1;
+			break;
+		}
+
+		knot_rrset_init(&rrsets[i], dname, type, KNOT_CLASS_IN, 3600);
+		if (knot_rrset_add_rdata(&rrsets[i], data, len, NULL) != KNOT_EOK) {
+			return NULL;
+		}
+	}
+
+	return rrsets;
+}
+
+static size_t data_size(knot_ctl_data_t *data)
+{
+	size_t size = 1; // Data unit type.
+	for (knot_ctl_idx_t i = 0; i < KNOT_CTL_IDX__COUNT; i++) {
+		if ((*data)[i] != NULL) {
+			size += 1 + sizeof(uint16_t) + strlen((*data)[i]);
+		}
+	}
+	return size;
+}
+
+static int send_data(bench_t *b, knot_ctl_data_t *data)
+{
+	b->bytes += data_size(data);
+	b->units++;
+	return knot_ctl_send(b->ctl, KNOT_CTL_TYPE_DATA, data);
+}
+
+static int send_txt(bench_t *b)
+{
+	knot_dname_txt_storage_t owner;
+	char ttl[16], type[32];
+	knot_ctl_data_t data = {
+		[KNOT_CTL_IDX_ZONE] = ZONE,
+		[KNOT_CTL_IDX_OWNER] = owner,
+		[KNOT_CTL_IDX_TTL] = ttl,
+		[KNOT_CTL_IDX_TYPE] = type,
+		[KNOT_CTL_IDX_DATA] = rdata
+	};
+
+	for (size_t i = 0; i < b->count; i++) {
+		knot_rrset_t *rrset = &b->rrsets[i];
+		if (knot_dname_to_str(owner, rrset->owner, sizeof(owner)) == NULL ||
+		    knot_rrtype_to_string(rrset->type, type, sizeof(type)) < 0) {
+			return KNOT_EINVAL;
+		}
+		(void)snprintf(ttl, sizeof(ttl), "%u", rrset->ttl);
+
+		for (size_t j = 0; j < rrset->rrs.count; j++) {
+			int ret = knot_rrset_txt_dump_data(rrset, j, rdata, sizeof(rdata), &style);
+			if (ret < 0) {
+				return ret;
+			}
+			ret = send_data(b, &data);
+			if (ret != KNOT_EOK) {
+				return ret;
+			}
+		}
+	}
+
+	return KNOT_EOK;
+}
+
+static int send_chunk(bench_t *b, const uint8_t *wire, size_t len)
+{
+	int32_t ret = knot_base64_encode(wire, len, (uint8_t *)rdata, sizeof(rdata) - 1);
+	if (ret < 0) {
+		return ret;
+	}
+	rdata[ret] = '\0';
+
+	knot_ctl_data_t data = {
+		[KNOT_CTL_IDX_FLAGS] = "w",
+		[KNOT_CTL_IDX_ZONE] = ZONE,
+		[KNOT_CTL_IDX_DATA] = rdata
+	};
+
+	return send_data(b, &data);
+}
+
+static int send_wire(bench_t *b)
+{
+	static uint8_t wire[WIRE_CHUNK_SIZE];
+	size_t len = 0;
+
+	for (size_t i = 0; i < b->count; i++) {
+		int ret = knot_rrset_to_wire(&b->rrsets[i], wire + len,
+		                             sizeof(wire) - len, NULL);
+		if (ret == KNOT_ESPACE && len > 0) {
+			ret = send_chunk(b, wire, len);
+			if (ret != KNOT_EOK) {
+				return ret;
+			}
+			len = 0;
+			ret = knot_rrset_to_wire(&b->rrsets[i], wire, sizeof(wire), NULL);
+		}
+		if (ret < 0) {
+			return ret;
+		}
+		len += ret;
+	}
+
+	return (len > 0) ? send_chunk(b, wire, len) : KNOT_EOK;
+}
+
+static void *sender(void *arg)
+{
+	bench_t *b = arg;
+
+	double begin = now(CLOCK_THREAD_CPUTIME_ID);
+	b->ret = knot_ctl_accept(b->ctl);
+	if (b->ret == KNOT_EOK) {
+		b->ret = b->wire ? send_wire(b) : send_txt(b);
+		if (b->ret == KNOT_EOK) {
+			b->ret = knot_ctl_send(b->ctl, KNOT_CTL_TYPE_BLOCK, NULL);
+		}
+		knot_ctl_close(b->ctl);
+	}
+	b->cpu = now(CLOCK_THREAD_CPUTIME_ID) - begin;
+
+	return NULL;
+}
+
+static int print_wire(FILE *out, const char *value, size_t *records)
+{
+	uint8_t *wire = NULL;
+	int32_t wire_len = knot_base64_decode_alloc((const uint8_t *)value,
+	                                            strlen(value), &wire);
+	if (wire_len < 0) {
+		return wire_len;
+	}
+
+	size_t pos = 0;
+	while (pos < wire_len) {
+		knot_rrset_t rrset;
+		int ret = knot_rrset_rr_from_wire(wire, &pos, wire_len, &rrset, NULL, false);
+		if (ret != KNOT_EOK) {
+			free(wire);
+			return ret;
+		}
+
+		knot_dname_txt_storage_t owner;
+		char type[32];
+		if (knot_dname_to_str(owner, rrset.owner, sizeof(owner)) == NULL ||
+		    knot_rrtype_to_string(rrset.type, type, sizeof(type)) < 0 ||
+		    knot_rrset_txt_dump_data(&rrset, 0, out_rdata, sizeof(out_rdata), &style) < 0) {
+			knot_rrset_clear(&rrset, NULL);
+			free(wire);
+			return KNOT_EMALF;
+		}
+		fprintf(out, "[%s] %s %u %s %s\n", ZONE, owner, rrset.ttl, type, out_rdata);
+		(*records)++;
+
+		knot_rrset_clear(&rrset, NULL);
+	}
+
+	free(wire);
+
+	return KNOT_EOK;
+}
+
+static int receive(knot_ctl_t *ctl, FILE *out, size_t *records)
+{
+	while (true) {
+		knot_ctl_type_t type;
+		knot_ctl_data_t data;
+		int ret = knot_ctl_receive(ctl, &type, &data);
+		if (ret != KNOT_EOK) {
+			return ret;
+		} else if (type != KNOT_CTL_TYPE_DATA) {
+			return KNOT_EOK;
+		}
+
+		const char *flags = data[KNOT_CTL_IDX_FLAGS];
+		if (flags != NULL && strchr(flags, 'w') != NULL) {
+			ret = print_wire(out, data[KNOT_CTL_IDX_DATA], records);
+			if (ret != KNOT_EOK) {
+				return ret;
+			}
+		} else {
+			fprintf(out, "[%s] %s %s %s %s\n", data[KNOT_CTL_IDX_ZONE],
+			        data[KNOT_CTL_IDX_OWNER], data[KNOT_CTL_IDX_TTL],
+			        data[KNOT_CTL_IDX_TYPE], data[KNOT_CTL_IDX_DATA]);
+			(*records)++;
+		}
+	}
+}
+
+static int run(bench_t *b, const char *path, FILE *out)
+{
+	knot_ctl_t *server = knot_ctl_alloc();
+	knot_ctl_t *client = knot_ctl_alloc();
+	if (server == NULL || client == NULL) {
+		knot_ctl_free(server);
+		knot_ctl_free(client);
+		return KNOT_ENOMEM;
+	}
+
+	int ret = knot_ctl_bind(server, path, 1);
+	if (ret != KNOT_EOK) {
+		knot_ctl_free(server);
+		knot_ctl_free(client);
+		return ret;
+	}
+
+	b->ctl = server;
+	b->bytes = 0;
+	b->units = 0;
+
+	double begin = now(CLOCK_MONOTONIC);
+
+	pthread_t thread;
+	if (pthread_create(&thread, NULL, sender, b) != 0) {
+		knot_ctl_unbind(server);
+		knot_ctl_free(server);
+		knot_ctl_free(client);
+		return KNOT_ERROR;
+	}
+
+	size_t records = 0;
+	ret = knot_ctl_connect(client, path);
+	if (ret == KNOT_EOK) {
+		ret = receive(client, out, &records);
+		knot_ctl_close(client);
+	}
+	pthread_join(thread, NULL);
+
+	double total = now(CLOCK_MONOTONIC) - begin;
+
+	knot_ctl_unbind(server);
+	knot_ctl_free(server);
+	knot_ctl_free(client);
+
+	if (ret == KNOT_EOK) {
+		ret = b->ret;
+	}
+	if (ret == KNOT_EOK && records != b->count) {
+		ret = KNOT_EMALF;
+	}
+	if (ret != KNOT_EOK) {
+		return ret;
+	}
+
+	printf("%s: %.3f s total, %.3f s sender CPU, %zu data units, %.1f MiB\n",
+	       b->wire ? "wire" : "text", total, b->cpu, b->units,
+	       b->bytes / (1024.0 * 1024.0));
+
+	return KNOT_EOK;
+}
+
+int main(int argc, char *argv[])
+{
+	size_t count = (argc > 1) ? strtoul(argv[1], NULL, 10) : 1000000;
+
+	knot_rrset_t *rrsets = gen_rrsets(count);
+	if (rrsets == NULL) {
+		fprintf(stderr, "failed to generate records\n");
+		return EXIT_FAILURE;
+	}
+
+	FILE *out = fopen("/dev/null", "w");
+	if (out == NULL) {
+		fprintf(stderr, "failed to open /dev/null\n");
+		return EXIT_FAILURE;
+	}
+
+	char path[] = "/tmp/bench_ctl_wire.XXXXXX";
+	if (mkdtemp(path) == NULL) {
+		fprintf(stderr, "failed to create temporary directory\n");
+		return EXIT_FAILURE;
+	}
+	char sock[sizeof(path) + 16];
+	(void)snprintf(sock, sizeof(sock), "%s/knot.sock", path);
+
+	printf("%zu records\n", count);
+
+	int ret = KNOT_EOK;
+	for (int wire = 0; wire <= 1 && ret == KNOT_EOK; wire++) {
+		bench_t b = {
+			.rrsets = rrsets,
+			.count = count,
+			.wire = wire
+		};
+		ret = run(&b, sock, out);
+		if (ret != KNOT_EOK) {
+			fprintf(stderr, "%s mode failed (%s)\n", wire ? "wire" : "text",
+			        knot_strerror(ret));
+		}
+	}
+
+	(void)unlink(sock);
+	(void)rmdir(path);
+	fclose(out);
+	for (size_t i = 0; i < count; i++) {
+		knot_rrset_clear(&rrsets[i], NULL);
+	}
+	free(rrsets);
+
+	return (ret == KNOT_EOK) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
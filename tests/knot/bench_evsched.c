@@ -0,0 +1,114 @@
+/*  Copyright (C) 2024 CZ.NIC, z.s.p.o. <knot-dns@labs.nic.cz>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Measures the event scheduler cost of scheduling, rescheduling, and
+ * cancelling one timer per zone, with hour-scale jittered timers as zone
+ * events have.
+ *
+ * Usage: bench_evsched [<zones>]
+ */
+
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "libknot/error.h"
+#include "knot/common/evsched.h"
+
+#define HOUR_MS	(3600 * 1000)
+
+static void event_cb(event_t *ev)
+{
+}
+
+static void interrupt_handle(int s)
+{
+}
+
+static double now(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static double schedule_all(event_t **events, size_t count)
+{
+	double begin = now();
+	for (size_t i = 0; i < count; i++) {
+		(void)evsched_schedule(events[i], HOUR_MS + random() % HOUR_MS);
+	}
+	return now() - begin;
+}
+
+int main(int argc, char *argv[])
+{
+	size_t count = (argc > 1) ? strtoul(argv[1], NULL, 10) : 1000000;
+
+	struct sigaction sa;
+	sa.sa_handler = interrupt_handle;
+	sigemptyset(&sa.sa_mask);
+	sa.sa_flags = 0;
+	sigaction(SIGALRM, &sa, NULL);
+
+	evsched_t sched;
+	int ret = evsched_init(&sched, NULL);
+	if (ret != KNOT_EOK) {
+		fprintf(stderr, "failed to create scheduler (%s)\n", knot_strerror(ret));
+		return EXIT_FAILURE;
+	}
+	evsched_start(&sched);
+
+	event_t **events = calloc(count, sizeof(*events));
+	if (events == NULL) {
+		fprintf(stderr, "failed to allocate events\n");
+		return EXIT_FAILURE;
+	}
+	for (size_t i = 0; i < count; i++) {
+		events[i] = evsched_event_create(&sched, event_cb, NULL);
+		if (events[i] == NULL) {
+			fprintf(stderr, "failed to create events\n");
+			return EXIT_FAILURE;
+		}
+	}
+
+	double schedule = schedule_all(events, count);
+	double reschedule = schedule_all(events, count);
+
+	double begin = now();
+	for (size_t i = 0; i < count; i++) {
+		(void)evsched_cancel(events[i]);
+	}
+	double cancel = now() - begin;
+
+	printf("%zu events\n", count);
+	printf("schedule:   %.3f s\n", schedule);
+	printf("reschedule: %.3f s\n", reschedule);
+	printf("cancel:     %.3f s\n", cancel);
+
+	evsched_stop(&sched);
+	evsched_join(&sched);
+
+	for (size_t i = 0; i < count; i++) {
+		evsched_event_free(events[i]);
+	}
+	free(events);
+	evsched_deinit(&sched);
+
+	return EXIT_SUCCESS;
+}
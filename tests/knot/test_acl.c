@@ -37,6 +37,26 @@ static void check_sockaddr_set(struct sockaddr_storage *ss, int family,
 	ok(ret == 0, "set address '%s'", straddr);
 }
 
+static void check_compiled(conf_t *conf, acl_action_t action,
+                           const struct sockaddr_storage *addr, const knot_tsig_key_t *key,
+                           const knot_dname_t *zone_name, knot_pkt_t *query, bool expected)
+{
+	acl_compiled_t *acl = acl_compile(conf, zone_name, NULL);
+	ok(acl != NULL, "Compile zone ACL");
+
+	knot_tsig_key_t tsig = *key;
+	tsig.secret = (dnssec_binary_t){ 0 };
+	bool ret = acl_compiled_allowed(acl, action, addr, &tsig, zone_name, query, NULL);
+	ok(ret == expected, "Compiled ACL equivalent");
+	if (ret && key->name != NULL) {
+		ok(tsig.secret.size == key->secret.size &&
+		   memcmp(tsig.secret.data, key->secret.data, tsig.secret.size) == 0,
+		   "Compiled ACL secret");
+	}
+
+	acl_compiled_free(acl);
+}
+
 void check_update(conf_t *conf, knot_rrset_t *authority, knot_tsig_key_t *key,
                   knot_dname_t *zone_name, bool allowed, const char *desc)
 {
@@ -57,11 +77,41 @@ void check_update(conf_t *conf, knot_rrset_t *authority, knot_tsig_key_t *key,
 	bool ret = acl_allowed(conf, &acl, ACL_ACTION_UPDATE, &addr, key,
 	                       zone_name, parsed, NULL);
 	ok(ret == allowed, "%s", desc);
+	check_compiled(conf, ACL_ACTION_UPDATE, &addr, key, zone_name, parsed, ret);
 
 	knot_pkt_free(parsed);
 	knot_pkt_free(query);
 }
 
+static void test_compiled(conf_t *conf, const knot_dname_t *zone_name,
+                          const knot_dname_t *zone2_name)
+{
+	trie_t *cache = trie_create(NULL);
+	ok(cache != NULL, "Create ACL cache");
+
+	acl_compiled_t *acl1 = acl_compile(conf, zone_name, cache);
+	ok(acl1 != NULL && acl1->count == 6, "Compile zone ACL, cached");
+	acl_compiled_t *acl2 = acl_compile(conf, zone_name, cache);
+	ok(acl2 != NULL && acl2->count == 6, "Compile zone ACL again, cached");
+	ok(acl1->rules[0] == acl2->rules[0] && acl1->rules[5] == acl2->rules[5],
+	   "Shared compiled rules");
+	acl_compiled_t *acl3 = acl_compile(conf, zone2_name, cache);
+	ok(acl3 != NULL && acl3->count == 2, "Compile zone2 ACL, cached");
+
+	acl_cache_free(cache);
+	acl_compiled_free(acl2);
+
+	/* Rules must outlive the cache and the other zone. */
+	struct sockaddr_storage addr;
+	check_sockaddr_set(&addr, AF_INET6, "::1", 0);
+	knot_tsig_key_t tsig = { 0 };
+	ok(acl_compiled_allowed(acl1, ACL_ACTION_TRANSFER, &addr, &tsig,
+	                        zone_name, NULL, NULL), "Compiled ACL after cache free");
+
+	acl_compiled_free(acl1);
+	acl_compiled_free(acl3);
+}
+
 static void test_acl_allowed(void)
 {
 	int ret;
@@ -163,96 +213,112 @@ static void test_acl_allowed(void)
 	check_sockaddr_set(&addr, AF_INET6, "2001::1", 0);
 	ret = acl_allowed(conf(), &acl, ACL_ACTION_QUERY, &addr, &key1, zone_name, NULL, NULL);
 	ok(ret == true, "Address, key, empty action");
+	check_compiled(conf(), ACL_ACTION_QUERY, &addr, &key1, zone_name, NULL, ret);
 
 	acl = conf_zone_get(conf(), C_ACL, zone_name);
 	ok(acl.code == KNOT_EOK, "Get zone ACL");
 	check_sockaddr_set(&addr, AF_INET6, "2001::1", 0);
 	ret = acl_allowed(conf(), &acl, ACL_ACTION_TRANSFER, &addr, &key1, zone_name, NULL, NULL);
 	ok(ret == true, "Address, key, action match");
+	check_compiled(conf(), ACL_ACTION_TRANSFER, &addr, &key1, zone_name, NULL, ret);
 
 	acl = conf_zone_get(conf(), C_ACL, zone_name);
 	ok(acl.code == KNOT_EOK, "Get zone ACL");
 	check_sockaddr_set(&addr, AF_INET6, "2001::2", 0);
 	ret = acl_allowed(conf(), &acl, ACL_ACTION_TRANSFER, &addr, &key1, zone_name, NULL, NULL);
 	ok(ret == false, "Address not match, key, action match");
+	check_compiled(conf(), ACL_ACTION_TRANSFER, &addr, &key1, zone_name, NULL, ret);
 
 	acl = conf_zone_get(conf(), C_ACL, zone_name);
 	ok(acl.code == KNOT_EOK, "Get zone ACL");
 	check_sockaddr_set(&addr, AF_INET6, "2001::1", 0);
 	ret = acl_allowed(conf(), &acl, ACL_ACTION_TRANSFER, &addr, &key0, zone_name, NULL, NULL);
 	ok(ret == false, "Address match, no key, action match");
+	check_compiled(conf(), ACL_ACTION_TRANSFER, &addr, &key0, zone_name, NULL, ret);
 
 	acl = conf_zone_get(conf(), C_ACL, zone_name);
 	ok(acl.code == KNOT_EOK, "Get zone ACL");
 	check_sockaddr_set(&addr, AF_INET6, "2001::1", 0);
 	ret = acl_allowed(conf(), &acl, ACL_ACTION_TRANSFER, &addr, &key2, zone_name, NULL, NULL);
 	ok(ret == false, "Address match, key not match, action match");
+	check_compiled(conf(), ACL_ACTION_TRANSFER, &addr, &key2, zone_name, NULL, ret);
 
 	acl = conf_zone_get(conf(), C_ACL, zone_name);
 	ok(acl.code == KNOT_EOK, "Get zone ACL");
 	check_sockaddr_set(&addr, AF_INET6, "2001::1", 0);
 	ret = acl_allowed(conf(), &acl, ACL_ACTION_NOTIFY, &addr, &key1, zone_name, NULL, NULL);
 	ok(ret == false, "Address, key match, action not match");
+	check_compiled(conf(), ACL_ACTION_NOTIFY, &addr, &key1, zone_name, NULL, ret);
 
 	acl = conf_zone_get(conf(), C_ACL, zone_name);
 	ok(acl.code == KNOT_EOK, "Get zone ACL");
 	check_sockaddr_set(&addr, AF_INET, "240.0.0.1", 0);
 	ret = acl_allowed(conf(), &acl, ACL_ACTION_NOTIFY, &addr, &key0, zone_name, NULL, NULL);
 	ok(ret == true, "Second address match, no key, action match");
+	check_compiled(conf(), ACL_ACTION_NOTIFY, &addr, &key0, zone_name, NULL, ret);
 
 	acl = conf_zone_get(conf(), C_ACL, zone_name);
 	ok(acl.code == KNOT_EOK, "Get zone ACL");
 	check_sockaddr_set(&addr, AF_INET, "240.0.0.1", 0);
 	ret = acl_allowed(conf(), &acl, ACL_ACTION_NOTIFY, &addr, &key1, zone_name, NULL, NULL);
 	ok(ret == false, "Second address match, extra key, action match");
+	check_compiled(conf(), ACL_ACTION_NOTIFY, &addr, &key1, zone_name, NULL, ret);
 
 	acl = conf_zone_get(conf(), C_ACL, zone_name);
 	ok(acl.code == KNOT_EOK, "Get zone ACL");
 	check_sockaddr_set(&addr, AF_INET, "240.0.0.2", 0);
 	ret = acl_allowed(conf(), &acl, ACL_ACTION_NOTIFY, &addr, &key0, zone_name, NULL, NULL);
 	ok(ret == false, "Denied address match, no key, action match");
+	check_compiled(conf(), ACL_ACTION_NOTIFY, &addr, &key0, zone_name, NULL, ret);
 
 	acl = conf_zone_get(conf(), C_ACL, zone_name);
 	ok(acl.code == KNOT_EOK, "Get zone ACL");
 	check_sockaddr_set(&addr, AF_INET, "240.0.0.2", 0);
 	ret = acl_allowed(conf(), &acl, ACL_ACTION_UPDATE, &addr, &key0, zone_name, NULL, NULL);
 	ok(ret == true, "Denied address match, no key, action not match");
+	check_compiled(conf(), ACL_ACTION_UPDATE, &addr, &key0, zone_name, NULL, ret);
 
 	acl = conf_zone_get(conf(), C_ACL, zone_name);
 	ok(acl.code == KNOT_EOK, "Get zone ACL");
 	check_sockaddr_set(&addr, AF_INET, "240.0.0.3", 0);
 	ret = acl_allowed(conf(), &acl, ACL_ACTION_UPDATE, &addr, &key0, zone_name, NULL, NULL);
 	ok(ret == false, "Denied address match, no key, no action");
+	check_compiled(conf(), ACL_ACTION_UPDATE, &addr, &key0, zone_name, NULL, ret);
 
 	acl = conf_zone_get(conf(), C_ACL, zone_name);
 	ok(acl.code == KNOT_EOK, "Get zone ACL");
 	check_sockaddr_set(&addr, AF_INET, "1.1.1.1", 0);
 	ret = acl_allowed(conf(), &acl, ACL_ACTION_UPDATE, &addr, &key3, zone_name, NULL, NULL);
 	ok(ret == true, "Arbitrary address, second key, action match");
+	check_compiled(conf(), ACL_ACTION_UPDATE, &addr, &key3, zone_name, NULL, ret);
 
 	acl = conf_zone_get(conf(), C_ACL, zone_name);
 	ok(acl.code == KNOT_EOK, "Get zone ACL");
 	check_sockaddr_set(&addr, AF_INET, "100.0.0.1", 0);
 	ret = acl_allowed(conf(), &acl, ACL_ACTION_TRANSFER, &addr, &key0, zone_name, NULL, NULL);
 	ok(ret == true, "IPv4 address from range, no key, action match");
+	check_compiled(conf(), ACL_ACTION_TRANSFER, &addr, &key0, zone_name, NULL, ret);
 
 	acl = conf_zone_get(conf(), C_ACL, zone_name);
 	ok(acl.code == KNOT_EOK, "Get zone ACL");
 	check_sockaddr_set(&addr, AF_INET6, "::1", 0);
 	ret = acl_allowed(conf(), &acl, ACL_ACTION_TRANSFER, &addr, &key0, zone_name, NULL, NULL);
 	ok(ret == true, "IPv6 address from range, no key, action match");
+	check_compiled(conf(), ACL_ACTION_TRANSFER, &addr, &key0, zone_name, NULL, ret);
 
 	acl = conf_zone_get(conf(), C_ACL, zone2_name);
 	ok(acl.code == KNOT_EOK, "Get zone2 ACL");
 	check_sockaddr_set(&addr, AF_INET, "240.0.0.4", 0);
 	ret = acl_allowed(conf(), &acl, ACL_ACTION_NOTIFY, &addr, &key1, zone2_name, NULL, NULL);
 	ok(ret == false, "Address, key, action, denied");
+	check_compiled(conf(), ACL_ACTION_NOTIFY, &addr, &key1, zone2_name, NULL, ret);
 
 	acl = conf_zone_get(conf(), C_ACL, zone2_name);
 	ok(acl.code == KNOT_EOK, "Get zone2 ACL");
 	check_sockaddr_set(&addr, AF_INET, "240.0.0.1", 0);
 	ret = acl_allowed(conf(), &acl, ACL_ACTION_NOTIFY, &addr, &key1, zone2_name, NULL, NULL);
 	ok(ret == true, "Address, key, action, match");
+	check_compiled(conf(), ACL_ACTION_NOTIFY, &addr, &key1, zone2_name, NULL, ret);
 
 	knot_rrset_t A;
 	knot_rrset_init(&A, key1_name, KNOT_RRTYPE_A, KNOT_CLASS_IN, 3600);
@@ -295,6 +361,8 @@ static void test_acl_allowed(void)
 	knot_dname_free(aa_key2_name, NULL);
 	knot_rdataset_clear(&aaA.rrs, NULL);
 
+	test_compiled(conf(), zone_name, zone2_name);
+
 	conf_free(conf());
 	knot_dname_free(zone_name, NULL);
 	knot_dname_free(zone2_name, NULL);
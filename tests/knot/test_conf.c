@@ -322,6 +322,60 @@ static void test_conf_remote(void)
 	test_conf_free();
 }
 
+static void test_conf_zone_cache(void)
+{
+	const char *conf_string =
+		"remote:\n"
+		"  - id: r1\n"
+		"    address: ::1\n"
+		"template:\n"
+		"  - id: default\n"
+		"    zonefile-sync: 60\n"
+		"    retry-min-interval: 10\n"
+		"  - id: t1\n"
+		"    dnssec-signing: on\n"
+		"    semantic-checks: soft\n"
+		"    ixfr-by-one: on\n"
+		"zone:\n"
+		"  - domain: a.\n"
+		"    template: t1\n"
+		"    master: r1\n"
+		"    retry-max-interval: 100\n"
+		"  - domain: b.\n"
+		"    zonemd-generate: zonemd-sha384\n"
+		"    zone-max-size: 1000\n";
+
+	int ret = test_conf(conf_string, NULL);
+	is_int(KNOT_EOK, ret, "Prepare configuration");
+
+	knot_dname_t *zone_a = knot_dname_from_str_alloc("a.");
+	knot_dname_t *zone_b = knot_dname_from_str_alloc("b.");
+	ok(zone_a != NULL && zone_b != NULL, "create zone names");
+
+	conf_zone_cache_t a = conf_zone_cache(conf(), zone_a);
+	ok(a.is_slave, "zone a, secondary");
+	ok(a.dnssec_signing, "zone a, template signing");
+	ok(a.ixfr_by_one, "zone a, template IXFR by one");
+	is_int(SEMCHECKS_SOFT, a.semantic_checks, "zone a, template semantic checks");
+	is_int(0, a.zonefile_sync, "zone a, implicit zonefile sync");
+	is_int(1, a.retry_min_interval, "zone a, implicit retry min interval");
+	is_int(100, a.retry_max_interval, "zone a, retry max interval");
+
+	conf_zone_cache_t b = conf_zone_cache(conf(), zone_b);
+	ok(!b.is_slave, "zone b, primary");
+	ok(!b.dnssec_signing, "zone b, default signing");
+	is_int(ZONE_DIGEST_SHA384, b.zonemd_generate, "zone b, ZONEMD generate");
+	is_int(60, b.zonefile_sync, "zone b, default zonefile sync");
+	is_int(10, b.retry_min_interval, "zone b, default retry min interval");
+	is_int(1000, b.zone_max_size, "zone b, max size");
+
+	is_int(1, b.adjust_threads, "zone b, implicit adjust threads");
+
+	test_conf_free();
+	knot_dname_free(zone_a, NULL);
+	knot_dname_free(zone_b, NULL);
+}
+
 int main(int argc, char *argv[])
 {
 	plan_lazy();
@@ -338,5 +392,8 @@ int main(int argc, char *argv[])
 	diag("conf_remote");
 	test_conf_remote();
 
+	diag("conf_zone_cache");
+	test_conf_zone_cache();
+
 	return 0;
 }
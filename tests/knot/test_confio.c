@@ -14,7 +14,10 @@
     along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include <stdio.h>
+#include <stdlib.h>
 #include <tap/basic.h>
+#include <tap/files.h>
 
 #include "test_conf.h"
 #include "knot/conf/confio.h"
@@ -911,6 +914,7 @@ static void test_conf_io_list(void)
 	      "server.tcp-remote-io-timeout\n"
 	      "server.tcp-max-clients\n"
 	      "server.tcp-reuseport\n"
+	      "server.tcp-io-uring\n"
 	      "server.tcp-fastopen\n"
 	      "server.quic-max-clients\n"
 	      "server.quic-idle-close-timeout\n"
@@ -978,6 +982,7 @@ static const yp_item_t desc_server[] = {
 	{ C_TCP_RMT_IO_TIMEOUT,	  YP_TINT,  YP_VNONE },
 	{ C_TCP_MAX_CLIENTS,	  YP_TINT,  YP_VNONE },
 	{ C_TCP_REUSEPORT,	  YP_TBOOL, YP_VNONE },
+	{ C_TCP_IO_URING,	  YP_TBOOL, YP_VNONE },
 	{ C_TCP_FASTOPEN,	  YP_TBOOL, YP_VNONE },
 	{ C_QUIC_MAX_CLIENTS,	  YP_TINT,  YP_VNONE },
 	{ C_QUIC_IDLE_CLOSE,	  YP_TINT,  YP_VNONE },
@@ -1006,10 +1011,13 @@ static const yp_item_t desc_xdp[] = {
 	{ C_TCP_IDLE_CLOSE,     YP_TINT,  YP_VNONE },
 	{ C_TCP_IDLE_RESET,     YP_TINT,  YP_VNONE },
 	{ C_TCP_RESEND,         YP_TINT,  YP_VNONE },
+	{ C_TCP_INIT_WINDOW,    YP_TINT,  YP_VNONE },
 	{ C_ROUTE_CHECK,        YP_TBOOL, YP_VNONE },
 	{ C_RING_SIZE,          YP_TINT,  YP_VNONE },
 	{ C_BUSYPOLL_BUDGET,    YP_TINT,  YP_VNONE },
 	{ C_BUSYPOLL_TIMEOUT,   YP_TINT,  YP_VNONE },
+	{ C_BUSYPOLL_ADAPTIVE,  YP_TBOOL, YP_VNONE },
+	{ C_TX_MULTI_BUFFER,    YP_TBOOL, YP_VNONE },
 	{ NULL }
 };
 
@@ -1065,6 +1073,147 @@ const yp_item_t test_schema[] = {
 	{ NULL }
 };
 
+static conf_io_type_t diff_zone_type(const char *zone)
+{
+	knot_dname_storage_t name;
+	if (conf()->io.zones == NULL ||
+	    knot_dname_from_str(name, zone, sizeof(name)) == NULL) {
+		return CONF_IO_TNONE;
+	}
+
+	trie_val_t *val = trie_get_try(conf()->io.zones, name, knot_dname_size(name));
+	return (val != NULL) ? (conf_io_type_t)(uintptr_t)*val : CONF_IO_TNONE;
+}
+
+static void test_conf_io_diff_reload(void)
+{
+	const char *old_str =
+		"remote:\n"
+		"  - id: primary\n"
+		"    address: 192.0.2.1\n"
+		"template:\n"
+		"  - id: default\n"
+		"    storage: /tmp\n"
+		"  - id: tpl\n"
+		"    storage: /tmp/a\n"
+		"zone:\n"
+		"  - domain: a.\n"
+		"  - domain: b.\n"
+		"    template: tpl\n"
+		"  - domain: c.\n"
+		"    template: tpl\n"
+		"  - domain: d.\n";
+	const char *new_str =
+		"remote:\n"
+		"  - id: primary\n"
+		"    address: 192.0.2.2\n"
+		"template:\n"
+		"  - id: default\n"
+		"    storage: /tmp\n"
+		"  - id: tpl\n"
+		"    storage: /tmp/b\n"
+		"zone:\n"
+		"  - domain: a.\n"
+		"    file: a.zone\n"
+		"  - domain: b.\n"
+		"    template: tpl\n"
+		"  - domain: c.\n"
+		"    template: tpl\n"
+		"  - domain: e.\n";
+
+	ok(test_conf(old_str, NULL) == KNOT_EOK, "Prepare old configuration");
+
+	conf_t *new_conf = NULL;
+	ok(conf_clone(&new_conf) == KNOT_EOK, "Clone configuration");
+	ok(conf_import(new_conf, new_str, 0) == KNOT_EOK, "Import new configuration");
+
+	int ret = conf_io_diff_reload(conf(), new_conf);
+	is_int(KNOT_EOK, ret, "Compare configurations");
+
+	// Swap the configurations to inspect the reload context.
+	conf_t *old_conf = conf_update(new_conf, CONF_UPD_FNOFREE);
+
+	yp_flag_t flags = conf()->io.flags;
+	ok((flags & CONF_IO_FACTIVE) != 0, "Reload context is active");
+	ok((flags & CONF_IO_FRLD_ZONE) != 0, "Zone reload required");
+	ok(!(flags & (CONF_IO_FRLD_ZONES | CONF_IO_FRLD_SRV | CONF_IO_FRLD_LOG |
+	              CONF_IO_FRLD_MOD)), "No global reload required");
+
+	ok(diff_zone_type("a.") == (CONF_IO_TCHANGE | CONF_IO_TRELOAD), "Changed zone");
+	ok(diff_zone_type("b.") == (CONF_IO_TCHANGE | CONF_IO_TRELOAD), "Changed template zone");
+	ok(diff_zone_type("c.") == (CONF_IO_TCHANGE | CONF_IO_TRELOAD), "Changed template zone");
+	ok(diff_zone_type("d.") == CONF_IO_TUNSET, "Removed zone");
+	ok(diff_zone_type("e.") == CONF_IO_TSET, "Added zone");
+	is_int(5, trie_weight(conf()->io.zones), "Changed zones count");
+
+	ok((flags & CONF_IO_FRLD_ACL) != 0, "ACL recompilation required");
+	const uint8_t *primary = (const uint8_t *)"primary";
+	const uint8_t *secondary = (const uint8_t *)"secondary";
+	ok(conf_io_ref_changed(conf(), C_RMT, primary, sizeof("primary")),
+	   "Changed remote");
+	ok(!conf_io_ref_changed(conf(), C_RMT, secondary, sizeof("secondary")),
+	   "Unchanged remote");
+	ok(conf_io_ref_changed(conf(), C_RMT, NULL, 0), "Changed any remote");
+	ok(!conf_io_ref_changed(conf(), C_ACL, NULL, 0), "Unchanged ACLs");
+
+	conf_free(old_conf);
+}
+
+static void test_conf_io_include_diff(void)
+{
+	const char *old_str =
+		"template:\n"
+		"  - id: default\n"
+		"    storage: /tmp\n"
+		"zone:\n"
+		"  - domain: a.\n"
+		"  - domain: b.\n"
+		"  - domain: c.\n";
+	const char *incl_str =
+		"template:\n"
+		"  - id: tpl\n"
+		"    storage: /tmp/a\n"
+		"zone:\n"
+		"  - domain: d.\n"
+		"  - domain: e.\n"
+		"    template: tpl\n";
+
+	ok(test_conf(old_str, NULL) == KNOT_EOK, "Prepare configuration");
+
+	char *tmpdir = test_mkdtemp();
+	ok(tmpdir != NULL, "Create temporary directory");
+	char path[1024];
+	(void)snprintf(path, sizeof(path), "%s/incl.conf", tmpdir);
+	FILE *f = fopen(path, "w");
+	ok(f != NULL && fputs(incl_str, f) >= 0 && fclose(f) == 0,
+	   "Write included file");
+
+	// The included batch follows other changes in the transaction.
+	ok(conf_io_begin(false) == KNOT_EOK, "Begin txn");
+	ok(conf_io_set("zone", "file", "b.", "b.zone") == KNOT_EOK, "Change zone");
+	ok(conf_io_unset("zone", NULL, "c.", NULL) == KNOT_EOK, "Remove zone");
+	is_int(KNOT_EOK, conf_io_set("include", NULL, NULL, path), "Include file");
+
+	// Only the exact zone changes, no full zones diff.
+	yp_flag_t flags = conf()->io.flags;
+	ok((flags & CONF_IO_FRLD_ZONE) != 0, "Zone reload required");
+	ok(!(flags & (CONF_IO_FDIFF_ZONES | CONF_IO_FRLD_ZONES | CONF_IO_FRLD_SRV |
+	              CONF_IO_FRLD_LOG | CONF_IO_FRLD_MOD)), "No global reload required");
+
+	ok(diff_zone_type("a.") == CONF_IO_TNONE, "Unchanged zone");
+	ok(diff_zone_type("b.") == (CONF_IO_TCHANGE | CONF_IO_TRELOAD), "Changed zone");
+	ok(diff_zone_type("c.") == CONF_IO_TUNSET, "Removed zone");
+	ok(diff_zone_type("d.") == CONF_IO_TSET, "Included zone");
+	ok(diff_zone_type("e.") & CONF_IO_TSET, "Included template zone");
+	is_int(4, (conf()->io.zones != NULL) ? trie_weight(conf()->io.zones) : 0,
+	       "Changed zones count");
+
+	conf_io_abort(false);
+
+	test_rm_rf(tmpdir);
+	free(tmpdir);
+}
+
 int main(int argc, char *argv[])
 {
 	plan_lazy();
@@ -1098,6 +1247,12 @@ int main(int argc, char *argv[])
 	diag("conf_io_list");
 	test_conf_io_list();
 
+	diag("conf_io_diff_reload");
+	test_conf_io_diff_reload();
+
+	diag("conf_io_set include diff");
+	test_conf_io_include_diff();
+
 	conf_free(conf());
 
 	return 0;
@@ -0,0 +1,162 @@
+/*  Copyright (C) 2024 CZ.NIC, z.s.p.o. <knot-dns@labs.nic.cz>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <tap/basic.h>
+
+#include <pthread.h>
+#include <signal.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "libknot/errcode.h"
+#include "knot/common/evsched.h"
+
+#define EVENTS		10000
+#define DELAY_MS	100
+#define JITTER_MS	200
+#define WAIT_SEC	10
+
+typedef struct {
+	pthread_mutex_t mx;
+	pthread_cond_t cond;
+	size_t fired;
+	bool disorder;
+	struct timeval last;
+} test_ctx_t;
+
+typedef struct {
+	test_ctx_t *ctx;
+	bool canceled;
+	bool fired;
+} test_event_t;
+
+static void event_cb(event_t *ev)
+{
+	test_event_t *data = ev->data;
+	test_ctx_t *ctx = data->ctx;
+
+	pthread_mutex_lock(&ctx->mx);
+	if (timercmp(&ev->tv, &ctx->last, <)) {
+		ctx->disorder = true;
+	}
+	ctx->last = ev->tv;
+	data->fired = true;
+	ctx->fired++;
+	pthread_cond_signal(&ctx->cond);
+	pthread_mutex_unlock(&ctx->mx);
+}
+
+static void interrupt_handle(int s)
+{
+}
+
+static bool wait_fired(test_ctx_t *ctx, size_t count)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_REALTIME, &ts);
+	ts.tv_sec += WAIT_SEC;
+
+	pthread_mutex_lock(&ctx->mx);
+	while (ctx->fired < count) {
+		if (pthread_cond_timedwait(&ctx->cond, &ctx->mx, &ts) != 0) {
+			break;
+		}
+	}
+	bool ret = (ctx->fired == count);
+	pthread_mutex_unlock(&ctx->mx);
+
+	return ret;
+}
+
+int main(int argc, char *argv[])
+{
+	plan_lazy();
+
+	struct sigaction sa;
+	sa.sa_handler = interrupt_handle;
+	sigemptyset(&sa.sa_mask);
+	sa.sa_flags = 0;
+	sigaction(SIGALRM, &sa, NULL); // Interrupt
+
+	test_ctx_t ctx = { .mx = PTHREAD_MUTEX_INITIALIZER,
+	                   .cond = PTHREAD_COND_INITIALIZER };
+
+	evsched_t sched;
+	int ret = evsched_init(&sched, NULL);
+	ok(ret == KNOT_EOK, "create scheduler");
+	evsched_start(&sched);
+
+	// A distant event must not delay sooner ones.
+	test_event_t distant_data = { .ctx = &ctx };
+	event_t *distant = evsched_event_create(&sched, event_cb, &distant_data);
+	ok(distant != NULL, "create distant event");
+	ok(evsched_schedule(distant, 3600 * 1000) == KNOT_EOK, "schedule distant event");
+
+	test_event_t soon_data = { .ctx = &ctx };
+	event_t *soon = evsched_event_create(&sched, event_cb, &soon_data);
+	ok(evsched_schedule(soon, 10) == KNOT_EOK, "schedule sooner event");
+	ok(wait_fired(&ctx, 1) && soon_data.fired && !distant_data.fired,
+	   "sooner event fired");
+
+	// Many jittered events with rescheduling and cancellation. The scheduler
+	// is paused so that no event fires before the preparation is done.
+	evsched_pause(&sched);
+	test_event_t *data = calloc(EVENTS, sizeof(*data));
+	event_t **events = calloc(EVENTS, sizeof(*events));
+	bool created = true;
+	for (size_t i = 0; i < EVENTS; i++) {
+		data[i].ctx = &ctx;
+		events[i] = evsched_event_create(&sched, event_cb, &data[i]);
+		created &= (events[i] != NULL &&
+		            evsched_schedule(events[i], DELAY_MS + random() % JITTER_MS) == KNOT_EOK);
+	}
+	ok(created, "schedule %u jittered events", EVENTS);
+
+	size_t expected = 1 + EVENTS;
+	bool done = true;
+	for (size_t i = 0; i < EVENTS; i++) {
+		if (i % 4 == 0) {
+			done &= (evsched_cancel(events[i]) == KNOT_EOK);
+			data[i].canceled = true;
+			expected--;
+		} else if (i % 3 == 0) {
+			done &= (evsched_schedule(events[i], DELAY_MS + random() % JITTER_MS) == KNOT_EOK);
+		}
+	}
+	ok(done, "reschedule and cancel events");
+	evsched_resume(&sched);
+
+	ok(wait_fired(&ctx, expected), "all scheduled events fired");
+
+	bool consistent = !ctx.disorder && !distant_data.fired;
+	for (size_t i = 0; i < EVENTS; i++) {
+		consistent &= (data[i].fired != data[i].canceled);
+	}
+	ok(consistent, "events fired in order");
+
+	evsched_stop(&sched);
+	evsched_join(&sched);
+
+	for (size_t i = 0; i < EVENTS; i++) {
+		evsched_event_free(events[i]);
+	}
+	free(events);
+	free(data);
+	evsched_event_free(soon);
+	evsched_deinit(&sched); // Frees the distant event.
+
+	return 0;
+}
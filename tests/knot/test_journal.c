@@ -18,7 +18,9 @@
 #include <string.h>
 #include <stdlib.h>
 #include <stdio.h>
+#include <inttypes.h>
 #include <limits.h>
+#include <pthread.h>
 #include <unistd.h>
 #include <sys/stat.h>
 #include <tap/basic.h>
@@ -54,22 +56,29 @@ static unsigned lmdb_page_size(knot_lmdb_db_t *db)
 	return st.ms_psize;
 }
 
-static void set_conf(int zonefile_sync, size_t journal_usage, const knot_dname_t *apex)
+static void set_conf_compression(int zonefile_sync, size_t journal_usage,
+                                 const char *compression)
 {
-	(void)apex;
 	char conf_str[512];
 	snprintf(conf_str, sizeof(conf_str),
 	         "template:\n"
 	         " - id: default\n"
 	         "   zonefile-sync: %d\n"
 	         "   journal-max-usage: %zu\n"
-	         "   journal-max-depth: 1000\n",
-	         zonefile_sync, journal_usage);
+	         "   journal-max-depth: 1000\n"
+	         "   journal-compression: %s\n",
+	         zonefile_sync, journal_usage, compression);
 	_unused_ int ret = test_conf(conf_str, NULL);
 	assert(ret == KNOT_EOK);
 	jj.conf = conf();
 }
 
+static void set_conf(int zonefile_sync, size_t journal_usage, const knot_dname_t *apex)
+{
+	(void)apex;
+	set_conf_compression(zonefile_sync, journal_usage, "none");
+}
+
 static void unset_conf(void)
 {
 	conf_update(NULL, CONF_UPD_FNONE);
@@ -798,6 +807,125 @@ static void test_merge(const knot_dname_t *apex)
 	unset_conf();
 }
 
+#ifdef HAVE_ZSTD
+static unsigned stored_codec(const knot_dname_t *apex, uint32_t serial)
+{
+	unsigned codec = UINT_MAX;
+	knot_lmdb_txn_t txn = { 0 };
+	knot_lmdb_begin(&jdb, &txn, false);
+	MDB_val key = journal_make_chunk_key(apex, serial, false, 0);
+	if (knot_lmdb_find(&txn, &key, KNOT_LMDB_EXACT)) {
+		codec = journal_chunk_codec(&txn.cur_val, NULL);
+	}
+	free(key.mv_data);
+	knot_lmdb_abort(&txn);
+	return codec;
+}
+
+/*! \brief Test reading of compressed and uncompressed changesets together. */
+static void test_compression(const knot_dname_t *apex)
+{
+	set_conf(1000, 512 * 1024, apex);
+	jj.zone = apex;
+	int ret = journal_scrape_with_md(jj, true);
+	is_int(KNOT_EOK, ret, "journal: compression scrape (%s)", knot_strerror(ret));
+
+	list_t expected, l;
+	init_list(&expected);
+	changeset_t *ch1 = changeset_new(apex), *ch2 = changeset_new(apex);
+	init_random_changeset(ch1, 0, 1, 128, apex, false);
+	init_random_changeset(ch2, 1, 2, 128, apex, false);
+	add_tail(&expected, &ch1->n);
+	add_tail(&expected, &ch2->n);
+
+	ret = journal_insert(jj, ch1, NULL, NULL);
+	is_int(KNOT_EOK, ret, "journal: store uncompressed changeset (%s)", knot_strerror(ret));
+	unset_conf();
+
+	set_conf_compression(1000, 512 * 1024, "zstd");
+	ret = journal_insert(jj, ch2, NULL, NULL);
+	is_int(KNOT_EOK, ret, "journal: store compressed changeset (%s)", knot_strerror(ret));
+	is_int(JOURNAL_COMPRESSION_NONE, stored_codec(apex, 0), "journal: first chunk uncompressed");
+	is_int(JOURNAL_COMPRESSION_ZSTD, stored_codec(apex, 1), "journal: second chunk compressed");
+
+	journal_read_t *read = NULL;
+	ret = load_j_list(&jj, false, 0, &read, &l);
+	is_int(KNOT_EOK, ret, "journal: read mixed changesets (%s)", knot_strerror(ret));
+	ok(changesets_list_eq(&expected, &l), "journal: mixed changesets equal after read");
+	changesets_free(&l);
+	journal_read_end(read);
+
+	ret = journal_sem_check(jj);
+	is_int(KNOT_EOK, ret, "journal: check after compression (%s)", knot_strerror(ret));
+
+	changesets_free(&expected);
+	journal_scrape_with_md(jj, true);
+	unset_conf();
+}
+#endif
+
+#define GC_THREADS 8
+#define GC_INSERTS 50
+
+typedef struct {
+	pthread_t thread;
+	knot_lmdb_db_t *db;
+	uint32_t id;
+	int ret;
+} gc_inserter_t;
+
+static void *gc_inserter(void *arg)
+{
+	gc_inserter_t *ctx = arg;
+	for (uint32_t i = 0; i < GC_INSERTS && ctx->ret == KNOT_EOK; i++) {
+		MDB_val key = knot_lmdb_make_key("II", ctx->id, i);
+		MDB_val val = knot_lmdb_make_key("I", i);
+		ctx->ret = knot_lmdb_quick_insert(ctx->db, key, val);
+	}
+	return NULL;
+}
+
+/*! \brief Test concurrent commits sharing disk syncs. */
+static void test_group_commit(void)
+{
+	char path[strlen(test_dir_name) + 4];
+	(void)snprintf(path, sizeof(path), "%s/gc", test_dir_name);
+
+	knot_lmdb_db_t db;
+	knot_lmdb_init(&db, path, 4096 * 1024, 0, NULL);
+	db.group_commit = true;
+	knot_lmdb_set_commit_delay(&db, 1);
+	int ret = knot_lmdb_open(&db);
+	is_int(KNOT_EOK, ret, "group commit: open db (%s)", knot_strerror(ret));
+
+	gc_inserter_t inserters[GC_THREADS];
+	for (uint32_t i = 0; i < GC_THREADS; i++) {
+		inserters[i] = (gc_inserter_t){ .db = &db, .id = i };
+		pthread_create(&inserters[i].thread, NULL, gc_inserter, &inserters[i]);
+	}
+	bool all_ok = true;
+	for (int i = 0; i < GC_THREADS; i++) {
+		pthread_join(inserters[i].thread, NULL);
+		all_ok = all_ok && (inserters[i].ret == KNOT_EOK);
+	}
+	ok(all_ok, "group commit: concurrent inserts");
+
+	uint64_t commits, syncs, batch_max, latency;
+	knot_lmdb_commit_stats(&db, &commits, &syncs, &batch_max, &latency);
+	is_int(GC_THREADS * GC_INSERTS, commits, "group commit: all commits synced");
+	ok(syncs > 0 && syncs <= commits, "group commit: %"PRIu64" syncs", syncs);
+	ok(batch_max >= 1 && batch_max <= GC_THREADS, "group commit: max batch %"PRIu64, batch_max);
+
+	knot_lmdb_txn_t txn = { 0 };
+	knot_lmdb_begin(&db, &txn, false);
+	MDB_stat st = { 0 };
+	mdb_stat(txn.txn, txn.db->dbi, &st);
+	knot_lmdb_abort(&txn);
+	is_int(GC_THREADS * GC_INSERTS, st.ms_entries, "group commit: all records stored");
+
+	knot_lmdb_deinit(&db);
+}
+
 static void test_stress_base(const knot_dname_t *apex,
                              size_t update_size, size_t file_size)
 {
@@ -861,6 +989,8 @@ int main(int argc, char *argv[])
 
 	test_journal_db();
 
+	test_group_commit();
+
 	test_store_load(apex);
 
 	if (lmdb_page_size(&jdb) == 4096) {
@@ -869,6 +999,10 @@ int main(int argc, char *argv[])
 
 	test_merge(apex);
 
+#ifdef HAVE_ZSTD
+	test_compression(apex);
+#endif
+
 	test_stress(apex);
 
 	knot_lmdb_deinit(&jdb);
@@ -0,0 +1,181 @@
+/*  Copyright (C) 2024 CZ.NIC, z.s.p.o. <knot-dns@labs.nic.cz>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <netinet/in.h>
+#include <poll.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <tap/basic.h>
+
+#include "knot/server/server.h"
+#include "libknot/libknot.h"
+
+#define SOCKETS	4
+#define CIDS	64
+
+/* Bind the sockets into one reuseport group, in the order of the workers. */
+static bool bind_group(int *socks, struct sockaddr_in *addr)
+{
+	for (unsigned i = 0; i < SOCKETS; i++) {
+		int on = 1;
+		socks[i] = socket(AF_INET, SOCK_DGRAM, 0);
+		if (socks[i] < 0 ||
+		    setsockopt(socks[i], SOL_SOCKET, SO_REUSEPORT, &on, sizeof(on)) != 0 ||
+		    bind(socks[i], (struct sockaddr *)addr, sizeof(*addr)) != 0) {
+			return false;
+		}
+		if (i == 0) {
+			socklen_t len = sizeof(*addr);
+			(void)getsockname(socks[0], (struct sockaddr *)addr, &len);
+		}
+	}
+
+	for (unsigned i = 0; i < SOCKETS; i++) {
+		if (!server_attach_quic_reuseport_bpf(socks[i], SOCKETS)) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/* Return the index of the socket which received the packet, -1 if none. */
+static int receiver(int *socks)
+{
+	struct pollfd pfd[SOCKETS];
+	for (unsigned i = 0; i < SOCKETS; i++) {
+		pfd[i].fd = socks[i];
+		pfd[i].events = POLLIN;
+	}
+
+	if (poll(pfd, SOCKETS, 1000) <= 0) {
+		return -1;
+	}
+
+	int idx = -1;
+	for (unsigned i = 0; i < SOCKETS; i++) {
+		if (pfd[i].revents & POLLIN) {
+			uint8_t buf[64];
+			(void)recv(socks[i], buf, sizeof(buf), 0);
+			idx = (idx == -1) ? i : -2; // More receivers are an error.
+		}
+	}
+
+	return idx;
+}
+
+static int send_packet(int sock, const struct sockaddr_in *addr, const uint8_t *pkt,
+                       size_t len, int *socks)
+{
+	if (sendto(sock, pkt, len, 0, (const struct sockaddr *)addr, sizeof(*addr)) != len) {
+		return -1;
+	}
+
+	return receiver(socks);
+}
+
+/* Long header packet with the given DCID length, CID prefix, and padding. */
+static size_t long_header(uint8_t *pkt, uint8_t dcid_len, uint16_t prefix)
+{
+	memset(pkt, 0xAA, 32);
+	pkt[0] = 0xC0;                  // Long header, Initial.
+	knot_wire_write_u32(pkt + 1, 1); // Version 1.
+	pkt[5] = dcid_len;
+	if (dcid_len >= sizeof(uint16_t)) {
+		knot_wire_write_u16(pkt + 6, prefix);
+	}
+	return 32;
+}
+
+/* Short header packet with the given CID prefix. */
+static size_t short_header(uint8_t *pkt, uint16_t prefix)
+{
+	memset(pkt, 0xBB, 32);
+	pkt[0] = 0x40;
+	knot_wire_write_u16(pkt + 1, prefix);
+	return 32;
+}
+
+int main(int argc, char *argv[])
+{
+#ifdef SO_ATTACH_REUSEPORT_CBPF
+	int socks[SOCKETS];
+	struct sockaddr_in addr = {
+		.sin_family = AF_INET,
+		.sin_addr.s_addr = htonl(INADDR_LOOPBACK)
+	};
+	if (!bind_group(socks, &addr)) {
+		skip_all("reuseport group with a socket filter not available");
+		return 0;
+	}
+
+	plan_lazy();
+
+	int client = socket(AF_INET, SOCK_DGRAM, 0);
+	ok(client >= 0, "create client socket");
+
+	uint8_t pkt[32];
+
+	/* CIDs generated as knot_quic_table_set_shard() does, for each worker. */
+	bool steered_long = true, steered_short = true;
+	const uint16_t span = (UINT16_MAX + 1) / SOCKETS;
+	for (unsigned i = 0; i < CIDS; i++) {
+		uint16_t shard = i % SOCKETS;
+		uint16_t prefix = (i * 997 % span) * SOCKETS + shard;
+
+		size_t len = long_header(pkt, 8, prefix);
+		int idx = send_packet(client, &addr, pkt, len, socks);
+		if (idx != shard) {
+			diag("long header, CID prefix 0x%04x to socket %i", prefix, idx);
+			steered_long = false;
+		}
+
+		len = short_header(pkt, prefix);
+		idx = send_packet(client, &addr, pkt, len, socks);
+		if (idx != shard) {
+			diag("short header, CID prefix 0x%04x to socket %i", prefix, idx);
+			steered_short = false;
+		}
+	}
+	ok(steered_long, "long header packets steered by DCID");
+	ok(steered_short, "short header packets steered by DCID");
+
+	/* The prefix is taken modulo the number of workers. */
+	size_t len = long_header(pkt, 8, UINT16_MAX);
+	is_int(UINT16_MAX % SOCKETS, send_packet(client, &addr, pkt, len, socks),
+	       "highest CID prefix");
+
+	/* Too short DCIDs fall back to the default hashing, still delivered. */
+	bool delivered = true;
+	for (uint8_t dcid_len = 0; dcid_len < sizeof(uint16_t); dcid_len++) {
+		len = long_header(pkt, dcid_len, 0);
+		if (send_packet(client, &addr, pkt, len, socks) < 0) {
+			delivered = false;
+		}
+	}
+	ok(delivered, "short DCID packets delivered by default hashing");
+
+	close(client);
+	for (unsigned i = 0; i < SOCKETS; i++) {
+		close(socks[i]);
+	}
+#else
+	skip_all("SO_ATTACH_REUSEPORT_CBPF not supported");
+#endif
+
+	return 0;
+}
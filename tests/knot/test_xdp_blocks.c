@@ -0,0 +1,82 @@
+/*  Copyright (C) 2024 CZ.NIC, z.s.p.o. <knot-dns@labs.nic.cz>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stdio.h>
+#include <tap/basic.h>
+
+#include "knot/server/xdp-handler.h"
+#include "libknot/errcode.h"
+#include "contrib/sockaddr.h"
+
+static int push(struct xdp_blocks *blocks, int family, const char *str,
+                unsigned prefix)
+{
+	struct sockaddr_storage addr;
+	if (sockaddr_set(&addr, family, str, 0) != KNOT_EOK) {
+		return KNOT_EINVAL;
+	}
+
+	return xdp_blocks_push(blocks, &addr, prefix, 1000, 2);
+}
+
+int main(int argc, char *argv[])
+{
+	plan_lazy();
+
+	struct sockaddr_storage addr;
+	sockaddr_set(&addr, AF_INET, "192.0.2.1", 0);
+
+	// Invalid parameters.
+	ok(xdp_blocks_push(NULL, &addr, 24, 1000, 2) == KNOT_EINVAL, "push, no queue");
+
+	struct xdp_blocks *blocks = xdp_blocks_new();
+	ok(blocks != NULL, "new queue");
+	ok(xdp_blocks_push(blocks, NULL, 24, 1000, 2) == KNOT_EINVAL, "push, no address");
+
+	// Basic push.
+	ok(push(blocks, AF_INET, "192.0.2.1", 24) == KNOT_EOK, "push IPv4 prefix");
+	ok(push(blocks, AF_INET6, "2001:db8::1", 56) == KNOT_EOK, "push IPv6 prefix");
+
+	// Fill the queue, the already pending prefixes don't take any space.
+	unsigned pushed = 2;
+	for (unsigned i = 0; pushed < XDP_BLOCKS_MAX; i++, pushed++) {
+		char str[32];
+		(void)snprintf(str, sizeof(str), "198.51.100.%u", i);
+		if (push(blocks, AF_INET, str, 32) != KNOT_EOK) {
+			break;
+		}
+	}
+	ok(pushed == XDP_BLOCKS_MAX, "fill the queue");
+
+	ok(push(blocks, AF_INET, "192.0.2.200", 24) == KNOT_EOK,
+	   "push address from a pending IPv4 prefix");
+	ok(push(blocks, AF_INET6, "2001:db8:0:ff::1", 56) == KNOT_EOK,
+	   "push address from a pending IPv6 prefix");
+	ok(push(blocks, AF_INET, "198.51.100.0", 32) == KNOT_EOK,
+	   "push pending address");
+
+	// The same address with another prefix length is a distinct block.
+	ok(push(blocks, AF_INET, "192.0.2.1", 16) == KNOT_ESPACE,
+	   "push other prefix length to a full queue");
+	ok(push(blocks, AF_INET, "203.0.113.1", 24) == KNOT_ESPACE,
+	   "push new prefix to a full queue");
+
+	xdp_blocks_free(blocks);
+	xdp_blocks_free(NULL);
+	ok(1, "free queue");
+
+	return 0;
+}
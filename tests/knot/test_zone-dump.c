@@ -0,0 +1,155 @@
+/*  Copyright (C) 2024 CZ.NIC, z.s.p.o. <knot-dns@labs.nic.cz>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <tap/basic.h>
+#include <tap/files.h>
+
+#include "knot/zone/zone-dump.h"
+#include "knot/zone/zonefile.h"
+#include "libknot/libknot.h"
+
+#define ORIGIN	"example."
+#define NAMES	40000 // The dump spans several writer buffers.
+
+static void write_zone(const char *path)
+{
+	FILE *f = fopen(path, "w");
+	fprintf(f, "$ORIGIN "ORIGIN"\n"
+	           "@ 3600 SOA ns admin 1 3600 900 604800 600\n"
+	           "@ 3600 NS ns\n"
+	           "ns 3600 A 192.0.2.1\n");
+	for (unsigned i = 0; i < NAMES; i++) {
+		fprintf(f, "host%u 300 A 192.0.%u.%u\n", i, (i >> 8) & 0xff, i & 0xff);
+		fprintf(f, "host%u 300 TXT \"record number %u\"\n", i, i);
+	}
+	fclose(f);
+}
+
+static zone_contents_t *load_zone(const char *path)
+{
+	knot_dname_t *origin = knot_dname_from_str_alloc(ORIGIN);
+	sem_handler_t handler = { .cb = err_handler_logger };
+
+	zloader_t zl;
+	zone_contents_t *contents = NULL;
+	if (zonefile_open(&zl, path, origin, 3600, SEMCHECK_MANDATORY_ONLY, 0) == KNOT_EOK) {
+		zl.err_handler = &handler;
+		contents = zonefile_load(&zl);
+		zonefile_close(&zl);
+	}
+	knot_dname_free(origin, NULL);
+
+	return contents;
+}
+
+static char *read_file(const char *path, size_t *len)
+{
+	FILE *f = fopen(path, "r");
+	if (f == NULL) {
+		return NULL;
+	}
+	fseek(f, 0, SEEK_END);
+	*len = ftell(f);
+	rewind(f);
+	char *data = malloc(*len + 1);
+	if (data != NULL && fread(data, 1, *len, f) != *len) {
+		free(data);
+		data = NULL;
+	}
+	fclose(f);
+
+	return data;
+}
+
+/* Dump the zone through stdio, the reference output. */
+static char *dump_file(zone_contents_t *contents, size_t *len)
+{
+	char *data = NULL;
+	FILE *f = open_memstream(&data, len);
+	int ret = zone_dump_text(contents, f, false, NULL);
+	fclose(f);
+	if (ret != KNOT_EOK) {
+		free(data);
+		return NULL;
+	}
+
+	return data;
+}
+
+int main(int argc, char *argv[])
+{
+	plan_lazy();
+
+	char *tmpdir = test_mkdtemp();
+	ok(tmpdir != NULL, "create temporary directory");
+
+	char in_path[1024], out_path[1024], fd_path[1024];
+	(void)snprintf(in_path, sizeof(in_path), "%s/in.zone", tmpdir);
+	(void)snprintf(out_path, sizeof(out_path), "%s/out.zone", tmpdir);
+	(void)snprintf(fd_path, sizeof(fd_path), "%s/fd.zone", tmpdir);
+
+	write_zone(in_path);
+	zone_contents_t *contents = load_zone(in_path);
+	ok(contents != NULL, "load zone");
+
+	// The descriptor dump equals the stdio one.
+	int fd = open(fd_path, O_WRONLY | O_CREAT | O_TRUNC, 0600);
+	int ret = zone_dump_text_fd(contents, fd, false);
+	close(fd);
+	is_int(KNOT_EOK, ret, "dump zone to a descriptor");
+
+	size_t ref_len = 0, fd_len = 0;
+	char *ref = dump_file(contents, &ref_len);
+	char *dump = read_file(fd_path, &fd_len);
+	ok(ref != NULL && dump != NULL && ref_len == fd_len && ref_len > 2 * 1024 * 1024 &&
+	   memcmp(ref, dump, ref_len) == 0, "descriptor dump equals stdio dump");
+	free(dump);
+
+	// The written zone file loads back to the same contents.
+	ret = zonefile_write(out_path, contents);
+	is_int(KNOT_EOK, ret, "write zone file");
+
+	zone_contents_t *reloaded = load_zone(out_path);
+	ok(reloaded != NULL, "load written zone file");
+
+	size_t reloaded_len = 0;
+	dump = (reloaded != NULL) ? dump_file(reloaded, &reloaded_len) : NULL;
+	ok(ref != NULL && dump != NULL && ref_len == reloaded_len &&
+	   memcmp(ref, dump, ref_len) == 0, "round-trip keeps contents");
+	free(dump);
+	free(ref);
+
+	// Write errors are propagated.
+	fd = open(in_path, O_RDONLY);
+	ret = zone_dump_text_fd(contents, fd, true);
+	close(fd);
+	ok(ret != KNOT_EOK, "write error detected");
+
+	ret = zone_dump_text_fd(contents, -1, true);
+	is_int(KNOT_EINVAL, ret, "invalid descriptor");
+
+	zone_contents_deep_free(reloaded);
+	zone_contents_deep_free(contents);
+	test_rm_rf(tmpdir);
+	free(tmpdir);
+
+	return 0;
+}
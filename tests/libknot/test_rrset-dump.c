@@ -0,0 +1,125 @@
+/*  Copyright (C) 2024 CZ.NIC, z.s.p.o. <knot-dns@labs.nic.cz>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <string.h>
+#include <tap/basic.h>
+
+#include "libknot/libknot.h"
+
+#define OWNER	(const uint8_t *)"\x03""www""\x07""example""\x03""com"
+#define LONG	(const uint8_t *)"\x1e""aaaaaaaaaaaaaaaaaaaaaaaaaaaaaa""\x03""com"
+
+typedef struct {
+	const char *rdata;
+	size_t len;
+} rdata_t;
+
+static void check_dump(const char *msg, const uint8_t *owner, uint16_t type,
+                       uint32_t ttl, const rdata_t *rdata,
+                       const knot_dump_style_t *style, const char *expected)
+{
+	knot_rrset_t *rrset = knot_rrset_new(owner, type, KNOT_CLASS_IN, ttl, NULL);
+	for (const rdata_t *rd = rdata; rd->rdata != NULL; rd++) {
+		(void)knot_rrset_add_rdata(rrset, (const uint8_t *)rd->rdata,
+		                           rd->len, NULL);
+	}
+
+	size_t buflen = 16; // Force buffer reallocation.
+	char *buf = malloc(buflen);
+	int ret = knot_rrset_txt_dump(rrset, &buf, &buflen, style);
+	ok(ret == (int)strlen(expected) && strcmp(buf, expected) == 0, "dump %s", msg);
+	if (ret < 0 || strcmp(buf, expected) != 0) {
+		diag("got '%s'", ret < 0 ? knot_strerror(ret) : buf);
+	}
+
+	free(buf);
+	knot_rrset_free(rrset, NULL);
+}
+
+int main(int argc, char *argv[])
+{
+	plan_lazy();
+
+	knot_dump_style_t style = KNOT_DUMP_STYLE_DEFAULT;
+	style.now = 1700000000;
+
+	const rdata_t a[] = {
+		{ "\xc0\x00\x02\x01", 4 },
+		{ "\xc0\x00\x02\xff", 4 },
+		{ "\x0a\x00\x00\x00", 4 },
+		{ NULL }
+	};
+	check_dump("A records", OWNER, KNOT_RRTYPE_A, 3600, a, &style,
+	           "www.example.com.    \t3600\tA\t10.0.0.0\n"
+	           "www.example.com.    \t3600\tA\t192.0.2.1\n"
+	           "www.example.com.    \t3600\tA\t192.0.2.255\n");
+
+	const rdata_t soa[] = {
+		{ "\x02""ns\x00""\x05""admin\x00"
+		  "\xff\xff\xff\xff""\x00\x00\x0e\x10""\x00\x00\x00\x00"
+		  "\x00\x01\x51\x80""\x00\x00\x00\x09", 31 },
+		{ NULL }
+	};
+	check_dump("SOA record", LONG, KNOT_RRTYPE_SOA, 0, soa, &style,
+	           "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaa.com. 0\tSOA\tns. admin. "
+	           "4294967295 3600 0 86400 9\n");
+
+	const rdata_t rrsig[] = {
+		{ "\x00\x01""\x0d\x03""\x00\x00\x0e\x10""\x65\x53\xf1\x00"
+		  "\x65\x2b\x1c\x00""\x30\x39""\x00""\xff\xfe", 21 },
+		{ "\x00\x01""\x0d\x03""\x00\x00\x01\x2c""\x65\x53\xf1\x00"
+		  "\x65\x2b\x1c\x00""\x30\x39""\x00""\xff\xfe", 21 },
+		{ "\x00\x1c""\x0d\x03""\x00\x00\x01\x2c""\x00\x00\x00\x01"
+		  "\x00\x00\x00\x00""\x00\x07""\x00""\xff\xfe", 21 },
+		{ NULL }
+	};
+	check_dump("RRSIG records", OWNER, KNOT_RRTYPE_RRSIG, 60, rrsig, &style,
+	           "www.example.com.    \t300\tRRSIG\tA 13 3 300 20231114221320 20231014225352 12345 . //4=\n"
+	           "www.example.com.    \t3600\tRRSIG\tA 13 3 3600 20231114221320 20231014225352 12345 . //4=\n"
+	           "www.example.com.    \t300\tRRSIG\tAAAA 13 3 300 19700101000001 19700101000000 7 . //4=\n");
+
+	const rdata_t nsec[] = {
+		{ "\x00""\x00\x07\x62\x01\x80\x08\x00\x03\x80""\x01\x01\x40", 13 },
+		{ NULL }
+	};
+	check_dump("NSEC record", OWNER, KNOT_RRTYPE_NSEC, 300, nsec, &style,
+	           "www.example.com.    \t300\tNSEC\t. A NS SOA MX TXT AAAA RRSIG NSEC DNSKEY CAA\n");
+
+	knot_dump_style_t custom = style;
+	custom.show_class = true;
+	custom.human_timestamp = false;
+	custom.original_ttl = false;
+	check_dump("RRSIG with class", OWNER, KNOT_RRTYPE_RRSIG, 60, rrsig, &custom,
+	           "www.example.com.    \t60\tIN\tRRSIG\tA 13 3 300 1700000000 1697324032 12345 . //4=\n"
+	           "www.example.com.    \t60\tIN\tRRSIG\tA 13 3 3600 1700000000 1697324032 12345 . //4=\n"
+	           "www.example.com.    \t60\tIN\tRRSIG\tAAAA 13 3 300 1 0 7 . //4=\n");
+
+	custom = style;
+	custom.human_ttl = true;
+	custom.generic = true;
+	check_dump("generic type", OWNER, KNOT_RRTYPE_A, 86461, a, &custom,
+	           "www.example.com.    \t1d1m1s\tTYPE1\t\\# 4 0A000000\n"
+	           "www.example.com.    \t1d1m1s\tTYPE1\t\\# 4 C0000201\n"
+	           "www.example.com.    \t1d1m1s\tTYPE1\t\\# 4 C00002FF\n");
+
+	custom = style;
+	custom.show_ttl = false;
+	custom.color = "\x1b[31m";
+	check_dump("colored", OWNER, KNOT_RRTYPE_A, 1, a + 2, &custom,
+	           "\x1b[31mwww.example.com.    \tA\t10.0.0.0\x1b[0m\n");
+
+	return 0;
+}
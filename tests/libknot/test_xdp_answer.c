@@ -0,0 +1,339 @@
+/*  Copyright (C) 2024 CZ.NIC, z.s.p.o. <knot-dns@labs.nic.cz>
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <netinet/in.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "tap/basic.h"
+#include "libknot/libknot.h"
+#include "libknot/xdp/answer.h"
+
+#define UDP_HDR_LEN	8
+#define PAYLOAD		1232
+
+static const uint8_t src_ip[4] = { 192, 0, 2, 1 };
+static const uint8_t dst_ip[4] = { 192, 0, 2, 53 };
+
+/* Full RFC 1071 UDP checksum over IPv4, returned in host byte order. */
+static uint16_t udp_csum(const uint8_t *src, const uint8_t *dst,
+                         const uint8_t *udp, size_t len)
+{
+	uint8_t pseudo[12] = { 0 };
+	memcpy(pseudo, src, 4);
+	memcpy(pseudo + 4, dst, 4);
+	pseudo[9] = IPPROTO_UDP;
+	knot_wire_write_u16(pseudo + 10, len);
+
+	uint32_t sum = 0;
+	for (size_t i = 0; i < sizeof(pseudo); i += 2) {
+		sum += knot_wire_read_u16(pseudo + i);
+	}
+	for (size_t i = 0; i < len; i++) {
+		sum += (i % 2 == 0) ? udp[i] << 8 : udp[i];
+	}
+	while (sum >> 16) {
+		sum = (sum & 0xffff) + (sum >> 16);
+	}
+	sum = (uint16_t)~sum;
+
+	return (sum == 0) ? 0xffff : sum;
+}
+
+static uint16_t load16(const uint8_t *ptr)
+{
+	uint16_t val;
+	memcpy(&val, ptr, sizeof(val));
+	return val;
+}
+
+static uint16_t csum_fold(uint32_t sum)
+{
+	sum = (sum & 0xffff) + (sum >> 16);
+	return (sum & 0xffff) + (sum >> 16);
+}
+
+static uint16_t csum_at(uint16_t sum, uint32_t offset)
+{
+	return (offset & 1) ? (uint16_t)((sum << 8) | (sum >> 8)) : sum;
+}
+
+/*
+ * Rewrite the query into the response the same way answer() in bpf-kernel.c
+ * does, including the incremental UDP checksum update.
+ */
+static size_t kernel_answer(uint8_t *udp, size_t q_end, bool opt,
+                            const knot_xdp_answer_t *ans)
+{
+	uint8_t *dns = udp + UDP_HDR_LEN;
+	size_t rr_len = ans->len - KNOT_XDP_ANSWER_OPT_LEN;
+	size_t opt_len = opt ? KNOT_XDP_ANSWER_OPT_LEN : 0;
+
+	uint16_t opt_sum = 0;
+	if (opt) {
+		uint8_t *rr = dns + q_end;
+		uint8_t last[2] = { rr[10], 0 };
+		uint32_t sum = load16(rr) + load16(rr + 2) + load16(rr + 4) +
+		               load16(rr + 6) + load16(rr + 8) + load16(last);
+		opt_sum = csum_at(csum_fold(sum), UDP_HDR_LEN + q_end);
+	}
+
+	uint16_t check = load16(udp + 6);
+	uint16_t arcount = load16(dns + 10);
+	uint16_t old_udp_len = load16(udp + 4);
+	uint16_t old_flags = load16(dns + 2);
+
+	// Swap the ports.
+	uint16_t port = load16(udp);
+	memcpy(udp, udp + 2, sizeof(port));
+	memcpy(udp + 2, &port, sizeof(port));
+
+	size_t udp_len = UDP_HDR_LEN + q_end + rr_len + opt_len;
+	knot_wire_write_u16(udp + 4, udp_len);
+
+	dns[2] = 0x84 | (dns[2] & 0x01);
+	dns[3] = ans->rcode;
+	memcpy(dns + 6, &ans->ancount, sizeof(uint16_t));
+	memcpy(dns + 8, &ans->nscount, sizeof(uint16_t));
+	knot_wire_write_u16(dns + 10, be16toh(ans->arcount) + (opt ? 1 : 0));
+	memcpy(dns + q_end, ans->data, rr_len + opt_len);
+
+	uint32_t sum = (uint16_t)~check;
+	sum += 2 * (uint32_t)(uint16_t)~old_udp_len + 2 * (uint32_t)load16(udp + 4);
+	sum += (uint16_t)~old_flags + load16(dns + 2);
+	sum += (uint16_t)~arcount + load16(dns + 10);
+	sum += load16(dns + 6) + load16(dns + 8);
+	sum += csum_at(ans->csum, UDP_HDR_LEN + q_end);
+	if (opt) {
+		sum += (uint16_t)~opt_sum;
+		sum += csum_at(ans->opt_csum, UDP_HDR_LEN + q_end + rr_len);
+	}
+	check = ~csum_fold(sum);
+	check = (check == 0) ? 0xffff : check;
+	memcpy(udp + 6, &check, sizeof(check));
+
+	return udp_len;
+}
+
+static void add_rr(knot_pkt_t *pkt, const knot_dname_t *owner, uint16_t type,
+                   const uint8_t *rdata, uint16_t rdlen)
+{
+	knot_rrset_t *rr = knot_rrset_new(owner, type, KNOT_CLASS_IN, 3600, &pkt->mm);
+	(void)knot_rrset_add_rdata(rr, rdata, rdlen, &pkt->mm);
+	(void)knot_pkt_put(pkt, KNOT_COMPR_HINT_QNAME, rr, KNOT_PF_FREE);
+}
+
+/* Build a response with the given number of NS records and A glues. */
+static knot_pkt_t *make_response(const knot_dname_t *qname, size_t ns, size_t glue)
+{
+	// Alternate the NS target lengths to get both record data length parities.
+	uint8_t targets[2][17] = { "\x03ns0\x07""example\x03""com", "\x03ns0\x03""net" };
+
+	knot_pkt_t *pkt = knot_pkt_new(NULL, KNOT_WIRE_MAX_PKTSIZE, NULL);
+	knot_wire_set_qr(pkt->wire);
+	knot_wire_set_aa(pkt->wire);
+	(void)knot_pkt_put_question(pkt, qname, KNOT_CLASS_IN, KNOT_RRTYPE_NS);
+
+	knot_pkt_begin(pkt, KNOT_ANSWER);
+	for (size_t i = 0; i < ns; i++) {
+		uint8_t *target = targets[i % 2];
+		target[3] = '0' + i;
+		add_rr(pkt, qname, KNOT_RRTYPE_NS, target, knot_dname_size(target));
+	}
+
+	knot_pkt_begin(pkt, KNOT_ADDITIONAL);
+	for (size_t i = 0; i < glue; i++) {
+		uint8_t owner[] = "\x03ns0\x07""example\x03""com";
+		owner[3] += i;
+		uint8_t addr[4] = { 192, 0, 2, 10 + i };
+		add_rr(pkt, owner, KNOT_RRTYPE_A, addr, sizeof(addr));
+	}
+
+	return pkt;
+}
+
+/* Build a UDP query with an optional bare OPT record, return its length. */
+static size_t make_query(uint8_t *udp, const knot_dname_t *qname, bool opt)
+{
+	uint8_t *dns = udp + UDP_HDR_LEN;
+	memset(udp, 0, UDP_HDR_LEN + KNOT_WIRE_HEADER_SIZE);
+	knot_wire_write_u16(udp, 53535);
+	knot_wire_write_u16(udp + 2, 53);
+	knot_wire_set_id(dns, 0xbeef);
+	knot_wire_set_rd(dns);
+	knot_wire_set_qdcount(dns, 1);
+
+	size_t qlen = knot_dname_size(qname);
+	uint8_t *pos = dns + KNOT_WIRE_HEADER_SIZE;
+	memcpy(pos, qname, qlen);
+	pos += qlen;
+	knot_wire_write_u16(pos, KNOT_RRTYPE_NS);
+	knot_wire_write_u16(pos + 2, KNOT_CLASS_IN);
+	pos += 2 * sizeof(uint16_t);
+
+	if (opt) {
+		knot_wire_set_arcount(dns, 1);
+		memset(pos, 0, KNOT_XDP_ANSWER_OPT_LEN);
+		knot_wire_write_u16(pos + 1, KNOT_RRTYPE_OPT);
+		knot_wire_write_u16(pos + 3, 4096);
+		pos += KNOT_XDP_ANSWER_OPT_LEN;
+	}
+
+	size_t len = pos - udp;
+	knot_wire_write_u16(udp + 4, len);
+	knot_wire_write_u16(udp + 6, udp_csum(src_ip, dst_ip, udp, len));
+
+	return len;
+}
+
+static void test_build(void)
+{
+	const knot_dname_t *qname = (const knot_dname_t *)"\x07""ExAmPlE\x03""COM";
+	knot_pkt_t *pkt = make_response(qname, 2, 1);
+	knot_wire_set_rcode(pkt->wire, KNOT_RCODE_NOERROR);
+
+	knot_xdp_answer_key_t key;
+	knot_xdp_answer_t ans;
+	int ret = answer_build(&key, &ans, pkt->wire, pkt->size, PAYLOAD);
+	is_int(KNOT_EOK, ret, "build: success");
+
+	knot_xdp_answer_key_t exp_key = { 0 };
+	memcpy(exp_key.qname, "\x07""example\x03""com", 13);
+	exp_key.qtype = htobe16(KNOT_RRTYPE_NS);
+	ok(memcmp(&key, &exp_key, sizeof(key)) == 0, "build: lower-cased key");
+
+	ok(be16toh(ans.ancount) == 2 && be16toh(ans.nscount) == 0 &&
+	   be16toh(ans.arcount) == 1, "build: section counts");
+
+	size_t q_end = KNOT_WIRE_HEADER_SIZE + knot_dname_size(qname) + 4;
+	size_t rr_len = pkt->size - q_end;
+	is_int(rr_len + KNOT_XDP_ANSWER_OPT_LEN, ans.len, "build: data length");
+	ok(memcmp(ans.data, pkt->wire + q_end, rr_len) == 0, "build: record data");
+
+	const uint8_t opt[] = { 0, 0, 41, PAYLOAD >> 8, PAYLOAD & 0xff, 0, 0, 0, 0, 0, 0 };
+	ok(memcmp(ans.data + rr_len, opt, sizeof(opt)) == 0, "build: trailing OPT");
+
+	// NXDOMAIN keeps the RCODE.
+	knot_wire_set_rcode(pkt->wire, KNOT_RCODE_NXDOMAIN);
+	ret = answer_build(&key, &ans, pkt->wire, pkt->size, PAYLOAD);
+	ok(ret == KNOT_EOK && ans.rcode == KNOT_RCODE_NXDOMAIN, "build: RCODE");
+
+	knot_pkt_free(pkt);
+}
+
+static void test_build_errors(void)
+{
+	knot_xdp_answer_key_t key;
+	knot_xdp_answer_t ans;
+	uint8_t wire[KNOT_WIRE_HEADER_SIZE + 4] = { 0 };
+
+	int ret = answer_build(&key, &ans, wire, KNOT_WIRE_HEADER_SIZE - 1, PAYLOAD);
+	is_int(KNOT_EMALF, ret, "build: short header");
+
+	ret = answer_build(&key, &ans, wire, sizeof(wire), PAYLOAD);
+	is_int(KNOT_EMALF, ret, "build: no question");
+
+	knot_wire_set_qdcount(wire, 1);
+	ret = answer_build(&key, &ans, wire, sizeof(wire) - 1, PAYLOAD);
+	is_int(KNOT_EMALF, ret, "build: truncated question");
+
+	// QNAME longer than the key, a 63-byte and a 1-byte label.
+	knot_dname_t long_name[KNOT_DNAME_MAXLABELLEN + 4] = { 0 };
+	long_name[0] = KNOT_DNAME_MAXLABELLEN;
+	memset(long_name + 1, 'a', KNOT_DNAME_MAXLABELLEN);
+	long_name[KNOT_DNAME_MAXLABELLEN + 1] = 1;
+	long_name[KNOT_DNAME_MAXLABELLEN + 2] = 'b';
+	knot_pkt_t *pkt = make_response(long_name, 1, 0);
+	ret = answer_build(&key, &ans, pkt->wire, pkt->size, PAYLOAD);
+	is_int(KNOT_ESPACE, ret, "build: too long QNAME");
+	knot_pkt_free(pkt);
+
+	// Record data not fitting the map item.
+	pkt = make_response((const knot_dname_t *)"\x07""example", 20, 20);
+	ret = answer_build(&key, &ans, pkt->wire, pkt->size, PAYLOAD);
+	is_int(KNOT_ESPACE, ret, "build: too long data");
+	knot_pkt_free(pkt);
+}
+
+static void test_csum(const knot_dname_t *qname, size_t ns, size_t glue, bool opt)
+{
+	knot_pkt_t *pkt = make_response(qname, ns, glue);
+	knot_wire_set_id(pkt->wire, 0xbeef);
+	knot_wire_set_rd(pkt->wire);
+
+	knot_xdp_answer_key_t key;
+	knot_xdp_answer_t ans;
+	int ret = answer_build(&key, &ans, pkt->wire, pkt->size, PAYLOAD);
+	if (ret != KNOT_EOK) {
+		ok(0, "csum: build failed");
+		knot_pkt_free(pkt);
+		return;
+	}
+
+	uint8_t udp[KNOT_WIRE_MIN_PKTSIZE + UDP_HDR_LEN] = { 0 };
+	(void)make_query(udp, qname, opt);
+	size_t q_end = KNOT_WIRE_HEADER_SIZE + knot_dname_size(qname) + 4;
+	size_t len = kernel_answer(udp, q_end, opt, &ans);
+
+	// The response equals the original one plus the OPT if requested.
+	uint8_t expected_wire[KNOT_WIRE_MIN_PKTSIZE];
+	size_t expected_len = pkt->size;
+	memcpy(expected_wire, pkt->wire, pkt->size);
+	if (opt) {
+		memcpy(expected_wire + pkt->size, ans.data + ans.len - KNOT_XDP_ANSWER_OPT_LEN,
+		       KNOT_XDP_ANSWER_OPT_LEN);
+		expected_len += KNOT_XDP_ANSWER_OPT_LEN;
+		knot_wire_add_arcount(expected_wire, 1);
+	}
+	bool same = len == UDP_HDR_LEN + expected_len &&
+	            memcmp(udp + UDP_HDR_LEN, expected_wire, expected_len) == 0 &&
+	            knot_wire_read_u16(udp) == 53 && knot_wire_read_u16(udp + 2) == 53535;
+
+	uint16_t check = knot_wire_read_u16(udp + 6);
+	knot_wire_write_u16(udp + 6, 0);
+	uint16_t expected = udp_csum(dst_ip, src_ip, udp, len);
+
+	ok(same && check == expected,
+	   "csum: qname length %zu, %zu NS, %zu glue, %s OPT",
+	   knot_dname_size(qname), ns, glue, opt ? "with" : "without");
+
+	knot_pkt_free(pkt);
+}
+
+int main(int argc, char *argv[])
+{
+	plan_lazy();
+
+	diag("answer encoding");
+	test_build();
+	test_build_errors();
+
+	diag("incremental checksum");
+	// Both parities of the question end and of the record data length.
+	const knot_dname_t *names[] = {
+		(const knot_dname_t *)"\x07""example\x03""com",
+		(const knot_dname_t *)"\x08""example2\x03""com",
+	};
+	for (size_t i = 0; i < 2; i++) {
+		for (size_t ns = 1; ns <= 2; ns++) {
+			test_csum(names[i], ns, 0, false);
+			test_csum(names[i], ns, 0, true);
+			test_csum(names[i], ns, 1, true);
+		}
+	}
+
+	return 0;
+}
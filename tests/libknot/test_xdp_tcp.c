@@ -575,6 +575,8 @@ void test_obufs(void)
 
 	int ret = knot_tcp_reply_data(&rl, test_table, false, data, DATA_LEN), i = 0;
 	is_int(KNOT_EOK, ret, "obufs: fill with data");
+	is_int(knot_tcp_outbufs_usage(rl.conn->outbufs), rl.conn->outbufs_usage, "obufs: usage counted");
+	is_int(rl.conn->outbufs_usage, test_table->outbufs_total, "obufs: total counted");
 	for (knot_tcp_outbuf_t *ob = rl.conn->outbufs; ob != NULL; ob = ob->next, i++) {
 		if (ob->next == NULL) {
 			ok(ob->len > 0, "init last ob[%d]: non-trivial", i);
@@ -609,6 +611,8 @@ void test_obufs(void)
 	ok(surv_ob != NULL, "obufs: unACKed survived");
 	assert(surv_ob);
 	ok(surv_ob->next == NULL, "obufs: just one survived");
+	is_int(knot_tcp_outbufs_usage(rl.conn->outbufs), rl.conn->outbufs_usage, "obufs: usage after ACK");
+	is_int(rl.conn->outbufs_usage, test_table->outbufs_total, "obufs: total after ACK");
 	ok(!surv_ob->sent, "obufs: survivor not sent");
 	ret = knot_tcp_send(test_sock, &rl, 1, 20);
 	is_int(KNOT_EOK, ret, "obufs: send rest OK");
@@ -621,6 +625,143 @@ void test_obufs(void)
 	free(data);
 }
 
+static knot_tcp_conn_t *establish(knot_xdp_msg_t *msg, uint16_t sport)
+{
+	knot_tcp_relay_t rl = { 0 };
+
+	prepare_msg(msg, KNOT_XDP_MSG_SYN, sport, 2);
+	(void)knot_tcp_recv(&rl, msg, test_table, test_syn_table, XDP_TCP_IGNORE_NONE); // SYN
+	(void)knot_tcp_send(test_sock, &rl, 1, 1); // SYN+ACK
+	prepare_msg(msg, KNOT_XDP_MSG_ACK, sport, 2);
+	prepare_seqack(msg, 0, 1);
+	(void)knot_tcp_recv(&rl, msg, test_table, test_syn_table, XDP_TCP_IGNORE_NONE); // ACK
+	knot_tcp_cleanup(test_table, &rl, 1);
+
+	return tcp_table_find(test_table, msg);
+}
+
+void test_out_of_order(void)
+{
+	knot_xdp_msg_t msg, msg2;
+	knot_tcp_relay_t rl = { 0 };
+
+	knot_tcp_conn_t *conn = establish(&msg, 3);
+	ok(conn != NULL, "ooo: established");
+	assert(conn);
+	uint32_t seqno = conn->seqno;
+	msg2 = msg;
+
+	// second segment arrives first
+	prepare_seqack(&msg2, 5, 0);
+	prepare_data(&msg2, "\x00\x02""ab""\x00", 5);
+	int ret = knot_tcp_recv(&rl, &msg2, test_table, test_syn_table, XDP_TCP_IGNORE_NONE);
+	is_int(KNOT_EOK, ret, "ooo: future segment OK");
+	is_int(KNOT_XDP_MSG_ACK, rl.auto_answer, "ooo: duplicate ACK");
+	ok(rl.inbf == NULL, "ooo: nothing complete");
+	ok(conn->ooo_segs != NULL, "ooo: segment stored");
+	ok(test_table->inbufs_total > 0, "ooo: segment accounted");
+	is_int(knot_tcp_outbufs_usage(conn->ooo_segs), conn->ooo_usage, "ooo: usage counted");
+	ret = knot_tcp_send(test_sock, &rl, 1, 1);
+	is_int(KNOT_EOK, ret, "ooo: send duplicate ACK");
+	is_int(seqno, sent_ackno, "ooo: still expecting first segment");
+	knot_tcp_cleanup(test_table, &rl, 1);
+
+	// retransmission of the same one is ignored
+	ret = knot_tcp_recv(&rl, &msg2, test_table, test_syn_table, XDP_TCP_IGNORE_NONE);
+	is_int(KNOT_EOK, ret, "ooo: duplicate segment OK");
+	ok(conn->ooo_segs != NULL && conn->ooo_segs->next == NULL, "ooo: stored once");
+	knot_tcp_cleanup(test_table, &rl, 1);
+
+	// the missing one completes both queries
+	prepare_seqack(&msg, 0, 0);
+	prepare_data(&msg, "\x00\x03""xyz", 5);
+	ret = knot_tcp_recv(&rl, &msg, test_table, test_syn_table, XDP_TCP_IGNORE_NONE);
+	is_int(KNOT_EOK, ret, "ooo: missing segment OK");
+	ok(rl.inbf != NULL && rl.inbf->next != NULL, "ooo: two results");
+	assert(rl.inbf && rl.inbf->next);
+	is_int(1, rl.inbf->n_inbufs, "ooo: first count");
+	is_int(0, memcmp("xyz", rl.inbf->inbufs[0].iov_base, 3), "ooo: first data");
+	is_int(1, rl.inbf->next->n_inbufs, "ooo: second count");
+	is_int(0, memcmp("ab", rl.inbf->next->inbufs[0].iov_base, 2), "ooo: second data");
+	ok(conn->ooo_segs == NULL, "ooo: no segment left");
+	is_int(0, conn->ooo_usage, "ooo: usage released");
+	is_int(1, conn->inbuf.iov_len, "ooo: trailing fragment buffered");
+	is_int(seqno + 10, conn->seqno, "ooo: seqno advanced");
+	ret = knot_tcp_send(test_sock, &rl, 1, 1);
+	is_int(KNOT_EOK, ret, "ooo: send ACK");
+	is_int(seqno + 10, sent_ackno, "ooo: everything ACKed");
+	knot_tcp_cleanup(test_table, &rl, 1);
+
+	clean_table();
+	is_int(0, test_table->inbufs_total, "ooo: buffers freed");
+}
+
+void test_cwnd(void)
+{
+	knot_xdp_msg_t msg;
+	knot_tcp_relay_t rl = { 0 };
+	size_t TEST_MSS = 1000;
+
+	test_table->init_cwnd = 2;
+	test_syn_table->init_cwnd = 2;
+	knot_tcp_conn_t *conn = establish(&msg, 4);
+	ok(conn != NULL, "cwnd: established");
+	assert(conn);
+	msg.win = 0xffff;
+	conn->mss = TEST_MSS;
+	conn->cwnd = 2 * TEST_MSS;
+	conn->window_size = 65536;
+	send2_mss = TEST_MSS;
+
+	uint8_t *data = calloc(10 * TEST_MSS, 1);
+	rl.conn = conn;
+	int ret = knot_tcp_reply_data(&rl, test_table, false, data, 10 * TEST_MSS - 2);
+	is_int(KNOT_EOK, ret, "cwnd: fill with data");
+	sent2_data = 0;
+	ret = knot_tcp_send(test_sock, &rl, 1, 20);
+	is_int(KNOT_EOK, ret, "cwnd: send OK");
+	is_int(2 * TEST_MSS, sent2_data, "cwnd: initial window");
+	memset(&rl, 0, sizeof(rl));
+
+	// slow start
+	prepare_seqack(&msg, 0, 0);
+	ret = knot_tcp_recv(&rl, &msg, test_table, test_syn_table, XDP_TCP_IGNORE_NONE);
+	is_int(KNOT_EOK, ret, "cwnd: ACK OK");
+	is_int(3 * TEST_MSS, conn->cwnd, "cwnd: slow start");
+	ret = knot_tcp_send(test_sock, &rl, 1, 20);
+	is_int(4 * TEST_MSS, sent2_data, "cwnd: window grown");
+	memset(&rl, 0, sizeof(rl));
+
+	// fast retransmit on third duplicate ACK
+	uint32_t flight = conn->ackno - conn->acked;
+	for (int i = 1; i <= DUPACK_THRESH; i++) {
+		knot_xdp_msg_t dup = msg;
+		ret = knot_tcp_recv(&rl, &dup, test_table, test_syn_table, XDP_TCP_IGNORE_NONE);
+		is_int(KNOT_EOK, ret, "cwnd: duplicate ACK %d", i);
+		is_int(i < DUPACK_THRESH ? XDP_TCP_NOOP : XDP_TCP_RESEND, rl.answer,
+		       "cwnd: duplicate ACK %d answer", i);
+	}
+	is_int(MAX(flight / 2, 2 * TEST_MSS), conn->ssthresh, "cwnd: ssthresh halved");
+	is_int(conn->ssthresh, conn->cwnd, "cwnd: window reduced");
+	ret = knot_tcp_send(test_sock, &rl, 1, 20);
+	is_int(4 * TEST_MSS + conn->cwnd, sent2_data, "cwnd: resent within window");
+	memset(&rl, 0, sizeof(rl));
+
+	// retransmission timeout
+	knot_sweep_stats_t stats = { 0 };
+	ret = knot_tcp_sweep(test_table, INFTY, INFTY, 0, INFTY, INFTY, INFTY,
+	                     &rl, 1, &stats);
+	is_int(KNOT_EOK, ret, "cwnd: sweep OK");
+	is_int(XDP_TCP_RESEND, rl.answer, "cwnd: resend on timeout");
+	is_int(TEST_MSS, conn->cwnd, "cwnd: window collapsed");
+	knot_tcp_cleanup(test_table, &rl, 1);
+
+	test_table->init_cwnd = 0;
+	test_syn_table->init_cwnd = 0;
+	clean_table();
+	free(data);
+}
+
 static void init_mock(knot_xdp_socket_t **socket, void *send_mock)
 {
 	*socket = calloc(1, sizeof(**socket));
@@ -656,6 +797,8 @@ int main(int argc, char *argv[])
 	knot_xdp_deinit(test_sock);
 	init_mock(&test_sock, mock_send2);
 	test_obufs();
+	test_out_of_order();
+	test_cwnd();
 
 	knot_xdp_deinit(test_sock);
 	knot_tcp_table_free(test_table);
@@ -168,7 +168,7 @@ static void *rrl_runnable(void *arg)
 				         hqi % 0xff, (hqi >> 8) % 0xff, (hqi >> 16) % 0xff);
 				sockaddr_set(&addr, d->stages[si].hosts[hi].addr_family, addr_str, 0);
 
-				if (rrl_query(d->rrl, &addr, NULL) == KNOT_EOK) {
+				if (rrl_query(d->rrl, &addr, NULL, NULL) == KNOT_EOK) {
 					atomic_fetch_add(&d->stages[si].hosts[hi].passed, 1);
 					if (!d->rrl->rw_mode) {
 						rrl_update(d->rrl, &addr, 1);
@@ -197,7 +197,7 @@ void count_test(char *desc, int expected_passing, double margin_fract,
 				i % (max_value - min_value + 1) + min_value,
 				i / (max_value - min_value + 1) % 256);
 		sockaddr_set(&addr, addr_family, addr_str, 0);
-		if (rrl_query(rrl, &addr, NULL) != KNOT_EOK) {
+		if (rrl_query(rrl, &addr, NULL, NULL) != KNOT_EOK) {
 			cnt = i;
 			break;
 		}
@@ -401,6 +401,48 @@ void test_rrl_mode(bool test_avx2, bool rw_mode)
 	}
 }
 
+static void check_overlap(const knotd_conf_t *range, int family, const char *addr_str,
+                          unsigned prefix, bool expected)
+{
+	struct sockaddr_storage addr;
+	sockaddr_set(&addr, family, addr_str, 0);
+	ok(rrl_prefix_overlap(range, &addr, prefix) == expected,
+	   "prefix overlap: %s/%u %s", addr_str, prefix, expected ? "overlaps" : "no overlap");
+}
+
+static void test_prefix_overlap(void)
+{
+	knotd_conf_val_t vals[4] = { 0 };
+	sockaddr_set(&vals[0].addr, AF_INET, "192.0.2.10", 0);        // Single address.
+	vals[0].addr_mask = -1;
+	sockaddr_set(&vals[1].addr, AF_INET, "198.51.100.128", 0);    // Network.
+	vals[1].addr_mask = 25;
+	sockaddr_set(&vals[2].addr, AF_INET, "203.0.113.20", 0);      // Range.
+	sockaddr_set(&vals[2].addr_max, AF_INET, "203.0.113.40", 0);
+	sockaddr_set(&vals[3].addr, AF_INET6, "2001:db8:0:1::", 0);   // IPv6 network.
+	vals[3].addr_mask = 64;
+	knotd_conf_t range = { .multi = vals, .count = 4 };
+
+	check_overlap(&range, AF_INET, "192.0.2.200", 24, true);
+	check_overlap(&range, AF_INET, "192.0.2.10", 32, true);
+	check_overlap(&range, AF_INET, "192.0.2.11", 32, false);
+	check_overlap(&range, AF_INET, "192.0.3.1", 24, false);
+	check_overlap(&range, AF_INET, "198.51.100.1", 24, true);
+	check_overlap(&range, AF_INET, "198.51.100.1", 25, false);
+	check_overlap(&range, AF_INET, "198.51.100.200", 32, true);
+	check_overlap(&range, AF_INET, "203.0.113.30", 32, true);
+	check_overlap(&range, AF_INET, "203.0.113.0", 28, false);
+	check_overlap(&range, AF_INET, "203.0.113.0", 27, true);
+	check_overlap(&range, AF_INET, "203.0.113.48", 28, false);
+	check_overlap(&range, AF_INET, "203.0.113.33", 28, true);
+	check_overlap(&range, AF_INET6, "2001:db8::1", 56, true);
+	check_overlap(&range, AF_INET6, "2001:db8:0:100::1", 56, false);
+	check_overlap(&range, AF_INET6, "2001:db8:0:1:1::1", 128, true);
+
+	knotd_conf_t empty = { 0 };
+	check_overlap(&empty, AF_INET, "192.0.2.10", 32, false);
+}
+
 int main(int argc, char *argv[])
 {
 	plan_lazy();
@@ -413,6 +455,8 @@ int main(int argc, char *argv[])
 	test_rrl_mode(test_avx2, true);
 	test_rrl_mode(test_avx2, false);
 
+	test_prefix_overlap();
+
 	dnssec_crypto_cleanup();
 	return 0;
 }